@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Encode and decode the VGA to RIA backchannel.
+
+Bytes with the top bit set are commands. 0x80|n is vsync n, 0x90 ack,
+0xA0 nak and 0xC0|type starts a frame. Frame data is 7-bit: each group
+of up to seven bytes follows a byte holding their top bits, bit 0 for
+the first. Unpacked, a frame is a little endian 16-bit length, the
+payload and a CRC-16/CCITT (poly 0x1021, init 0xFFFF) of type, length
+and payload. Commands may land anywhere inside a frame. Other ASCII
+outside a frame is the version string.
+
+The decoder reads a raw capture of the line, such as one saved by a
+logic analyzer, and prints one message per line.
+
+Usage:
+    python3 backchannel.py decode capture.bin
+    python3 backchannel.py encode TYPE HEX
+    python3 backchannel.py --self-test
+"""
+
+import sys
+
+MAX_PAYLOAD = 256
+FRAME_TYPES = {0: "sprite report"}
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+def pack7(data):
+    out = bytearray()
+    for i in range(0, len(data), 7):
+        group = data[i:i + 7]
+        out.append(sum(1 << n for n, b in enumerate(group) if b & 0x80))
+        out += bytes(b & 0x7F for b in group)
+    return bytes(out)
+
+
+def encode(ftype, payload):
+    if not 0 <= ftype <= 0xF or len(payload) > MAX_PAYLOAD:
+        raise ValueError("bad frame")
+    body = len(payload).to_bytes(2, "little") + bytes(payload)
+    crc = crc16(bytes([ftype]) + body)
+    return bytes([0xC0 | ftype]) + pack7(body + crc.to_bytes(2, "little"))
+
+
+class Decoder:
+    """Yields ("vsync", n), ("ack",), ("nak",), ("frame", type, payload),
+    ("error", reason) and ("version", text) for each byte fed."""
+
+    def __init__(self):
+        self.frame = None
+        self.version = bytearray()
+
+    def feed(self, data):
+        for byte in data:
+            yield from self.byte(byte)
+
+    def byte(self, byte):
+        if byte & 0x80:
+            cmd, scalar = byte & 0xF0, byte & 0xF
+            if cmd == 0x80:
+                yield ("vsync", scalar)
+            elif cmd == 0x90:
+                yield ("ack",)
+            elif cmd == 0xA0:
+                yield ("nak",)
+            elif cmd == 0xC0:
+                if self.frame:
+                    yield ("error", "frame restarted")
+                self.frame = {"type": scalar, "group": 0, "msb": 0, "data": bytearray()}
+            else:
+                if self.frame:
+                    yield ("error", f"frame aborted by 0x{byte:02X}")
+                self.frame = None
+            return
+        f = self.frame
+        if not f:
+            if byte in b"\r\n":
+                if self.version:
+                    yield ("version", self.version.decode("ascii", "replace"))
+                self.version = bytearray()
+            else:
+                self.version.append(byte)
+            return
+        if not f["group"]:
+            f["msb"], f["group"] = byte, 7
+            return
+        if f["msb"] & 1:
+            byte |= 0x80
+        f["msb"] >>= 1
+        f["group"] -= 1
+        data = f["data"]
+        data.append(byte)
+        if len(data) < 2:
+            return
+        length = int.from_bytes(data[:2], "little")
+        if length > MAX_PAYLOAD:
+            self.frame = None
+            yield ("error", f"length {length}")
+        elif len(data) == length + 4:
+            self.frame = None
+            if crc16(bytes([f["type"]]) + data[:-2]) == int.from_bytes(data[-2:], "little"):
+                yield ("frame", f["type"], bytes(data[2:-2]))
+            else:
+                yield ("error", "CRC failed")
+
+
+def describe(msg):
+    if msg[0] == "frame":
+        name = FRAME_TYPES.get(msg[1], f"type {msg[1]}")
+        return f"frame {name}: {msg[2].hex(' ')}"
+    return " ".join(str(m) for m in msg)
+
+
+def self_test():
+    assert crc16(b"123456789") == 0x29B1
+    assert pack7(bytes([0x81, 0x02])) == bytes([0x01, 0x01, 0x02])
+    report = bytes([0x01, 0x80, 0x00, 0xFF, 0x7F, 0x00, 0x10, 0x00])
+    wire = encode(0, report)
+    assert wire[0] == 0xC0 and all(b < 0x80 for b in wire[1:])
+    assert len(wire) == 1 + 12 + 2
+    assert list(Decoder().feed(wire)) == [("frame", 0, report)]
+    # Commands interleave anywhere in a frame.
+    mixed = wire[:5] + b"\x83\x90" + wire[5:] + b"\xA0"
+    assert list(Decoder().feed(mixed)) == [
+        ("vsync", 3), ("ack",), ("frame", 0, report), ("nak",)]
+    # Every largest payload byte value survives the packing.
+    big = bytes(i & 0xFF for i in range(MAX_PAYLOAD))
+    assert list(Decoder().feed(encode(15, big))) == [("frame", 15, big)]
+    assert list(Decoder().feed(encode(1, b""))) == [("frame", 1, b"")]
+    # A bad CRC is dropped and the next frame still decodes.
+    bad = bytearray(wire)
+    bad[5] ^= 0x01
+    msgs = list(Decoder().feed(bytes(bad) + wire))
+    assert msgs == [("error", "CRC failed"), ("frame", 0, report)]
+    # A truncated frame resyncs on the next start byte.
+    msgs = list(Decoder().feed(wire[:6] + wire))
+    assert msgs == [("error", "frame restarted"), ("frame", 0, report)]
+    msgs = list(Decoder().feed(b"VGA 1.0\r\x81" + wire))
+    assert msgs == [("version", "VGA 1.0"), ("vsync", 1), ("frame", 0, report)]
+    try:
+        encode(0, bytes(MAX_PAYLOAD + 1))
+        assert False, "oversize frame encoded"
+    except ValueError:
+        pass
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+    elif len(args) == 2 and args[0] == "decode":
+        with open(args[1], "rb") as f:
+            for msg in Decoder().feed(f.read()):
+                print(describe(msg))
+    elif len(args) == 3 and args[0] == "encode":
+        print(encode(int(args[1], 0), bytes.fromhex(args[2])).hex(" "))
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Pack the VGA code page fonts into shared glyph tables.
+
+Most code pages repeat the same box drawing, accented and symbol
+glyphs. font.c stores each unique glyph once and each code page as
+128 indices into that table. The VGA expands a code page into its RAM
+font when the page is selected.
+
+The shared tables are only built when RP6502_CODE_PAGE is 0. A single
+code page build gets a table of just its own glyphs under #elif.
+
+Fonts are exchanged as raw .fnt files of 128 glyphs, glyph-major,
+for characters 128-255. cpNNN-8.fnt is 8x8 and cpNNN-16.fnt is 8x16.
+
+Usage:
+    python3 font_pack.py unpack src/vga/term/font.c DIR
+    python3 font_pack.py pack DIR > tables.c
+    python3 font_pack.py --self-test
+"""
+
+import os
+import re
+import sys
+
+HEIGHTS = (8, 16)
+ARRAY_RE = re.compile(
+    r"static const __in_flash\(\"font\"\) (uint8_t|uint16_t|font_index_t) (\w+)(\[\]|\[\]\[\d+\]) = \{(.*?)\};",
+    re.S)
+
+
+def parse_arrays(text):
+    arrays = {}
+    for ctype, name, _, body in ARRAY_RE.findall(text):
+        arrays[name] = [int(x, 0) for x in re.findall(r"0x[0-9a-fA-F]+|\b\d+\b", body)]
+    return arrays
+
+
+def code_pages(text):
+    """Return {(cp, height): [128 glyphs as bytes]} from font.c."""
+    # The shared tables hold every code page, skip the single page ones.
+    arrays = parse_arrays(text.split("\n#elif", 1)[0])
+    pages = {}
+    for name, data in arrays.items():
+        m = re.fullmatch(r"FONT(8|16)_CP(\d+)", name)
+        if not m:
+            continue
+        h, cp = int(m.group(1)), int(m.group(2))
+        if len(data) == 128 * h:  # row-major raw bitmap
+            glyphs = [bytes(data[r * 128 + g] for r in range(h)) for g in range(128)]
+        else:  # indices into FONTn_GLYPHS
+            table = arrays[f"FONT{h}_GLYPHS"]
+            glyphs = [bytes(table[i * h:(i + 1) * h]) for i in data]
+        pages[(cp, h)] = glyphs
+    return pages
+
+
+def unpack(src, out_dir):
+    with open(src) as f:
+        pages = code_pages(f.read())
+    os.makedirs(out_dir, exist_ok=True)
+    for (cp, h), glyphs in sorted(pages.items()):
+        with open(os.path.join(out_dir, f"cp{cp}-{h}.fnt"), "wb") as f:
+            f.write(b"".join(glyphs))
+    print(f"{len(pages)} fonts written", file=sys.stderr)
+
+
+def load_dir(in_dir):
+    pages = {}
+    for name in os.listdir(in_dir):
+        m = re.fullmatch(r"cp(\d+)-(8|16)\.fnt", name)
+        if not m:
+            continue
+        cp, h = int(m.group(1)), int(m.group(2))
+        with open(os.path.join(in_dir, name), "rb") as f:
+            data = f.read()
+        if len(data) != 128 * h:
+            sys.exit(f"{name} is not {128 * h} bytes")
+        pages[(cp, h)] = [data[g * h:(g + 1) * h] for g in range(128)]
+    return pages
+
+
+def hex_rows(values, fmt, per_line):
+    items = [fmt.format(v) for v in values]
+    lines = [", ".join(items[i:i + per_line]) for i in range(0, len(items), per_line)]
+    return ",\n    ".join(lines)
+
+
+def pack_tables(out, h, pages):
+    """Emit one glyph table and an index table per code page."""
+    glyphs, index = [], {}
+    tables = {}
+    for cp, page in sorted(pages.items()):
+        ids = []
+        for g in page:
+            if g not in index:
+                index[g] = len(glyphs)
+                glyphs.append(g)
+            ids.append(index[g])
+        tables[cp] = ids
+    out.append(f"static const __in_flash(\"font\") uint8_t FONT{h}_GLYPHS[][{h}] = {{")
+    out.append("    " + ",\n    ".join(
+        "{" + ", ".join(f"0x{b:02x}" for b in g) + "}" for g in glyphs) + "};")
+    out.append("")
+    for cp, ids in tables.items():
+        out.append(f"static const __in_flash(\"font\") font_index_t FONT{h}_CP{cp}[] = {{")
+        out.append("    " + hex_rows(ids, "{}", 16) + "};")
+        out.append("")
+
+
+def pack(pages):
+    out = ["// Generated by font_pack.py, do not edit.", "",
+           "#if RP6502_CODE_PAGE == 0", "",
+           "typedef uint16_t font_index_t;", ""]
+    for h in HEIGHTS:
+        pack_tables(out, h, {cp: page for (cp, ph), page in pages.items() if ph == h})
+    for cp in sorted({cp for cp, _ in pages}):
+        out += [f"#elif RP6502_CODE_PAGE == {cp}", "",
+                "typedef uint8_t font_index_t;", ""]
+        for h in HEIGHTS:
+            if (cp, h) in pages:
+                pack_tables(out, h, {cp: pages[(cp, h)]})
+    out += ["#else", "",
+            "typedef uint8_t font_index_t;"]
+    for h in HEIGHTS:
+        out.append(f"static const __in_flash(\"font\") uint8_t FONT{h}_GLYPHS[1][{h}];")
+    out += ["", "#endif"]
+    return "\n".join(out)
+
+
+def self_test():
+    a = bytes(range(8))
+    b = bytes(8)
+    pages = {(437, 8): [a, b] * 64, (850, 8): [b, a] * 64,
+             (437, 16): [a + b] * 128}
+    text = pack(pages)
+    shared = text.split("\n#elif", 1)[0]
+    assert shared.count("{0x") == 3, "glyphs were not shared"
+    cp850 = text.split("#elif RP6502_CODE_PAGE == 850", 1)[1]
+    assert cp850.count("{0x") == 2, "single page has other glyphs"
+    assert code_pages(text) == pages
+    raw = ("static const __in_flash(\"font\") uint8_t FONT8_CP437[] = {"
+           + ", ".join(f"0x{(g + r) & 0xFF:02x}" for r in range(8) for g in range(128))
+           + "};")
+    glyphs = code_pages(raw)[(437, 8)]
+    assert glyphs[5] == bytes((5 + r) & 0xFF for r in range(8))
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+    elif len(args) == 3 and args[0] == "unpack":
+        unpack(args[1], args[2])
+    elif len(args) == 2 and args[0] == "pack":
+        print(pack(load_dir(args[1])))
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
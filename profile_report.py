@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+Match RIA profiler samples with 6502 program symbols.
+
+PROFILE SAVE writes one "ADDR COUNT" line per sampled program counter,
+in hex and decimal. This sums the samples by the nearest symbol at or
+below each address and prints the hottest first.
+
+Symbols are read from any mix of:
+    ld65 map files (-m), the exports list
+    ld65 label files (-Ln), "al 00C012 .name"
+    llvm-mos lld map files (-Map)
+    nm output, "0000c012 T name"
+
+Usage:
+    python3 profile_report.py profile.txt [prog.map ...]
+    python3 profile_report.py --self-test
+"""
+
+import bisect
+import re
+import sys
+
+LD65_EXPORT = re.compile(r"(\S+)\s+([0-9A-F]{6})\s+[A-Z]{3}\b")
+LD65_LABEL = re.compile(r"^al\s+([0-9A-Fa-f]+)\s+\.(\S+)\s*$")
+LLD_SYMBOL = re.compile(r"^\s*([0-9a-f]+)\s+[0-9a-f]+\s+[0-9a-f]+\s+\d+\s+([A-Za-z_][\w.$]*)\s*$")
+NM_SYMBOL = re.compile(r"^([0-9a-fA-F]{4,16})\s+[A-Za-z]\s+(\S+)\s*$")
+
+
+def parse_profile(text):
+    samples = {}
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        addr, count = line.split()
+        samples[int(addr, 16)] = samples.get(int(addr, 16), 0) + int(count)
+    return samples
+
+
+def parse_symbols(text):
+    symbols = {}
+
+    def add(addr, name):
+        if addr <= 0xFFFF and not name.startswith("__"):
+            symbols.setdefault(addr, name)
+
+    in_exports = False
+    for line in text.splitlines():
+        if line.startswith("Exports list"):
+            in_exports = True
+            continue
+        if in_exports and line.endswith(":") and not line.startswith(" "):
+            in_exports = False
+        if in_exports:
+            for name, addr in LD65_EXPORT.findall(line):
+                add(int(addr, 16), name)
+            continue
+        for regex in (LD65_LABEL, NM_SYMBOL):
+            m = regex.match(line)
+            if m:
+                add(int(m.group(1), 16), m.group(2))
+                break
+        else:
+            m = LLD_SYMBOL.match(line)
+            if m:
+                add(int(m.group(1), 16), m.group(2))
+    return symbols
+
+
+def report(samples, symbols):
+    """Return [(count, name)] hottest first."""
+    addrs = sorted(symbols)
+    totals = {}
+    for pc, count in samples.items():
+        i = bisect.bisect_right(addrs, pc) - 1
+        name = symbols[addrs[i]] if i >= 0 else f"${pc:04X}"
+        totals[name] = totals.get(name, 0) + count
+    return sorted(((c, n) for n, c in totals.items()), key=lambda t: (-t[0], t[1]))
+
+
+def self_test():
+    profile = "# RP6502 profile 1000 Hz 10 samples 12 ticks 0 dropped\nC012 6\nC100 3\n0200 1\n"
+    samples = parse_profile(profile)
+    assert samples == {0xC012: 6, 0xC100: 3, 0x200: 1}
+    ld65 = ("Exports list by name:\n---------------------\n"
+            "_main                     00C000 RLA    _update                   00C0F0 RLA\n"
+            "\nImports list:\n-------------\n_other 00D000 RLA\n")
+    assert parse_symbols(ld65) == {0xC000: "_main", 0xC0F0: "_update"}
+    assert parse_symbols("al 00C000 ._main\n") == {0xC000: "_main"}
+    lld = ("     VMA      LMA     Size Align Out     In      Symbol\n"
+           "     200      200      100     1 .zp\n"
+           "    c000     c000      200     1 .text\n"
+           "    c000     c000       f0     1         main.o:(.text.main)\n"
+           "    c000     c000        0     1                 main\n"
+           "    c0f0     c0f0        0     1                 update\n")
+    assert parse_symbols(lld) == {0xC000: "main", 0xC0F0: "update"}
+    assert parse_symbols("0000c000 T main\n0000c0f0 t update\n") == {
+        0xC000: "main", 0xC0F0: "update"}
+    rows = report(samples, parse_symbols(ld65))
+    assert rows == [(6, "_main"), (3, "_update"), (1, "$0200")]
+    assert report(samples, {}) == [(6, "$C012"), (3, "$C100"), (1, "$0200")]
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        return self_test()
+    if not args:
+        sys.exit(__doc__)
+    with open(args[0]) as f:
+        samples = parse_profile(f.read())
+    symbols = {}
+    for path in args[1:]:
+        with open(path, errors="replace") as f:
+            for addr, name in parse_symbols(f.read()).items():
+                symbols.setdefault(addr, name)
+    total = sum(samples.values()) or 1
+    for count, name in report(samples, symbols):
+        print(f"{count:8} {count * 100 / total:6.2f}%  {name}")
+
+
+if __name__ == "__main__":
+    main()
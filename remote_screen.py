@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""
+View the screen of an RP6502 served with SET SCREEN.
+
+The RIA streams "RP6502D1" then messages:
+
+    'X' uint16 len, the xreg log in snapshot format
+    'P' uint8 page, uint16 size, PackBits of 256 bytes of XRAM
+    'F' uint8 vsync, end of an update
+
+This keeps a copy of XRAM, replays the VGA canvas and mode
+programming from the log and renders bitmap mode 3 planes. Other
+modes are reported but not drawn. Each update is written to a PPM
+file, replaced atomically so another program can watch it.
+
+Usage:
+    python3 remote_screen.py HOST[:PORT] screen.ppm
+    python3 remote_screen.py --self-test
+"""
+
+import os
+import socket
+import struct
+import sys
+
+from snapshot_tool import pack, unpack, xreg_calls
+
+MAGIC = b"RP6502D1"
+DEFAULT_PORT = 6502
+CANVASES = {1: (320, 240), 2: (320, 180), 3: (640, 480), 4: (640, 360)}
+MODE3 = struct.Struct("<??hhhhHH")
+ANSI = [(0, 0, 0), (205, 0, 0), (0, 205, 0), (205, 205, 0),
+        (0, 0, 238), (205, 0, 205), (0, 205, 205), (229, 229, 229),
+        (127, 127, 127), (255, 0, 0), (0, 255, 0), (255, 255, 0),
+        (92, 92, 255), (255, 0, 255), (0, 255, 255), (255, 255, 255)]
+
+
+def xterm_256():
+    colors = list(ANSI)
+    levels = [0, 95, 135, 175, 215, 255]
+    colors += [(levels[i // 36], levels[i // 6 % 6], levels[i % 6]) for i in range(216)]
+    colors += [(8 + 10 * i,) * 3 for i in range(24)]
+    return colors
+
+
+def rgb(pixel):
+    """VGA pixels are 5 bits each of red, green and blue, and bit 5 alpha."""
+    r, g, b = pixel & 31, pixel >> 6 & 31, pixel >> 11 & 31
+    return (r * 255 // 31, g * 255 // 31, b * 255 // 31)
+
+
+class Screen:
+    def __init__(self):
+        self.xram = bytearray(0x10000)
+        self.log = b""
+        self.buf = bytearray()
+        self.hello = False
+        self.frames = 0
+
+    def feed(self, data):
+        """Returns the number of completed updates."""
+        self.buf += data
+        done = 0
+        while True:
+            if not self.hello:
+                if len(self.buf) < 8:
+                    return done
+                if self.buf[:8] != MAGIC:
+                    raise ValueError("not an RP6502 screen")
+                del self.buf[:8]
+                self.hello = True
+            if not self.buf:
+                return done
+            kind = self.buf[0]
+            if kind == ord("X") and len(self.buf) >= 3:
+                size = self.buf[1] | self.buf[2] << 8
+                if len(self.buf) < 3 + size:
+                    return done
+                self.log = bytes(self.buf[3:3 + size])
+                del self.buf[:3 + size]
+            elif kind == ord("P") and len(self.buf) >= 4:
+                size = self.buf[2] | self.buf[3] << 8
+                if len(self.buf) < 4 + size:
+                    return done
+                page = self.buf[1] * 256
+                self.xram[page:page + 256] = unpack(bytes(self.buf[4:4 + size]), 256)
+                del self.buf[:4 + size]
+            elif kind == ord("F") and len(self.buf) >= 2:
+                del self.buf[:2]
+                self.frames += 1
+                done += 1
+            elif kind in b"XPF":
+                return done
+            else:
+                raise ValueError(f"bad message 0x{kind:02X}")
+
+    def programming(self):
+        """Replay the log like the VGA does. Returns canvas and planes."""
+        canvas, planes, xregs = 0, {}, [0] * 8
+        for dev, ch, addr, words in xreg_calls(self.log):
+            if dev != 1 or ch != 0:
+                continue
+            for i, word in enumerate(words):
+                if addr + i < len(xregs):
+                    xregs[addr + i] = word
+            if addr == 0:
+                canvas, planes = xregs[0], {}
+            if addr <= 1 < addr + len(words):
+                mode = xregs[1]
+                plane = xregs[2] if mode == 0 else xregs[5] if mode == 4 else xregs[4]
+                planes[plane] = (mode, xregs[2], xregs[3], xregs[5], xregs[6])
+            if addr <= 1:
+                xregs = [0] * 8
+        return canvas, planes
+
+    def palette(self, ptr, bpp):
+        entries = 1 << bpp
+        if not ptr & 1 and ptr + 2 * entries <= 0x10000:
+            return [rgb(p) + (bool(p & 0x20),)
+                    for p in struct.unpack_from(f"<{entries}H", self.xram, ptr)]
+        if bpp == 1:
+            return [(0, 0, 0, True), (192, 192, 192, True)]
+        return [c + (True,) for c in xterm_256()]
+
+    def draw_mode3(self, image, width, height, attr, config, begin, end, base):
+        bpp = {0: 1, 1: 2, 2: 4, 3: 8, 4: 16}.get(attr & 7)
+        if bpp is None or config & 1 or config + MODE3.size > 0x10000:
+            return
+        x_wrap, y_wrap, x_pos, y_pos, w, h, data, pal = MODE3.unpack_from(self.xram, config)
+        row_size = (w * bpp + 7) // 8
+        if w < 1 or h < 1 or h * row_size > 0x10000 - data:
+            return
+        colors = None if bpp == 16 else self.palette(pal, bpp)
+        for y in range(begin, end or height):
+            row = y - y_pos
+            if y_wrap:
+                row %= h
+            if not 0 <= row < h or not 0 <= y < height:
+                continue
+            start = data + row * row_size
+            for x in range(width):
+                col = x - x_pos
+                if x_wrap:
+                    col %= w
+                if not 0 <= col < w:
+                    continue
+                if bpp == 16:
+                    p = self.xram[start + col * 2] | self.xram[start + col * 2 + 1] << 8
+                    color = rgb(p) + (bool(p & 0x20),)
+                else:
+                    bit = col * bpp
+                    byte = self.xram[start + bit // 8]
+                    shift = bit % 8 if attr & 8 else 8 - bpp - bit % 8
+                    color = colors[byte >> shift & ((1 << bpp) - 1)]
+                if base or color[3]:
+                    image[y * width + x] = color[:3]
+
+    def render(self):
+        """Returns (width, height, [rgb]) and a list of modes not drawn."""
+        canvas, planes = self.programming()
+        width, height = CANVASES.get(canvas, (320, 240))
+        image = [(0, 0, 0)] * (width * height)
+        skipped = []
+        for plane in sorted(planes):
+            mode, attr, config, begin, end = planes[plane]
+            if mode == 3:
+                self.draw_mode3(image, width, height, attr, config, begin, end, plane == 0)
+            else:
+                skipped.append(mode)
+        return width, height, image, skipped
+
+
+def ppm(width, height, image):
+    return f"P6 {width} {height} 255\n".encode() + bytes(c for p in image for c in p)
+
+
+def watch(address, path):
+    host, _, port = address.partition(":")
+    screen = Screen()
+    with socket.create_connection((host, int(port or DEFAULT_PORT))) as sock:
+        while True:
+            data = sock.recv(65536)
+            if not data:
+                break
+            if screen.feed(data):
+                width, height, image, skipped = screen.render()
+                with open(path + ".tmp", "wb") as f:
+                    f.write(ppm(width, height, image))
+                os.replace(path + ".tmp", path)
+                note = f", modes {sorted(set(skipped))} not drawn" if skipped else ""
+                print(f"\rframe {screen.frames} {width}x{height}{note}  ", end="", flush=True)
+    print()
+
+
+def self_test():
+    # Canvas 320x240, then mode 3 8bpp, config $FF00, plane 0, all lines.
+    def call(dev, ch, addr, words):
+        body = b"".join(w.to_bytes(2, "little") for w in reversed(words))
+        body += bytes([addr, ch, dev])
+        return len(body).to_bytes(2, "little") + body
+    log = call(1, 0, 0, [1]) + call(1, 0, 1, [3, 3, 0xFF00, 0, 0, 0])
+    xram = bytearray(0x10000)
+    MODE3.pack_into(xram, 0xFF00, False, False, 1, 2, 4, 2, 0x1000, 0x2000)
+    xram[0x1000:0x1008] = bytes([0, 1, 2, 3, 4, 5, 6, 7])
+    struct.pack_into("<2H", xram, 0x2000, 0, 31 | 0x20)  # entry 1 red
+    stream = bytearray(MAGIC)
+    stream += b"X" + len(log).to_bytes(2, "little") + log
+    for page in (0x10, 0x20, 0xFF):
+        packed = pack(bytes(xram[page * 256:page * 256 + 256]))
+        stream += bytes([ord("P"), page]) + len(packed).to_bytes(2, "little") + packed
+    stream += b"F\x07"
+    screen = Screen()
+    # Split anywhere, the parser waits for whole messages.
+    assert screen.feed(stream[:13]) == 0
+    assert screen.feed(stream[13:]) == 1
+    assert screen.xram[0x1000:0x1008] == xram[0x1000:0x1008]
+    assert screen.programming() == (1, {0: (3, 3, 0xFF00, 0, 0)})
+    width, height, image, skipped = screen.render()
+    assert (width, height, skipped) == (320, 240, [])
+    # Bitmap at x 1, y 2. Pixel value 1 is palette entry 1.
+    assert image[2 * width + 2] == (255, 0, 0)
+    assert image[2 * width + 1] == (0, 0, 0)
+    assert image[0] == (0, 0, 0)
+    assert len(ppm(width, height, image)) == len(b"P6 320 240 255\n") + 320 * 240 * 3
+    # A new canvas drops the mode.
+    screen.log = log + call(1, 0, 0, [3])
+    assert screen.programming() == (3, {})
+    try:
+        Screen().feed(b"NOTASCREEN")
+        assert False, "bad magic accepted"
+    except ValueError:
+        pass
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+    elif len(args) == 2:
+        watch(args[0], args[1])
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+"""
+Serve a host directory as the NET0: volume of an RP6502.
+
+Point the RIA at this computer with SET NET0 host:port, then 6502
+programs open paths like "NET0:/game.dat". Requests are a 4 byte
+header, uint8 op, uint8 id, uint16 length, then the payload. Responses
+are uint8 FRESULT, uint8 id, uint16 length, then the payload. All
+little endian. See NET_VOLUME.md.
+
+Usage:
+    python3 rfs_server.py DIR [PORT]
+    python3 rfs_server.py --bench [HOST:PORT]
+    python3 rfs_server.py --self-test
+"""
+
+import os
+import socket
+import socketserver
+import struct
+import sys
+import tempfile
+import threading
+import time
+
+DEFAULT_PORT = 6503
+HEAD = struct.Struct("<BBH")
+BUF_SIZE = 2048  # RFS_BUF_SIZE in rfs.c
+ENCODING = "cp437"
+
+# FatFs FRESULT
+FR_OK = 0
+FR_DISK_ERR = 1
+FR_NO_FILE = 4
+FR_NO_PATH = 5
+FR_INVALID_NAME = 6
+FR_DENIED = 7
+FR_EXIST = 8
+FR_INVALID_OBJECT = 9
+FR_TOO_MANY_OPEN_FILES = 18
+FR_INVALID_PARAMETER = 19
+
+# FatFs f_open modes
+FA_READ = 0x01
+FA_WRITE = 0x02
+FA_CREATE_NEW = 0x04
+FA_CREATE_ALWAYS = 0x08
+FA_OPEN_ALWAYS = 0x10
+
+# FatFs attributes
+AM_RDO = 0x01
+AM_HID = 0x02
+AM_DIR = 0x10
+AM_ARC = 0x20
+
+
+class Error(Exception):
+    def __init__(self, fresult):
+        super().__init__(fresult)
+        self.fresult = fresult
+
+
+def filinfo(path, name):
+    """uint32 size, uint16 date, uint16 time, uint8 attr, name"""
+    st = os.stat(path)
+    t = time.localtime(st.st_mtime)
+    fdate = max(t.tm_year - 1980, 0) << 9 | t.tm_mon << 5 | t.tm_mday
+    ftime = t.tm_hour << 11 | t.tm_min << 5 | t.tm_sec // 2
+    is_dir = os.path.isdir(path)
+    attr = AM_DIR if is_dir else AM_ARC
+    if not os.access(path, os.W_OK):
+        attr |= AM_RDO
+    if name.startswith("."):
+        attr |= AM_HID
+    size = 0 if is_dir else min(st.st_size, 0xFFFFFFFF)
+    return (struct.pack("<IHHB", size, fdate, ftime & 0xFFFF, attr)
+            + name.encode(ENCODING, "replace")[:255])
+
+
+class Volume:
+    """The requests of one connection. Ids are only good for it."""
+
+    def __init__(self, root):
+        self.root = os.path.realpath(root)
+        self.handles = {}
+
+    def path(self, payload):
+        name = payload.decode(ENCODING, "replace").replace("\\", "/").lstrip("/")
+        path = os.path.realpath(os.path.join(self.root, name))
+        if os.path.commonpath([self.root, path]) != self.root:
+            raise Error(FR_INVALID_NAME)
+        return path
+
+    def missing(self, path):
+        return Error(FR_NO_FILE if os.path.isdir(os.path.dirname(path)) else FR_NO_PATH)
+
+    def new_id(self, handle):
+        for i in range(1, 256):
+            if i not in self.handles:
+                self.handles[i] = handle
+                return i
+        raise Error(FR_TOO_MANY_OPEN_FILES)
+
+    def get(self, hid, kind):
+        handle = self.handles.get(hid)
+        if not handle or handle[0] != kind:
+            raise Error(FR_INVALID_OBJECT)
+        return handle
+
+    def open(self, payload):
+        mode, path = payload[0], self.path(payload[1:])
+        if os.path.isdir(path):
+            raise Error(FR_NO_FILE)
+        exists = os.path.exists(path)
+        if mode & FA_CREATE_NEW and exists:
+            raise Error(FR_EXIST)
+        if not exists and not mode & (FA_CREATE_NEW | FA_CREATE_ALWAYS | FA_OPEN_ALWAYS):
+            raise self.missing(path)
+        if not os.path.isdir(os.path.dirname(path)):
+            raise Error(FR_NO_PATH)
+        if mode & FA_CREATE_ALWAYS or not exists:
+            open(path, "wb").close()
+        f = open(path, "r+b" if mode & FA_WRITE else "rb")
+        size = os.fstat(f.fileno()).st_size
+        return self.new_id(("file", f)), struct.pack("<I", min(size, 0xFFFFFFFF))
+
+    def handle(self, op, hid, payload):
+        """Returns (id, payload) or raises Error."""
+        if op == ord("O"):
+            return self.open(payload)
+        if op == ord("C"):
+            handle = self.handles.pop(hid, None)
+            if not handle:
+                raise Error(FR_INVALID_OBJECT)
+            if handle[0] == "file":
+                handle[1].close()
+            return hid, b""
+        if op == ord("R"):
+            f = self.get(hid, "file")[1]
+            ofs, count = struct.unpack_from("<IH", payload)
+            f.seek(ofs)
+            return hid, f.read(min(count, BUF_SIZE))
+        if op == ord("W"):
+            f = self.get(hid, "file")[1]
+            if f.mode == "rb":
+                raise Error(FR_DENIED)
+            f.seek(struct.unpack_from("<I", payload)[0])
+            f.write(payload[4:])
+            f.flush()
+            return hid, b""
+        if op == ord("S"):
+            path = self.path(payload)
+            if not os.path.exists(path):
+                raise self.missing(path)
+            return 0, filinfo(path, os.path.basename(path))
+        if op == ord("D"):
+            path = self.path(payload)
+            if not os.path.isdir(path):
+                raise Error(FR_NO_PATH)
+            return self.new_id(["dir", path, sorted(os.listdir(path)), 0]), b""
+        if op == ord("N"):
+            handle = self.get(hid, "dir")
+            _, path, names, pos = handle
+            if pos >= len(names):
+                return hid, b""
+            handle[3] += 1
+            try:
+                return hid, filinfo(os.path.join(path, names[pos]), names[pos])
+            except FileNotFoundError:  # deleted since opendir
+                return self.handle(op, hid, payload)
+        if op == ord("A"):
+            handle = self.get(hid, "dir")
+            handle[2], handle[3] = sorted(os.listdir(handle[1])), 0
+            return hid, b""
+        if op == ord("U"):
+            path = self.path(payload)
+            if path == self.root:
+                raise Error(FR_DENIED)
+            if os.path.isdir(path):
+                if os.listdir(path):
+                    raise Error(FR_DENIED)
+                os.rmdir(path)
+            elif os.path.exists(path):
+                os.remove(path)
+            else:
+                raise self.missing(path)
+            return 0, b""
+        if op == ord("M"):
+            path = self.path(payload)
+            if os.path.exists(path):
+                raise Error(FR_EXIST)
+            if not os.path.isdir(os.path.dirname(path)):
+                raise Error(FR_NO_PATH)
+            os.mkdir(path)
+            return 0, b""
+        if op == ord("V"):
+            old, _, new = payload.partition(b"\0")
+            old, new = self.path(old), self.path(new)
+            if not os.path.exists(old):
+                raise self.missing(old)
+            if os.path.exists(new):
+                raise Error(FR_EXIST)
+            os.rename(old, new)
+            return 0, b""
+        raise Error(FR_INVALID_PARAMETER)
+
+    def request(self, op, hid, payload):
+        try:
+            hid, data = self.handle(op, hid, payload)
+            return HEAD.pack(FR_OK, hid, len(data)) + data
+        except Error as e:
+            return HEAD.pack(e.fresult, hid, 0)
+        except PermissionError:
+            return HEAD.pack(FR_DENIED, hid, 0)
+        except (OSError, struct.error):
+            return HEAD.pack(FR_DISK_ERR, hid, 0)
+
+    def close(self):
+        for handle in self.handles.values():
+            if handle[0] == "file":
+                handle[1].close()
+        self.handles.clear()
+
+
+def recv_exact(sock, size):
+    data = bytearray()
+    while len(data) < size:
+        chunk = sock.recv(size - len(data))
+        if not chunk:
+            raise ConnectionError("closed")
+        data += chunk
+    return bytes(data)
+
+
+class Handler(socketserver.BaseRequestHandler):
+    def handle(self):
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        volume = Volume(self.server.root)
+        try:
+            while True:
+                op, hid, size = HEAD.unpack(recv_exact(self.request, HEAD.size))
+                payload = recv_exact(self.request, size)
+                self.request.sendall(volume.request(op, hid, payload))
+        except ConnectionError:
+            pass
+        finally:
+            volume.close()
+
+
+class Server(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+    def __init__(self, root, port):
+        super().__init__(("", port), Handler)
+        self.root = root
+
+
+def start(root, port=0):
+    server = Server(root, port)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server
+
+
+class Client:
+    """Talks to the server like the RIA does."""
+
+    def __init__(self, host, port):
+        self.sock = socket.create_connection((host, port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def __call__(self, op, hid=0, payload=b""):
+        self.sock.sendall(HEAD.pack(ord(op), hid, len(payload)) + payload)
+        fresult, hid, size = HEAD.unpack(recv_exact(self.sock, HEAD.size))
+        return fresult, hid, recv_exact(self.sock, size)
+
+    def close(self):
+        self.sock.close()
+
+
+def self_test():
+    with tempfile.TemporaryDirectory() as root:
+        server = start(root)
+        rfs = Client("127.0.0.1", server.server_address[1])
+        assert rfs("O", 0, bytes([FA_READ]) + b"/nope.txt")[0] == FR_NO_FILE
+        assert rfs("O", 0, bytes([FA_READ]) + b"/no/nope.txt")[0] == FR_NO_PATH
+        fr, fid, data = rfs("O", 0, bytes([FA_WRITE | FA_CREATE_NEW]) + b"/a.txt")
+        assert fr == FR_OK and data == bytes(4)
+        assert rfs("O", 0, bytes([FA_WRITE | FA_CREATE_NEW]) + b"/a.txt")[0] == FR_EXIST
+        # Positional writes, a gap reads back as zeros.
+        assert rfs("W", fid, struct.pack("<I", 0) + b"hello")[0] == FR_OK
+        assert rfs("W", fid, struct.pack("<I", 8) + b"world")[0] == FR_OK
+        assert rfs("C", fid)[0] == FR_OK
+        assert rfs("C", fid)[0] == FR_INVALID_OBJECT
+        fr, fid, data = rfs("O", 0, bytes([FA_READ]) + b"a.txt")
+        assert fr == FR_OK and struct.unpack("<I", data)[0] == 13
+        assert rfs("R", fid, struct.pack("<IH", 0, 100))[2] == b"hello\0\0\0world"
+        assert rfs("R", fid, struct.pack("<IH", 13, 100))[2] == b""
+        assert rfs("W", fid, struct.pack("<I", 0) + b"x")[0] == FR_DENIED
+        assert rfs("C", fid)[0] == FR_OK
+        fr, _, info = rfs("S", 0, b"/a.txt")
+        size, _, _, attr = struct.unpack_from("<IHHB", info)
+        assert (fr, size, attr, info[9:]) == (FR_OK, 13, AM_ARC, b"a.txt")
+        assert rfs("M", 0, b"/sub")[0] == FR_OK
+        assert rfs("M", 0, b"/sub")[0] == FR_EXIST
+        assert rfs("V", 0, b"/a.txt\0/sub/b.txt")[0] == FR_OK
+        fr, did, _ = rfs("D", 0, b"/")
+        names = []
+        while True:
+            fr, _, info = rfs("N", did)
+            if not info:
+                break
+            names.append((info[9:], info[8]))
+        assert names == [(b"sub", AM_DIR)]
+        assert rfs("A", did)[0] == FR_OK
+        assert rfs("N", did)[2][9:] == b"sub"
+        assert rfs("C", did)[0] == FR_OK
+        assert rfs("U", 0, b"/sub")[0] == FR_DENIED
+        assert rfs("U", 0, b"/sub/b.txt")[0] == FR_OK
+        assert rfs("U", 0, b"/sub")[0] == FR_OK
+        assert rfs("S", 0, b"/../etc/passwd")[0] == FR_INVALID_NAME
+        # Reads never exceed the RIA buffer.
+        fr, fid, _ = rfs("O", 0, bytes([FA_READ | FA_WRITE | FA_CREATE_ALWAYS]) + b"/big")
+        rfs("W", fid, struct.pack("<I", 0) + bytes(5000))
+        assert len(rfs("R", fid, struct.pack("<IH", 0, 0xFFFF))[2]) == BUF_SIZE
+        rfs.close()
+        server.shutdown()
+        server.server_close()
+    print("self-test passed")
+
+
+def bench(address):
+    """Moves 1 MB with the same request sizes as the RIA."""
+    server = None
+    tmp = tempfile.TemporaryDirectory()
+    if address:
+        host, _, port = address.partition(":")
+        port = int(port or DEFAULT_PORT)
+    else:
+        server = start(tmp.name)
+        host, port = "127.0.0.1", server.server_address[1]
+    rfs = Client(host, port)
+    total = 1 << 20
+    block = os.urandom(BUF_SIZE)
+    fr, fid, _ = rfs("O", 0, bytes([FA_READ | FA_WRITE | FA_CREATE_ALWAYS]) + b"/BENCH.TMP")
+    if fr != FR_OK:
+        sys.exit(f"open failed {fr}")
+    start_time = time.perf_counter()
+    for ofs in range(0, total, BUF_SIZE):
+        rfs("W", fid, struct.pack("<I", ofs) + block)
+    write_s = time.perf_counter() - start_time
+    start_time = time.perf_counter()
+    for ofs in range(0, total, BUF_SIZE):
+        rfs("R", fid, struct.pack("<IH", ofs, BUF_SIZE))
+    read_s = time.perf_counter() - start_time
+    rfs("C", fid)
+    rfs("U", 0, b"/BENCH.TMP")
+    rfs.close()
+    requests = total // BUF_SIZE
+    print(f"write {total / write_s / 1024:.0f} KB/s, "
+          f"read {total / read_s / 1024:.0f} KB/s, "
+          f"{requests / read_s:.0f} requests/s at {BUF_SIZE} bytes")
+    if server:
+        server.shutdown()
+        server.server_close()
+    tmp.cleanup()
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+    elif args and args[0] == "--bench" and len(args) <= 2:
+        bench(args[1] if len(args) == 2 else None)
+    elif 1 <= len(args) <= 2 and os.path.isdir(args[0]):
+        port = int(args[1]) if len(args) == 2 else DEFAULT_PORT
+        server = Server(args[0], port)
+        print(f"Serving {os.path.realpath(args[0])} as NET0: on port {port}")
+        try:
+            server.serve_forever()
+        except KeyboardInterrupt:
+            pass
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
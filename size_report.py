@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+Report where the firmware lives: RAM, flash and stack per subsystem.
+
+Reads the GNU ld map written next to the .elf and the .su files from
+-fstack-usage in the target's CMakeFiles directory.
+
+    RAM    code and data in SRAM, including copy_to_ram code
+    XIP    code and constants executed or read from flash
+    FLASH  everything stored in flash: XIP plus RAM initial images
+    STACK  largest single frame, dynamic frames marked with +
+
+Usage:
+    python3 size_report.py build/src/rp6502_vga.elf.map build/src/CMakeFiles/rp6502_vga.dir
+    python3 size_report.py --self-test
+"""
+
+import os
+import re
+import sys
+
+FLASH_BASE = 0x10000000
+RAM_BASE = 0x20000000
+LIBS = ("pico-sdk", "tinyusb", "btstack", "lwip", "cyw43-driver", "cyw43")
+
+ENTRY_RE = re.compile(r"^ (\.\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+NAME_RE = re.compile(r"^ (\.\S+)$")
+SU_RE = re.compile(r"^(.*):\d+:\d+:(\S+)\t(\d+)\t(\S+)$")
+
+
+def subsystem(path):
+    """Group an object or source path into a subsystem name."""
+    path = path.replace("\\", "/")
+    m = re.search(r"\(([^)]*)\)$", path)
+    if m and path.endswith(")"):  # archive member
+        return os.path.basename(path[:m.start()]).rsplit(".", 1)[0]
+    for lib in LIBS:
+        if "/" + lib + "/" in path:
+            return lib.replace("-driver", "")
+    m = re.search(r"\.dir/(ria|vga)/([^/]+)/", path)
+    if m:
+        return m.group(1) + "/" + m.group(2)
+    m = re.search(r"\.dir/(ria|vga)/", path)
+    if m:
+        return m.group(1)
+    m = re.search(r"\.dir/([^/]+)/", path)
+    if m:
+        return m.group(1)
+    m = re.search(r"/src/(ria|vga)/([^/]+)/", path)
+    if m:
+        return m.group(1) + "/" + m.group(2)
+    m = re.search(r"/src/([^/]+)/", path)
+    if m:
+        return m.group(1)
+    return "other"
+
+
+def parse_map(lines):
+    """Return [(section, address, size, path)] for allocated input sections."""
+    entries = []
+    pending = None
+    in_map = False
+    for line in lines:
+        line = line.rstrip("\n")
+        if line.startswith("Linker script and memory map"):
+            in_map = True
+            continue
+        if not in_map:
+            continue
+        m = NAME_RE.match(line)
+        if m:
+            pending = m.group(1)
+            continue
+        m = ENTRY_RE.match(line)
+        if m:
+            section = m.group(1) or pending
+            pending = None
+            addr, size = int(m.group(2), 16), int(m.group(3), 16)
+            path = m.group(4).strip()
+            if section and size and addr and not path.startswith("load address"):
+                entries.append((section, addr, size, path))
+            continue
+        pending = None
+    return entries
+
+
+def is_zero_init(section):
+    return section.startswith((".bss", "COMMON", ".heap", ".stack", ".uninitialized"))
+
+
+def tally(entries):
+    totals = {}
+    for section, addr, size, path in entries:
+        t = totals.setdefault(subsystem(path), {"ram": 0, "xip": 0, "flash": 0, "stack": 0, "dyn": False})
+        if addr >= RAM_BASE:
+            t["ram"] += size
+            if not is_zero_init(section):
+                t["flash"] += size
+        elif addr >= FLASH_BASE:
+            t["xip"] += size
+            t["flash"] += size
+    return totals
+
+
+def parse_su(lines, path_hint=""):
+    """Return [(subsystem, function, bytes, dynamic)] from .su lines."""
+    frames = []
+    for line in lines:
+        m = SU_RE.match(line.rstrip("\n"))
+        if m:
+            src, fn, size, kind = m.groups()
+            frames.append((subsystem(path_hint or src), fn, int(size), kind != "static"))
+    return frames
+
+
+def load_su(obj_dir):
+    frames = []
+    for root, _, files in os.walk(obj_dir):
+        for name in files:
+            if name.endswith(".su"):
+                path = os.path.join(root, name)
+                with open(path) as f:
+                    frames += parse_su(f, path)
+    return frames
+
+
+def report(totals, frames, out=sys.stdout):
+    for sub, fn, size, dyn in frames:
+        t = totals.setdefault(sub, {"ram": 0, "xip": 0, "flash": 0, "stack": 0, "dyn": False})
+        if size > t["stack"]:
+            t["stack"], t["dyn"] = size, dyn
+    print(f"{'Subsystem':<16} {'RAM':>8} {'XIP':>8} {'FLASH':>8} {'STACK':>7}", file=out)
+    for sub, t in sorted(totals.items(), key=lambda kv: -kv[1]["ram"]):
+        stack = f"{t['stack']}{'+' if t['dyn'] else ''}" if t["stack"] else "-"
+        print(f"{sub:<16} {t['ram']:>8} {t['xip']:>8} {t['flash']:>8} {stack:>7}", file=out)
+    print(f"{'total':<16} {sum(t['ram'] for t in totals.values()):>8} "
+          f"{sum(t['xip'] for t in totals.values()):>8} "
+          f"{sum(t['flash'] for t in totals.values()):>8}", file=out)
+    if frames:
+        print("\nLargest stack frames:", file=out)
+        for sub, fn, size, dyn in sorted(frames, key=lambda f: -f[2])[:10]:
+            print(f"  {size:>6}{'+' if dyn else ' '} {fn} ({sub})", file=out)
+
+
+def self_test():
+    import io
+    text = """Memory map
+Linker script and memory map
+
+ .text.api_task
+                0x20001000       0x40 CMakeFiles/rp6502_ria_w.dir/ria/api/api.c.obj
+ .text          0x20001040       0x10 CMakeFiles/rp6502_ria_w.dir/ria/api/std.c.obj
+ .bss.mbuf      0x20010000      0x400 CMakeFiles/rp6502_ria_w.dir/ria/sys/mem.c.obj
+ .flashtext.api_platform_errno
+                0x10004000       0x80 CMakeFiles/rp6502_ria_w.dir/ria/api/api.c.obj
+ .text.memcpy   0x20002000       0x20 /opt/arm/lib/libc.a(libc_a-memcpy.o)
+ .text.pwm_init
+                0x20003000       0x30 CMakeFiles/rp6502_ria_w.dir/home/u/pico-sdk/src/rp2_common/hardware_pwm/pwm.c.obj
+ .text.unused   0x00000000       0x30 CMakeFiles/rp6502_ria_w.dir/ria/api/api.c.obj
+"""
+    totals = tally(parse_map(io.StringIO(text)))
+    assert totals["ria/api"] == {"ram": 0x50, "xip": 0x80, "flash": 0xD0, "stack": 0, "dyn": False}
+    assert totals["ria/sys"]["ram"] == 0x400 and totals["ria/sys"]["flash"] == 0
+    assert totals["libc"]["ram"] == 0x20
+    assert totals["pico-sdk"]["ram"] == 0x30
+    frames = parse_su(["/src/ria/api/std.c:42:6:std_api_open\t96\tstatic\n",
+                       "/src/ria/api/std.c:80:6:std_api_read\t40\tdynamic,bounded\n"],
+                      "CMakeFiles/rp6502_ria_w.dir/ria/api/std.c.su")
+    assert frames[0] == ("ria/api", "std_api_open", 96, False) and frames[1][3]
+    out = io.StringIO()
+    report(totals, frames, out)
+    assert "ria/api" in out.getvalue() and "std_api_open" in out.getvalue()
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+        return
+    if len(args) not in (1, 2):
+        sys.exit(__doc__)
+    with open(args[0]) as f:
+        totals = tally(parse_map(f))
+    frames = load_su(args[1]) if len(args) == 2 else []
+    report(totals, frames)
+
+
+if __name__ == "__main__":
+    main()
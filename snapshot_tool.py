@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+List and extract RP6502 snapshots saved with SNAPSHOT.
+
+The file is "RP6502S1" then records of a 12 byte header, tag[4],
+uint32 address, uint16 unpacked length and uint16 packed length, all
+little endian, followed by PackBits data. See SNAPSHOTS.md.
+
+Usage:
+    python3 snapshot_tool.py list file.snp
+    python3 snapshot_tool.py extract file.snp ram.bin xram.bin
+    python3 snapshot_tool.py --self-test
+"""
+
+import struct
+import sys
+
+MAGIC = b"RP6502S1"
+RECORD = struct.Struct("<4sIHH")
+INFO = struct.Struct("<QH6x")
+DEVICES = {0: "RIA", 1: "VGA"}
+
+
+def pack(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 2:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+        lit = 0
+        while i + lit < len(data) and lit < 128:
+            if data[i + lit:i + lit + 3] == bytes([data[i + lit]]) * 3:
+                break
+            lit += 1
+        out.append(lit - 1)
+        out += data[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def unpack(data, length):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    if len(out) != length:
+        raise ValueError("corrupt record")
+    return bytes(out)
+
+
+def records(data):
+    """Yield (tag, addr, payload) for each record."""
+    if data[:8] != MAGIC:
+        raise ValueError("not a snapshot")
+    pos = 8
+    while pos < len(data):
+        tag, addr, length, size = RECORD.unpack_from(data, pos)
+        pos += RECORD.size
+        yield tag.decode("ascii", "replace"), addr, unpack(data[pos:pos + size], length)
+        pos += size
+
+
+def xreg_calls(log):
+    """Yield (device, channel, addr, [words]) for each logged call."""
+    pos = 0
+    while pos < len(log):
+        length = int.from_bytes(log[pos:pos + 2], "little")
+        call = log[pos + 2:pos + 2 + length]
+        pos += 2 + length
+        words = [int.from_bytes(call[i:i + 2], "little") for i in range(0, length - 3, 2)]
+        yield call[-1], call[-2], call[-3], words[::-1]
+
+
+def build(ram, xram, regs=bytes(32), log=b"", clock_us=0, code_page=437):
+    out = bytearray(MAGIC)
+
+    def record(tag, addr, payload):
+        packed = pack(payload)
+        out.extend(RECORD.pack(tag, addr, len(payload), len(packed)) + packed)
+
+    record(b"INFO", 0, INFO.pack(clock_us, code_page))
+    record(b"REGS", 0xFFE0, regs)
+    for addr in range(0, 0x10000, 1024):
+        record(b"XRAM", 0x10000 + addr, xram[addr:addr + 1024])
+    for addr in range(0, 0x10000, 1024):
+        record(b"RAM_", addr, ram[addr:addr + 1024])
+    record(b"XREG", 0, log)
+    record(b"END_", 0, b"")
+    return bytes(out)
+
+
+def extract(data):
+    ram, xram = bytearray(0x10000), bytearray(0x10000)
+    for tag, addr, payload in records(data):
+        if tag == "RAM_":
+            ram[addr:addr + len(payload)] = payload
+        elif tag == "XRAM":
+            xram[addr - 0x10000:addr - 0x10000 + len(payload)] = payload
+    return bytes(ram), bytes(xram)
+
+
+def listing(data):
+    out = []
+    packed = 0
+    for tag, addr, payload in records(data):
+        if tag == "INFO":
+            clock_us, code_page = INFO.unpack(payload)
+            out.append(f"clock {clock_us / 1e6:.3f} s, code page {code_page}")
+        elif tag == "REGS":
+            out.append("regs " + payload[4:12].hex(" "))
+        elif tag == "XREG":
+            for dev, ch, addr, words in xreg_calls(payload):
+                name = DEVICES.get(dev, f"dev {dev}")
+                out.append(f"xreg {name} ch {ch} ${addr:02X}: "
+                           + " ".join(f"${w:04X}" for w in words))
+        elif tag in ("RAM_", "XRAM"):
+            packed += len(payload)
+    out.append(f"{packed} bytes of RAM and XRAM in {len(data)} byte file")
+    return "\n".join(out)
+
+
+def self_test():
+    for sample in (b"", b"a", b"aa", b"aaa", b"ab" * 200, bytes(300),
+                   bytes(range(256)) * 3, b"xyzzzzy" * 50):
+        packed = pack(sample)
+        assert unpack(packed, len(sample)) == sample
+        assert len(packed) <= len(sample) + (len(sample) + 127) // 128
+    assert pack(bytes(4)) == bytes([253, 0])
+    assert pack(b"abc") == bytes([2]) + b"abc"
+    ram = bytearray(0x10000)
+    ram[0x200:0x210] = bytes(range(16))
+    xram = bytearray(b"\xAA" * 0x10000)
+    # VGA ch 0 $01 = 3, $02 = 0, $03 = $FF00
+    log = bytes([9, 0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01])
+    data = build(bytes(ram), bytes(xram), log=log, clock_us=1500000)
+    assert len(data) < 4096
+    assert extract(data) == (bytes(ram), bytes(xram))
+    assert list(xreg_calls(log)) == [(1, 0, 1, [3, 0, 0xFF00])]
+    text = listing(data)
+    assert "clock 1.500 s, code page 437" in text
+    assert "xreg VGA ch 0 $01: $0003 $0000 $FF00" in text
+    try:
+        unpack(bytes([5, 1]), 6)
+        assert False, "short record accepted"
+    except ValueError:
+        pass
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+    elif len(args) == 2 and args[0] == "list":
+        with open(args[1], "rb") as f:
+            print(listing(f.read()))
+    elif len(args) == 4 and args[0] == "extract":
+        with open(args[1], "rb") as f:
+            ram, xram = extract(f.read())
+        with open(args[2], "wb") as f:
+            f.write(ram)
+        with open(args[3], "wb") as f:
+            f.write(xram)
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
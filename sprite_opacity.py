@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Append opacity metadata to a mode 4 16bpp sprite.
+
+Mode 4 sprites are little endian 16bpp pixels with bit 5 set on opaque
+pixels (red bits 0-4, alpha bit 5, green bits 6-10, blue bits 11-15).
+The optional metadata is one 32-bit word per row after the image:
+
+    bits  0-15  end of the opaque span (exclusive)
+    bits 16-30  start of the opaque span
+    bit     31  every pixel in the span is opaque
+
+The VGA clips each row to its span and blits a fully opaque span
+without testing alpha. Set has_opacity_metadata in the sprite config
+after loading the output.
+
+Usage:
+    python3 sprite_opacity.py WIDTH in.bin out.bin
+    python3 sprite_opacity.py WIDTH in.png out.bin   (needs Pillow)
+    python3 sprite_opacity.py --self-test
+"""
+
+import struct
+import sys
+
+ALPHA = 1 << 5
+
+
+def rgb8_to_pixel(r, g, b, a):
+    pixel = (r >> 3) | ((g >> 3) << 6) | ((b >> 3) << 11)
+    return pixel | ALPHA if a >= 128 else pixel
+
+
+def load_png(path):
+    from PIL import Image
+    img = Image.open(path).convert("RGBA")
+    pixels = [rgb8_to_pixel(*p) for p in img.getdata()]
+    return img.width, pixels
+
+
+def row_metadata(row):
+    opaque = [i for i, p in enumerate(row) if p & ALPHA]
+    if not opaque:
+        return 0
+    start, end = opaque[0], opaque[-1] + 1
+    solid = len(opaque) == end - start
+    return (solid << 31) | (start << 16) | end
+
+
+def build(width, pixels):
+    if width < 1 or len(pixels) % width:
+        raise ValueError("image size is not a multiple of width")
+    rows = [pixels[i:i + width] for i in range(0, len(pixels), width)]
+    image = struct.pack(f"<{len(pixels)}H", *pixels)
+    meta = struct.pack(f"<{len(rows)}I", *(row_metadata(r) for r in rows))
+    return image + meta
+
+
+def self_test():
+    o, t = 0x1F | ALPHA, 0x1F
+    assert row_metadata([t, t, t, t]) == 0
+    assert row_metadata([o, o, o, o]) == (1 << 31) | 4
+    assert row_metadata([t, o, o, t]) == (1 << 31) | (1 << 16) | 3
+    assert row_metadata([o, t, o, t]) == 3
+    out = build(3, [t, o, t, o, o, o])
+    assert len(out) == 3 * 2 * 2 + 2 * 4
+    assert struct.unpack_from("<2I", out, 12) == (
+        (1 << 31) | (1 << 16) | 2, (1 << 31) | 3)
+    assert rgb8_to_pixel(255, 0, 0, 255) == 0x1F | ALPHA
+    assert rgb8_to_pixel(0, 0, 255, 0) == 0x1F << 11
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        self_test()
+        return
+    if len(args) != 3:
+        sys.exit(__doc__)
+    width, src, dst = int(args[0]), args[1], args[2]
+    if src.lower().endswith(".png"):
+        png_width, pixels = load_png(src)
+        if png_width != width:
+            sys.exit(f"PNG is {png_width} pixels wide")
+    else:
+        with open(src, "rb") as f:
+            data = f.read()
+        pixels = list(struct.unpack(f"<{len(data) // 2}H", data))
+    out = build(width, pixels)
+    with open(dst, "wb") as f:
+        f.write(out)
+    print(f"{width}x{len(pixels) // width} sprite, {len(out)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -7,6 +7,7 @@
 #include "main.h"
 #include "api/api.h"
 #include "sys/cpu.h"
+#include "sys/prf.h"
 #include "sys/ria.h"
 #include "fatfs/ff.h"
 #include <pico.h>
@@ -87,7 +88,7 @@ void api_task(void)
     // Latch called op in case 6502 app misbehaves
     if (cpu_active() && !ria_active() &&
         !api_active_op && API_BUSY &&
-        API_OP != 0x00 && API_OP != 0xFF)
+        API_OP != 0x00 && API_OP != 0xFF && API_OP != PRF_API_OP)
         api_active_op = API_OP;
     if (api_active_op && !main_api(api_active_op))
         api_active_op = 0;
@@ -356,3 +357,47 @@ bool api_pop_int32_end(int32_t *data)
         return false;
     }
 }
+
+#ifdef RIA_BENCHMARK
+#include <pico/time.h>
+#include <stdio.h>
+
+// Calls cheap API ops through the dispatcher and reports the
+// time per call. Run before the 6502 starts.
+void api_benchmark(void)
+{
+    static const struct
+    {
+        const char *name;
+        uint8_t op;
+        const char *path;
+    } ops[] = {
+        {"lrand", 0x04, NULL},
+        {"errno_opt", 0x06, NULL},
+        {"clock", 0x0F, NULL},
+        {"stat", 0x1F, "BENCH.NOT"},
+    };
+    const unsigned iterations = 1000;
+#ifdef RP6502_RIA_PROFILE_SPEED
+    printf("API benchmark, speed profile\n");
+#else
+    printf("API benchmark, size profile\n");
+#endif
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++)
+    {
+        uint64_t start = time_us_64();
+        for (unsigned n = 0; n < iterations; n++)
+        {
+            xstack_ptr = XSTACK_SIZE;
+            if (ops[i].path)
+                api_push_n(ops[i].path, strlen(ops[i].path));
+            API_A = API_ERRNO_OPT_CC65;
+            main_api(ops[i].op);
+        }
+        uint32_t ns_per_op = (time_us_64() - start) * 1000 / iterations;
+        printf("%-10s %6lu ns/op\n", ops[i].name, (unsigned long)ns_per_op);
+    }
+    xstack_ptr = XSTACK_SIZE;
+    api_errno_opt = API_ERRNO_OPT_NULL;
+}
+#endif
@@ -24,6 +24,10 @@ void api_task(void);
 void api_run(void);
 void api_stop(void);
 
+#ifdef RIA_BENCHMARK
+void api_benchmark(void);
+#endif
+
 typedef enum
 {
     API_ENOENT,  /* No such file or directory */
@@ -10,6 +10,8 @@
 #include "api/api.h"
 #include "api/clk.h"
 #include "sys/cfg.h"
+#include "sys/mem.h"
+#include "sys/ria.h"
 #include <hardware/timer.h>
 #include <pico/aon_timer.h>
 #include <stdio.h>
@@ -24,37 +26,181 @@ static inline void DBG(const char *fmt, ...) { (void)fmt; }
 
 #define CLK_ID_REALTIME 0
 
+// Offsets below CLK_STEP_US are slewed at no more than
+// the slew rate so time never runs backwards. Same as ntpd.
+#define CLK_SLEW_PPM 500
+#define CLK_FREQ_MAX_PPB 500000
+#define CLK_FREQ_GAIN 4
+#define CLK_FREQ_MIN_INTERVAL_US (16 * 1000000)
+#define CLK_REBASE_US 1000000
+// FatFs timestamps have two second resolution.
+#define CLK_AON_SET_US 1000000
+
 static uint64_t clk_clock_start;
 
+// Realtime is the timer plus corrections since the last rebase.
+static uint64_t clk_mono_base;
+static int64_t clk_epoch_base;
+static int64_t clk_slew_us;
+static int32_t clk_freq_ppb;
+static bool clk_disciplined;
+static uint64_t clk_last_discipline;
+
+static uint16_t clk_xram = 0xFFFF;
+static uint32_t clk_xram_ms;
+
+static int64_t clk_slew_part(uint64_t elapsed)
+{
+    int64_t max = elapsed * CLK_SLEW_PPM / 1000000;
+    if (clk_slew_us > max)
+        return max;
+    if (clk_slew_us < -max)
+        return -max;
+    return clk_slew_us;
+}
+
+static int64_t clk_epoch_at(uint64_t mono)
+{
+    int64_t elapsed = mono - clk_mono_base;
+    return clk_epoch_base + elapsed +
+           elapsed * clk_freq_ppb / 1000000000 +
+           clk_slew_part(elapsed);
+}
+
+// Fold corrections into the base to keep the math small.
+static void clk_rebase(uint64_t now)
+{
+    int64_t epoch = clk_epoch_at(now);
+    clk_slew_us -= clk_slew_part(now - clk_mono_base);
+    clk_epoch_base = epoch;
+    clk_mono_base = now;
+}
+
+static bool clk_step(int64_t epoch_us)
+{
+    struct timespec ts;
+    ts.tv_sec = epoch_us / 1000000;
+    ts.tv_nsec = epoch_us % 1000000 * 1000;
+    if (!aon_timer_set_time(&ts))
+        return false;
+    clk_mono_base = time_us_64();
+    clk_epoch_base = epoch_us;
+    clk_slew_us = 0;
+    return true;
+}
+
 void clk_init(void)
 {
     // starting at noon avoids time zone wraparound
     const struct timespec ts = {43200, 0};
     aon_timer_start(&ts);
+    clk_mono_base = time_us_64();
+    clk_epoch_base = (int64_t)ts.tv_sec * 1000000;
     cfg_set_time_zone(clk_set_time_zone(cfg_get_time_zone()));
 }
 
+void clk_task(void)
+{
+    uint64_t now = time_us_64();
+    if (now - clk_mono_base > CLK_REBASE_US)
+        clk_rebase(now);
+    if (clk_xram != 0xFFFF)
+    {
+        uint32_t ms = clk_epoch_at(now) / 1000;
+        if (ms != clk_xram_ms)
+        {
+            clk_xram_ms = ms;
+            memcpy(&xram[clk_xram], &ms, sizeof(ms));
+            // The 6502 may be parked on the counter with STEP 0.
+            ria_refresh_rw();
+        }
+    }
+}
+
 void clk_run(void)
 {
     clk_clock_start = time_us_64();
 }
 
+void clk_stop(void)
+{
+    clk_xram = 0xFFFF;
+}
+
+bool clk_xreg(uint16_t word)
+{
+    if (word != 0xFFFF && word > 0x10000 - sizeof(clk_xram_ms))
+        return false;
+    clk_xram = word;
+    if (clk_xram != 0xFFFF)
+    {
+        clk_xram_ms = clk_epoch_at(time_us_64()) / 1000;
+        memcpy(&xram[clk_xram], &clk_xram_ms, sizeof(clk_xram_ms));
+    }
+    return true;
+}
+
 void clk_print_status(void)
 {
     printf("Time: ");
-    struct timespec ts;
-    if (!aon_timer_get_time(&ts))
+    char buf[100];
+    struct tm tminfo;
+    time_t sec = clk_get_time_us() / 1000000;
+    localtime_r(&sec, &tminfo);
+    strftime(buf, sizeof(buf), "%c %z %Z", &tminfo);
+    printf("%s\n", buf);
+}
+
+int64_t clk_get_time_us(void)
+{
+    return clk_epoch_at(time_us_64());
+}
+
+bool clk_discipline(int64_t offset_us)
+{
+    uint64_t now = time_us_64();
+    clk_rebase(now);
+    if (!clk_disciplined || offset_us > CLK_STEP_US || offset_us < -CLK_STEP_US)
     {
-        puts("get time failure");
+        if (!clk_step(clk_epoch_base + offset_us))
+            return false;
+        clk_disciplined = true;
+        clk_last_discipline = now;
+        DBG("CLK step %lld us\n", offset_us);
+        return true;
     }
-    else
+    // What remains after the planned slew is oscillator drift.
+    uint64_t interval = now - clk_last_discipline;
+    if (interval >= CLK_FREQ_MIN_INTERVAL_US)
+    {
+        int64_t drift_ppb = (offset_us - clk_slew_us) * 1000000000 / (int64_t)interval;
+        int64_t freq_ppb = clk_freq_ppb + drift_ppb / CLK_FREQ_GAIN;
+        if (freq_ppb > CLK_FREQ_MAX_PPB)
+            freq_ppb = CLK_FREQ_MAX_PPB;
+        if (freq_ppb < -CLK_FREQ_MAX_PPB)
+            freq_ppb = -CLK_FREQ_MAX_PPB;
+        clk_freq_ppb = freq_ppb;
+    }
+    clk_last_discipline = now;
+    clk_slew_us = offset_us;
+    // Keep the AON timer close for FatFs timestamps.
+    struct timespec ts;
+    int64_t epoch = clk_epoch_base + offset_us;
+    aon_timer_get_time(&ts);
+    int64_t aon_err = epoch - ((int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+    if (aon_err > CLK_AON_SET_US || aon_err < -CLK_AON_SET_US)
     {
-        char buf[100];
-        struct tm tminfo;
-        localtime_r(&ts.tv_sec, &tminfo);
-        strftime(buf, sizeof(buf), "%c %z %Z", &tminfo);
-        printf("%s\n", buf);
+        ts.tv_sec = epoch / 1000000;
+        ts.tv_nsec = epoch % 1000000 * 1000;
+        aon_timer_set_time(&ts);
     }
+    DBG("CLK slew %lld us, freq %ld ppb\n", offset_us, (long)clk_freq_ppb);
+    return true;
+}
+
+int32_t clk_get_freq_ppb(void)
+{
+    return clk_freq_ppb;
 }
 
 const char *clk_set_time_zone(const char *tz)
@@ -67,6 +213,16 @@ const char *clk_set_time_zone(const char *tz)
     return time_zone;
 }
 
+uint64_t clk_get_clock_us(void)
+{
+    return time_us_64() - clk_clock_start;
+}
+
+void clk_set_clock_us(uint64_t us)
+{
+    clk_clock_start = time_us_64() - us;
+}
+
 bool clk_api_clock(void)
 {
     return api_return_axsreg((time_us_64() - clk_clock_start) / 10000);
@@ -95,10 +251,9 @@ bool clk_api_get_time(void)
     uint8_t clock_id = API_A;
     if (clock_id == CLK_ID_REALTIME)
     {
-        struct timespec ts;
-        aon_timer_get_time(&ts);
-        int32_t nsec = ts.tv_nsec;
-        uint32_t sec = ts.tv_sec;
+        int64_t us = clk_get_time_us();
+        int32_t nsec = us % 1000000 * 1000;
+        uint32_t sec = us / 1000000;
         if (!api_push_int32(&nsec) ||
             !api_push_uint32(&sec))
             return api_return_errno(API_EINVAL);
@@ -118,10 +273,8 @@ bool clk_api_set_time(void)
         if (!api_pop_uint32(&rawtime_sec) ||
             !api_pop_int32_end(&rawtime_nsec))
             return api_return_errno(API_EINVAL);
-        struct timespec ts;
-        ts.tv_sec = rawtime_sec;
-        ts.tv_nsec = rawtime_nsec;
-        if (!aon_timer_set_time(&ts))
+        if (rawtime_nsec < 0 || rawtime_nsec >= 1000000000 ||
+            !clk_step((int64_t)rawtime_sec * 1000000 + rawtime_nsec / 1000))
             return api_return_errno(API_ERANGE);
         else
             return api_return_ax(0);
@@ -130,6 +283,20 @@ bool clk_api_set_time(void)
         return api_return_errno(API_EINVAL);
 }
 
+bool clk_api_get_time_us(void)
+{
+    uint8_t clock_id = API_A;
+    if (clock_id == CLK_ID_REALTIME)
+    {
+        int64_t us = clk_get_time_us();
+        if (!api_push_n(&us, sizeof(us)))
+            return api_return_errno(API_EINVAL);
+        return api_return_ax(0);
+    }
+    else
+        return api_return_errno(API_EINVAL);
+}
+
 bool clk_api_get_time_zone(void)
 {
     struct __attribute__((packed)) cc65_timezone
@@ -18,7 +18,13 @@
  */
 
 void clk_init(void);
+void clk_task(void);
 void clk_run(void);
+void clk_stop(void);
+
+// Set the extended register value.
+// XRAM address of a free-running uint32_t millisecond counter.
+bool clk_xreg(uint16_t word);
 
 // Print for status command.
 void clk_print_status(void);
@@ -26,12 +32,30 @@ void clk_print_status(void);
 // Use POSIX TZ format. e.g. PST8PDT,M3.2.0/2,M11.1.0/2
 const char *clk_set_time_zone(const char *tz);
 
+// Discipline offsets larger than this step the clock.
+#define CLK_STEP_US 128000
+
+// Disciplined realtime in microseconds since the epoch.
+int64_t clk_get_time_us(void);
+
+// Correct realtime by a measured offset, e.g. from NTP.
+// Large offsets step, small ones slew and train the frequency.
+bool clk_discipline(int64_t offset_us);
+
+// Current oscillator correction in parts per billion.
+int32_t clk_get_freq_ppb(void);
+
+// Time since the program started, for snapshots.
+uint64_t clk_get_clock_us(void);
+void clk_set_clock_us(uint64_t us);
+
 /* The API implementation for time support
  */
 
 bool clk_api_clock(void);
 bool clk_api_get_res(void);
 bool clk_api_get_time(void);
+bool clk_api_get_time_us(void);
 bool clk_api_set_time(void);
 bool clk_api_get_time_zone(void);
 
@@ -6,6 +6,7 @@
 
 #include "api/api.h"
 #include "api/dir.h"
+#include "net/rfs.h"
 #include <fatfs/ff.h>
 #include <pico.h>
 
@@ -24,8 +25,10 @@ static_assert(FF_FS_CRTIME == 1);
 static_assert(FF_USE_LABEL == 1);
 
 #define DIR_MAX_OPEN 8
+#define DIR_NET DIR_MAX_OPEN
+#define DIR_END (DIR_NET + RFS_DIR_MAX)
 static DIR dirs[DIR_MAX_OPEN];
-static int32_t tells[DIR_MAX_OPEN];
+static int32_t tells[DIR_END];
 
 void dir_run(void)
 {
@@ -37,6 +40,31 @@ void dir_stop(void)
 {
     for (int i = 0; i < DIR_MAX_OPEN; i++)
         f_closedir(&dirs[i]);
+    for (int i = 0; i < RFS_DIR_MAX; i++)
+        rfs_closedir(i);
+}
+
+// Descriptors from DIR_NET are on the NET0: volume.
+
+static bool dir_is_open(unsigned des)
+{
+    if (des >= DIR_NET)
+        return rfs_dir_is_open(des - DIR_NET);
+    return dirs[des].obj.fs != 0;
+}
+
+static FRESULT dir_readdir(unsigned des, FILINFO *fno)
+{
+    if (des >= DIR_NET)
+        return rfs_readdir(des - DIR_NET, fno);
+    return f_readdir(&dirs[des], fno);
+}
+
+static FRESULT dir_rewinddir(unsigned des)
+{
+    if (des >= DIR_NET)
+        return rfs_rewinddir(des - DIR_NET);
+    return f_rewinddir(&dirs[des]);
 }
 
 static void dir_push_filinfo(FILINFO *fno)
@@ -64,7 +92,11 @@ bool dir_api_stat(void)
     TCHAR *path = (TCHAR *)&xstack[xstack_ptr];
     xstack_ptr = XSTACK_SIZE;
     FILINFO fno;
-    FRESULT fresult = f_stat(path, &fno);
+    FRESULT fresult;
+    if (rfs_is_path(path))
+        fresult = rfs_stat(path, &fno);
+    else
+        fresult = f_stat(path, &fno);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     dir_push_filinfo(&fno);
@@ -74,6 +106,17 @@ bool dir_api_stat(void)
 // int f_opendir (const char* name);
 bool dir_api_opendir(void)
 {
+    TCHAR *path = (TCHAR *)&xstack[xstack_ptr];
+    if (rfs_is_path(path))
+    {
+        xstack_ptr = XSTACK_SIZE;
+        int net_des;
+        FRESULT fresult = rfs_opendir(&net_des, path);
+        if (fresult != FR_OK)
+            return api_return_fresult(fresult);
+        tells[DIR_NET + net_des] = 0;
+        return api_return_ax(DIR_NET + net_des);
+    }
     DIR *dir = 0;
     unsigned des = 0;
     for (; des < DIR_MAX_OPEN; des++)
@@ -85,7 +128,6 @@ bool dir_api_opendir(void)
     if (!dir)
         return api_return_errno(API_EMFILE);
     tells[des] = 0;
-    TCHAR *path = (TCHAR *)&xstack[xstack_ptr];
     xstack_ptr = XSTACK_SIZE;
     FRESULT fresult = f_opendir(dir, path);
     if (fresult != FR_OK)
@@ -97,11 +139,10 @@ bool dir_api_opendir(void)
 bool dir_api_readdir(void)
 {
     unsigned des = API_A;
-    if (des >= DIR_MAX_OPEN)
+    if (des >= DIR_END)
         return api_return_errno(API_EINVAL);
-    DIR *dir = &dirs[des];
     FILINFO fno;
-    FRESULT fresult = f_readdir(dir, &fno);
+    FRESULT fresult = dir_readdir(des, &fno);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     if (fno.fname[0])
@@ -114,10 +155,13 @@ bool dir_api_readdir(void)
 bool dir_api_closedir(void)
 {
     unsigned des = API_A;
-    if (des >= DIR_MAX_OPEN)
+    if (des >= DIR_END)
         return api_return_errno(API_EINVAL);
-    DIR *dir = &dirs[des];
-    FRESULT fresult = f_closedir(dir);
+    FRESULT fresult;
+    if (des >= DIR_NET)
+        fresult = rfs_closedir(des - DIR_NET);
+    else
+        fresult = f_closedir(&dirs[des]);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
@@ -127,10 +171,9 @@ bool dir_api_closedir(void)
 bool dir_api_telldir(void)
 {
     unsigned des = API_A;
-    if (des >= DIR_MAX_OPEN)
+    if (des >= DIR_END)
         return api_return_errno(API_EINVAL);
-    DIR *dir = &dirs[des];
-    if (dir->obj.fs == 0)
+    if (!dir_is_open(des))
         return api_return_errno(API_EBADF);
     return api_return_axsreg(tells[des]);
 }
@@ -139,17 +182,16 @@ bool dir_api_telldir(void)
 bool dir_api_seekdir(void)
 {
     unsigned des = API_A;
-    if (des >= DIR_MAX_OPEN)
+    if (des >= DIR_END)
         return api_return_errno(API_EINVAL);
-    DIR *dir = &dirs[des];
-    if (dir->obj.fs == 0)
+    if (!dir_is_open(des))
         return api_return_errno(API_EBADF);
     int32_t offs;
     if (!api_pop_int32_end(&offs))
         return api_return_errno(API_EINVAL);
     if (tells[des] > offs)
     {
-        FRESULT fresult = f_rewinddir(dir);
+        FRESULT fresult = dir_rewinddir(des);
         if (fresult != FR_OK)
             return api_return_fresult(fresult);
         tells[des] = 0;
@@ -157,7 +199,7 @@ bool dir_api_seekdir(void)
     while (tells[des] < offs)
     {
         FILINFO fno;
-        FRESULT fresult = f_readdir(dir, &fno);
+        FRESULT fresult = dir_readdir(des, &fno);
         if (fresult != FR_OK)
             return api_return_fresult(fresult);
         tells[des]++;
@@ -171,10 +213,9 @@ bool dir_api_seekdir(void)
 bool dir_api_rewinddir(void)
 {
     unsigned des = API_A;
-    if (des >= DIR_MAX_OPEN)
+    if (des >= DIR_END)
         return api_return_errno(API_EINVAL);
-    DIR *dir = &dirs[des];
-    FRESULT fresult = f_rewinddir(dir);
+    FRESULT fresult = dir_rewinddir(des);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     tells[des] = 0;
@@ -186,7 +227,11 @@ bool dir_api_unlink(void)
 {
     TCHAR *path = (TCHAR *)&xstack[xstack_ptr];
     xstack_ptr = XSTACK_SIZE;
-    FRESULT fresult = f_unlink(path);
+    FRESULT fresult;
+    if (rfs_is_path(path))
+        fresult = rfs_unlink(path);
+    else
+        fresult = f_unlink(path);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
@@ -203,7 +248,11 @@ bool dir_api_rename(void)
     if (oldname == &xstack[XSTACK_SIZE])
         return api_return_errno(API_EINVAL);
     oldname++;
-    FRESULT fresult = f_rename((TCHAR *)oldname, (TCHAR *)newname);
+    FRESULT fresult;
+    if (rfs_is_path((TCHAR *)oldname))
+        fresult = rfs_rename((TCHAR *)oldname, (TCHAR *)newname);
+    else
+        fresult = f_rename((TCHAR *)oldname, (TCHAR *)newname);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
@@ -246,7 +295,11 @@ bool dir_api_mkdir(void)
 {
     TCHAR *path = (TCHAR *)&xstack[xstack_ptr];
     xstack_ptr = XSTACK_SIZE;
-    FRESULT fresult = f_mkdir(path);
+    FRESULT fresult;
+    if (rfs_is_path(path))
+        fresult = rfs_mkdir(path);
+    else
+        fresult = f_mkdir(path);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
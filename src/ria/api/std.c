@@ -10,6 +10,7 @@
 #include "sys/pix.h"
 #include "sys/rln.h"
 #include "net/mdm.h"
+#include "net/rfs.h"
 #include "fatfs/ff.h"
 #include <stdio.h>
 
@@ -27,7 +28,9 @@ FIL std_fil[STD_FIL_MAX];
 #define STD_FIL_STDERR 2
 #define STD_FIL_MODEM 3
 #define STD_FIL_OFFS 4
-static_assert(STD_FIL_MAX + STD_FIL_OFFS < 128);
+#define STD_FIL_NET (STD_FIL_OFFS + STD_FIL_MAX)
+#define STD_FIL_END (STD_FIL_NET + RFS_FIL_MAX)
+static_assert(STD_FIL_END < 128);
 
 static int32_t std_count_xram;
 static int32_t std_count_std;
@@ -73,6 +76,14 @@ bool std_api_open(void)
                 mode |= FA_OPEN_ALWAYS;
         }
     }
+    if (rfs_is_path(path))
+    {
+        int net_fd;
+        FRESULT fresult = rfs_open(&net_fd, path, mode);
+        if (fresult != FR_OK)
+            return api_return_fresult(fresult);
+        return api_return_ax(net_fd + STD_FIL_NET);
+    }
     int fd = 0;
     for (; fd < STD_FIL_MAX; fd++)
         if (!std_fil[fd].obj.fs)
@@ -96,10 +107,13 @@ bool std_api_close(void)
         else
             return api_return_fresult(FR_INVALID_OBJECT);
     }
-    if (fd < STD_FIL_OFFS || fd >= STD_FIL_MAX + STD_FIL_OFFS)
+    if (fd < STD_FIL_OFFS || fd >= STD_FIL_END)
         return api_return_errno(API_EINVAL);
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
-    FRESULT fresult = f_close(fp);
+    FRESULT fresult;
+    if (fd >= STD_FIL_NET)
+        fresult = rfs_close(fd - STD_FIL_NET);
+    else
+        fresult = f_close(&std_fil[fd - STD_FIL_OFFS]);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
@@ -188,7 +202,7 @@ bool std_api_read_xstack(void)
         int16_t fd = API_A;
         if (!api_pop_uint16_end(&count) ||
             (fd && fd < STD_FIL_MODEM) ||
-            fd >= STD_FIL_MAX + STD_FIL_OFFS ||
+            fd >= STD_FIL_END ||
             count > XSTACK_SIZE)
             return api_return_errno(API_EINVAL);
         buf = &xstack[XSTACK_SIZE - count];
@@ -203,9 +217,12 @@ bool std_api_read_xstack(void)
             std_count_moved = 0;
             return api_working();
         }
-        FIL *fp = &std_fil[fd - STD_FIL_OFFS];
         UINT br;
-        FRESULT fresult = f_read(fp, buf, count, &br);
+        FRESULT fresult;
+        if (fd >= STD_FIL_NET)
+            fresult = rfs_read(fd - STD_FIL_NET, buf, count, &br);
+        else
+            fresult = f_read(&std_fil[fd - STD_FIL_OFFS], buf, count, &br);
         std_count_moved = br;
         if (fresult != FR_OK)
             return api_return_fresult(fresult);
@@ -267,7 +284,7 @@ bool std_api_read_xram(void)
     if (!api_pop_uint16(&count) ||
         !api_pop_uint16_end(&xram_addr) ||
         (fd && fd < STD_FIL_MODEM) ||
-        fd >= STD_FIL_MAX + STD_FIL_OFFS)
+        fd >= STD_FIL_END)
         return api_return_errno(API_EINVAL);
     std_buf_ptr = (char *)&xram[xram_addr];
     if (fd == STD_FIL_STDIN)
@@ -285,9 +302,12 @@ bool std_api_read_xram(void)
         count = 0x7FFF;
     if (std_buf_ptr + count > (char *)xram + 0x10000)
         return api_return_errno(API_EINVAL);
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
     UINT br;
-    FRESULT fresult = f_read(fp, std_buf_ptr, count, &br);
+    FRESULT fresult;
+    if (fd >= STD_FIL_NET)
+        fresult = rfs_read(fd - STD_FIL_NET, std_buf_ptr, count, &br);
+    else
+        fresult = f_read(&std_fil[fd - STD_FIL_OFFS], std_buf_ptr, count, &br);
     if (fresult == FR_OK)
         api_set_ax(br);
     else
@@ -338,7 +358,7 @@ bool std_api_write_xstack(void)
         return std_mdm_write();
     uint16_t count;
     int fd = API_A;
-    if (fd == STD_FIL_STDIN || fd >= STD_FIL_MAX + STD_FIL_OFFS)
+    if (fd == STD_FIL_STDIN || fd >= STD_FIL_END)
         return api_return_errno(API_EINVAL);
     count = XSTACK_SIZE - xstack_ptr;
     std_count_moved = 0;
@@ -354,9 +374,12 @@ bool std_api_write_xstack(void)
         std_count_std = count;
         return api_working();
     }
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
     UINT bw;
-    FRESULT fresult = f_write(fp, std_buf_ptr, count, &bw);
+    FRESULT fresult;
+    if (fd >= STD_FIL_NET)
+        fresult = rfs_write(fd - STD_FIL_NET, std_buf_ptr, count, &bw);
+    else
+        fresult = f_write(&std_fil[fd - STD_FIL_OFFS], std_buf_ptr, count, &bw);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(bw);
@@ -371,7 +394,7 @@ bool std_api_write_xram(void)
     uint16_t xram_addr;
     uint16_t count;
     int fd = API_A;
-    if (fd == STD_FIL_STDIN || fd >= STD_FIL_MAX + STD_FIL_OFFS)
+    if (fd == STD_FIL_STDIN || fd >= STD_FIL_END)
         return api_return_errno(API_EINVAL);
     if (!api_pop_uint16(&count) ||
         !api_pop_uint16_end(&xram_addr))
@@ -392,9 +415,12 @@ bool std_api_write_xram(void)
         std_count_std = count;
         return api_working();
     }
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
     UINT bw;
-    FRESULT fresult = f_write(fp, std_buf_ptr, count, &bw);
+    FRESULT fresult;
+    if (fd >= STD_FIL_NET)
+        fresult = rfs_write(fd - STD_FIL_NET, std_buf_ptr, count, &bw);
+    else
+        fresult = f_write(&std_fil[fd - STD_FIL_OFFS], std_buf_ptr, count, &bw);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(bw);
@@ -407,23 +433,24 @@ static bool std_api_lseek(int set, int cur, int end)
     int32_t ofs;
     int fd = API_A;
     if (fd < STD_FIL_OFFS ||
-        fd >= STD_FIL_MAX + STD_FIL_OFFS ||
+        fd >= STD_FIL_END ||
         !api_pop_int8(&whence) ||
         !api_pop_int32_end(&ofs))
         return api_return_errno(API_EINVAL);
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
+    bool net = fd >= STD_FIL_NET;
+    FIL *fp = net ? NULL : &std_fil[fd - STD_FIL_OFFS];
     if (whence == set)
         ; /* noop */
     else if (whence == cur)
-        ofs += f_tell(fp);
+        ofs += net ? rfs_tell(fd - STD_FIL_NET) : f_tell(fp);
     else if (whence == end)
-        ofs += f_size(fp);
+        ofs += net ? rfs_size(fd - STD_FIL_NET) : f_size(fp);
     else
         return api_return_errno(API_EINVAL);
-    FRESULT fresult = f_lseek(fp, ofs);
+    FRESULT fresult = net ? rfs_lseek(fd - STD_FIL_NET, ofs) : f_lseek(fp, ofs);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
-    FSIZE_t pos = f_tell(fp);
+    FSIZE_t pos = net ? rfs_tell(fd - STD_FIL_NET) : f_tell(fp);
     // Beyond 2GB is darkness.
     if (pos > 0x7FFFFFFF)
         pos = 0x7FFFFFFF;
@@ -444,15 +471,28 @@ bool std_api_lseek_llvm(void)
 bool std_api_syncfs(void)
 {
     int fd = API_A;
-    if (fd < STD_FIL_OFFS || fd >= STD_FIL_MAX + STD_FIL_OFFS)
+    if (fd < STD_FIL_OFFS || fd >= STD_FIL_END)
         return api_return_errno(API_EINVAL);
-    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
-    FRESULT fresult = f_sync(fp);
+    FRESULT fresult;
+    if (fd >= STD_FIL_NET)
+        fresult = rfs_sync(fd - STD_FIL_NET);
+    else
+        fresult = f_sync(&std_fil[fd - STD_FIL_OFFS]);
     if (fresult != FR_OK)
         return api_return_fresult(fresult);
     return api_return_ax(0);
 }
 
+FIL *std_get_fil(int fd)
+{
+    if (fd < STD_FIL_OFFS || fd >= STD_FIL_MAX + STD_FIL_OFFS)
+        return NULL;
+    FIL *fp = &std_fil[fd - STD_FIL_OFFS];
+    if (!fp->obj.fs)
+        return NULL;
+    return fp;
+}
+
 void std_run(void)
 {
     std_count_xram = -1;
@@ -471,4 +511,6 @@ void std_stop(void)
     for (int i = 0; i < STD_FIL_MAX; i++)
         if (std_fil[i].obj.fs)
             f_close(&std_fil[i]);
+    for (int i = 0; i < RFS_FIL_MAX; i++)
+        rfs_close(i);
 }
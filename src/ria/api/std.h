@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "fatfs/ff.h"
 
 /* Main events
  */
@@ -34,4 +35,10 @@ bool std_api_lseek_llvm(void);
 bool std_api_syncfs(void);
 bool std_api_stdin_opt(void);
 
+/* Utility
+ */
+
+// Open FatFs file for a 6502 file descriptor, NULL if not open.
+FIL *std_get_fil(int fd);
+
 #endif /* _RIA_API_STD_H_ */
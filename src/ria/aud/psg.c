@@ -291,3 +291,36 @@ bool psg_xreg(uint16_t word)
     }
     return true;
 }
+
+#ifdef RIA_BENCHMARK
+#include <pico/time.h>
+#include <stdio.h>
+#include <string.h>
+
+// Runs one second of the IRQ with every channel playing and
+// reports its share of a core. Run before audio starts.
+void psg_benchmark(void)
+{
+    const uint16_t xaddr = 0x10000 - PSG_CHANNELS * sizeof(struct psg_channel);
+    struct psg_channel *channels = (void *)&xram[xaddr];
+    for (unsigned i = 0; i < PSG_CHANNELS; i++)
+        channels[i] = (struct psg_channel){
+            .freq = (440 + i * 110) * 3,
+            .duty = 128,
+            .wave_release = (i % 5) << 4,
+            .pan_gate = 0x01,
+        };
+    psg_xaddr = xaddr;
+    uint64_t start = time_us_64();
+    for (unsigned n = 0; n < PSG_RATE; n++)
+        psg_irq_handler();
+    uint32_t us = time_us_64() - start;
+    psg_xaddr = 0xFFFF;
+    memset(psg_channel_state, 0, sizeof(psg_channel_state));
+    // The VGA never saw these writes, leave XRAM zeroed like it.
+    memset(channels, 0, PSG_CHANNELS * sizeof(struct psg_channel));
+    printf("PSG IRQ    %6lu ns, %lu.%lu%% of a core\n",
+           (unsigned long)((uint64_t)us * 1000 / PSG_RATE),
+           (unsigned long)(us / 10000), (unsigned long)(us / 1000 % 10));
+}
+#endif
@@ -19,4 +19,8 @@
 
 bool psg_xreg(uint16_t word);
 
+#ifdef RIA_BENCHMARK
+void psg_benchmark(void);
+#endif
+
 #endif /* _RIA_AUD_PSG_H_ */
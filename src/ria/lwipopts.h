@@ -3,21 +3,42 @@
 
 // see https://www.nongnu.org/lwip/2_1_x/group__lwip__opts.html for details
 
+// The TCP profile is chosen by the build, see RP6502_NET_THROUGHPUT.
+#ifdef RP6502_NET_THROUGHPUT
+// Full Ethernet frames and a deep window for bulk transfers.
+#define LWP_PROFILE_NAME            "throughput"
+#define MEM_SIZE                    (16 * 1024)
+#define MEMP_NUM_TCP_SEG            32
+#define PBUF_POOL_SIZE              24
+#define TCP_MSS                     1460
+#define TCP_WND                     (8 * TCP_MSS)
+#else
+// Does not fragment, small pool footprint.
+#define LWP_PROFILE_NAME            "low memory"
+#define MEM_SIZE                    (4 * 1024)
+#define MEMP_NUM_TCP_SEG            16
+#define PBUF_POOL_SIZE              16
+#define TCP_MSS                     536
+#define TCP_WND                     (4 * TCP_MSS)
+#endif
+#define TCP_SND_BUF                 TCP_WND
+#define TCP_SND_QUEUELEN            ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
+
+// Every TCP user may be connected at once: the modem call,
+// the telnet caller queue, NET0:, HTTP, MQTT, the remote
+// screen and iperf. Two spare for a refused caller and
+// connections still closing.
+#define LWP_TEL_CALLERS_MAX         4
+#define MEMP_NUM_TCP_PCB            (1 + LWP_TEL_CALLERS_MAX + 5 + 2)
+
 #define NO_SYS                      1
 #define LWIP_SOCKET                 0
 #define MEM_LIBC_MALLOC             0
 #define MEM_ALIGNMENT               4
-#define MEM_SIZE                    (4 * 1024)
-#define MEMP_NUM_TCP_SEG            16
-#define PBUF_POOL_SIZE              16
 #define LWIP_ARP                    1
 #define LWIP_ETHERNET               1
 #define LWIP_ICMP                   1
 #define LWIP_RAW                    1
-#define TCP_MSS                     536
-#define TCP_WND                     (4 * TCP_MSS)
-#define TCP_SND_BUF                 (4 * TCP_MSS)
-#define TCP_SND_QUEUELEN            ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
 #define LWIP_NETIF_STATUS_CALLBACK  1
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_HOSTNAME         1
@@ -32,14 +53,33 @@
 #define LWIP_TCP                    1
 #define LWIP_UDP                    1
 #define LWIP_DNS                    1
+#define DNS_TABLE_SIZE              16
+#define DNS_MAX_NAME_LENGTH         128
+#define LWIP_DNS_SUPPORT_MDNS_QUERIES 1
+#define LWIP_IGMP                   1
+#define LWIP_MDNS_RESPONDER         1
+#define LWIP_NUM_NETIF_CLIENT_DATA  1
+#define MDNS_MAX_SERVICES           2
+#define MEMP_NUM_UDP_PCB            6
+#define MEMP_NUM_SYS_TIMEOUT        (LWIP_NUM_SYS_TIMEOUT_INTERNAL + 8)
 #define LWIP_TCP_KEEPALIVE          1
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
 #define DHCP_DOES_ARP_CHECK         0
 #define LWIP_DHCP_DOES_ACD_CHECK    0
 
+// TCP counters for STATUS NET, nothing else is counted
+#define LWIP_STATS                  1
+#define MIB2_STATS                  1
+#define TCP_STATS                   1
+#define ETHARP_STATS                0
+#define IP_STATS                    0
+#define IPFRAG_STATS                0
+#define ICMP_STATS                  0
+#define IGMP_STATS                  0
+#define UDP_STATS                   0
+
 #ifndef NDEBUG
 #define LWIP_DEBUG                  1
-#define LWIP_STATS                  1
 #define LWIP_STATS_DISPLAY          1
 #endif
 
@@ -20,11 +20,17 @@
 #include "mon/mon.h"
 #include "mon/ram.h"
 #include "mon/rom.h"
+#include "mon/snp.h"
 #include "net/ble.h"
 #include "net/cyw.h"
+#include "net/htc.h"
+#include "net/mdn.h"
 #include "net/mdm.h"
 #include "net/mq.h"
+#include "net/nst.h"
 #include "net/ntp.h"
+#include "net/rsv.h"
+#include "net/scr.h"
 #include "net/wfi.h"
 #include "sys/com.h"
 #include "sys/cfg.h"
@@ -32,10 +38,14 @@
 #include "sys/led.h"
 #include "sys/lfs.h"
 #include "sys/pix.h"
+#include "sys/prf.h"
 #include "sys/ria.h"
 #include "sys/rln.h"
+#include "sys/stk.h"
 #include "sys/sys.h"
+#include "sys/trc.h"
 #include "sys/vga.h"
+#include "usb/msc.h"
 #include "usb/usb.h"
 #include "usb/xin.h"
 
@@ -49,6 +59,9 @@
 // Initialization event for power up, reboot command, or reboot button.
 static void init(void)
 {
+    // Paint stacks before core 1 launches.
+    stk_init();
+
     // Bring up stdio dispatcher first.
     com_init();
 
@@ -57,14 +70,17 @@ static void init(void)
     ria_init();
     pix_init();
     vga_init(); // Must be after PIX
+    sys_boot_mark("gpio");
 
     // Load config before we continue.
     lfs_init();
     cfg_init(); // Config stored on lfs
+    sys_boot_mark("config");
 
     // Print startup message after setting code page.
     oem_init();
     sys_init(); // This clears screen
+    sys_boot_mark("console");
 
     // Misc device drivers, add yours here.
     usb_init();
@@ -73,10 +89,20 @@ static void init(void)
     kbd_init();
     mou_init();
     pad_init();
-    rom_init();
     clk_init();
     mdm_init();
     mq_init();
+    scr_init();
+    sys_boot_mark("init");
+
+#ifdef RIA_BENCHMARK
+    api_benchmark();
+    psg_benchmark();
+#endif
+
+    // Start loading the boot ROM last. Radio power up and USB
+    // drive mounts wait until it's running, see rom_booting().
+    rom_init();
 }
 
 // Task events are repeatedly called by the main loop.
@@ -95,13 +121,19 @@ void main_task(void)
     vga_task();
     com_task();
     wfi_task();
+    rsv_task();
+    mdn_task();
     ntp_task();
+    clk_task();
     xin_task();
     ble_task();
     led_task();
     mdm_task();
     mq_task();
+    scr_task();
+    nst_task();
     ram_task();
+    prf_task();
 }
 
 // Tasks that call FatFs should be here instead of main_task().
@@ -112,6 +144,10 @@ static void task(void)
     rln_task();
     fil_task();
     rom_task();
+    snp_task();
+    htc_task();
+    msc_task();
+    cfg_task();
 }
 
 // Event to start running the 6502.
@@ -123,8 +159,12 @@ static void run(void)
     vga_run();
     api_run();
     clk_run();
+    prf_run();
+    trc_run();
+    snp_run();
     ria_run(); // Must be immediately before cpu
     cpu_run(); // Must be last
+    sys_boot_mark("6502");
 }
 
 // Event to stop the 6502.
@@ -132,6 +172,7 @@ static void stop(void)
 {
     cpu_stop(); // Must be first
     vga_stop(); // Must be before ria
+    snp_stop(); // Must be before ria and oem
     com_stop();
     api_stop();
     ria_stop();
@@ -142,9 +183,13 @@ static void stop(void)
     kbd_stop();
     mou_stop();
     pad_stop();
+    clk_stop();
     aud_stop();
     mdm_stop();
     mq_stop();
+    htc_stop();
+    nst_stop();
+    trc_stop();
 }
 
 // Event for CTRL-ALT-DEL and UART breaks.
@@ -155,6 +200,7 @@ static void break_(void) // break is keyword
     mon_break();
     ram_break();
     rom_break();
+    snp_break();
     vga_break();
     rln_break();
 }
@@ -200,6 +246,12 @@ bool main_xreg(uint8_t chan, uint8_t addr, uint16_t word)
     // Channel 1 for audio devices.
     case 0x100:
         return psg_xreg(word);
+    // Channel 2 for timers.
+    case 0x200:
+        return clk_xreg(word);
+    // Channel 3 for video.
+    case 0x300:
+        return vga_xreg(word);
     default:
         return false;
     }
@@ -224,6 +276,8 @@ bool main_api(uint8_t operation)
         return std_api_stdin_opt();
     case 0x06:
         return api_api_errno_opt();
+    case 0x0E:
+        return clk_api_get_time_us();
     case 0x0F:
         return clk_api_clock();
     case 0x10:
@@ -310,6 +364,20 @@ bool main_api(uint8_t operation)
         return mq_api_set_auth();
     case 0x3A:
         return mq_api_set_will();
+    case 0x3B:
+        return mq_api_bind();
+    case 0x3C:
+        return mq_api_unbind();
+    case 0x40:
+        return htc_api_request();
+    case 0x41:
+        return htc_api_sink();
+    case 0x42:
+        return htc_api_status();
+    case 0x43:
+        return htc_api_close();
+    case 0x44:
+        return nst_api_stats();
     }
     return api_return_errno(API_ENOSYS);
 }
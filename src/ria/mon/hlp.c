@@ -22,7 +22,7 @@ static const char __in_flash("helptext") hlp_text_help[] =
     "Commands:\n"
     "HELP (command|rom)  - This help or expanded help for command or rom.\n"
     "HELP ABOUT|SYSTEM   - About includes credits. System for general usage.\n"
-    "STATUS              - Show status of system and connected devices.\n"
+    "STATUS (NET)        - Show status of system and connected devices.\n"
     "SET (attr) (value)  - Change or show settings.\n"
     "LS (dir|drive)      - List contents of directory.\n"
     "CD (dir)            - Change or show current directory.\n"
@@ -38,6 +38,14 @@ static const char __in_flash("helptext") hlp_text_help[] =
     "UNLINK file|dir     - Delete a file or empty directory.\n"
     "UPLOAD file         - Write file. Binary chunks follow.\n"
     "BINARY addr len crc - Write memory. Binary data follows.\n"
+    "STACK               - Show stack and heap high-water marks.\n"
+    "PROFILE (ON|OFF)    - Sample the 6502 program counter.\n"
+    "TRACE (ON|OFF)      - Record 6502 accesses to RIA registers.\n"
+    "SNAPSHOT file       - Save memory and device state of the last program.\n"
+    "RESUME file         - Restore a snapshot and start the 6502.\n"
+#ifdef RP6502_RIA_W
+    "IPERF (0|1)         - Stop or start the iperf network benchmark server.\n"
+#endif
     "0000 (00 00 ...)    - Read or write memory.";
 
 static const char __in_flash("helptext") hlp_text_set[] =
@@ -55,7 +63,10 @@ static const char __in_flash("helptext") hlp_text_set[] =
     "SET RFCC (cc|-)     - Set country code for RF devices. \"-\" for worldwide.\n"
     "SET SSID (ssid|-)   - Set SSID for WiFi. \"-\" for none.\n"
     "SET PASS (pass|-)   - Set password for WiFi. \"-\" for none.\n"
-    "SET BLE (0|1|2)     - Disable or enable Bluetooth LE. 2 enables pairing."
+    "SET RFPM (0|1|2)    - Select WiFi power saving when no sockets are open.\n"
+    "SET BLE (0|1|2)     - Disable or enable Bluetooth LE. 2 enables pairing.\n"
+    "SET SCREEN (port)   - Serve the screen to a remote viewer. 0 for off.\n"
+    "SET NET0 (host|-)   - Set server for the NET0: volume. \"-\" for none."
 #endif
     "";
 
@@ -169,7 +180,34 @@ static const char __in_flash("helptext") hlp_text_binary[] =
     "You will return to a \"]\" prompt on success or \"?\" error on failure.";
 
 static const char __in_flash("helptext") hlp_text_status[] =
-    "STATUS will show the status of all hardware in and connected to the RIA.";
+    "STATUS will show the status of all hardware in and connected to the RIA.\n"
+    "STATUS NET shows network counters: bytes, rates, segments, retransmits and\n"
+    "zero window events, then each TCP connection and the modem and MQTT queues.";
+
+static const char __in_flash("helptext") hlp_text_stack[] =
+    "STACK shows the most stack each core has used since boot, the static RAM\n"
+    "size, and heap use. Check it before growing buffers or adding features.";
+
+static const char __in_flash("helptext") hlp_text_profile[] =
+    "PROFILE ON (hz) clears the samples and raises a 6502 IRQ at the given rate,\n"
+    "1000 by default, while programs run. The program must enable RIA IRQs and\n"
+    "install the sample handler from PROFILER.md. PROFILE OFF stops sampling.\n"
+    "PROFILE alone shows the hottest addresses. PROFILE SAVE file writes every\n"
+    "address and count for profile_report.py to match with a map file.";
+
+static const char __in_flash("helptext") hlp_text_trace[] =
+    "TRACE ON (range ...) records the time, address and data of 6502 accesses to\n"
+    "RIA registers, like \"TRACE ON FFE4-FFEB FFEF\". All registers by default.\n"
+    "The last 8192 accesses of the most recent run are kept. TRACE alone shows\n"
+    "the count, TRACE SAVE file writes them for trace_report.py, and TRACE OFF\n"
+    "frees the buffer. See BUS_TRACE.md for the file format.";
+
+static const char __in_flash("helptext") hlp_text_snapshot[] =
+    "SNAPSHOT file saves 6502 RAM, XRAM, XRAM port registers, the code page, the\n"
+    "program clock and every xreg the program sent to VGA, PSG and input devices.\n"
+    "RESUME file restores all of it and starts the 6502 at the reset vector. The\n"
+    "RIA can't see 6502 registers, so programs that want to continue where they\n"
+    "left off point $FFFC at a warm start. See SNAPSHOTS.md for details.";
 
 #define STR(x) #x
 #define XSTR(x) STR(x)
@@ -235,10 +273,36 @@ static const char __in_flash("helptext") hlp_text_set_ssid[] =
 static const char __in_flash("helptext") hlp_text_set_pass[] =
     "This is the password for your WiFi network. Use \"-\" to clear password.";
 
+static const char __in_flash("helptext") hlp_text_set_rfpm[] =
+    "SET RFPM selects WiFi power saving. While any TCP connection is open, power\n"
+    "saving is always off so replies are not held for the next beacon.\n"
+    "  0 - Off. Lowest latency, most power. This is the default.\n"
+    "  1 - Light. The radio naps between packets when idle.\n"
+    "  2 - Deep. The radio sleeps through beacons when idle.\n"
+    "Setting is saved on the RIA flash.";
+
 static const char __in_flash("helptext") hlp_text_set_ble[] =
     "Setting 0 disables Bluetooth LE. Setting 1 enables. Setting 2 enters pairing\n"
     "mode which will remain active until successful.";
 
+static const char __in_flash("helptext") hlp_text_set_screen[] =
+    "SET SCREEN port serves the screen to remote_screen.py over TCP, one viewer at\n"
+    "a time. It streams changed XRAM pages at most once per frame and the VGA\n"
+    "programming of the running program. 0 turns it off. Setting is saved on the\n"
+    "RIA flash. See REMOTE_SCREEN.md for the protocol.";
+
+static const char __in_flash("helptext") hlp_text_set_net0[] =
+    "SET NET0 host:port selects the computer running rfs_server.py. Programs then\n"
+    "open files with paths like \"NET0:/game.dat\" and the host directory is used\n"
+    "instead of USB storage. The port defaults to 6503. Use \"-\" for none. Setting\n"
+    "is saved on the RIA flash. See NET_VOLUME.md.";
+
+static const char __in_flash("helptext") hlp_text_iperf[] =
+    "IPERF 1 starts an iperf 2 compatible TCP server on port 5001. Measure with\n"
+    "\"iperf -c <ip>\" from another computer, then IPERF shows the result.\n"
+    "IPERF 0 stops the server. STATUS shows the TCP profile the firmware was\n"
+    "built with.";
+
 #endif
 
 static struct
@@ -278,6 +342,14 @@ static struct
     {6, "upload", hlp_text_upload},
     {6, "unlink", hlp_text_unlink},
     {6, "binary", hlp_text_binary},
+    {5, "stack", hlp_text_stack},
+    {7, "profile", hlp_text_profile},
+    {5, "trace", hlp_text_trace},
+    {8, "snapshot", hlp_text_snapshot},
+    {6, "resume", hlp_text_snapshot},
+#ifdef RP6502_RIA_W
+    {5, "iperf", hlp_text_iperf},
+#endif
 };
 static const size_t COMMANDS_COUNT = sizeof COMMANDS / sizeof *COMMANDS;
 
@@ -298,7 +370,10 @@ static struct
     {4, "rfcc", hlp_text_set_rfcc},
     {4, "ssid", hlp_text_set_ssid},
     {4, "pass", hlp_text_set_pass},
+    {4, "rfpm", hlp_text_set_rfpm},
     {3, "ble", hlp_text_set_ble},
+    {6, "screen", hlp_text_set_screen},
+    {4, "net0", hlp_text_set_net0},
 #endif
 };
 static const size_t SETTINGS_COUNT = sizeof SETTINGS / sizeof *SETTINGS;
@@ -11,10 +11,15 @@
 #include "mon/ram.h"
 #include "mon/rom.h"
 #include "mon/set.h"
+#include "mon/snp.h"
 #include "mon/str.h"
 #include "net/cyw.h"
+#include "net/lwp.h"
+#include "sys/prf.h"
 #include "sys/rln.h"
+#include "sys/stk.h"
 #include "sys/sys.h"
+#include "sys/trc.h"
 #include <pico.h>
 #include <stdio.h>
 #include <strings.h>
@@ -55,6 +60,14 @@ static struct
     {6, "upload", fil_mon_upload},
     {6, "unlink", fil_mon_unlink},
     {6, "binary", ram_mon_binary},
+    {5, "stack", stk_mon_stack},
+    {7, "profile", prf_mon_profile},
+    {5, "trace", trc_mon_trace},
+    {8, "snapshot", snp_mon_snapshot},
+    {6, "resume", snp_mon_resume},
+#ifdef RP6502_RIA_W
+    {5, "iperf", lwp_mon_iperf},
+#endif
 };
 static const size_t COMMANDS_COUNT = sizeof COMMANDS / sizeof *COMMANDS;
 
@@ -147,6 +160,7 @@ static bool mon_suspended(void)
            // task so we can't use only main_active().
            ram_active() ||
            rom_active() ||
+           snp_active() ||
            fil_active();
 }
 
@@ -35,6 +35,7 @@ static uint32_t rom_addr;
 static uint32_t rom_len;
 static bool rom_FFFC;
 static bool rom_FFFD;
+static bool rom_is_booting;
 static bool is_reading_fat;
 static bool lfs_file_open;
 static lfs_file_t lfs_file;
@@ -418,7 +419,7 @@ void rom_init(void)
     // Try booting the set boot ROM
     char *boot = cfg_get_boot();
     size_t boot_len = strlen(boot);
-    rom_load_installed((char *)boot, boot_len);
+    rom_is_booting = rom_load_installed((char *)boot, boot_len);
 }
 
 void rom_task(void)
@@ -466,6 +467,13 @@ bool rom_active(void)
     return rom_state != ROM_IDLE;
 }
 
+bool rom_booting(void)
+{
+    if (rom_state == ROM_IDLE)
+        rom_is_booting = false;
+    return rom_is_booting;
+}
+
 void rom_break(void)
 {
     rom_state = ROM_IDLE;
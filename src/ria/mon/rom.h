@@ -25,6 +25,10 @@ void rom_break(void);
 // True when more work is pending.
 bool rom_active(void);
 
+// True until the boot ROM from cold start has loaded or failed.
+// Slow drivers wait for this so the 6502 starts sooner.
+bool rom_booting(void);
+
 /* Monitor commands
  */
 
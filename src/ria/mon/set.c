@@ -8,6 +8,7 @@
 #include "mon/set.h"
 #include "mon/str.h"
 #include "net/ble.h"
+#include "net/scr.h"
 #include "sys/cfg.h"
 #include "sys/lfs.h"
 
@@ -236,6 +237,30 @@ static void set_pass(const char *args, size_t len)
     set_print_pass();
 }
 
+static void set_print_rfpm(void)
+{
+    static const char *const names[] = {"off", "light when idle", "deep when idle"};
+    uint8_t rfpm = cfg_get_rfpm();
+    printf("RFPM: %u, %s\n", rfpm, names[rfpm]);
+}
+
+static void set_rfpm(const char *args, size_t len)
+{
+    uint32_t val;
+    if (len)
+    {
+        if (!str_parse_uint32(&args, &len, &val) ||
+            !str_parse_end(args, len) ||
+            val > UINT8_MAX ||
+            !cfg_set_rfpm(val))
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+    }
+    set_print_rfpm();
+}
+
 static void set_print_ble(void)
 {
     printf("BLE : %s%s%s\n",
@@ -263,6 +288,58 @@ static void set_ble(const char *args, size_t len)
     set_print_ble();
 }
 
+static void set_print_screen(void)
+{
+    uint16_t port = cfg_get_screen_port();
+    if (port)
+        printf("SCRN: port %u\n", port);
+    else
+        printf("SCRN: off\n");
+}
+
+static void set_screen(const char *args, size_t len)
+{
+    uint32_t val;
+    if (len)
+    {
+        if (!str_parse_uint32(&args, &len, &val) ||
+            !str_parse_end(args, len) ||
+            val > UINT16_MAX)
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+        cfg_set_screen_port(val);
+    }
+    set_print_screen();
+}
+
+static void set_print_net0(void)
+{
+    const char *server = cfg_get_net_volume();
+    printf("NET0: %s\n", strlen(server) ? server : "(none)");
+}
+
+static void set_net0(const char *args, size_t len)
+{
+    char server[65];
+    if (len)
+    {
+        if (args[0] == '-' && str_parse_end(++args, --len))
+        {
+            cfg_set_net_volume("");
+        }
+        else if (!str_parse_string(&args, &len, server, sizeof(server)) ||
+                 !str_parse_end(args, len) ||
+                 !cfg_set_net_volume(server))
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+    }
+    set_print_net0();
+}
+
 #endif
 
 static void set_print_time_zone(void)
@@ -325,7 +402,10 @@ static struct
     {4, "rfcc", set_rfcc},
     {4, "ssid", set_ssid},
     {4, "pass", set_pass},
+    {4, "rfpm", set_rfpm},
     {3, "ble", set_ble},
+    {6, "screen", set_screen},
+    {4, "net0", set_net0},
 #endif
 };
 static const size_t SETTERS_COUNT = sizeof SETTERS / sizeof *SETTERS;
@@ -343,7 +423,10 @@ static void set_print_all(void)
     set_print_rfcc();
     set_print_ssid();
     set_print_pass();
+    set_print_rfpm();
     set_print_ble();
+    set_print_screen();
+    set_print_net0();
 #endif
 }
 
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "main.h"
+#include "api/api.h"
+#include "api/clk.h"
+#include "api/oem.h"
+#include "mon/snp.h"
+#include "sys/mem.h"
+#include "sys/pix.h"
+#include "sys/ria.h"
+#include <fatfs/ff.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(DEBUG_RIA_MON) || defined(DEBUG_RIA_MON_SNP)
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+#define SNP_MAGIC "RP6502S1"
+#define SNP_XREG_LOG_SIZE 2048
+
+// Every record is this header then PackBits data.
+typedef struct
+{
+    char tag[4];
+    uint32_t addr;
+    uint16_t len;  // unpacked
+    uint16_t size; // packed
+} snp_record_t;
+
+// Saved when a program stops.
+typedef struct
+{
+    uint64_t clock_us;
+    uint16_t code_page;
+    uint16_t reserved[3];
+} snp_info_t;
+
+static enum {
+    SNP_IDLE,
+    SNP_SAVING_XRAM,
+    SNP_SAVING_RAM,
+    SNP_LOADING,
+    SNP_XRAM_WRITING,
+    SNP_RIA_WRITING,
+    SNP_RIA_VERIFYING,
+    SNP_REPLAYING,
+} snp_state;
+
+static FIL snp_fil;
+static uint32_t snp_addr;
+static uint32_t snp_len;
+static bool snp_resuming;
+static bool snp_replay_busy;
+static size_t snp_replay_pos;
+static snp_info_t snp_info;
+static uint8_t snp_regs[32];
+
+// Entries are a uint16_t length then the xstack image of an xreg call.
+static uint8_t snp_xreg_log[SNP_XREG_LOG_SIZE];
+static size_t snp_xreg_log_len;
+static bool snp_xreg_log_full;
+static uint32_t snp_xreg_log_version;
+
+// Worst case PackBits adds one byte per 128.
+static uint8_t snp_packed[SNP_XREG_LOG_SIZE + SNP_XREG_LOG_SIZE / 128];
+
+// PackBits. n of 0-127 copies n+1 bytes, 129-255 repeats one byte 257-n times.
+size_t snp_pack(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    size_t out = 0;
+    size_t i = 0;
+    while (i < len)
+    {
+        size_t run = 1;
+        while (i + run < len && run < 128 && src[i + run] == src[i])
+            run++;
+        if (run > 2)
+        {
+            dst[out++] = 257 - run;
+            dst[out++] = src[i];
+            i += run;
+            continue;
+        }
+        size_t lit = 0;
+        while (i + lit < len && lit < 128)
+        {
+            if (i + lit + 2 < len &&
+                src[i + lit] == src[i + lit + 1] &&
+                src[i + lit] == src[i + lit + 2])
+                break;
+            lit++;
+        }
+        dst[out++] = lit - 1;
+        memcpy(&dst[out], &src[i], lit);
+        out += lit;
+        i += lit;
+    }
+    return out;
+}
+
+static bool snp_unpack(const uint8_t *src, size_t size, uint8_t *dst, size_t len)
+{
+    size_t in = 0;
+    size_t out = 0;
+    while (in < size)
+    {
+        size_t n = src[in++];
+        if (n < 128)
+        {
+            if (in + n + 1 > size || out + n + 1 > len)
+                return false;
+            memcpy(&dst[out], &src[in], n + 1);
+            in += n + 1;
+            out += n + 1;
+        }
+        else if (n > 128)
+        {
+            if (in >= size || out + 257 - n > len)
+                return false;
+            memset(&dst[out], src[in++], 257 - n);
+            out += 257 - n;
+        }
+    }
+    return out == len;
+}
+
+// Value an xreg call sends to addr, 0 if it doesn't.
+static uint16_t snp_call_word(const uint8_t *call, size_t len, uint8_t addr)
+{
+    uint8_t first = call[len - 3];
+    size_t count = (len - 3) / 2;
+    if (addr < first || addr >= first + count)
+        return 0;
+    size_t i = first + count - 1 - addr;
+    return call[i * 2] | call[i * 2 + 1] << 8;
+}
+
+// VGA modes are programmed once per plane, so the plane is part
+// of the key. Its register moves with the mode number.
+static uint16_t snp_call_plane(const uint8_t *call, size_t len)
+{
+    if (call[len - 1] != PIX_DEVICE_VGA || call[len - 2] != 0)
+        return 0;
+    uint16_t mode = snp_call_word(call, len, 1);
+    return snp_call_word(call, len, mode == 0 ? 2 : mode == 4 ? 5 : 4);
+}
+
+// Later calls replace earlier ones to the same registers.
+static bool snp_call_replaces(const uint8_t *call, size_t len,
+                              const uint8_t *old, size_t old_len)
+{
+    bool canvas = call[len - 1] == PIX_DEVICE_VGA &&
+                  call[len - 2] == 0 && call[len - 3] == 0;
+    if (canvas && old[old_len - 1] == PIX_DEVICE_VGA && old[old_len - 2] == 0)
+        return true;
+    return len == old_len &&
+           !memcmp(&call[len - 3], &old[old_len - 3], 3) &&
+           snp_call_plane(call, len) == snp_call_plane(old, old_len);
+}
+
+void snp_xreg(const uint8_t *call, size_t len)
+{
+    if (snp_state == SNP_REPLAYING)
+        return;
+    snp_xreg_log_version++;
+    size_t pos = 0;
+    while (pos < snp_xreg_log_len)
+    {
+        size_t old_len = snp_xreg_log[pos] | snp_xreg_log[pos + 1] << 8;
+        size_t next = pos + 2 + old_len;
+        if (snp_call_replaces(call, len, &snp_xreg_log[pos + 2], old_len))
+        {
+            memmove(&snp_xreg_log[pos], &snp_xreg_log[next], snp_xreg_log_len - next);
+            snp_xreg_log_len -= next - pos;
+        }
+        else
+            pos = next;
+    }
+    if (snp_xreg_log_len + 2 + len > SNP_XREG_LOG_SIZE)
+    {
+        snp_xreg_log_full = true;
+        return;
+    }
+    snp_xreg_log[snp_xreg_log_len++] = len;
+    snp_xreg_log[snp_xreg_log_len++] = len >> 8;
+    memcpy(&snp_xreg_log[snp_xreg_log_len], call, len);
+    snp_xreg_log_len += len;
+}
+
+const uint8_t *snp_get_xreg_log(size_t *len, uint32_t *version)
+{
+    *len = snp_xreg_log_len;
+    *version = snp_xreg_log_version;
+    return snp_xreg_log;
+}
+
+static bool snp_write(const char *tag, uint32_t addr, const uint8_t *data, size_t len)
+{
+    snp_record_t record;
+    memcpy(record.tag, tag, sizeof(record.tag));
+    record.addr = addr;
+    record.len = len;
+    record.size = snp_pack(data, len, snp_packed);
+    UINT bw;
+    FRESULT result = f_write(&snp_fil, &record, sizeof(record), &bw);
+    if (result == FR_OK && record.size)
+        result = f_write(&snp_fil, snp_packed, record.size, &bw);
+    if (result != FR_OK)
+    {
+        printf("?Unable to write file (%d)\n", result);
+        snp_state = SNP_IDLE;
+        return false;
+    }
+    return true;
+}
+
+static bool snp_action_is_finished(void)
+{
+    if (ria_active())
+        return false;
+    if (ria_print_error_message())
+    {
+        snp_state = SNP_IDLE;
+        return false;
+    }
+    return true;
+}
+
+static void snp_saving_xram(void)
+{
+    if (!snp_write("XRAM", snp_addr, &xram[snp_addr - 0x10000], MBUF_SIZE))
+        return;
+    snp_addr += MBUF_SIZE;
+    if (snp_addr < 0x20000)
+        return;
+    snp_state = SNP_SAVING_RAM;
+    snp_addr = 0;
+    mbuf_len = MBUF_SIZE;
+    ria_read_buf(snp_addr);
+}
+
+static void snp_saving_ram(void)
+{
+    if (!snp_action_is_finished())
+        return;
+    if (!snp_write("RAM_", snp_addr, mbuf, MBUF_SIZE))
+        return;
+    snp_addr += MBUF_SIZE;
+    if (snp_addr < 0x10000)
+    {
+        mbuf_len = MBUF_SIZE;
+        ria_read_buf(snp_addr);
+        return;
+    }
+    if (!snp_write("XREG", 0, snp_xreg_log, snp_xreg_log_len) ||
+        !snp_write("END_", 0, NULL, 0))
+        return;
+    snp_state = SNP_IDLE;
+    FRESULT result = f_close(&snp_fil);
+    if (result != FR_OK)
+        printf("?Unable to close file (%d)\n", result);
+    else if (snp_xreg_log_full)
+        printf("?Too many xregs, video and audio may not restore\n");
+    else
+        printf("Saved.\n");
+}
+
+static void snp_corrupt(void)
+{
+    printf("?Corrupt snapshot\n");
+    snp_state = SNP_IDLE;
+}
+
+static bool snp_read(const snp_record_t *record, uint8_t *dst, size_t max)
+{
+    if (record->len > max ||
+        !snp_unpack(snp_packed, record->size, dst, record->len))
+    {
+        snp_corrupt();
+        return false;
+    }
+    return true;
+}
+
+static void snp_loading(void)
+{
+    snp_record_t record;
+    UINT br;
+    FRESULT result = f_read(&snp_fil, &record, sizeof(record), &br);
+    if (result == FR_OK && (br != sizeof(record) || record.size > sizeof(snp_packed)))
+        return snp_corrupt();
+    if (result == FR_OK)
+        result = f_read(&snp_fil, snp_packed, record.size, &br);
+    if (result != FR_OK)
+    {
+        printf("?Unable to read file (%d)\n", result);
+        snp_state = SNP_IDLE;
+        return;
+    }
+    if (br != record.size)
+        return snp_corrupt();
+    DBG("SNP %.4s $%05lX %u\n", record.tag, record.addr, record.len);
+    if (!memcmp(record.tag, "RAM_", 4))
+    {
+        if (!record.len || record.addr + record.len > 0x10000)
+            return snp_corrupt();
+        if (!snp_read(&record, mbuf, MBUF_SIZE))
+            return;
+        mbuf_len = record.len;
+        snp_addr = record.addr;
+        snp_state = SNP_RIA_WRITING;
+        ria_write_buf(snp_addr);
+    }
+    else if (!memcmp(record.tag, "XRAM", 4))
+    {
+        if (record.addr < 0x10000 || record.addr + record.len > 0x20000)
+            return snp_corrupt();
+        if (!snp_read(&record, mbuf, MBUF_SIZE))
+            return;
+        snp_addr = record.addr - 0x10000;
+        snp_len = record.len;
+        snp_state = SNP_XRAM_WRITING;
+    }
+    else if (!memcmp(record.tag, "REGS", 4))
+        snp_read(&record, snp_regs, sizeof(snp_regs));
+    else if (!memcmp(record.tag, "INFO", 4))
+        snp_read(&record, (uint8_t *)&snp_info, sizeof(snp_info));
+    else if (!memcmp(record.tag, "XREG", 4))
+    {
+        if (!snp_read(&record, snp_xreg_log, sizeof(snp_xreg_log)))
+            return;
+        snp_xreg_log_len = record.len;
+        snp_xreg_log_full = false;
+        snp_xreg_log_version++;
+        snp_replay_pos = 0;
+        snp_state = SNP_REPLAYING;
+    }
+    else if (!memcmp(record.tag, "END_", 4))
+    {
+        snp_state = SNP_IDLE;
+        f_close(&snp_fil);
+        oem_set_code_page(snp_info.code_page);
+        snp_resuming = true;
+        main_run();
+    }
+    // Unknown records are skipped.
+}
+
+static bool snp_xram_writing(void)
+{
+    while (snp_len && pix_ready())
+    {
+        uint32_t addr = snp_addr + --snp_len;
+        xram[addr] = mbuf[snp_len];
+        PIX_SEND_XRAM(addr, xram[addr]);
+    }
+    return !!snp_len;
+}
+
+// Replay through the API handler so VGA acks and
+// RIA devices work just as when the program ran.
+static void snp_replaying(void)
+{
+    if (snp_replay_busy)
+    {
+        if (pix_api_xreg())
+            return;
+        snp_replay_busy = false;
+        if (API_AX == 0xFFFF)
+            printf("?xreg replay failed\n");
+    }
+    if (snp_replay_pos >= snp_xreg_log_len)
+    {
+        snp_state = SNP_LOADING;
+        return;
+    }
+    size_t len = snp_xreg_log[snp_replay_pos] | snp_xreg_log[snp_replay_pos + 1] << 8;
+    if (len < 5 || len > XSTACK_SIZE || snp_replay_pos + 2 + len > snp_xreg_log_len)
+        return snp_corrupt();
+    xstack_ptr = XSTACK_SIZE - len;
+    memcpy(&xstack[xstack_ptr], &snp_xreg_log[snp_replay_pos + 2], len);
+    snp_replay_pos += 2 + len;
+    snp_replay_busy = true;
+}
+
+void snp_task(void)
+{
+    switch (snp_state)
+    {
+    case SNP_IDLE:
+        if (snp_fil.obj.fs)
+        {
+            FRESULT result = f_close(&snp_fil);
+            if (result != FR_OK)
+                printf("?Unable to close file (%d)\n", result);
+        }
+        break;
+    case SNP_SAVING_XRAM:
+        snp_saving_xram();
+        break;
+    case SNP_SAVING_RAM:
+        snp_saving_ram();
+        break;
+    case SNP_LOADING:
+        snp_loading();
+        break;
+    case SNP_XRAM_WRITING:
+        if (!snp_xram_writing())
+            snp_state = SNP_LOADING;
+        break;
+    case SNP_RIA_WRITING:
+        if (snp_action_is_finished())
+        {
+            snp_state = SNP_RIA_VERIFYING;
+            ria_verify_buf(snp_addr);
+        }
+        break;
+    case SNP_RIA_VERIFYING:
+        if (snp_action_is_finished())
+            snp_state = SNP_LOADING;
+        break;
+    case SNP_REPLAYING:
+        snp_replaying();
+        break;
+    }
+}
+
+// A fresh program starts a fresh xreg log. A resumed
+// program gets back its XRAM ports and clock.
+void snp_run(void)
+{
+    if (ria_active())
+        return;
+    if (!snp_resuming)
+    {
+        snp_xreg_log_len = 0;
+        snp_xreg_log_full = false;
+        snp_xreg_log_version++;
+        return;
+    }
+    snp_resuming = false;
+    for (uint32_t addr = 0xFFE4; addr <= 0xFFEB; addr++)
+        REGS(addr) = snp_regs[addr & 0x1F];
+    REGS(0xFFE4) = xram[REGSW(0xFFE6)];
+    REGS(0xFFE8) = xram[REGSW(0xFFEA)];
+    clk_set_clock_us(snp_info.clock_us);
+}
+
+// Monitor actions reset registers so keep what the program left.
+void snp_stop(void)
+{
+    if (ria_active())
+        return;
+    snp_info.clock_us = clk_get_clock_us();
+    snp_info.code_page = oem_get_code_page();
+    for (uint32_t i = 0; i < sizeof(snp_regs); i++)
+        snp_regs[i] = REGS(0xFFE0 + i);
+}
+
+void snp_break(void)
+{
+    snp_state = SNP_IDLE;
+    snp_replay_busy = false;
+    snp_resuming = false;
+}
+
+bool snp_active(void)
+{
+    return snp_state != SNP_IDLE;
+}
+
+void snp_mon_snapshot(const char *args, size_t len)
+{
+    (void)(len);
+    FRESULT result = f_open(&snp_fil, args, FA_CREATE_ALWAYS | FA_WRITE);
+    if (result != FR_OK)
+    {
+        printf("?Unable to open file (%d)\n", result);
+        return;
+    }
+    UINT bw;
+    result = f_write(&snp_fil, SNP_MAGIC, 8, &bw);
+    if (result != FR_OK)
+    {
+        printf("?Unable to write file (%d)\n", result);
+        return;
+    }
+    if (snp_write("INFO", 0, (uint8_t *)&snp_info, sizeof(snp_info)) &&
+        snp_write("REGS", 0xFFE0, snp_regs, sizeof(snp_regs)))
+    {
+        snp_addr = 0x10000;
+        snp_state = SNP_SAVING_XRAM;
+    }
+}
+
+void snp_mon_resume(const char *args, size_t len)
+{
+    (void)(len);
+    FRESULT result = f_open(&snp_fil, args, FA_READ);
+    if (result != FR_OK)
+    {
+        printf("?Unable to open file (%d)\n", result);
+        return;
+    }
+    char magic[8];
+    UINT br;
+    result = f_read(&snp_fil, magic, sizeof(magic), &br);
+    if (result != FR_OK || br != sizeof(magic) || memcmp(magic, SNP_MAGIC, sizeof(magic)))
+    {
+        printf("?Not a snapshot file\n");
+        return;
+    }
+    snp_state = SNP_LOADING;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_MON_SNP_H_
+#define _RIA_MON_SNP_H_
+
+/* Monitor commands to save and restore the whole machine.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void snp_task(void);
+void snp_run(void);
+void snp_stop(void);
+void snp_break(void);
+
+// True when more work is pending.
+bool snp_active(void);
+
+/* Utility
+ */
+
+// Pix calls this with the xstack image of every xreg call
+// so the device programming can be replayed on restore.
+void snp_xreg(const uint8_t *call, size_t len);
+
+// The xreg log as saved in snapshots. The version
+// changes every time the log does.
+const uint8_t *snp_get_xreg_log(size_t *len, uint32_t *version);
+
+// PackBits compress len bytes. dst needs len + len / 128 + 1 bytes.
+size_t snp_pack(const uint8_t *src, size_t len, uint8_t *dst);
+
+/* Monitor commands
+ */
+
+void snp_mon_snapshot(const char *args, size_t len);
+void snp_mon_resume(const char *args, size_t len);
+
+#endif /* _RIA_MON_SNP_H_ */
@@ -6,6 +6,7 @@
 
 #include "net/cmd.h"
 #include "net/mdm.h"
+#include "net/nst.h"
 #include "net/tel.h"
 #include "sys/cfg.h"
 #include "sys/mem.h"
@@ -30,6 +31,8 @@ static inline void DBG(const char *fmt, ...) { (void)fmt; }
 static int cmd_plus_cipstatus_response(char *buf, size_t buf_size, int state);
 static int cmd_plus_ciprecv_response(char *buf, size_t buf_size, int state);
 static int cmd_plus_cifsr_response(char *buf, size_t buf_size, int state);
+static int cmd_plus_cipserver_response(char *buf, size_t buf_size, int state);
+static int cmd_plus_netstats_response(char *buf, size_t buf_size, int state);
 
 // The design philosophy here is to use AT+XXX? and AT+XXX=YYY
 // for everything modern like WiFi and telnet configuration.
@@ -50,6 +53,18 @@ static int cmd_parse_num(const char **s)
     return num;
 }
 
+// A, A0
+static bool cmd_answer(const char **s)
+{
+    switch (cmd_parse_num(s))
+    {
+    case -1:
+    case 0:
+        return mdm_answer();
+    }
+    return false;
+}
+
 // D
 static bool cmd_dial(const char **s)
 {
@@ -152,7 +167,7 @@ static int cmd_s_query_response(char *buf, size_t buf_size, int state)
         val = mdm_settings.auto_answer;
         break;
     case 1:
-        val = 0; // TODO ring count
+        val = mdm_get_ring_count();
         break;
     case 2:
         val = mdm_settings.esc_char;
@@ -166,6 +181,9 @@ static int cmd_s_query_response(char *buf, size_t buf_size, int state)
     case 5:
         val = mdm_settings.bs_char;
         break;
+    case 15:
+        val = mdm_settings.telnet;
+        break;
     }
     snprintf(buf, buf_size, "%u\r\n", val);
     return -1;
@@ -185,6 +203,7 @@ static bool cmd_s_pointer(const char **s)
     case 3:
     case 4:
     case 5:
+    case 15:
         mdm_settings.s_pointer = num;
         return true;
     default:
@@ -223,6 +242,12 @@ static bool cmd_s_set(const char **s)
     case 5:
         mdm_settings.bs_char = num;
         return true;
+    case 15:
+        // 0 raw TCP, 1 telnet, 2 telnet on port 23
+        if (num > 2)
+            return false;
+        mdm_settings.telnet = num;
+        return true;
     default:
         return false;
     }
@@ -296,13 +321,14 @@ static int cmd_view_config_response(char *buf, size_t buf_size, int state)
                  mdm_settings.progress);
         break;
     case 2:
-        snprintf(buf, buf_size, "S0:%03u S1:%03u S2:%03u S3:%03u S4:%03u S5:%03u\r\n",
+        snprintf(buf, buf_size, "S0:%03u S1:%03u S2:%03u S3:%03u S4:%03u S5:%03u S15:%03u\r\n",
                  mdm_settings.auto_answer,
-                 0, // TODO ring counter
+                 mdm_get_ring_count(),
                  mdm_settings.esc_char,
                  mdm_settings.cr_char,
                  mdm_settings.lf_char,
-                 mdm_settings.bs_char);
+                 mdm_settings.bs_char,
+                 mdm_settings.telnet);
         break;
     case 3:
         snprintf(buf, buf_size, "\r\nSTORED PROFILE:\r\n");
@@ -317,12 +343,13 @@ static int cmd_view_config_response(char *buf, size_t buf_size, int state)
         break;
     case 5:
         mdm_read_settings(&nvr_settings);
-        snprintf(buf, buf_size, "S0:%03u S2:%03u S3:%03u S4:%03u S5:%03u\r\n",
+        snprintf(buf, buf_size, "S0:%03u S2:%03u S3:%03u S4:%03u S5:%03u S15:%03u\r\n",
                  nvr_settings.auto_answer,
                  nvr_settings.esc_char,
                  nvr_settings.cr_char,
                  nvr_settings.lf_char,
-                 nvr_settings.bs_char);
+                 nvr_settings.bs_char,
+                 nvr_settings.telnet);
         break;
     case 6:
         snprintf(buf, buf_size, "\r\nTELEPHONE NUMBERS:\r\n");
@@ -632,6 +659,34 @@ static bool cmd_parse_modern(const char **s)
         // We only support normal mode (0)
         return (mode == 0);
     }
+    // AT+CIPSERVER=<mode>[,<port>] - Listen for callers (ESP8266 compatible)
+    // mode=1: listen, default port 23, mode=0: stop
+    // Callers queue and RING until ATA or S0 auto-answer.
+    // AT+CIPSERVER? -> +CIPSERVER:<mode>,<port>
+    if (!strncasecmp(*s, "CIPSERVER", 9))
+    {
+        (*s) += 9;
+        if (**s == '?')
+        {
+            ++*s;
+            mdm_set_response_fn(cmd_plus_cipserver_response, 0);
+            return true;
+        }
+        if (**s != '=') return false;
+        ++*s;
+        int mode = cmd_parse_num(s);
+        int port = 23;
+        if (**s == ',')
+        {
+            ++*s;
+            port = cmd_parse_num(s);
+        }
+        if (mode == 0)
+            return tel_listen(0);
+        if (mode != 1 || port <= 0 || port > 65535)
+            return false;
+        return tel_listen(port);
+    }
     // Basic TCP commands (single connection) mapped onto existing modem/telnet stack.
     // AT+CIPSTART="TCP","host",port  (ESP8266 format)
     // AT+CIPSTART="host",port        (simplified format)
@@ -703,6 +758,15 @@ static bool cmd_parse_modern(const char **s)
         mdm_set_response_fn(cmd_plus_cipstatus_response, 0);
         return true;
     }
+    // AT+NETSTATS? -> network counters, same order as net_stats
+    if (!strncasecmp(*s, "NETSTATS", 8))
+    {
+        (*s) += 8;
+        if (**s != '?') return false;
+        ++*s;
+        mdm_set_response_fn(cmd_plus_netstats_response, 0);
+        return true;
+    }
     // AT+CIPSEND="text"  (sends raw text)
     if (!strncasecmp(*s, "CIPSEND", 7))
     {
@@ -744,6 +808,14 @@ static bool cmd_parse_modern(const char **s)
     return false;
 }
 
+static int cmd_plus_cipserver_response(char *buf, size_t buf_size, int state)
+{
+    (void)state;
+    unsigned port = tel_get_listen_port();
+    snprintf(buf, buf_size, "+CIPSERVER:%u,%u\r\n", port ? 1u : 0u, port);
+    return -1;
+}
+
 static int cmd_plus_cipstatus_response(char *buf, size_t buf_size, int state)
 {
     (void)state;
@@ -753,6 +825,25 @@ static int cmd_plus_cipstatus_response(char *buf, size_t buf_size, int state)
     return -1;
 }
 
+static int cmd_plus_netstats_response(char *buf, size_t buf_size, int state)
+{
+    (void)state;
+    nst_stats_t st;
+    nst_get_stats(&st);
+    snprintf(buf, buf_size,
+             "+NETSTATS:%lu,%lu,%lu,%lu,%lu,%lu,%lu,%u,%u,"
+             "%u,%u,%u,%u,%u,%u,%u,%d,%u,%u\r\n",
+             (unsigned long)st.bytes_in, (unsigned long)st.bytes_out,
+             (unsigned long)st.rate_in, (unsigned long)st.rate_out,
+             (unsigned long)st.segs_in, (unsigned long)st.segs_out,
+             (unsigned long)st.retransmits,
+             st.zero_win_remote, st.zero_win_local,
+             st.sockets, st.tel_pbufs, st.tel_pbufs_max, st.tel_callers,
+             st.tel_bytes, st.mq_bytes, st.mq_waiting, st.rssi,
+             st.mq_drops, st.mq_overflows);
+    return -1;
+}
+
 static int cmd_plus_ciprecv_response(char *buf, size_t buf_size, int state)
 {
     int remaining = state;
@@ -791,6 +882,8 @@ bool cmd_parse(const char **s)
     ++*s;
     switch (toupper(ch))
     {
+    case 'A':
+        return cmd_answer(s);
     case 'D':
         return cmd_dial(s);
     case 'E':
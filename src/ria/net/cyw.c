@@ -7,6 +7,7 @@
 #ifndef RP6502_RIA_W
 #include "net/cyw.h"
 void cyw_task() {}
+bool cyw_ready() { return false; }
 void cyw_pre_reclock() {}
 void cyw_post_reclock(uint32_t) {}
 void cyw_reset_radio() {}
@@ -15,7 +16,9 @@ void cyw_reset_radio() {}
 #include "net/ble.h"
 #include "net/cyw.h"
 #include "net/wfi.h"
+#include "mon/rom.h"
 #include "sys/cfg.h"
+#include "sys/sys.h"
 #include <pico/cyw43_arch.h>
 #include <pico/cyw43_driver.h>
 #include <pico/stdio.h>
@@ -87,6 +90,7 @@ static const char COUNTRY_CODES[] = {
 static bool cyw_led_status;
 static bool cyw_led_requested;
 static bool cyw_initialized;
+static bool cyw_powered;
 
 bool cyw_validate_country_code(char *cc)
 {
@@ -108,6 +112,19 @@ void cyw_reset_radio(void)
 
 void cyw_task(void)
 {
+    if (!cyw_initialized)
+        return;
+    if (!cyw_powered)
+    {
+        // The first driver call downloads firmware to the radio,
+        // which blocks. Let the boot ROM get going first.
+        if (rom_booting())
+            return;
+        cyw_led_status = cyw_led_requested;
+        cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, cyw_led_status);
+        cyw_powered = true;
+        sys_boot_mark("radio");
+    }
     if (cyw_led_requested != cyw_led_status)
     {
         cyw_led_status = cyw_led_requested;
@@ -130,6 +147,7 @@ void cyw_pre_reclock(void)
     if (cyw_initialized)
         cyw43_arch_deinit();
     cyw_initialized = false;
+    cyw_powered = false;
 }
 
 void cyw_post_reclock(uint32_t sys_clk_khz)
@@ -159,11 +177,15 @@ void cyw_post_reclock(uint32_t sys_clk_khz)
     else
     {
         // cyw43_arch is full of blocking functions.
-        // This seems to block only once after cyw43_arch_init.
-        cyw_led_status = cyw_led_requested;
-        cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, cyw_led_status);
+        // The first one after cyw43_arch_init powers up the
+        // radio, so cyw_task does that when it's convenient.
         cyw_initialized = true;
     }
 }
 
+bool cyw_ready(void)
+{
+    return cyw_powered;
+}
+
 #endif /* RP6502_RIA_W */
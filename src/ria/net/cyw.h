@@ -25,6 +25,9 @@ void cyw_post_reclock(uint32_t sys_clk_khz);
  */
 
 void cyw_led(bool ison);
+
+// True once the radio is powered up. Wi-Fi and BLE wait for this.
+bool cyw_ready(void);
 bool cyw_validate_country_code(char *cc);
 void cyw_reset_radio(void);
 
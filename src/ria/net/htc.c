@@ -0,0 +1,776 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/htc.h"
+void htc_task(void) {}
+void htc_stop(void) {}
+bool htc_api_request(void) { return false; }
+bool htc_api_sink(void) { return false; }
+bool htc_api_status(void) { return false; }
+bool htc_api_close(void) { return false; }
+#else
+
+#include "net/htc.h"
+#include "api/api.h"
+#include "api/std.h"
+#include "net/rsv.h"
+#include "sys/mem.h"
+#include "sys/pix.h"
+#include <lwip/tcp.h>
+#include <lwip/dns.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_HTC)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+#define HTC_HOST_MAX 128
+#define HTC_LINE_MAX 256
+#define HTC_REQ_MAX 512
+#define HTC_NO_ADDR 0xFFFF
+
+typedef enum
+{
+    htc_state_idle,
+    htc_state_dns_lookup,
+    htc_state_connecting,
+    htc_state_sending,
+    htc_state_headers,
+    htc_state_body,
+    htc_state_chunk_size,
+    htc_state_chunk_data,
+    htc_state_chunk_end,
+    htc_state_trailers,
+    htc_state_done,
+    htc_state_error,
+} htc_state_t;
+static htc_state_t htc_state;
+
+// State as seen by the 6502
+#define HTC_STATUS_IDLE 0
+#define HTC_STATUS_CONNECTING 1
+#define HTC_STATUS_SENDING 2
+#define HTC_STATUS_HEADERS 3
+#define HTC_STATUS_BODY 4
+#define HTC_STATUS_DONE 5
+#define HTC_STATUS_ERROR 0xFF
+
+// Progress registers in XRAM, little endian.
+// The 6502 owns tail, the RIA never writes it after the request starts.
+typedef struct __attribute__((packed))
+{
+    uint8_t state;
+    uint8_t flags; // bit 0 chunked, bit 1 keep-alive
+    uint16_t code;
+    uint32_t length; // 0xFFFFFFFF when unknown
+    uint32_t received;
+    uint16_t head;
+    uint16_t tail;
+} htc_status_t;
+
+// Connection, kept open between requests to the same host
+static struct tcp_pcb *htc_pcb;
+static bool htc_pcb_connected;
+static char htc_host[HTC_HOST_MAX];
+static u16_t htc_port;
+
+// Request
+static char htc_req[HTC_REQ_MAX];
+static u16_t htc_req_len;
+static u16_t htc_req_pos;
+static uint16_t htc_body_addr;
+static uint16_t htc_body_len;
+static uint16_t htc_body_pos;
+
+// Response
+static struct pbuf *htc_rx;
+static u16_t htc_rx_pos;
+static bool htc_rx_closed;
+static char htc_line[HTC_LINE_MAX];
+static u16_t htc_line_len;
+static uint16_t htc_code;
+static bool htc_chunked;
+static bool htc_keep_alive;
+static bool htc_has_length;
+static uint32_t htc_length;
+static uint32_t htc_remaining;
+static uint32_t htc_received;
+static api_errno htc_errno;
+static FRESULT htc_fresult;
+
+// Sink
+static FIL *htc_fil;
+static uint16_t htc_status_addr = HTC_NO_ADDR;
+static uint16_t htc_ring_addr;
+static uint16_t htc_ring_size;
+static uint16_t htc_ring_head;
+static uint16_t htc_pix_addr;
+static uint16_t htc_pix_count;
+
+// Unread data still opens the window for the next response.
+static void htc_rx_free(void)
+{
+    if (htc_rx)
+    {
+        if (htc_pcb)
+            tcp_recved(htc_pcb, htc_rx->tot_len - htc_rx_pos);
+        pbuf_free(htc_rx);
+    }
+    htc_rx = NULL;
+    htc_rx_pos = 0;
+}
+
+static void htc_disconnect(void)
+{
+    if (htc_pcb)
+    {
+        tcp_arg(htc_pcb, NULL);
+        tcp_recv(htc_pcb, NULL);
+        tcp_err(htc_pcb, NULL);
+        if (tcp_close(htc_pcb) != ERR_OK)
+        {
+            DBG("NET HTC tcp_close failed\n");
+            tcp_abort(htc_pcb);
+        }
+        htc_pcb = NULL;
+    }
+    htc_pcb_connected = false;
+    htc_rx_free();
+}
+
+static void htc_fail(api_errno err)
+{
+    DBG("NET HTC failed (%d)\n", err);
+    htc_errno = err;
+    htc_state = htc_state_error;
+    htc_disconnect();
+}
+
+static void htc_finish(void)
+{
+    DBG("NET HTC done, %lu bytes\n", (unsigned long)htc_received);
+    htc_state = htc_state_done;
+    if (!htc_keep_alive || htc_rx_closed)
+        htc_disconnect();
+    else
+        htc_rx_free(); // Anything extra is not ours
+    if (htc_fil)
+        f_sync(htc_fil);
+}
+
+static uint8_t htc_public_state(void)
+{
+    switch (htc_state)
+    {
+    case htc_state_idle:
+        return HTC_STATUS_IDLE;
+    case htc_state_dns_lookup:
+    case htc_state_connecting:
+        return HTC_STATUS_CONNECTING;
+    case htc_state_sending:
+        return HTC_STATUS_SENDING;
+    case htc_state_headers:
+        return HTC_STATUS_HEADERS;
+    case htc_state_done:
+        return HTC_STATUS_DONE;
+    case htc_state_error:
+        return HTC_STATUS_ERROR;
+    default:
+        return HTC_STATUS_BODY;
+    }
+}
+
+static void htc_status_update(void)
+{
+    if (htc_status_addr == HTC_NO_ADDR)
+        return;
+    htc_status_t status = {
+        .state = htc_public_state(),
+        .flags = (htc_chunked ? 1 : 0) | (htc_keep_alive ? 2 : 0),
+        .code = htc_code,
+        .length = htc_has_length ? htc_length : 0xFFFFFFFF,
+        .received = htc_received,
+        .head = htc_ring_head,
+    };
+    memcpy(&xram[htc_status_addr], &status, offsetof(htc_status_t, tail));
+}
+
+static uint16_t htc_ring_tail(void)
+{
+    uint16_t tail;
+    memcpy(&tail, &xram[htc_status_addr + offsetof(htc_status_t, tail)], sizeof(tail));
+    return tail;
+}
+
+// Mirror new ring data to the VGA.
+static void htc_mirror(void)
+{
+    for (; htc_pix_count && pix_ready(); --htc_pix_count, ++htc_pix_addr)
+        pix_send(PIX_DEVICE_XRAM, 0, xram[htc_pix_addr], htc_pix_addr);
+}
+
+// Deliver body bytes, returns how many were accepted.
+static u16_t htc_sink(const uint8_t *data, u16_t len)
+{
+    if (htc_fil)
+    {
+        UINT bw;
+        htc_fresult = f_write(htc_fil, data, len, &bw);
+        if (htc_fresult != FR_OK)
+        {
+            htc_fail(API_EIO);
+            return 0;
+        }
+        return bw;
+    }
+    if (htc_ring_size)
+    {
+        if (htc_pix_count)
+            return 0;
+        uint16_t tail = htc_ring_tail();
+        if (tail >= htc_ring_size)
+            tail = 0;
+        uint16_t space = (tail + htc_ring_size - htc_ring_head - 1) % htc_ring_size;
+        if (htc_ring_size - htc_ring_head < space)
+            space = htc_ring_size - htc_ring_head;
+        if (len > space)
+            len = space;
+        htc_pix_addr = htc_ring_addr + htc_ring_head;
+        htc_pix_count = len;
+        memcpy(&xram[htc_pix_addr], data, len);
+        htc_ring_head = (htc_ring_head + len) % htc_ring_size;
+        return len;
+    }
+    return len; // No sink, discard
+}
+
+static void htc_rx_consume(u16_t len)
+{
+    if (htc_pcb)
+        tcp_recved(htc_pcb, len);
+    htc_rx_pos += len;
+    while (htc_rx && htc_rx_pos >= htc_rx->len)
+    {
+        struct pbuf *p = htc_rx;
+        htc_rx_pos -= p->len;
+        htc_rx = p->next;
+        if (htc_rx)
+            pbuf_ref(htc_rx);
+        pbuf_free(p);
+    }
+}
+
+// Returns true when a full line is in htc_line.
+static bool htc_read_line(void)
+{
+    while (htc_rx)
+    {
+        const char *data = (char *)htc_rx->payload + htc_rx_pos;
+        u16_t len = htc_rx->len - htc_rx_pos;
+        u16_t used = 0;
+        bool eol = false;
+        while (used < len && !eol)
+        {
+            char ch = data[used++];
+            if (ch == '\n')
+                eol = true;
+            else if (htc_line_len < HTC_LINE_MAX - 1)
+                htc_line[htc_line_len++] = ch;
+        }
+        // One window update per line or pbuf.
+        htc_rx_consume(used);
+        if (eol)
+        {
+            if (htc_line_len && htc_line[htc_line_len - 1] == '\r')
+                htc_line_len--;
+            htc_line[htc_line_len] = 0;
+            htc_line_len = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Case insensitive search for a token in a header value.
+static bool htc_has_token(const char *value, const char *token)
+{
+    size_t len = strlen(token);
+    for (; *value; value++)
+        if (!strncasecmp(value, token, len))
+            return true;
+    return false;
+}
+
+static void htc_parse_header(void)
+{
+    char *value = strchr(htc_line, ':');
+    if (!value)
+        return;
+    *value++ = 0;
+    while (*value == ' ' || *value == '\t')
+        value++;
+    if (!strcasecmp(htc_line, "Content-Length"))
+    {
+        htc_has_length = true;
+        htc_length = strtoul(value, NULL, 10);
+    }
+    else if (!strcasecmp(htc_line, "Transfer-Encoding"))
+        htc_chunked = htc_has_token(value, "chunked");
+    else if (!strcasecmp(htc_line, "Connection"))
+    {
+        if (htc_has_token(value, "close"))
+            htc_keep_alive = false;
+        else if (htc_has_token(value, "keep-alive"))
+            htc_keep_alive = true;
+    }
+}
+
+static void htc_headers(void)
+{
+    while (htc_state == htc_state_headers && htc_read_line())
+    {
+        if (!htc_code)
+        {
+            // HTTP/1.1 200 OK
+            if (strncasecmp(htc_line, "HTTP/1.", 7) || !htc_line[7])
+            {
+                htc_fail(API_EIO);
+                return;
+            }
+            htc_keep_alive = htc_line[7] != '0';
+            htc_code = strtoul(&htc_line[8], NULL, 10);
+            if (!htc_code)
+            {
+                htc_fail(API_EIO);
+                return;
+            }
+            DBG("NET HTC status %u\n", htc_code);
+        }
+        else if (htc_line[0])
+            htc_parse_header();
+        else if (htc_code < 200)
+            htc_code = 0; // 100 Continue, next status line follows
+        else if (htc_code == 204 || htc_code == 304)
+            htc_finish();
+        else if (htc_chunked)
+        {
+            htc_has_length = false;
+            htc_state = htc_state_chunk_size;
+        }
+        else if (htc_has_length)
+        {
+            htc_remaining = htc_length;
+            if (htc_remaining)
+                htc_state = htc_state_body;
+            else
+                htc_finish();
+        }
+        else
+        {
+            htc_keep_alive = false; // Body ends at close
+            htc_state = htc_state_body;
+        }
+    }
+}
+
+// Move body bytes to the sink, bounded by htc_remaining unless reading to close.
+static bool htc_body(bool bounded)
+{
+    bool moved = false;
+    while (htc_rx && (!bounded || htc_remaining))
+    {
+        u16_t len = htc_rx->len - htc_rx_pos;
+        if (bounded && len > htc_remaining)
+            len = htc_remaining;
+        u16_t done = htc_sink((uint8_t *)htc_rx->payload + htc_rx_pos, len);
+        if (!done)
+            break;
+        htc_rx_consume(done);
+        htc_received += done;
+        if (bounded)
+            htc_remaining -= done;
+        moved = true;
+    }
+    return moved;
+}
+
+static void htc_send(void)
+{
+    while (htc_req_pos < htc_req_len || htc_body_pos < htc_body_len)
+    {
+        u16_t len = tcp_sndbuf(htc_pcb);
+        if (!len)
+            break;
+        const void *data;
+        if (htc_req_pos < htc_req_len)
+        {
+            data = &htc_req[htc_req_pos];
+            if (len > htc_req_len - htc_req_pos)
+                len = htc_req_len - htc_req_pos;
+        }
+        else
+        {
+            data = &xram[htc_body_addr + htc_body_pos];
+            if (len > htc_body_len - htc_body_pos)
+                len = htc_body_len - htc_body_pos;
+        }
+        err_t err = tcp_write(htc_pcb, data, len, TCP_WRITE_FLAG_COPY);
+        if (err == ERR_MEM)
+            break;
+        if (err != ERR_OK)
+        {
+            htc_fail(API_EIO);
+            return;
+        }
+        if (htc_req_pos < htc_req_len)
+            htc_req_pos += len;
+        else
+            htc_body_pos += len;
+    }
+    tcp_output(htc_pcb);
+    if (htc_req_pos == htc_req_len && htc_body_pos == htc_body_len)
+        htc_state = htc_state_headers;
+}
+
+void htc_task(void)
+{
+    htc_mirror();
+    if (htc_state == htc_state_sending)
+        htc_send();
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        switch (htc_state)
+        {
+        case htc_state_headers:
+            htc_headers();
+            progress = htc_state != htc_state_headers;
+            break;
+        case htc_state_body:
+            progress = htc_body(htc_has_length);
+            if (htc_has_length && !htc_remaining)
+                htc_finish();
+            break;
+        case htc_state_chunk_size:
+            if (htc_read_line())
+            {
+                htc_remaining = strtoul(htc_line, NULL, 16);
+                htc_state = htc_remaining ? htc_state_chunk_data
+                                          : htc_state_trailers;
+                progress = true;
+            }
+            break;
+        case htc_state_chunk_data:
+            progress = htc_body(true);
+            if (!htc_remaining)
+            {
+                htc_state = htc_state_chunk_end;
+                progress = true;
+            }
+            break;
+        case htc_state_chunk_end:
+            if (htc_read_line())
+            {
+                htc_state = htc_state_chunk_size;
+                progress = true;
+            }
+            break;
+        case htc_state_trailers:
+            if (htc_read_line() && !htc_line[0])
+                htc_finish();
+            else
+                progress = htc_rx != NULL;
+            break;
+        case htc_state_idle:
+        case htc_state_done:
+            htc_rx_free(); // Unsolicited data on a kept-alive connection
+            if (htc_rx_closed && htc_pcb)
+                htc_disconnect();
+            break;
+        default:
+            break;
+        }
+    }
+    if (htc_rx_closed && !htc_rx)
+    {
+        if (htc_state == htc_state_body && !htc_has_length)
+            htc_finish();
+        else if (htc_state >= htc_state_sending && htc_state < htc_state_done)
+            htc_fail(API_EIO);
+        else if (htc_pcb)
+            htc_disconnect();
+    }
+    if (htc_state != htc_state_idle)
+        htc_status_update();
+}
+
+void htc_stop(void)
+{
+    htc_disconnect();
+    htc_state = htc_state_idle;
+    htc_fil = NULL;
+    htc_status_addr = HTC_NO_ADDR;
+    htc_ring_size = 0;
+    htc_pix_count = 0;
+}
+
+static err_t htc_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+{
+    (void)arg;
+    (void)tpcb;
+    (void)err;
+    if (!p)
+    {
+        DBG("NET HTC remote closed\n");
+        htc_rx_closed = true;
+        htc_pcb_connected = false;
+        return ERR_OK;
+    }
+    if (htc_rx)
+        pbuf_cat(htc_rx, p);
+    else
+    {
+        htc_rx = p;
+        htc_rx_pos = 0;
+    }
+    return ERR_OK;
+}
+
+static void htc_err(void *arg, err_t err)
+{
+    (void)arg;
+    (void)err;
+    DBG("NET HTC tcp_err %d\n", err);
+    htc_pcb = NULL; // Already freed by lwIP
+    htc_pcb_connected = false;
+    htc_rx_closed = true;
+    if (htc_state > htc_state_idle && htc_state < htc_state_done)
+        htc_fail(API_EIO);
+}
+
+static err_t htc_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
+{
+    (void)arg;
+    (void)tpcb;
+    (void)err;
+    DBG("NET HTC TCP Connected %d\n", err);
+    htc_pcb_connected = true;
+    htc_state = htc_state_sending;
+    return ERR_OK;
+}
+
+static void htc_dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    (void)name;
+    (void)arg;
+    if (htc_state != htc_state_dns_lookup)
+        return;
+    if (!ipaddr)
+    {
+        DBG("NET HTC DNS did not resolve\n");
+        htc_fail(API_ENOENT);
+        return;
+    }
+    htc_pcb = tcp_new_ip_type(IP_GET_TYPE(ipaddr));
+    if (!htc_pcb)
+    {
+        htc_fail(API_ENOMEM);
+        return;
+    }
+    htc_state = htc_state_connecting;
+    tcp_nagle_disable(htc_pcb);
+    tcp_err(htc_pcb, htc_err);
+    tcp_recv(htc_pcb, htc_recv);
+    err_t err = tcp_connect(htc_pcb, ipaddr, htc_port, htc_connected);
+    if (err != ERR_OK)
+    {
+        DBG("NET HTC tcp_connect failed %d\n", err);
+        htc_fail(API_EIO);
+    }
+}
+
+// Split "http://host[:port]/path", returns path or NULL.
+static const char *htc_parse_url(const char *url, char *host, u16_t *port)
+{
+    if (strncasecmp(url, "http://", 7))
+        return NULL;
+    url += 7;
+    size_t len = strcspn(url, ":/");
+    if (!len || len >= HTC_HOST_MAX)
+        return NULL;
+    memcpy(host, url, len);
+    host[len] = 0;
+    url += len;
+    *port = 80;
+    if (*url == ':')
+    {
+        char *end;
+        unsigned long p = strtoul(url + 1, &end, 10);
+        if (!p || p > 0xFFFF || (*end && *end != '/'))
+            return NULL;
+        *port = p;
+        url = end;
+    }
+    return *url ? url : "/";
+}
+
+bool htc_api_request(void)
+{
+    if (htc_state > htc_state_idle && htc_state < htc_state_done)
+        return api_return_errno(API_EBUSY);
+
+    uint16_t url_addr = API_AX;
+    uint16_t body_addr, body_len;
+    uint8_t method;
+    if (!api_pop_uint16(&body_addr) ||
+        !api_pop_uint16(&body_len) ||
+        !api_pop_uint8_end(&method) ||
+        method > 1 ||
+        body_addr + body_len > XRAM_SIZE)
+        return api_return_errno(API_EINVAL);
+
+    char url[HTC_LINE_MAX];
+    size_t i;
+    for (i = 0; i < sizeof(url) - 1 && url_addr + i < XRAM_SIZE; i++)
+        if (!(url[i] = xram[url_addr + i]))
+            break;
+    url[i] = 0;
+    char host[HTC_HOST_MAX];
+    u16_t port;
+    const char *path = htc_parse_url(url, host, &port);
+    if (!path)
+        return api_return_errno(API_EINVAL);
+
+    int len = snprintf(htc_req, sizeof(htc_req),
+                       "%s %s HTTP/1.1\r\n"
+                       "Host: %s\r\n"
+                       "User-Agent: RP6502\r\n"
+                       "Connection: keep-alive\r\n",
+                       method ? "POST" : "GET", path, host);
+    if (method && len > 0 && len < (int)sizeof(htc_req))
+        len += snprintf(htc_req + len, sizeof(htc_req) - len,
+                        "Content-Type: application/octet-stream\r\n"
+                        "Content-Length: %u\r\n",
+                        body_len);
+    if (len > 0 && len < (int)sizeof(htc_req))
+        len += snprintf(htc_req + len, sizeof(htc_req) - len, "\r\n");
+    if (len <= 0 || len >= (int)sizeof(htc_req))
+        return api_return_errno(API_ENOMEM);
+    htc_req_len = len;
+    htc_req_pos = 0;
+    htc_body_addr = body_addr;
+    htc_body_len = method ? body_len : 0;
+    htc_body_pos = 0;
+
+    htc_code = 0;
+    htc_chunked = false;
+    htc_keep_alive = true;
+    htc_has_length = false;
+    htc_length = 0;
+    htc_received = 0;
+    htc_errno = 0;
+    htc_fresult = FR_OK;
+    htc_line_len = 0;
+    htc_ring_head = 0;
+    htc_pix_count = 0;
+    if (htc_status_addr != HTC_NO_ADDR)
+        memset(&xram[htc_status_addr], 0, sizeof(htc_status_t));
+
+    if (htc_pcb && htc_pcb_connected && !htc_rx_closed &&
+        port == htc_port && !strcasecmp(host, htc_host))
+    {
+        DBG("NET HTC reusing connection\n");
+        htc_state = htc_state_sending;
+        htc_status_update();
+        return api_return_ax(0);
+    }
+
+    htc_disconnect();
+    htc_rx_closed = false;
+    strcpy(htc_host, host);
+    htc_port = port;
+    htc_state = htc_state_dns_lookup;
+    htc_status_update();
+    ip_addr_t ipaddr;
+    err_t err = rsv_gethostbyname(htc_host, &ipaddr, htc_dns_found, NULL);
+    if (err == ERR_OK)
+        htc_dns_found(htc_host, &ipaddr, NULL);
+    else if (err != ERR_INPROGRESS)
+    {
+        DBG("NET HTC rsv_gethostbyname (%d)\n", err);
+        htc_fail(API_EIO);
+    }
+    if (htc_state == htc_state_error)
+        return api_return_errno(htc_errno);
+    return api_return_ax(0);
+}
+
+bool htc_api_sink(void)
+{
+    if (htc_state > htc_state_idle && htc_state < htc_state_done)
+        return api_return_errno(API_EBUSY);
+
+    int8_t fd = API_A;
+    uint16_t status_addr, ring_addr, ring_size;
+    if (!api_pop_uint16(&ring_size) ||
+        !api_pop_uint16(&ring_addr) ||
+        !api_pop_uint16_end(&status_addr))
+        return api_return_errno(API_EINVAL);
+    if (status_addr != HTC_NO_ADDR &&
+        status_addr > XRAM_SIZE - sizeof(htc_status_t))
+        return api_return_errno(API_EINVAL);
+
+    FIL *fil = NULL;
+    if (fd >= 0)
+    {
+        fil = std_get_fil(fd);
+        if (!fil)
+            return api_return_errno(API_EBADF);
+        ring_size = 0;
+    }
+    else if (ring_size)
+    {
+        // Ring needs the tail register for flow control
+        if (status_addr == HTC_NO_ADDR ||
+            ring_size < 2 || ring_addr + ring_size > XRAM_SIZE)
+            return api_return_errno(API_EINVAL);
+    }
+
+    htc_fil = fil;
+    htc_status_addr = status_addr;
+    htc_ring_addr = ring_addr;
+    htc_ring_size = ring_size;
+    htc_ring_head = 0;
+    return api_return_ax(0);
+}
+
+bool htc_api_status(void)
+{
+    if (htc_state == htc_state_error)
+    {
+        if (htc_fresult != FR_OK)
+            return api_return_fresult(htc_fresult);
+        return api_return_errno(htc_errno);
+    }
+    return api_return_ax(htc_public_state());
+}
+
+bool htc_api_close(void)
+{
+    htc_disconnect();
+    htc_state = htc_state_idle;
+    return api_return_ax(0);
+}
+
+#endif /* RP6502_RIA_W */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_HTC_H_
+#define _RIA_NET_HTC_H_
+
+/* HTTP/1.1 client driver
+ * Streams response bodies into an XRAM ring or an open file.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void htc_task(void);
+void htc_stop(void);
+
+/* API operations
+ */
+
+// Start a request
+// Stack: uint8_t method, uint16_t body_len, uint16_t body_addr
+// A/X: uint8_t *url (null-terminated "http://host[:port]/path")
+// Method: 0=GET, 1=POST
+// Returns: 0 on success, errno on error
+bool htc_api_request(void);
+
+// Select where the next response body goes
+// Stack: uint16_t status_addr, uint16_t ring_addr, uint16_t ring_size
+// A: int8_t fd (-1 for the XRAM ring)
+// Returns: 0 on success, errno on error
+bool htc_api_sink(void);
+
+// Poll request progress
+// Returns: state, or errno if the request failed
+bool htc_api_status(void);
+
+// Abort the request and drop any kept-alive connection
+// Returns: 0
+bool htc_api_close(void);
+
+#endif /* _RIA_NET_HTC_H_ */
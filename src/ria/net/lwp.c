@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/lwp.h"
+void lwp_print_status(void) {}
+void lwp_mon_iperf(const char *, size_t) {}
+#else
+
+#include "mon/str.h"
+#include "net/lwp.h"
+#include "net/wfi.h"
+#include <lwip/tcp.h>
+#include <lwip/apps/lwiperf.h>
+#include <stdio.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_LWP)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+static void *lwp_iperf_session;
+static u32_t lwp_iperf_kbps;
+static u32_t lwp_iperf_bytes;
+static u32_t lwp_iperf_ms;
+
+void lwp_print_status(void)
+{
+    printf("TCP : %s, MSS %u, window %u\n",
+           LWP_PROFILE_NAME, TCP_MSS, TCP_WND);
+}
+
+static void lwp_iperf_report(void *arg, enum lwiperf_report_type report_type,
+                             const ip_addr_t *local_addr, u16_t local_port,
+                             const ip_addr_t *remote_addr, u16_t remote_port,
+                             u32_t bytes_transferred, u32_t ms_duration,
+                             u32_t bandwidth_kbitpsec)
+{
+    (void)arg;
+    (void)local_addr;
+    (void)local_port;
+    (void)remote_addr;
+    (void)remote_port;
+    DBG("NET LWP iperf report %d\n", report_type);
+    lwp_iperf_bytes = bytes_transferred;
+    lwp_iperf_ms = ms_duration;
+    lwp_iperf_kbps = bandwidth_kbitpsec;
+}
+
+static void lwp_print_iperf(void)
+{
+    if (!lwp_iperf_session)
+        puts("iperf server stopped");
+    else
+        printf("iperf server on port %u\n", LWIPERF_TCP_PORT_DEFAULT);
+    if (lwp_iperf_ms)
+        printf("Last run: %lu bytes in %lu ms, %lu kbit/s\n",
+               (unsigned long)lwp_iperf_bytes,
+               (unsigned long)lwp_iperf_ms,
+               (unsigned long)lwp_iperf_kbps);
+}
+
+void lwp_mon_iperf(const char *args, size_t len)
+{
+    uint32_t val;
+    if (len)
+    {
+        if (!str_parse_uint32(&args, &len, &val) ||
+            !str_parse_end(args, len) || val > 1)
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+        if (val && !lwp_iperf_session)
+        {
+            if (!wfi_ready())
+            {
+                printf("?WiFi not connected\n");
+                return;
+            }
+            lwp_iperf_ms = 0;
+            lwp_iperf_session = lwiperf_start_tcp_server_default(lwp_iperf_report, NULL);
+            if (!lwp_iperf_session)
+                printf("?Unable to start iperf server\n");
+        }
+        if (!val && lwp_iperf_session)
+        {
+            lwiperf_abort(lwp_iperf_session);
+            lwp_iperf_session = NULL;
+        }
+    }
+    lwp_print_iperf();
+}
+
+#endif /* RP6502_RIA_W */
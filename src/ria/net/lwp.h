@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_LWP_H_
+#define _RIA_NET_LWP_H_
+
+/* lwIP TCP profile report and iperf benchmark server.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Utility
+ */
+
+void lwp_print_status(void);
+
+/* Monitor commands
+ */
+
+void lwp_mon_iperf(const char *args, size_t len);
+
+#endif /* _RIA_NET_LWP_H_ */
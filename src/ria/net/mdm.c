@@ -29,20 +29,20 @@ int mdm_tx(char) { return -1; }
 static inline void DBG(const char *fmt, ...) { (void)fmt; }
 #endif
 
-// Leave a little room for escaped telnet characters.
-#if TCP_MSS == 536 // does not fragment and good enough
-#define MDM_TX_BUF_SIZE (512)
-#elif TCP_MSS == 1460 // in case someone wants to try
-#define MDM_TX_BUF_SIZE (1024)
-#else
-#error unexpected TCP_MSS
-#endif
+// TCP_MSS is set by the build profile.
+// 536 does not fragment and good enough, 1460 gets 1024.
+#define MDM_TX_BUF_SIZE (TCP_MSS < 1024 ? 512 : 1024)
 static char mdm_tx_buf[MDM_TX_BUF_SIZE];
 static size_t mdm_tx_buf_len;
 
 #define MDM_ESCAPE_GUARD_TIME_US 1000000
 #define MDM_ESCAPE_COUNT 3
 
+// RING repeats while a caller waits to be answered.
+#define MDM_RING_INTERVAL_US 2000000
+static unsigned mdm_ring_count;
+static absolute_time_t mdm_ring_next;
+
 // Batch transmission: accumulate data before sending
 #define MDM_SEND_BATCH_SIZE 256         // Send after accumulating this many bytes
 #define MDM_SEND_BATCH_TIMEOUT_US 50000 // Or after this timeout in microseconds (50ms)
@@ -111,6 +111,8 @@ static const char __in_flash("net_mdm") devicename0[] = "AT0:";
 void mdm_stop(void)
 {
     tel_close();
+    tel_listen(0);
+    mdm_ring_count = 0;
     mdm_is_open = false;
     mdm_cmd_buf_len = 0;
     memset(mdm_cmd_buf, 0, sizeof(mdm_cmd_buf));  // Zero entire buffer
@@ -419,6 +421,7 @@ void mdm_factory_settings(mdm_settings_t *settings)
     settings->cr_char = '\r';  // S3=13
     settings->lf_char = '\n';  // S4=10
     settings->bs_char = '\b';  // S5=8
+    settings->telnet = 2;      // S15=2
 }
 
 const char *mdm_read_phonebook_entry(unsigned index)
@@ -515,6 +518,7 @@ bool mdm_write_settings(const mdm_settings_t *settings)
                                "S3=%u\n"
                                "S4=%u\n"
                                "S5=%u\n"
+                               "S15=%u\n"
                                "",
                                settings->echo,
                                settings->quiet,
@@ -524,7 +528,8 @@ bool mdm_write_settings(const mdm_settings_t *settings)
                                settings->esc_char,
                                settings->cr_char,
                                settings->lf_char,
-                               settings->bs_char);
+                               settings->bs_char,
+                               settings->telnet);
         if (lfsresult < 0)
             DBG("?Unable to write %s contents (%d)\n", modem0_sys, lfsresult);
     }
@@ -578,6 +583,11 @@ bool mdm_read_settings(mdm_settings_t *settings)
             break;
         case 'S':
             uint8_t s_register = atoi(str);
+            while (str[0] >= '0' && str[0] <= '9')
+            {
+                ++str;
+                len -= 1;
+            }
             if (str[0] != '=')
                 break;
             ++str;
@@ -599,6 +609,9 @@ bool mdm_read_settings(mdm_settings_t *settings)
             case 5:
                 settings->bs_char = atoi(str);
                 break;
+            case 15:
+                settings->telnet = atoi(str);
+                break;
             default:
                 break;
             }
@@ -643,8 +656,12 @@ void mdm_task()
             should_send = true;
         }
         
-        if (should_send && tel_tx(mdm_tx_buf, mdm_tx_buf_len))
-            mdm_tx_buf_len = 0;
+        if (should_send)
+        {
+            u16_t sent = tel_tx(mdm_tx_buf, mdm_tx_buf_len);
+            mdm_tx_buf_len -= sent;
+            memmove(mdm_tx_buf, &mdm_tx_buf[sent], mdm_tx_buf_len);
+        }
     }
     // Publish pending URCs when not busy
     if (mdm_response_state < 0 && mdm_urc_head != mdm_urc_tail)
@@ -692,6 +709,19 @@ void mdm_task()
         mdm_escape_count = 0;
         mdm_set_response_fn(mdm_response_code, 0); // OK
     }
+    // Ring for the oldest waiting caller, answer on S0 rings.
+    if (mdm_state != mdm_state_on_hook || !tel_waiting())
+        mdm_ring_count = 0;
+    else if (mdm_response_state < 0 && !mdm_is_parsing &&
+             (!mdm_ring_count || absolute_time_diff_us(get_absolute_time(), mdm_ring_next) < 0))
+    {
+        mdm_ring_count++;
+        mdm_ring_next = make_timeout_time_us(MDM_RING_INTERVAL_US);
+        mdm_set_response_fn(mdm_response_code, 2); // RING
+        if (mdm_settings.auto_answer && mdm_ring_count >= mdm_settings.auto_answer &&
+            !mdm_answer())
+            mdm_urc("NO CARRIER");
+    }
 }
 
 bool mdm_dial(const char *s)
@@ -723,6 +753,25 @@ bool mdm_dial(const char *s)
     return false;
 }
 
+bool mdm_answer(void)
+{
+    if (mdm_state != mdm_state_on_hook || !tel_waiting())
+        return false;
+    // tel_answer sends CONNECT ahead of any early data.
+    if (!tel_answer())
+        return false;
+    mdm_state = mdm_state_connected;
+    // Same as dialing out, data goes through AT+CIPSEND.
+    mdm_in_command_mode = true;
+    mdm_ring_count = 0;
+    return true;
+}
+
+unsigned mdm_get_ring_count(void)
+{
+    return mdm_ring_count;
+}
+
 bool mdm_connect(void)
 {
     if (mdm_state == mdm_state_dialing ||
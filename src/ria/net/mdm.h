@@ -27,6 +27,7 @@ typedef struct
     uint8_t cr_char;
     uint8_t lf_char;
     uint8_t bs_char;
+    uint8_t telnet;
     uint8_t s_pointer;
 } mdm_settings_t;
 
@@ -64,6 +65,8 @@ bool mdm_write_phonebook_entry(const char *entry, unsigned index);
 const char *mdm_read_phonebook_entry(unsigned index);
 bool mdm_dial(const char *s);
 bool mdm_connect(void);
+bool mdm_answer(void);
+unsigned mdm_get_ring_count(void);
 bool mdm_hangup(void);
 void mdm_carrier_lost(void);
 int mdm_get_state(void);
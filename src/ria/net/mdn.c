@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/mdn.h"
+void mdn_task(void) {}
+void mdn_print_status(void) {}
+void mdn_set_telnet_port(uint16_t) {}
+#else
+
+#include "net/mdn.h"
+#include "net/wfi.h"
+#include <lwip/apps/mdns.h>
+#include <pico/cyw43_arch.h>
+#include <stdio.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_MDN)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+static bool mdn_started;
+static bool mdn_added;
+static bool mdn_was_ready;
+static char mdn_hostname[16];
+static uint16_t mdn_telnet_port;
+static s8_t mdn_telnet_slot = -1;
+
+static struct netif *mdn_netif(void)
+{
+    return &cyw43_state.netif[CYW43_ITF_STA];
+}
+
+static void mdn_telnet_txt(struct mdns_service *service, void *txt_userdata)
+{
+    (void)txt_userdata;
+    static const char txt[] = "board=rp6502";
+    mdns_resp_add_service_txtitem(service, txt, sizeof(txt) - 1);
+}
+
+static void mdn_update_services(void)
+{
+    if (mdn_telnet_slot >= 0)
+        mdns_resp_del_service(mdn_netif(), mdn_telnet_slot);
+    mdn_telnet_slot = -1;
+    if (mdn_telnet_port)
+    {
+        mdn_telnet_slot = mdns_resp_add_service(
+            mdn_netif(), mdn_hostname, "_telnet", DNSSD_PROTO_TCP,
+            mdn_telnet_port, mdn_telnet_txt, NULL);
+        if (mdn_telnet_slot < 0)
+            DBG("NET MDN add service failed (%d)\n", mdn_telnet_slot);
+    }
+    mdns_resp_announce(mdn_netif());
+}
+
+void mdn_task(void)
+{
+    bool ready = wfi_ready();
+    if (ready && !mdn_was_ready)
+    {
+        if (!mdn_started)
+        {
+            mdns_resp_init();
+            mdn_started = true;
+        }
+        if (!mdn_added)
+        {
+            uint8_t mac[6];
+            cyw43_wifi_get_mac(&cyw43_state, CYW43_ITF_STA, mac);
+            snprintf(mdn_hostname, sizeof(mdn_hostname), "rp6502-%02x%02x%02x",
+                     mac[3], mac[4], mac[5]);
+            err_t err = mdns_resp_add_netif(mdn_netif(), mdn_hostname);
+            if (err == ERR_OK)
+            {
+                DBG("NET MDN %s.local\n", mdn_hostname);
+                mdn_added = true;
+                mdn_update_services();
+            }
+            else
+                DBG("NET MDN add netif failed (%d)\n", err);
+        }
+        else
+            mdns_resp_announce(mdn_netif());
+    }
+    mdn_was_ready = ready;
+}
+
+void mdn_set_telnet_port(uint16_t port)
+{
+    if (mdn_telnet_port == port)
+        return;
+    mdn_telnet_port = port;
+    if (mdn_added)
+        mdn_update_services();
+}
+
+void mdn_print_status(void)
+{
+    printf("MDNS: ");
+    if (mdn_added)
+        printf("%s.local\n", mdn_hostname);
+    else
+        puts("not started");
+}
+
+#endif /* RP6502_RIA_W */
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_MDN_H_
+#define _RIA_NET_MDN_H_
+
+/* Multicast DNS responder.
+ * Advertises the board as rp6502-XXXXXX.local plus its services.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void mdn_task(void);
+
+/* Utility
+ */
+
+void mdn_print_status(void);
+
+// Advertise _telnet._tcp on port, 0 to withdraw.
+void mdn_set_telnet_port(uint16_t port);
+
+#endif /* _RIA_NET_MDN_H_ */
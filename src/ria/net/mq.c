@@ -20,11 +20,19 @@ bool mq_api_get_topic(void) { return false; }
 bool mq_api_connected(void) { return false; }
 bool mq_api_set_auth(void) { return false; }
 bool mq_api_set_will(void) { return false; }
+bool mq_api_bind(void) { return false; }
+size_t mq_rx_pending(void) { return 0; }
+unsigned mq_messages_waiting(void) { return 0; }
+uint16_t mq_get_drops(void) { return 0; }
+uint16_t mq_get_overflows(void) { return 0; }
+bool mq_api_unbind(void) { return false; }
 #else
 
 #include "net/mq.h"
 #include "api/api.h"
+#include "net/rsv.h"
 #include "sys/mem.h"
+#include "sys/pix.h"
 #include <pico/time.h>
 #include <lwip/tcp.h>
 #include <lwip/dns.h>
@@ -72,6 +80,13 @@ static inline void DBG(const char *fmt, ...) { (void)fmt; }
 #define MQTT_USERNAME_MAX 128
 #define MQTT_PASSWORD_MAX 128
 
+// XRAM bindings
+#define MQ_BIND_MAX 8
+#define MQ_BIND_TOPIC_MAX 64
+#define MQ_BIND_FMT_RAW 0
+#define MQ_BIND_FMT_DEC 1
+#define MQ_BIND_FMT_FIXED 2
+
 // Timing constants
 #define MQTT_KEEPALIVE_SECONDS 60
 #define MQTT_PING_INTERVAL_US (MQTT_KEEPALIVE_SECONDS * 1000000 / 2)
@@ -86,6 +101,19 @@ typedef enum {
     MQ_STATE_DISCONNECTING
 } mq_state_t;
 
+/* Binding of a topic filter to an XRAM field.
+ * Matching messages are decoded straight into XRAM
+ * and mirrored to the VGA by mq_task.
+ */
+typedef struct {
+    char topic[MQ_BIND_TOPIC_MAX];
+    uint16_t addr;
+    uint16_t len;
+    uint8_t format;
+    uint8_t decimals;
+    uint16_t pix_pos; // bytes remaining to send over PIX
+} mq_bind_t;
+
 static struct {
     mq_state_t state;
     struct tcp_pcb *pcb;
@@ -131,8 +159,15 @@ static struct {
     char current_payload[MQTT_PAYLOAD_BUF_SIZE];
     uint16_t current_payload_len;
     bool message_available;
+
+    // XRAM bindings
+    mq_bind_t binds[MQ_BIND_MAX];
 } mq;
 
+// Statistics since boot
+static uint16_t mq_drops;
+static uint16_t mq_overflows;
+
 /* Helper Functions */
 
 static uint16_t mq_get_packet_id(void)
@@ -433,36 +468,175 @@ static void mq_handle_connack(const uint8_t *buf, uint16_t len)
     }
 }
 
-static void mq_handle_publish(const uint8_t *buf, uint16_t len)
+/* XRAM Bindings */
+
+static bool mq_topic_match(const char *filter, const char *topic, uint16_t topic_len)
 {
-    if (mq.message_available) {
-        DBG("MQTT: Message overflow, dropping\n");
+    uint16_t pos = 0;
+    while (*filter) {
+        if (filter[0] == '#')
+            return true;
+        if (filter[0] == '/' && filter[1] == '#' && pos == topic_len)
+            return true; // "a/#" also matches "a"
+        if (filter[0] == '+') {
+            while (pos < topic_len && topic[pos] != '/')
+                pos++;
+            filter++;
+            continue;
+        }
+        if (pos >= topic_len || filter[0] != topic[pos])
+            return false;
+        filter++;
+        pos++;
+    }
+    return pos == topic_len;
+}
+
+// Parse decimal text into an integer scaled by 10^decimals.
+// Fraction digits beyond the requested precision are rounded.
+// Digits stop accumulating at the clamp, too wide for any field.
+#define MQ_BIND_CLAMP 100000000000000000
+static bool mq_bind_parse(const uint8_t *buf, uint16_t len, uint8_t decimals, int64_t *value)
+{
+    uint16_t pos = 0;
+    while (pos < len && (buf[pos] == ' ' || buf[pos] == '\t'))
+        pos++;
+    bool negative = false;
+    if (pos < len && (buf[pos] == '-' || buf[pos] == '+'))
+        negative = buf[pos++] == '-';
+    int64_t result = 0;
+    bool has_digits = false;
+    for (; pos < len && buf[pos] >= '0' && buf[pos] <= '9'; pos++) {
+        has_digits = true;
+        if (result < MQ_BIND_CLAMP)
+            result = result * 10 + buf[pos] - '0';
+    }
+    uint8_t frac = 0;
+    if (pos < len && buf[pos] == '.') {
+        for (pos++; pos < len && buf[pos] >= '0' && buf[pos] <= '9'; pos++) {
+            has_digits = true;
+            if (frac < decimals) {
+                if (result < MQ_BIND_CLAMP)
+                    result = result * 10 + buf[pos] - '0';
+                frac++;
+            } else {
+                if (frac == decimals && buf[pos] >= '5')
+                    result++;
+                frac = decimals + 1; // only round on the first extra digit
+            }
+        }
+    }
+    if (!has_digits)
+        return false;
+    for (; frac < decimals && result < MQ_BIND_CLAMP; frac++)
+        result *= 10;
+    *value = negative ? -result : result;
+    return true;
+}
+
+// Right-align a scaled integer into the XRAM field, space padded.
+// Values that don't fit or were clamped are shown as a field of '*'.
+static void mq_bind_format(mq_bind_t *b, int64_t value)
+{
+    char digits[24];
+    uint8_t n = 0;
+    bool negative = value < 0;
+    uint64_t mag = negative ? -(uint64_t)value : (uint64_t)value;
+    bool clamped = mag >= MQ_BIND_CLAMP;
+    do {
+        digits[n++] = '0' + mag % 10;
+        mag /= 10;
+        if (n == b->decimals)
+            digits[n++] = '.';
+    } while (mag || n <= b->decimals + (b->decimals ? 1 : 0));
+    if (negative)
+        digits[n++] = '-';
+    uint8_t *field = &xram[b->addr];
+    if (n > b->len || clamped) {
+        memset(field, '*', b->len);
         return;
     }
-    
+    uint16_t pad = b->len - n;
+    memset(field, ' ', pad);
+    for (uint16_t i = 0; i < n; i++)
+        field[pad + i] = digits[n - 1 - i];
+}
+
+// Returns true if the message was consumed by at least one binding.
+static bool mq_bind_apply(const char *topic, uint16_t topic_len,
+                          const uint8_t *payload, uint16_t payload_len)
+{
+    bool consumed = false;
+    for (int i = 0; i < MQ_BIND_MAX; i++) {
+        mq_bind_t *b = &mq.binds[i];
+        if (!b->topic[0] || !mq_topic_match(b->topic, topic, topic_len))
+            continue;
+        consumed = true;
+        if (b->format == MQ_BIND_FMT_RAW) {
+            uint16_t copy_len = payload_len < b->len ? payload_len : b->len;
+            memcpy(&xram[b->addr], payload, copy_len);
+            memset(&xram[b->addr + copy_len], 0, b->len - copy_len);
+        } else {
+            int64_t value;
+            if (!mq_bind_parse(payload, payload_len, b->decimals, &value)) {
+                DBG("MQTT: Binding %d payload not numeric\n", i);
+                continue;
+            }
+            mq_bind_format(b, value);
+        }
+        b->pix_pos = b->len;
+    }
+    return consumed;
+}
+
+static void mq_handle_publish(uint8_t flags, const uint8_t *buf, uint16_t len)
+{
+    if (len < 2)
+        return;
+
     uint16_t pos = 0;
     
     // Decode topic
     uint16_t topic_len = (buf[pos] << 8) | buf[pos + 1];
     pos += 2;
+    if (pos + topic_len > len)
+        return;
+    const char *topic = (const char *)buf + pos;
+    pos += topic_len;
+    
+    // Skip packet ID if QoS > 0
+    if (flags & 0x06)
+        pos += 2;
+    if (pos > len)
+        return;
+    
+    // Payload is the rest
+    const uint8_t *payload = buf + pos;
+    uint16_t payload_len = len - pos;
+    
+    // Bound topics go straight to XRAM and skip the 6502 queue
+    if (mq_bind_apply(topic, topic_len, payload, payload_len)) {
+        mq_update_activity();
+        return;
+    }
+    
+    if (mq.message_available) {
+        DBG("MQTT: Message overflow, dropping\n");
+        mq_drops++;
+        return;
+    }
     
     if (topic_len >= MQTT_TOPIC_BUF_SIZE - 1)
         topic_len = MQTT_TOPIC_BUF_SIZE - 1;
     
-    memcpy(mq.current_topic, buf + pos, topic_len);
+    memcpy(mq.current_topic, topic, topic_len);
     mq.current_topic[topic_len] = '\0';
     mq.current_topic_len = topic_len;
-    pos += topic_len;
-    
-    // Skip packet ID if QoS > 0 (we can determine from flags)
-    // For simplicity, we'll just copy the payload
     
-    // Payload is the rest
-    uint16_t payload_len = len - pos;
     if (payload_len >= MQTT_PAYLOAD_BUF_SIZE - 1)
         payload_len = MQTT_PAYLOAD_BUF_SIZE - 1;
     
-    memcpy(mq.current_payload, buf + pos, payload_len);
+    memcpy(mq.current_payload, payload, payload_len);
     mq.current_payload[payload_len] = '\0';
     mq.current_payload_len = payload_len;
     
@@ -516,7 +690,7 @@ static void mq_parse_packet(const uint8_t *buf, uint16_t len)
         mq_handle_connack(payload, remaining_len);
         break;
     case MQTT_MSG_TYPE_PUBLISH:
-        mq_handle_publish(payload, remaining_len);
+        mq_handle_publish(buf[0], payload, remaining_len);
         break;
     case MQTT_MSG_TYPE_PUBACK:
         mq_handle_puback(payload, remaining_len);
@@ -551,6 +725,7 @@ static err_t mq_tcp_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t
     uint16_t copy_len = p->tot_len;
     if (mq.rx_buf_len + copy_len > MQTT_RX_BUF_SIZE) {
         DBG("MQTT: RX buffer overflow\n");
+        mq_overflows++;
         pbuf_free(p);
         tcp_recved(tpcb, p->tot_len);
         return ERR_OK;
@@ -689,6 +864,15 @@ void mq_init(void)
 
 void mq_task(void)
 {
+    // Mirror updated bindings to the VGA
+    for (int i = 0; i < MQ_BIND_MAX; i++) {
+        mq_bind_t *b = &mq.binds[i];
+        for (; b->pix_pos && pix_ready(); --b->pix_pos) {
+            uint16_t addr = b->addr + b->len - b->pix_pos;
+            pix_send(PIX_DEVICE_XRAM, 0, xram[addr], addr);
+        }
+    }
+
     if (mq.state == MQ_STATE_CONNECTED) {
         // Send periodic PING
         absolute_time_t now = get_absolute_time();
@@ -713,6 +897,7 @@ void mq_stop(void)
         }
         mq_reset();
     }
+    memset(mq.binds, 0, sizeof(mq.binds));
 }
 
 /* API Implementations */
@@ -773,7 +958,7 @@ bool mq_api_connect(void)
     mq.last_ping = mq.last_activity;
     
     // Resolve hostname
-    err_t err = dns_gethostbyname(hostname, &mq.broker_ip, mq_dns_found, NULL);
+    err_t err = rsv_gethostbyname(hostname, &mq.broker_ip, mq_dns_found, NULL);
     if (err == ERR_OK) {
         // Already resolved
         mq_dns_found(hostname, &mq.broker_ip, NULL);
@@ -1042,4 +1227,87 @@ bool mq_api_set_will(void)
     return api_return_ax(0);
 }
 
+bool mq_api_bind(void)
+{
+    uint16_t topic_addr = API_AX;
+    uint16_t field_addr, field_len;
+    uint8_t format;
+    
+    if (!api_pop_uint16(&field_addr))
+        return api_return_errno(API_EINVAL);
+    if (!api_pop_uint16(&field_len))
+        return api_return_errno(API_EINVAL);
+    if (!api_pop_uint8_end(&format))
+        return api_return_errno(API_EINVAL);
+    
+    uint8_t type = format & 0x0F;
+    uint8_t decimals = format >> 4;
+    if (!field_len || field_addr + field_len > XRAM_SIZE ||
+        type > MQ_BIND_FMT_FIXED || decimals > 9)
+        return api_return_errno(API_EINVAL);
+    if (type != MQ_BIND_FMT_FIXED)
+        decimals = 0;
+    
+    int slot = -1;
+    for (int i = 0; i < MQ_BIND_MAX; i++)
+        if (!mq.binds[i].topic[0]) {
+            slot = i;
+            break;
+        }
+    if (slot < 0)
+        return api_return_errno(API_ENOMEM);
+    
+    mq_bind_t *b = &mq.binds[slot];
+    size_t i;
+    for (i = 0; i < MQ_BIND_TOPIC_MAX && topic_addr + i < XRAM_SIZE; i++) {
+        b->topic[i] = xram[topic_addr + i];
+        if (b->topic[i] == 0)
+            break;
+    }
+    if (i == 0 || i == MQ_BIND_TOPIC_MAX || topic_addr + i == XRAM_SIZE) {
+        memset(b, 0, sizeof(mq_bind_t));
+        return api_return_errno(API_EINVAL);
+    }
+    
+    b->addr = field_addr;
+    b->len = field_len;
+    b->format = type;
+    b->decimals = decimals;
+    b->pix_pos = 0;
+    
+    DBG("MQTT: Bound '%s' to xram[0x%04x] len %d fmt %d.%d\n",
+        b->topic, field_addr, field_len, type, decimals);
+    
+    return api_return_ax(slot);
+}
+
+bool mq_api_unbind(void)
+{
+    uint8_t handle = API_A;
+    if (handle >= MQ_BIND_MAX || !mq.binds[handle].topic[0])
+        return api_return_errno(API_EINVAL);
+    memset(&mq.binds[handle], 0, sizeof(mq_bind_t));
+    return api_return_ax(0);
+}
+
+size_t mq_rx_pending(void)
+{
+    return mq.rx_buf_len - mq.rx_buf_read;
+}
+
+unsigned mq_messages_waiting(void)
+{
+    return mq.message_available ? 1 : 0;
+}
+
+uint16_t mq_get_drops(void)
+{
+    return mq_drops;
+}
+
+uint16_t mq_get_overflows(void)
+{
+    return mq_overflows;
+}
+
 #endif /* RP6502_RIA_W */
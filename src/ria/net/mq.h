@@ -78,4 +78,24 @@ bool mq_api_set_auth(void);
 // Returns: 0 on success
 bool mq_api_set_will(void);
 
+// Bind a topic filter to an XRAM field, decoded by the RIA as messages arrive
+// Stack: uint8_t format, uint16_t field_len, uint16_t field_addr
+// A/X: uint8_t *topic (null-terminated, wildcards allowed)
+// Format: low nibble 0=raw, 1=decimal, 2=fixed-point; high nibble decimals
+// Returns: binding handle, or errno on error
+bool mq_api_bind(void);
+
+// Remove an XRAM binding
+// A: uint8_t handle
+// Returns: 0 on success, errno on error
+bool mq_api_unbind(void);
+
+/* Statistics
+ */
+
+size_t mq_rx_pending(void);
+unsigned mq_messages_waiting(void);
+uint16_t mq_get_drops(void);
+uint16_t mq_get_overflows(void);
+
 #endif /* _RIA_NET_MQ_H_ */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/nst.h"
+#include "api/api.h"
+#include <string.h>
+void nst_task(void) {}
+void nst_stop(void) {}
+void nst_get_stats(nst_stats_t *stats) { memset(stats, 0, sizeof(nst_stats_t)); }
+void nst_print_status(void) {}
+bool nst_api_stats(void) { return api_return_errno(API_ENOSYS); }
+#else
+
+#include "api/api.h"
+#include "net/mq.h"
+#include "net/nst.h"
+#include "net/tel.h"
+#include "net/wfi.h"
+#include "sys/mem.h"
+#include "sys/pix.h"
+#include <pico/time.h>
+#include <lwip/tcp.h>
+#include <lwip/stats.h>
+#include <lwip/priv/tcp_priv.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_NST)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+// lwIP keeps no byte counts, so connections are sampled and
+// the sequence numbers give the bytes moved between samples.
+// Zero windows are counted on the edge seen by a sample.
+#define NST_SAMPLE_MS 100
+#define NST_RATE_MS 1000
+#define NST_SOCKETS_MAX 8
+
+typedef struct
+{
+    const struct tcp_pcb *pcb;
+    u16_t local_port;
+    u16_t remote_port;
+    u32_t rcv_nxt;
+    u32_t lastack;
+    uint32_t bytes_in;
+    uint32_t bytes_out;
+    uint32_t mark_in;
+    uint32_t mark_out;
+    uint32_t rate_in;
+    uint32_t rate_out;
+    bool zero_remote;
+    bool zero_local;
+    bool seen;
+} nst_socket_t;
+static nst_socket_t nst_sockets[NST_SOCKETS_MAX];
+
+static absolute_time_t nst_sample_timer;
+static absolute_time_t nst_rate_timer;
+static uint32_t nst_bytes_in;
+static uint32_t nst_bytes_out;
+static uint32_t nst_mark_in;
+static uint32_t nst_mark_out;
+static uint32_t nst_rate_in;
+static uint32_t nst_rate_out;
+static uint16_t nst_zero_win_remote;
+static uint16_t nst_zero_win_local;
+static uint16_t nst_pix_addr;
+static uint16_t nst_pix_count;
+
+static bool nst_is_open(const struct tcp_pcb *pcb)
+{
+    return pcb->state >= ESTABLISHED && pcb->state != TIME_WAIT;
+}
+
+static nst_socket_t *nst_socket(const struct tcp_pcb *pcb)
+{
+    nst_socket_t *free_socket = NULL;
+    for (int i = 0; i < NST_SOCKETS_MAX; i++)
+    {
+        nst_socket_t *socket = &nst_sockets[i];
+        // A freed pcb may come back as a new connection.
+        if (socket->pcb == pcb &&
+            socket->local_port == pcb->local_port &&
+            socket->remote_port == pcb->remote_port)
+            return socket;
+        if (!socket->pcb && !free_socket)
+            free_socket = socket;
+    }
+    if (free_socket)
+    {
+        memset(free_socket, 0, sizeof(nst_socket_t));
+        free_socket->pcb = pcb;
+        free_socket->local_port = pcb->local_port;
+        free_socket->remote_port = pcb->remote_port;
+        free_socket->rcv_nxt = pcb->rcv_nxt;
+        free_socket->lastack = pcb->lastack;
+    }
+    return free_socket;
+}
+
+static void nst_sample(void)
+{
+    for (int i = 0; i < NST_SOCKETS_MAX; i++)
+        nst_sockets[i].seen = false;
+    for (struct tcp_pcb *pcb = tcp_active_pcbs; pcb; pcb = pcb->next)
+    {
+        if (!nst_is_open(pcb))
+            continue;
+        nst_socket_t *socket = nst_socket(pcb);
+        if (!socket)
+            continue;
+        socket->seen = true;
+        u32_t in = pcb->rcv_nxt - socket->rcv_nxt;
+        u32_t out = pcb->lastack - socket->lastack;
+        socket->rcv_nxt = pcb->rcv_nxt;
+        socket->lastack = pcb->lastack;
+        socket->bytes_in += in;
+        socket->bytes_out += out;
+        nst_bytes_in += in;
+        nst_bytes_out += out;
+        bool zero_remote = !pcb->snd_wnd;
+        bool zero_local = !pcb->rcv_wnd;
+        if (zero_remote && !socket->zero_remote)
+            nst_zero_win_remote++;
+        if (zero_local && !socket->zero_local)
+            nst_zero_win_local++;
+        socket->zero_remote = zero_remote;
+        socket->zero_local = zero_local;
+    }
+    for (int i = 0; i < NST_SOCKETS_MAX; i++)
+        if (!nst_sockets[i].seen)
+            nst_sockets[i].pcb = NULL;
+}
+
+static void nst_rate(void)
+{
+    nst_rate_in = nst_bytes_in - nst_mark_in;
+    nst_rate_out = nst_bytes_out - nst_mark_out;
+    nst_mark_in = nst_bytes_in;
+    nst_mark_out = nst_bytes_out;
+    for (int i = 0; i < NST_SOCKETS_MAX; i++)
+    {
+        nst_socket_t *socket = &nst_sockets[i];
+        socket->rate_in = socket->bytes_in - socket->mark_in;
+        socket->rate_out = socket->bytes_out - socket->mark_out;
+        socket->mark_in = socket->bytes_in;
+        socket->mark_out = socket->bytes_out;
+    }
+}
+
+void nst_task(void)
+{
+    if (absolute_time_diff_us(get_absolute_time(), nst_sample_timer) >= 0)
+        return;
+    nst_sample_timer = make_timeout_time_ms(NST_SAMPLE_MS);
+    nst_sample();
+    if (absolute_time_diff_us(get_absolute_time(), nst_rate_timer) < 0)
+    {
+        nst_rate_timer = make_timeout_time_ms(NST_RATE_MS);
+        nst_rate();
+    }
+}
+
+void nst_stop(void)
+{
+    nst_pix_count = 0;
+}
+
+void nst_get_stats(nst_stats_t *stats)
+{
+    unsigned sockets = 0;
+    for (struct tcp_pcb *pcb = tcp_active_pcbs; pcb; pcb = pcb->next)
+        sockets++;
+    size_t tel_bytes = tel_rx_pending();
+    size_t mq_bytes = mq_rx_pending();
+    *stats = (nst_stats_t){
+        .bytes_in = nst_bytes_in,
+        .bytes_out = nst_bytes_out,
+        .rate_in = nst_rate_in,
+        .rate_out = nst_rate_out,
+        .segs_in = lwip_stats.mib2.tcpinsegs,
+        .segs_out = lwip_stats.mib2.tcpoutsegs,
+        .retransmits = lwip_stats.mib2.tcpretranssegs,
+        .zero_win_remote = nst_zero_win_remote,
+        .zero_win_local = nst_zero_win_local,
+        .sockets = sockets > UINT8_MAX ? UINT8_MAX : sockets,
+        .tel_pbufs = tel_pbufs_queued(),
+        .tel_pbufs_max = tel_pbufs_max(),
+        .tel_callers = tel_waiting(),
+        .tel_bytes = tel_bytes > UINT16_MAX ? UINT16_MAX : tel_bytes,
+        .mq_bytes = mq_bytes > UINT16_MAX ? UINT16_MAX : mq_bytes,
+        .mq_waiting = mq_messages_waiting(),
+        .rssi = wfi_get_rssi(),
+        .mq_drops = mq_get_drops(),
+        .mq_overflows = mq_get_overflows(),
+    };
+}
+
+static const char *nst_state_name(enum tcp_state state)
+{
+    switch (state)
+    {
+    case SYN_SENT:
+    case SYN_RCVD:
+        return "opening";
+    case ESTABLISHED:
+        return "open";
+    case CLOSE_WAIT:
+        return "remote closed";
+    default:
+        return "closing";
+    }
+}
+
+void nst_print_status(void)
+{
+    nst_stats_t stats;
+    nst_get_stats(&stats);
+    printf("TCP : %lu bytes in, %lu out, %lu B/s in, %lu B/s out\n",
+           (unsigned long)stats.bytes_in, (unsigned long)stats.bytes_out,
+           (unsigned long)stats.rate_in, (unsigned long)stats.rate_out);
+    printf("Segs: %lu in, %lu out, %lu retransmitted\n",
+           (unsigned long)stats.segs_in, (unsigned long)stats.segs_out,
+           (unsigned long)stats.retransmits);
+    printf("Wnd : %u remote zero, %u local zero\n",
+           stats.zero_win_remote, stats.zero_win_local);
+    for (struct tcp_pcb *pcb = tcp_active_pcbs; pcb; pcb = pcb->next)
+    {
+        printf("Sock: %u > %s:%u %s", pcb->local_port,
+               ipaddr_ntoa(&pcb->remote_ip), pcb->remote_port,
+               nst_state_name(pcb->state));
+        for (int i = 0; i < NST_SOCKETS_MAX; i++)
+            if (nst_sockets[i].pcb == pcb)
+                printf(", %lu/%lu bytes, %lu/%lu B/s",
+                       (unsigned long)nst_sockets[i].bytes_in,
+                       (unsigned long)nst_sockets[i].bytes_out,
+                       (unsigned long)nst_sockets[i].rate_in,
+                       (unsigned long)nst_sockets[i].rate_out);
+        printf("\n      wnd %u/%u, sndbuf %u, queue %u, rtx %u\n",
+               (unsigned)pcb->rcv_wnd, (unsigned)pcb->snd_wnd,
+               (unsigned)pcb->snd_buf, (unsigned)pcb->snd_queuelen,
+               (unsigned)pcb->nrtx);
+    }
+    printf("Tel : %u pbufs (max %u), %u bytes, %u callers\n",
+           stats.tel_pbufs, stats.tel_pbufs_max, stats.tel_bytes,
+           stats.tel_callers);
+    printf("MQTT: %u waiting, %u bytes, %u dropped, %u overflows\n",
+           stats.mq_waiting, stats.mq_bytes, stats.mq_drops,
+           stats.mq_overflows);
+}
+
+bool nst_api_stats(void)
+{
+    // Mirror the block to the VGA before returning.
+    if (nst_pix_count)
+    {
+        for (; nst_pix_count && pix_ready(); --nst_pix_count, ++nst_pix_addr)
+            pix_send(PIX_DEVICE_XRAM, 0, xram[nst_pix_addr], nst_pix_addr);
+        if (!nst_pix_count)
+            return api_return();
+        return api_working();
+    }
+    uint16_t xram_addr = API_AX;
+    if (xram_addr > 0x10000 - sizeof(nst_stats_t))
+        return api_return_errno(API_EINVAL);
+    nst_stats_t stats;
+    nst_get_stats(&stats);
+    memcpy(&xram[xram_addr], &stats, sizeof(stats));
+    nst_pix_addr = xram_addr;
+    nst_pix_count = sizeof(stats);
+    api_set_ax(sizeof(stats));
+    return api_working();
+}
+
+#endif /* RP6502_RIA_W */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_NST_H_
+#define _RIA_NET_NST_H_
+
+/* Network statistics.
+ * Samples lwIP connections and driver queues for STATUS NET,
+ * AT+NETSTATS? and the net_stats API.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Written to XRAM by the API, little endian.
+typedef struct __attribute__((packed))
+{
+    uint32_t bytes_in;  // TCP payload, all connections since boot
+    uint32_t bytes_out; // acknowledged by the remote
+    uint32_t rate_in;   // bytes per second, last second
+    uint32_t rate_out;
+    uint32_t segs_in;
+    uint32_t segs_out;
+    uint32_t retransmits;
+    uint16_t zero_win_remote; // remote stopped us
+    uint16_t zero_win_local;  // we stopped the remote
+    uint8_t sockets;
+    uint8_t tel_pbufs; // modem receive ring
+    uint8_t tel_pbufs_max;
+    uint8_t tel_callers;
+    uint16_t tel_bytes;
+    uint16_t mq_bytes; // MQTT receive buffer
+    uint8_t mq_waiting;
+    int8_t rssi;
+    uint16_t mq_drops;
+    uint16_t mq_overflows;
+} nst_stats_t;
+
+/* Main events
+ */
+
+void nst_task(void);
+void nst_stop(void);
+
+/* Utility
+ */
+
+void nst_get_stats(nst_stats_t *stats);
+void nst_print_status(void);
+
+/* API operations
+ */
+
+// Copy nst_stats_t into XRAM
+// A/X: uint16_t xram_addr
+// Returns: bytes written, or errno on error
+bool nst_api_stats(void);
+
+#endif /* _RIA_NET_NST_H_ */
@@ -10,12 +10,14 @@ void ntp_task() {}
 void ntp_print_status() {}
 #else
 
+#include "api/clk.h"
 #include "net/ntp.h"
+#include "net/rsv.h"
 #include "net/wfi.h"
 #include <lwip/dns.h>
 #include <lwip/udp.h>
-#include <pico/aon_timer.h>
 #include <pico/time.h>
+#include <stdio.h>
 #include <string.h>
 
 #if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_NTP)
@@ -53,13 +55,23 @@ static int ntp_retry_retry_count;
 static absolute_time_t ntp_retry_timer;
 static absolute_time_t ntp_timeout_timer;
 
+// Our transmit timestamp, echoed back as the originate timestamp.
+static uint8_t ntp_xmt[8];
+static int64_t ntp_t1_us;
+static int32_t ntp_offset_us;
+static int32_t ntp_delay_us;
+static uint32_t ntp_poll_secs;
+
 // Be aggressive 5 times then back off
 #define NTP_RETRY_RETRIES 5
 #define NTP_RETRY_RETRY_SECS 2
 #define NTP_RETRY_UNSET_SECS 60
-#define NTP_RETRY_REFRESH_SECS (24 * 3600)
 #define NTP_TIMEOUT_SECS 2
 
+// Poll quickly while the clock trains then back off.
+#define NTP_POLL_MIN_SECS 64
+#define NTP_POLL_MAX_SECS 1024
+
 static void ntp_retry(void)
 {
     if (ntp_retry_retry_count < NTP_RETRY_RETRIES)
@@ -71,6 +83,26 @@ static void ntp_retry(void)
         ntp_retry_timer = make_timeout_time_ms(NTP_RETRY_UNSET_SECS * 1000);
 }
 
+// NTP timestamps are 32.32 fixed point seconds since 1900.
+static void ntp_put_timestamp(uint8_t *buf, int64_t us)
+{
+    uint32_t sec = us / 1000000 + NTP_DELTA;
+    uint32_t frac = ((uint64_t)(us % 1000000) << 32) / 1000000;
+    for (int i = 0; i < 4; i++)
+    {
+        buf[i] = sec >> (24 - i * 8);
+        buf[4 + i] = frac >> (24 - i * 8);
+    }
+}
+
+static int64_t ntp_get_timestamp(const uint8_t *buf)
+{
+    uint32_t sec = buf[0] << 24 | buf[1] << 16 | buf[2] << 8 | buf[3];
+    uint32_t frac = buf[4] << 24 | buf[5] << 16 | buf[6] << 8 | buf[7];
+    uint32_t seconds_since_1970 = sec - NTP_DELTA;
+    return (int64_t)seconds_since_1970 * 1000000 + (((uint64_t)frac * 1000000) >> 32);
+}
+
 static void ntp_dns_found(const char *hostname, const ip_addr_t *ipaddr, void *arg)
 {
     (void)arg;
@@ -95,23 +127,36 @@ static void ntp_udp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const i
     uint8_t mode = pbuf_get_at(p, 0) & 0x7;
     uint8_t stratum = pbuf_get_at(p, 1);
 
+    int64_t t4 = clk_get_time_us();
+    uint8_t msg[NTP_MSG_LEN];
+
     if (ip_addr_cmp(addr, &ntp_server_address) &&
         port == NTP_PORT && p->tot_len == NTP_MSG_LEN &&
-        mode == 0x4 && stratum != 0)
+        mode == 0x4 && stratum != 0 &&
+        ntp_state == ntp_state_request_wait &&
+        pbuf_copy_partial(p, msg, NTP_MSG_LEN, 0) == NTP_MSG_LEN &&
+        !memcmp(&msg[24], ntp_xmt, sizeof(ntp_xmt)))
     {
-        uint8_t seconds_buf[4] = {0};
-        pbuf_copy_partial(p, seconds_buf, sizeof(seconds_buf), 40);
-        uint32_t seconds_since_1900 = seconds_buf[0] << 24 | seconds_buf[1] << 16 | seconds_buf[2] << 8 | seconds_buf[3];
-        uint32_t seconds_since_1970 = seconds_since_1900 - NTP_DELTA;
-        time_t epoch = seconds_since_1970;
-        struct timespec ts;
-        ts.tv_sec = epoch;
-        ts.tv_nsec = 0;
-        if (aon_timer_set_time(&ts))
+        // Standard on-wire offset and round trip delay.
+        int64_t t2 = ntp_get_timestamp(&msg[32]);
+        int64_t t3 = ntp_get_timestamp(&msg[40]);
+        int64_t offset = ((t2 - ntp_t1_us) + (t3 - t4)) / 2;
+        int64_t delay = (t4 - ntp_t1_us) - (t3 - t2);
+        ntp_offset_us = offset > INT32_MAX   ? INT32_MAX
+                        : offset < INT32_MIN ? INT32_MIN
+                                             : offset;
+        ntp_delay_us = delay;
+        bool was_disciplined = ntp_success_at_least_once;
+        if (clk_discipline(offset))
         {
-            DBG("NET NTP success\n");
+            DBG("NET NTP offset %ld us, delay %ld us\n",
+                (long)ntp_offset_us, (long)ntp_delay_us);
+            if (!was_disciplined || ntp_offset_us > CLK_STEP_US || ntp_offset_us < -CLK_STEP_US)
+                ntp_poll_secs = NTP_POLL_MIN_SECS;
+            else if (ntp_poll_secs < NTP_POLL_MAX_SECS)
+                ntp_poll_secs *= 2;
             ntp_success_at_least_once = true;
-            ntp_retry_timer = make_timeout_time_ms(NTP_RETRY_REFRESH_SECS * 1000);
+            ntp_retry_timer = make_timeout_time_ms(ntp_poll_secs * 1000);
             ntp_state = ntp_state_success;
         }
         else
@@ -148,7 +193,7 @@ void ntp_task(void)
         }
         break;
     case ntp_state_dns:
-        err_t err = dns_gethostbyname(NTP_SERVER, &ntp_server_address, ntp_dns_found, NULL);
+        err_t err = rsv_gethostbyname(NTP_SERVER, &ntp_server_address, ntp_dns_found, NULL);
         ntp_timeout_timer = make_timeout_time_ms(NTP_TIMEOUT_SECS * 1000);
         if (err == ERR_OK)
             ntp_state = ntp_state_request;
@@ -160,6 +205,9 @@ void ntp_task(void)
         uint8_t *req = (uint8_t *)p->payload;
         memset(req, 0, NTP_MSG_LEN);
         req[0] = 0x1b;
+        ntp_t1_us = clk_get_time_us();
+        ntp_put_timestamp(ntp_xmt, ntp_t1_us);
+        memcpy(&req[40], ntp_xmt, sizeof(ntp_xmt));
         udp_sendto(ntp_pcb, p, &ntp_server_address, NTP_PORT);
         pbuf_free(p);
         ntp_timeout_timer = make_timeout_time_ms(NTP_TIMEOUT_SECS * 1000);
@@ -214,7 +262,8 @@ void ntp_print_status(void)
         puts("set time failure");
         break;
     case ntp_state_success:
-        puts("success");
+        printf("success, offset %ld us, delay %ld us, drift %ld ppb\n",
+               (long)ntp_offset_us, (long)ntp_delay_us, (long)clk_get_freq_ppb());
         break;
     case ntp_state_internal_error:
         puts("internal error");
@@ -0,0 +1,667 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/rfs.h"
+bool rfs_is_path(const char *) { return false; }
+void rfs_reset(void) {}
+void rfs_print_status(void) {}
+FRESULT rfs_open(int *, const char *, BYTE) { return FR_INVALID_DRIVE; }
+FRESULT rfs_close(int) { return FR_INVALID_OBJECT; }
+FRESULT rfs_read(int, void *, UINT, UINT *) { return FR_INVALID_OBJECT; }
+FRESULT rfs_write(int, const void *, UINT, UINT *) { return FR_INVALID_OBJECT; }
+FRESULT rfs_lseek(int, FSIZE_t) { return FR_INVALID_OBJECT; }
+FSIZE_t rfs_tell(int) { return 0; }
+FSIZE_t rfs_size(int) { return 0; }
+FRESULT rfs_sync(int) { return FR_INVALID_OBJECT; }
+FRESULT rfs_stat(const char *, FILINFO *) { return FR_INVALID_DRIVE; }
+FRESULT rfs_opendir(int *, const char *) { return FR_INVALID_DRIVE; }
+FRESULT rfs_readdir(int, FILINFO *) { return FR_INVALID_OBJECT; }
+FRESULT rfs_rewinddir(int) { return FR_INVALID_OBJECT; }
+FRESULT rfs_closedir(int) { return FR_INVALID_OBJECT; }
+bool rfs_dir_is_open(int) { return false; }
+FRESULT rfs_unlink(const char *) { return FR_INVALID_DRIVE; }
+FRESULT rfs_rename(const char *, const char *) { return FR_INVALID_DRIVE; }
+FRESULT rfs_mkdir(const char *) { return FR_INVALID_DRIVE; }
+#else
+
+#include "main.h"
+#include "net/rfs.h"
+#include "net/rsv.h"
+#include "net/wfi.h"
+#include "sys/cfg.h"
+#include <lwip/tcp.h>
+#include <pico/time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_RFS)
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+// Requests are uint8_t op, uint8_t id, uint16_t len, payload.
+// Responses are uint8_t FRESULT, uint8_t id, uint16_t len, payload.
+// See NET_VOLUME.md for the operations.
+#define RFS_PREFIX "NET0:"
+#define RFS_PREFIX_LEN 5
+#define RFS_DEFAULT_PORT 6503
+#define RFS_HEAD_SIZE 4
+#define RFS_BUF_SIZE 2048
+#define RFS_TIMEOUT_MS 3000
+
+typedef enum
+{
+    rfs_state_closed,
+    rfs_state_dns_lookup,
+    rfs_state_connecting,
+    rfs_state_connected,
+} rfs_state_t;
+static rfs_state_t rfs_state;
+
+static struct tcp_pcb *rfs_pcb;
+static u16_t rfs_port;
+
+// Server ids are only good for the connection they came from.
+static uint32_t rfs_session;
+
+static uint8_t rfs_rx[RFS_HEAD_SIZE + RFS_BUF_SIZE];
+static size_t rfs_rx_len;
+static bool rfs_rx_overflow;
+
+typedef struct
+{
+    bool open;
+    uint8_t id;
+    BYTE mode;
+    uint32_t session;
+    FSIZE_t pos;
+    FSIZE_t size;
+} rfs_fil_t;
+static rfs_fil_t rfs_fil[RFS_FIL_MAX];
+
+typedef struct
+{
+    bool open;
+    uint8_t id;
+    uint32_t session;
+} rfs_dir_t;
+static rfs_dir_t rfs_dir[RFS_DIR_MAX];
+
+// One buffer does both read ahead and write coalescing.
+static uint8_t rfs_buf[RFS_BUF_SIZE];
+static int rfs_buf_fd = -1;
+static bool rfs_buf_dirty;
+static FSIZE_t rfs_buf_ofs;
+static size_t rfs_buf_len;
+
+static uint32_t rfs_requests;
+static uint32_t rfs_bytes_read;
+static uint32_t rfs_bytes_written;
+
+static void rfs_put_le32(uint8_t *dst, uint32_t val)
+{
+    dst[0] = val;
+    dst[1] = val >> 8;
+    dst[2] = val >> 16;
+    dst[3] = val >> 24;
+}
+
+static uint32_t rfs_get_le32(const uint8_t *src)
+{
+    return src[0] | src[1] << 8 | src[2] << 16 | (uint32_t)src[3] << 24;
+}
+
+static inline size_t rfs_rx_size(void)
+{
+    return rfs_rx[2] | rfs_rx[3] << 8;
+}
+
+static inline const uint8_t *rfs_rx_data(void)
+{
+    return &rfs_rx[RFS_HEAD_SIZE];
+}
+
+static void rfs_disconnect(void)
+{
+    if (rfs_pcb)
+    {
+        DBG("NET RFS disconnect\n");
+        tcp_arg(rfs_pcb, NULL);
+        tcp_recv(rfs_pcb, NULL);
+        tcp_err(rfs_pcb, NULL);
+        if (rfs_state != rfs_state_connected || tcp_close(rfs_pcb) != ERR_OK)
+            tcp_abort(rfs_pcb);
+        rfs_pcb = NULL;
+    }
+    rfs_state = rfs_state_closed;
+    // Buffered writes are lost with the server ids.
+    rfs_buf_fd = -1;
+    rfs_buf_dirty = false;
+}
+
+static err_t rfs_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+{
+    (void)arg;
+    (void)err;
+    if (!p)
+    {
+        rfs_disconnect();
+        return ERR_OK;
+    }
+    if (rfs_rx_len + p->tot_len > sizeof(rfs_rx))
+        rfs_rx_overflow = true;
+    else
+    {
+        pbuf_copy_partial(p, &rfs_rx[rfs_rx_len], p->tot_len, 0);
+        rfs_rx_len += p->tot_len;
+    }
+    tcp_recved(tpcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+static void rfs_err(void *arg, err_t err)
+{
+    (void)arg;
+    (void)err;
+    DBG("NET RFS tcp_err %d\n", err);
+    rfs_pcb = NULL;
+    rfs_state = rfs_state_closed;
+}
+
+static err_t rfs_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
+{
+    (void)arg;
+    (void)tpcb;
+    (void)err;
+    DBG("NET RFS connected\n");
+    rfs_state = rfs_state_connected;
+    return ERR_OK;
+}
+
+static void rfs_dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    (void)name;
+    (void)arg;
+    if (rfs_state != rfs_state_dns_lookup)
+        return;
+    if (!ipaddr)
+    {
+        DBG("NET RFS DNS did not resolve\n");
+        rfs_state = rfs_state_closed;
+        return;
+    }
+    rfs_pcb = tcp_new_ip_type(IP_GET_TYPE(ipaddr));
+    if (!rfs_pcb)
+    {
+        rfs_state = rfs_state_closed;
+        return;
+    }
+    rfs_state = rfs_state_connecting;
+    tcp_nagle_disable(rfs_pcb);
+    tcp_err(rfs_pcb, rfs_err);
+    tcp_recv(rfs_pcb, rfs_recv);
+    if (tcp_connect(rfs_pcb, ipaddr, rfs_port, rfs_connected) != ERR_OK)
+    {
+        DBG("NET RFS tcp_connect failed\n");
+        rfs_disconnect();
+    }
+}
+
+static FRESULT rfs_connect(void)
+{
+    if (rfs_state == rfs_state_connected)
+        return FR_OK;
+    rfs_disconnect();
+    char host[65];
+    strcpy(host, cfg_get_net_volume());
+    if (!host[0])
+        return FR_INVALID_DRIVE;
+    if (!wfi_ready())
+        return FR_NOT_READY;
+    rfs_port = RFS_DEFAULT_PORT;
+    char *colon = strrchr(host, ':');
+    if (colon)
+    {
+        *colon = 0;
+        rfs_port = strtoul(colon + 1, NULL, 10);
+    }
+    ip_addr_t ipaddr;
+    rfs_state = rfs_state_dns_lookup;
+    err_t err = rsv_gethostbyname(host, &ipaddr, rfs_dns_found, NULL);
+    if (err == ERR_OK)
+        rfs_dns_found(host, &ipaddr, NULL);
+    else if (err != ERR_INPROGRESS)
+        rfs_state = rfs_state_closed;
+    absolute_time_t deadline = make_timeout_time_ms(RFS_TIMEOUT_MS);
+    while (rfs_state == rfs_state_dns_lookup ||
+           rfs_state == rfs_state_connecting)
+    {
+        if (time_reached(deadline))
+        {
+            rfs_disconnect();
+            return FR_TIMEOUT;
+        }
+        main_task();
+    }
+    if (rfs_state != rfs_state_connected)
+        return FR_NOT_READY;
+    rfs_session++;
+    return FR_OK;
+}
+
+static bool rfs_live(uint32_t session)
+{
+    return rfs_state == rfs_state_connected && session == rfs_session;
+}
+
+static bool rfs_send(const void *data, size_t len, absolute_time_t deadline)
+{
+    const uint8_t *src = data;
+    while (len)
+    {
+        if (rfs_state != rfs_state_connected)
+            return false;
+        size_t n = tcp_sndbuf(rfs_pcb);
+        if (n > len)
+            n = len;
+        if (n && tcp_write(rfs_pcb, src, n, TCP_WRITE_FLAG_COPY) == ERR_OK)
+        {
+            src += n;
+            len -= n;
+            continue;
+        }
+        tcp_output(rfs_pcb);
+        if (time_reached(deadline))
+            return false;
+        main_task();
+    }
+    return true;
+}
+
+// Blocks for the response like USB storage does. The
+// payload is sent in two parts to avoid another copy.
+static FRESULT rfs_request(uint8_t op, uint8_t id,
+                           const void *a, size_t a_len,
+                           const void *b, size_t b_len)
+{
+    FRESULT fresult = rfs_connect();
+    if (fresult != FR_OK)
+        return fresult;
+    size_t len = a_len + b_len;
+    uint8_t head[RFS_HEAD_SIZE] = {op, id, len, len >> 8};
+    absolute_time_t deadline = make_timeout_time_ms(RFS_TIMEOUT_MS);
+    rfs_rx_len = 0;
+    rfs_rx_overflow = false;
+    rfs_requests++;
+    if (!rfs_send(head, sizeof(head), deadline) ||
+        !rfs_send(a, a_len, deadline) ||
+        !rfs_send(b, b_len, deadline))
+    {
+        rfs_disconnect();
+        return FR_DISK_ERR;
+    }
+    tcp_output(rfs_pcb);
+    while (!rfs_rx_overflow &&
+           (rfs_rx_len < RFS_HEAD_SIZE ||
+            rfs_rx_len < RFS_HEAD_SIZE + rfs_rx_size()))
+    {
+        if (rfs_state != rfs_state_connected || time_reached(deadline))
+        {
+            DBG("NET RFS no response to '%c'\n", op);
+            rfs_disconnect();
+            return FR_DISK_ERR;
+        }
+        main_task();
+    }
+    if (rfs_rx_overflow)
+    {
+        rfs_disconnect();
+        return FR_INT_ERR;
+    }
+    return rfs_rx[0];
+}
+
+static FRESULT rfs_request_path(uint8_t op, const char *path)
+{
+    const char *name = path + RFS_PREFIX_LEN;
+    return rfs_request(op, 0, name, strlen(name), NULL, 0);
+}
+
+static FRESULT rfs_flush(void)
+{
+    if (!rfs_buf_dirty)
+        return FR_OK;
+    rfs_buf_dirty = false;
+    rfs_fil_t *fp = &rfs_fil[rfs_buf_fd];
+    if (!rfs_live(fp->session))
+        return FR_INVALID_OBJECT;
+    uint8_t ofs[4];
+    rfs_put_le32(ofs, rfs_buf_ofs);
+    FRESULT fresult = rfs_request('W', fp->id, ofs, sizeof(ofs), rfs_buf, rfs_buf_len);
+    if (fresult != FR_OK)
+        rfs_buf_fd = -1;
+    else
+        rfs_bytes_written += rfs_buf_len;
+    return fresult;
+}
+
+static rfs_fil_t *rfs_get_fil(int fd)
+{
+    if (fd < 0 || fd >= RFS_FIL_MAX || !rfs_fil[fd].open)
+        return NULL;
+    return &rfs_fil[fd];
+}
+
+static rfs_dir_t *rfs_get_dir(int des)
+{
+    if (des < 0 || des >= RFS_DIR_MAX || !rfs_dir[des].open)
+        return NULL;
+    return &rfs_dir[des];
+}
+
+static FRESULT rfs_get_filinfo(FILINFO *fno)
+{
+    // uint32_t size, uint16_t date, uint16_t time, uint8_t attr, name
+    const uint8_t *data = rfs_rx_data();
+    size_t size = rfs_rx_size();
+    memset(fno, 0, sizeof(FILINFO));
+    if (!size)
+        return FR_OK;
+    if (size < 9)
+        return FR_INT_ERR;
+    fno->fsize = rfs_get_le32(data);
+    fno->fdate = fno->crdate = data[4] | data[5] << 8;
+    fno->ftime = fno->crtime = data[6] | data[7] << 8;
+    fno->fattrib = data[8];
+    size_t len = size - 9;
+    if (len > FF_LFN_BUF)
+        len = FF_LFN_BUF;
+    memcpy(fno->fname, &data[9], len);
+    return FR_OK;
+}
+
+bool rfs_is_path(const char *path)
+{
+    return !strncasecmp(path, RFS_PREFIX, RFS_PREFIX_LEN);
+}
+
+void rfs_reset(void)
+{
+    rfs_disconnect();
+}
+
+void rfs_print_status(void)
+{
+    const char *server = cfg_get_net_volume();
+    printf("NET0: ");
+    if (!server[0])
+        puts("off");
+    else if (rfs_state != rfs_state_connected)
+        printf("%s, not connected\n", server);
+    else
+        printf("%s, %lu requests, %lu bytes read, %lu written\n", server,
+               (unsigned long)rfs_requests,
+               (unsigned long)rfs_bytes_read,
+               (unsigned long)rfs_bytes_written);
+}
+
+FRESULT rfs_open(int *fd, const char *path, BYTE mode)
+{
+    int i = 0;
+    for (; i < RFS_FIL_MAX; i++)
+        if (!rfs_fil[i].open)
+            break;
+    if (i == RFS_FIL_MAX)
+        return FR_TOO_MANY_OPEN_FILES;
+    const char *name = path + RFS_PREFIX_LEN;
+    FRESULT fresult = rfs_request('O', 0, &mode, 1, name, strlen(name));
+    if (fresult != FR_OK)
+        return fresult;
+    if (rfs_rx_size() < 4)
+        return FR_INT_ERR;
+    rfs_fil_t *fp = &rfs_fil[i];
+    fp->open = true;
+    fp->id = rfs_rx[1];
+    fp->mode = mode;
+    fp->session = rfs_session;
+    fp->size = rfs_get_le32(rfs_rx_data());
+    fp->pos = (mode & FA_OPEN_APPEND) == FA_OPEN_APPEND ? fp->size : 0;
+    *fd = i;
+    return FR_OK;
+}
+
+FRESULT rfs_close(int fd)
+{
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    if (!fp)
+        return FR_INVALID_OBJECT;
+    FRESULT fresult = FR_OK;
+    if (rfs_buf_fd == fd)
+    {
+        fresult = rfs_flush();
+        rfs_buf_fd = -1;
+    }
+    fp->open = false;
+    if (!rfs_live(fp->session))
+        return FR_INVALID_OBJECT;
+    FRESULT close_result = rfs_request('C', fp->id, NULL, 0, NULL, 0);
+    return fresult != FR_OK ? fresult : close_result;
+}
+
+FRESULT rfs_read(int fd, void *buf, UINT btr, UINT *br)
+{
+    *br = 0;
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    if (!fp)
+        return FR_INVALID_OBJECT;
+    if (!(fp->mode & FA_READ))
+        return FR_DENIED;
+    FRESULT fresult = rfs_flush();
+    if (fresult != FR_OK)
+        return fresult;
+    uint8_t *dst = buf;
+    while (btr)
+    {
+        if (rfs_buf_fd != fd ||
+            fp->pos < rfs_buf_ofs ||
+            fp->pos >= rfs_buf_ofs + rfs_buf_len)
+        {
+            if (!rfs_live(fp->session))
+                return FR_INVALID_OBJECT;
+            // Read ahead a whole buffer.
+            uint8_t args[6];
+            rfs_put_le32(args, fp->pos);
+            args[4] = RFS_BUF_SIZE & 0xFF;
+            args[5] = RFS_BUF_SIZE >> 8;
+            rfs_buf_fd = -1;
+            fresult = rfs_request('R', fp->id, args, sizeof(args), NULL, 0);
+            if (fresult != FR_OK)
+                return fresult;
+            size_t len = rfs_rx_size();
+            if (!len) // end of file
+                break;
+            memcpy(rfs_buf, rfs_rx_data(), len);
+            rfs_buf_fd = fd;
+            rfs_buf_ofs = fp->pos;
+            rfs_buf_len = len;
+            rfs_bytes_read += len;
+        }
+        size_t skip = fp->pos - rfs_buf_ofs;
+        size_t n = rfs_buf_len - skip;
+        if (n > btr)
+            n = btr;
+        memcpy(dst, &rfs_buf[skip], n);
+        dst += n;
+        btr -= n;
+        *br += n;
+        fp->pos += n;
+    }
+    return FR_OK;
+}
+
+// Errors from coalesced writes are returned by a later
+// write, sync or close, the same as a POSIX write cache.
+FRESULT rfs_write(int fd, const void *buf, UINT btw, UINT *bw)
+{
+    *bw = 0;
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    if (!fp)
+        return FR_INVALID_OBJECT;
+    if (!(fp->mode & FA_WRITE))
+        return FR_DENIED;
+    if (!rfs_live(fp->session))
+        return FR_INVALID_OBJECT;
+    const uint8_t *src = buf;
+    while (btw)
+    {
+        if (rfs_buf_fd != fd || !rfs_buf_dirty ||
+            fp->pos != rfs_buf_ofs + rfs_buf_len ||
+            rfs_buf_len == RFS_BUF_SIZE)
+        {
+            FRESULT fresult = rfs_flush();
+            if (fresult != FR_OK)
+                return fresult;
+            rfs_buf_fd = fd;
+            rfs_buf_dirty = true;
+            rfs_buf_ofs = fp->pos;
+            rfs_buf_len = 0;
+        }
+        size_t n = RFS_BUF_SIZE - rfs_buf_len;
+        if (n > btw)
+            n = btw;
+        memcpy(&rfs_buf[rfs_buf_len], src, n);
+        rfs_buf_len += n;
+        src += n;
+        btw -= n;
+        *bw += n;
+        fp->pos += n;
+        if (fp->size < fp->pos)
+            fp->size = fp->pos;
+    }
+    return FR_OK;
+}
+
+FRESULT rfs_lseek(int fd, FSIZE_t ofs)
+{
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    if (!fp)
+        return FR_INVALID_OBJECT;
+    // Same as FatFs, read only files clip to the end.
+    if (!(fp->mode & FA_WRITE) && ofs > fp->size)
+        ofs = fp->size;
+    fp->pos = ofs;
+    return FR_OK;
+}
+
+FSIZE_t rfs_tell(int fd)
+{
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    return fp ? fp->pos : 0;
+}
+
+FSIZE_t rfs_size(int fd)
+{
+    rfs_fil_t *fp = rfs_get_fil(fd);
+    return fp ? fp->size : 0;
+}
+
+FRESULT rfs_sync(int fd)
+{
+    if (!rfs_get_fil(fd))
+        return FR_INVALID_OBJECT;
+    if (rfs_buf_fd == fd)
+        return rfs_flush();
+    return FR_OK;
+}
+
+FRESULT rfs_stat(const char *path, FILINFO *fno)
+{
+    FRESULT fresult = rfs_request_path('S', path);
+    if (fresult != FR_OK)
+        return fresult;
+    return rfs_get_filinfo(fno);
+}
+
+FRESULT rfs_opendir(int *des, const char *path)
+{
+    int i = 0;
+    for (; i < RFS_DIR_MAX; i++)
+        if (!rfs_dir[i].open)
+            break;
+    if (i == RFS_DIR_MAX)
+        return FR_TOO_MANY_OPEN_FILES;
+    FRESULT fresult = rfs_request_path('D', path);
+    if (fresult != FR_OK)
+        return fresult;
+    rfs_dir[i].open = true;
+    rfs_dir[i].id = rfs_rx[1];
+    rfs_dir[i].session = rfs_session;
+    *des = i;
+    return FR_OK;
+}
+
+FRESULT rfs_readdir(int des, FILINFO *fno)
+{
+    rfs_dir_t *dp = rfs_get_dir(des);
+    if (!dp || !rfs_live(dp->session))
+        return FR_INVALID_OBJECT;
+    FRESULT fresult = rfs_request('N', dp->id, NULL, 0, NULL, 0);
+    if (fresult != FR_OK)
+        return fresult;
+    return rfs_get_filinfo(fno);
+}
+
+FRESULT rfs_rewinddir(int des)
+{
+    rfs_dir_t *dp = rfs_get_dir(des);
+    if (!dp || !rfs_live(dp->session))
+        return FR_INVALID_OBJECT;
+    return rfs_request('A', dp->id, NULL, 0, NULL, 0);
+}
+
+FRESULT rfs_closedir(int des)
+{
+    rfs_dir_t *dp = rfs_get_dir(des);
+    if (!dp)
+        return FR_INVALID_OBJECT;
+    dp->open = false;
+    if (!rfs_live(dp->session))
+        return FR_INVALID_OBJECT;
+    return rfs_request('C', dp->id, NULL, 0, NULL, 0);
+}
+
+bool rfs_dir_is_open(int des)
+{
+    return rfs_get_dir(des) != NULL;
+}
+
+FRESULT rfs_unlink(const char *path)
+{
+    return rfs_request_path('U', path);
+}
+
+FRESULT rfs_rename(const char *path_old, const char *path_new)
+{
+    if (!rfs_is_path(path_new))
+        return FR_INVALID_DRIVE;
+    // Names are separated by a zero.
+    const char *name_old = path_old + RFS_PREFIX_LEN;
+    const char *name_new = path_new + RFS_PREFIX_LEN;
+    return rfs_request('V', 0, name_old, strlen(name_old) + 1,
+                       name_new, strlen(name_new));
+}
+
+FRESULT rfs_mkdir(const char *path)
+{
+    return rfs_request_path('M', path);
+}
+
+#endif /* RP6502_RIA_W */
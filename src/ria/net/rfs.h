@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_RFS_H_
+#define _RIA_NET_RFS_H_
+
+/* Remote file system.
+ * Paths starting with NET0: go to a host directory served by
+ * rfs_server.py. Calls mirror FatFs and block like USB storage.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fatfs/ff.h"
+
+#define RFS_FIL_MAX 4
+#define RFS_DIR_MAX 2
+
+/* Utility
+ */
+
+// True when path is on the NET0: volume.
+bool rfs_is_path(const char *path);
+
+// Drop the connection, the server changed.
+void rfs_reset(void);
+void rfs_print_status(void);
+
+/* FatFs style file access. fd and des start at 0.
+ */
+
+FRESULT rfs_open(int *fd, const char *path, BYTE mode);
+FRESULT rfs_close(int fd);
+FRESULT rfs_read(int fd, void *buf, UINT btr, UINT *br);
+FRESULT rfs_write(int fd, const void *buf, UINT btw, UINT *bw);
+FRESULT rfs_lseek(int fd, FSIZE_t ofs);
+FSIZE_t rfs_tell(int fd);
+FSIZE_t rfs_size(int fd);
+FRESULT rfs_sync(int fd);
+FRESULT rfs_stat(const char *path, FILINFO *fno);
+FRESULT rfs_opendir(int *des, const char *path);
+FRESULT rfs_readdir(int des, FILINFO *fno);
+FRESULT rfs_rewinddir(int des);
+FRESULT rfs_closedir(int des);
+bool rfs_dir_is_open(int des);
+FRESULT rfs_unlink(const char *path);
+FRESULT rfs_rename(const char *path_old, const char *path_new);
+FRESULT rfs_mkdir(const char *path);
+
+#endif /* _RIA_NET_RFS_H_ */
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/rsv.h"
+void rsv_task(void) {}
+void rsv_print_status(void) {}
+#else
+
+#include "net/rsv.h"
+#include <pico/time.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_RSV)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+// Unicast servers rarely send a usable negative TTL
+// through lwIP, so failures are held for a fixed time.
+#define RSV_NEGATIVE_SECS 30
+#define RSV_NEGATIVE_MAX 4
+#define RSV_PENDING_MAX 4
+#define RSV_NAME_MAX 64
+
+typedef struct
+{
+    bool in_use;
+    bool negative;
+    dns_found_callback found;
+    void *arg;
+    char name[RSV_NAME_MAX];
+} rsv_pending_t;
+static rsv_pending_t rsv_pending[RSV_PENDING_MAX];
+
+typedef struct
+{
+    char name[RSV_NAME_MAX];
+    absolute_time_t expires;
+} rsv_negative_t;
+static rsv_negative_t rsv_negative[RSV_NEGATIVE_MAX];
+
+static uint32_t rsv_count_local;
+static uint32_t rsv_count_network;
+static uint32_t rsv_count_negative;
+
+static rsv_negative_t *rsv_negative_find(const char *name)
+{
+    for (int i = 0; i < RSV_NEGATIVE_MAX; i++)
+    {
+        rsv_negative_t *neg = &rsv_negative[i];
+        if (!neg->name[0])
+            continue;
+        if (absolute_time_diff_us(get_absolute_time(), neg->expires) < 0)
+            neg->name[0] = 0;
+        else if (!strcasecmp(neg->name, name))
+            return neg;
+    }
+    return NULL;
+}
+
+static void rsv_negative_add(const char *name)
+{
+    if (strlen(name) >= RSV_NAME_MAX)
+        return;
+    rsv_negative_t *neg = rsv_negative_find(name);
+    for (int i = 0; !neg && i < RSV_NEGATIVE_MAX; i++)
+        if (!rsv_negative[i].name[0])
+            neg = &rsv_negative[i];
+    if (!neg) // evict the oldest
+    {
+        neg = &rsv_negative[0];
+        for (int i = 1; i < RSV_NEGATIVE_MAX; i++)
+            if (absolute_time_diff_us(rsv_negative[i].expires, neg->expires) > 0)
+                neg = &rsv_negative[i];
+    }
+    strcpy(neg->name, name);
+    neg->expires = make_timeout_time_ms(RSV_NEGATIVE_SECS * 1000);
+}
+
+static rsv_pending_t *rsv_pending_alloc(const char *name,
+                                        dns_found_callback found, void *arg)
+{
+    if (strlen(name) >= RSV_NAME_MAX)
+        return NULL;
+    for (int i = 0; i < RSV_PENDING_MAX; i++)
+    {
+        rsv_pending_t *pend = &rsv_pending[i];
+        if (!pend->in_use)
+        {
+            pend->in_use = true;
+            pend->negative = false;
+            pend->found = found;
+            pend->arg = arg;
+            strcpy(pend->name, name);
+            return pend;
+        }
+    }
+    return NULL;
+}
+
+static void rsv_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    rsv_pending_t *pend = (rsv_pending_t *)arg;
+    dns_found_callback found = pend->found;
+    void *found_arg = pend->arg;
+    pend->in_use = false;
+    if (!ipaddr)
+    {
+        DBG("NET RSV %s did not resolve\n", name);
+        rsv_negative_add(name);
+    }
+    found(name, ipaddr, found_arg);
+}
+
+err_t rsv_gethostbyname(const char *hostname, ip_addr_t *addr,
+                        dns_found_callback found, void *arg)
+{
+    if (rsv_negative_find(hostname))
+    {
+        rsv_pending_t *pend = rsv_pending_alloc(hostname, found, arg);
+        if (!pend)
+            return ERR_VAL;
+        DBG("NET RSV %s negative hit\n", hostname);
+        rsv_count_negative++;
+        pend->negative = true;
+        return ERR_INPROGRESS;
+    }
+    rsv_pending_t *pend = rsv_pending_alloc(hostname, found, arg);
+    err_t err = pend ? dns_gethostbyname(hostname, addr, rsv_found, pend)
+                     : dns_gethostbyname(hostname, addr, found, arg);
+    if (err == ERR_INPROGRESS)
+        rsv_count_network++;
+    else if (pend)
+        pend->in_use = false;
+    if (err == ERR_OK)
+        rsv_count_local++;
+    return err;
+}
+
+void rsv_task(void)
+{
+    // Negative hits complete here so callers see the
+    // same order of events as a failed network lookup.
+    for (int i = 0; i < RSV_PENDING_MAX; i++)
+    {
+        rsv_pending_t *pend = &rsv_pending[i];
+        if (pend->in_use && pend->negative)
+        {
+            pend->in_use = false;
+            pend->found(pend->name, NULL, pend->arg);
+        }
+    }
+}
+
+void rsv_print_status(void)
+{
+    printf("DNS : %lu cached, %lu queried, %lu cached failures\n",
+           (unsigned long)rsv_count_local,
+           (unsigned long)rsv_count_network,
+           (unsigned long)rsv_count_negative);
+}
+
+#endif /* RP6502_RIA_W */
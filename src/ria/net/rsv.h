@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_RSV_H_
+#define _RIA_NET_RSV_H_
+
+/* Caching name resolver.
+ * Positive answers live in the lwIP table until their TTL expires.
+ * Failures are remembered here so retries don't wait on the network.
+ * Names ending in .local are resolved with mDNS.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void rsv_task(void);
+
+/* Utility
+ */
+
+void rsv_print_status(void);
+
+#ifdef RP6502_RIA_W
+#include <lwip/dns.h>
+
+// Drop-in for dns_gethostbyname(). Cached failures return
+// ERR_INPROGRESS and the callback fires from rsv_task().
+err_t rsv_gethostbyname(const char *hostname, ip_addr_t *addr,
+                        dns_found_callback found, void *arg);
+#endif
+
+#endif /* _RIA_NET_RSV_H_ */
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RP6502_RIA_W
+#include "net/scr.h"
+void scr_init(void) {}
+void scr_task(void) {}
+void scr_set_port(uint16_t) {}
+void scr_print_status(void) {}
+#else
+
+#include "mon/snp.h"
+#include "net/scr.h"
+#include "net/wfi.h"
+#include "sys/cfg.h"
+#include "sys/mem.h"
+#include <lwip/tcp.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_SCR)
+#include <stdio.h>
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+// The stream starts with this, then messages follow.
+// 'X' uint16_t len, xreg log
+// 'P' uint8_t page, uint16_t size, PackBits of 256 bytes
+// 'F' uint8_t vsync, end of one update
+#define SCR_MAGIC "RP6502D1"
+#define SCR_PAGE_SIZE 256
+
+static uint16_t scr_port;
+static struct tcp_pcb *scr_listen_pcb;
+static struct tcp_pcb *scr_pcb;
+static bool scr_hello_sent;
+static bool scr_log_sent;
+static uint32_t scr_log_version;
+static uint16_t scr_page;
+static bool scr_scanning;
+static bool scr_frame_pending;
+static uint8_t scr_vsync;
+static uint32_t scr_frames;
+static uint32_t scr_bytes;
+
+static void scr_disconnect(void)
+{
+    if (!scr_pcb)
+        return;
+    DBG("NET SCR disconnect\n");
+    tcp_arg(scr_pcb, NULL);
+    tcp_recv(scr_pcb, NULL);
+    tcp_err(scr_pcb, NULL);
+    if (tcp_close(scr_pcb) != ERR_OK)
+        tcp_abort(scr_pcb);
+    scr_pcb = NULL;
+}
+
+static err_t scr_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+{
+    (void)arg;
+    (void)err;
+    if (!p)
+    {
+        scr_disconnect();
+        return ERR_OK;
+    }
+    // The viewer has nothing to say.
+    tcp_recved(tpcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+static void scr_err(void *arg, err_t err)
+{
+    (void)arg;
+    (void)err;
+    DBG("NET SCR tcp_err %d\n", err);
+    scr_pcb = NULL;
+}
+
+static err_t scr_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
+{
+    (void)arg;
+    if (err != ERR_OK || !newpcb)
+        return ERR_VAL;
+    // One viewer at a time.
+    if (scr_pcb)
+    {
+        tcp_abort(newpcb);
+        return ERR_ABRT;
+    }
+    DBG("NET SCR connect\n");
+    scr_pcb = newpcb;
+    tcp_nagle_disable(scr_pcb);
+    tcp_recv(scr_pcb, scr_recv);
+    tcp_err(scr_pcb, scr_err);
+    scr_hello_sent = false;
+    scr_log_sent = false;
+    scr_scanning = false;
+    scr_frame_pending = false;
+    memset((void *)xram_dirty, 1, sizeof(xram_dirty));
+    return ERR_OK;
+}
+
+static void scr_listen(void)
+{
+    struct tcp_pcb *pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+    if (!pcb)
+        return;
+    if (tcp_bind(pcb, IP_ANY_TYPE, scr_port) != ERR_OK)
+    {
+        DBG("NET SCR tcp_bind failed\n");
+        tcp_close(pcb);
+        return;
+    }
+    scr_listen_pcb = tcp_listen(pcb);
+    if (!scr_listen_pcb)
+    {
+        tcp_close(pcb);
+        return;
+    }
+    tcp_accept(scr_listen_pcb, scr_accept);
+}
+
+static bool scr_write(const void *data, u16_t len)
+{
+    if (tcp_sndbuf(scr_pcb) < len)
+        return false;
+    err_t err = tcp_write(scr_pcb, data, len, TCP_WRITE_FLAG_COPY);
+    if (err != ERR_OK)
+        return false;
+    scr_bytes += len;
+    return true;
+}
+
+// Returns false when out of send buffer.
+static bool scr_send_log(void)
+{
+    size_t len;
+    uint32_t version;
+    const uint8_t *log = snp_get_xreg_log(&len, &version);
+    if (scr_log_sent && version == scr_log_version)
+        return true;
+    uint8_t head[3] = {'X', len, len >> 8};
+    if (tcp_sndbuf(scr_pcb) < sizeof(head) + len)
+        return false;
+    if (!scr_write(head, sizeof(head)) || !scr_write(log, len))
+    {
+        // A half sent message can't be taken back.
+        scr_disconnect();
+        return false;
+    }
+    scr_log_sent = true;
+    scr_frame_pending = true;
+    scr_log_version = version;
+    return true;
+}
+
+static bool scr_send_page(uint8_t page)
+{
+    static uint8_t msg[4 + SCR_PAGE_SIZE + SCR_PAGE_SIZE / 128];
+    // A page changes while packing, so clear first.
+    xram_dirty[page] = 0;
+    size_t size = snp_pack(&xram[page * SCR_PAGE_SIZE], SCR_PAGE_SIZE, &msg[4]);
+    msg[0] = 'P';
+    msg[1] = page;
+    msg[2] = size;
+    msg[3] = size >> 8;
+    if (scr_write(msg, 4 + size))
+        return true;
+    xram_dirty[page] = 1;
+    return false;
+}
+
+// At most one scan of the dirty pages per vsync.
+static void scr_update(void)
+{
+    uint8_t vsync = REGS(0xFFE3);
+    if (!scr_scanning)
+    {
+        if (vsync == scr_vsync && scr_hello_sent)
+            return;
+        scr_vsync = vsync;
+        scr_scanning = true;
+        scr_page = 0;
+    }
+    if (!scr_hello_sent)
+    {
+        if (!scr_write(SCR_MAGIC, 8))
+            return;
+        scr_hello_sent = true;
+    }
+    if (!scr_send_log() || !scr_pcb)
+        return;
+    for (; scr_page < XRAM_PAGES; scr_page++)
+        if (xram_dirty[scr_page])
+        {
+            if (!scr_send_page(scr_page))
+                return;
+            scr_frame_pending = true;
+        }
+    if (scr_frame_pending)
+    {
+        uint8_t msg[2] = {'F', vsync};
+        if (!scr_write(msg, sizeof(msg)))
+            return;
+        scr_frame_pending = false;
+        scr_frames++;
+    }
+    scr_scanning = false;
+}
+
+void scr_init(void)
+{
+    scr_set_port(cfg_get_screen_port());
+}
+
+void scr_task(void)
+{
+    if (!scr_listen_pcb && scr_port && wfi_ready())
+        scr_listen();
+    if (!scr_pcb)
+        return;
+    scr_update();
+    if (scr_pcb)
+        tcp_output(scr_pcb);
+}
+
+void scr_set_port(uint16_t port)
+{
+    if (port == scr_port)
+        return;
+    scr_disconnect();
+    if (scr_listen_pcb)
+    {
+        tcp_close(scr_listen_pcb);
+        scr_listen_pcb = NULL;
+    }
+    scr_port = port;
+}
+
+void scr_print_status(void)
+{
+    printf("SCRN: ");
+    if (!scr_port)
+        puts("off");
+    else if (!scr_listen_pcb)
+        printf("port %u, waiting for WiFi\n", scr_port);
+    else if (!scr_pcb)
+        printf("port %u, no viewer\n", scr_port);
+    else
+        printf("port %u, %lu frames, %lu bytes\n", scr_port,
+               (unsigned long)scr_frames, (unsigned long)scr_bytes);
+}
+
+#endif /* RP6502_RIA_W */
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_NET_SCR_H_
+#define _RIA_NET_SCR_H_
+
+/* Remote screen server.
+ * Streams dirty XRAM pages and VGA programming to a host viewer.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void scr_init(void);
+void scr_task(void);
+
+/* Utility
+ */
+
+// Listen on port, 0 to stop.
+void scr_set_port(uint16_t port);
+void scr_print_status(void);
+
+#endif /* _RIA_NET_SCR_H_ */
@@ -7,6 +7,8 @@
 #ifdef RP6502_RIA_W
 
 #include "net/mdm.h"
+#include "net/mdn.h"
+#include "net/rsv.h"
 #include "net/tel.h"
 #include <string.h>
 #include <lwip/tcp.h>
@@ -36,6 +38,67 @@ struct pbuf *tel_pbufs[PBUF_POOL_SIZE];
 static uint8_t tel_pbuf_head;
 static uint8_t tel_pbuf_tail;
 static u16_t tel_pbuf_pos;
+static uint8_t tel_pbuf_max;
+
+// Inbound callers wait here, oldest first, until answered.
+// Each keeps what it sends before the answer. Past the limit,
+// lwIP holds the data and the TCP window closes on the caller.
+// The queue is the listen backlog, lwIP accepts immediately.
+#define TEL_CALLERS_MAX LWP_TEL_CALLERS_MAX
+#define TEL_CALLER_RX_MAX 512
+typedef struct
+{
+    struct tcp_pcb *pcb;
+    struct pbuf *rx;
+} tel_caller_t;
+static tel_caller_t tel_callers[TEL_CALLERS_MAX];
+static uint8_t tel_caller_count;
+static struct tcp_pcb *tel_listen_pcb;
+static u16_t tel_listen_port;
+
+// Telnet protocol, RFC 854. Options are answered here so the
+// 6502 only sees data. The filter reads in place from the pbufs.
+#define TEL_IAC 255
+#define TEL_DONT 254
+#define TEL_DO 253
+#define TEL_WONT 252
+#define TEL_WILL 251
+#define TEL_SB 250
+#define TEL_SE 240
+#define TEL_OPT_BINARY 0
+#define TEL_OPT_ECHO 1
+#define TEL_OPT_SGA 3
+#define TEL_OPT_TTYPE 24
+#define TEL_OPT_NAWS 31
+#define TEL_TTYPE_IS 0
+#define TEL_TTYPE_SEND 1
+// The VGA console.
+#define TEL_NAWS_COLS 80
+#define TEL_NAWS_ROWS 30
+#define TEL_REPLY_MAX 64
+typedef enum
+{
+    tel_iac_data,
+    tel_iac_cr,
+    tel_iac_cmd,
+    tel_iac_opt,
+    tel_iac_sb,
+    tel_iac_sb_data,
+    tel_iac_sb_iac,
+} tel_iac_state_t;
+static bool tel_telnet;
+static bool tel_answered;
+static tel_iac_state_t tel_iac_state;
+static uint8_t tel_iac_verb;
+static uint8_t tel_sb_opt;
+static int tel_sb_cmd;
+static uint32_t tel_opt_us;
+static uint32_t tel_opt_him;
+static uint8_t tel_reply[TEL_REPLY_MAX];
+static u16_t tel_reply_len;
+
+// Escaped data goes out in one write so a doubled IAC is never split.
+static char tel_tx_buf[TCP_MSS];
 
 err_t tel_close(void)
 {
@@ -79,7 +142,7 @@ err_t tel_close(void)
     return ERR_OK;
 }
 
-int tel_rx(char *ch)
+static int tel_rx_raw(char *ch)
 {
     if (tel_pbuf_head == tel_pbuf_tail)
         return 0;
@@ -106,20 +169,275 @@ int tel_rx(char *ch)
     return 1;
 }
 
-bool tel_tx(char *ch, u16_t len)
+static void tel_reply_bytes(const uint8_t *bytes, u16_t len)
+{
+    // Dropped if full, the queue is far bigger than any burst
+    // of negotiation and is flushed as soon as TCP has room.
+    if (tel_reply_len + len <= TEL_REPLY_MAX)
+    {
+        memcpy(&tel_reply[tel_reply_len], bytes, len);
+        tel_reply_len += len;
+    }
+}
+
+static void tel_reply_opt(uint8_t verb, uint8_t opt)
+{
+    const uint8_t cmd[] = {TEL_IAC, verb, opt};
+    tel_reply_bytes(cmd, sizeof(cmd));
+}
+
+static void tel_reply_flush(void)
+{
+    if (!tel_reply_len || !tel_pcb || tel_state != tel_state_connected)
+        return;
+    if (tcp_sndbuf(tel_pcb) < tel_reply_len)
+        return;
+    if (tcp_write(tel_pcb, tel_reply, tel_reply_len, TCP_WRITE_FLAG_COPY) == ERR_OK)
+    {
+        tcp_output(tel_pcb);
+        tel_reply_len = 0;
+    }
+}
+
+static void tel_reply_naws(void)
+{
+    const uint8_t sb[] = {TEL_IAC, TEL_SB, TEL_OPT_NAWS,
+                          0, TEL_NAWS_COLS, 0, TEL_NAWS_ROWS,
+                          TEL_IAC, TEL_SE};
+    tel_reply_bytes(sb, sizeof(sb));
+}
+
+// Options the RIA will perform when asked with DO.
+static bool tel_opt_us_ok(uint8_t opt)
+{
+    switch (opt)
+    {
+    case TEL_OPT_BINARY:
+    case TEL_OPT_SGA:
+    case TEL_OPT_TTYPE:
+    case TEL_OPT_NAWS:
+        return true;
+    case TEL_OPT_ECHO:
+        return tel_answered; // the 6502 is the server
+    }
+    return false;
+}
+
+// Options the RIA accepts from the remote with WILL.
+static bool tel_opt_him_ok(uint8_t opt)
+{
+    switch (opt)
+    {
+    case TEL_OPT_BINARY:
+    case TEL_OPT_SGA:
+        return true;
+    case TEL_OPT_ECHO:
+        return !tel_answered;
+    }
+    return false;
+}
+
+// Only state changes are answered, so negotiation can't loop.
+static void tel_negotiate(uint8_t verb, uint8_t opt)
+{
+    uint32_t bit = opt < 32 ? 1u << opt : 0;
+    switch (verb)
+    {
+    case TEL_DO:
+        if (bit && tel_opt_us_ok(opt))
+        {
+            if (!(tel_opt_us & bit))
+            {
+                tel_opt_us |= bit;
+                tel_reply_opt(TEL_WILL, opt);
+            }
+            if (opt == TEL_OPT_NAWS)
+                tel_reply_naws();
+        }
+        else
+            tel_reply_opt(TEL_WONT, opt);
+        break;
+    case TEL_DONT:
+        if (tel_opt_us & bit)
+        {
+            tel_opt_us &= ~bit;
+            tel_reply_opt(TEL_WONT, opt);
+        }
+        break;
+    case TEL_WILL:
+        if (bit && tel_opt_him_ok(opt))
+        {
+            if (!(tel_opt_him & bit))
+            {
+                tel_opt_him |= bit;
+                tel_reply_opt(TEL_DO, opt);
+            }
+        }
+        else
+            tel_reply_opt(TEL_DONT, opt);
+        break;
+    case TEL_WONT:
+        if (tel_opt_him & bit)
+        {
+            tel_opt_him &= ~bit;
+            tel_reply_opt(TEL_DONT, opt);
+        }
+        break;
+    }
+}
+
+static void tel_subnegotiate(void)
+{
+    if (tel_sb_opt == TEL_OPT_TTYPE && tel_sb_cmd == TEL_TTYPE_SEND &&
+        (tel_opt_us & (1u << TEL_OPT_TTYPE)))
+    {
+        static const uint8_t sb[] = {TEL_IAC, TEL_SB, TEL_OPT_TTYPE, TEL_TTYPE_IS,
+                                     'A', 'N', 'S', 'I', TEL_IAC, TEL_SE};
+        tel_reply_bytes(sb, sizeof(sb));
+    }
+}
+
+static void tel_telnet_reset(bool telnet, bool answered)
+{
+    tel_telnet = telnet;
+    tel_answered = answered;
+    tel_iac_state = tel_iac_data;
+    tel_opt_us = tel_opt_him = 0;
+    tel_reply_len = 0;
+    if (telnet && answered)
+    {
+        // Like a BBS, the 6502 echoes in character mode.
+        tel_opt_us = (1u << TEL_OPT_ECHO) | (1u << TEL_OPT_SGA);
+        tel_reply_opt(TEL_WILL, TEL_OPT_ECHO);
+        tel_reply_opt(TEL_WILL, TEL_OPT_SGA);
+    }
+}
+
+static bool tel_telnet_for_port(u16_t port)
+{
+    return mdm_settings.telnet == 1 ||
+           (mdm_settings.telnet == 2 && port == 23);
+}
+
+int tel_rx(char *ch)
+{
+    if (!tel_telnet)
+        return tel_rx_raw(ch);
+    int got = 0;
+    while (!got && tel_rx_raw(ch))
+    {
+        uint8_t byte = (uint8_t)*ch;
+        switch (tel_iac_state)
+        {
+        case tel_iac_cr:
+            // NVT sends CR NUL for a bare carriage return.
+            tel_iac_state = tel_iac_data;
+            if (!byte)
+                break;
+            __attribute__((fallthrough));
+        case tel_iac_data:
+            if (byte == TEL_IAC)
+                tel_iac_state = tel_iac_cmd;
+            else
+            {
+                if (byte == '\r' && !(tel_opt_him & (1u << TEL_OPT_BINARY)))
+                    tel_iac_state = tel_iac_cr;
+                got = 1;
+            }
+            break;
+        case tel_iac_cmd:
+            tel_iac_state = tel_iac_data;
+            if (byte == TEL_IAC)
+                got = 1; // escaped 255
+            else if (byte >= TEL_WILL && byte <= TEL_DONT)
+            {
+                tel_iac_verb = byte;
+                tel_iac_state = tel_iac_opt;
+            }
+            else if (byte == TEL_SB)
+                tel_iac_state = tel_iac_sb;
+            break;
+        case tel_iac_opt:
+            tel_negotiate(tel_iac_verb, byte);
+            tel_iac_state = tel_iac_data;
+            break;
+        case tel_iac_sb:
+            tel_sb_opt = byte;
+            tel_sb_cmd = -1;
+            tel_iac_state = tel_iac_sb_data;
+            break;
+        case tel_iac_sb_data:
+            if (byte == TEL_IAC)
+                tel_iac_state = tel_iac_sb_iac;
+            else if (tel_sb_cmd < 0)
+                tel_sb_cmd = byte;
+            break;
+        case tel_iac_sb_iac:
+            if (byte == TEL_SE)
+            {
+                tel_subnegotiate();
+                tel_iac_state = tel_iac_data;
+            }
+            else
+                tel_iac_state = tel_iac_sb_data;
+            break;
+        }
+    }
+    tel_reply_flush();
+    return got;
+}
+
+// Double each IAC. Chunks end on an IAC and the next begins
+// on it, so data is never copied before tcp_write copies it.
+// Queues what fits, *taken is how much of ch was queued.
+static err_t tel_write(const char *ch, u16_t len, u16_t *taken)
+{
+    *taken = 0;
+    if (!tel_telnet)
+    {
+        err_t err = tcp_write(tel_pcb, ch, len, TCP_WRITE_FLAG_COPY);
+        if (err == ERR_OK)
+            *taken = len;
+        return err;
+    }
+    tel_reply_flush();
+    u16_t room = tcp_sndbuf(tel_pcb);
+    if (room > sizeof(tel_tx_buf))
+        room = sizeof(tel_tx_buf);
+    u16_t pos = 0;
+    u16_t i = 0;
+    for (; i < len; i++)
+    {
+        bool iac = (uint8_t)ch[i] == TEL_IAC;
+        if (pos + 1 + iac > room)
+            break;
+        tel_tx_buf[pos++] = ch[i];
+        if (iac)
+            tel_tx_buf[pos++] = ch[i];
+    }
+    if (!i)
+        return ERR_MEM;
+    err_t err = tcp_write(tel_pcb, tel_tx_buf, pos, TCP_WRITE_FLAG_COPY);
+    if (err == ERR_OK)
+        *taken = i;
+    return err;
+}
+
+u16_t tel_tx(char *ch, u16_t len)
 {
     if (!tel_pcb)
-        return true; // drop data
+        return len; // drop data
     if (tel_state == tel_state_connected)
     {
-        err_t err = tcp_write(tel_pcb, ch, len, TCP_WRITE_FLAG_COPY);
+        u16_t taken;
+        err_t err = tel_write(ch, len, &taken);
         if (err == ERR_CONN)
             tel_close();
         if (err == ERR_OK)
-            err = tcp_output(tel_pcb);
-        return err == ERR_OK;
+            tcp_output(tel_pcb);
+        return taken;
     }
-    return false;
+    return 0;
 }
 
 static err_t tel_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
@@ -141,6 +459,8 @@ static err_t tel_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err
     {
         tel_pbufs[tel_pbuf_head] = p;
         tel_pbuf_head = (tel_pbuf_head + 1) % PBUF_POOL_SIZE;
+        if (tel_pbufs_queued() > tel_pbuf_max)
+            tel_pbuf_max = tel_pbufs_queued();
         // Announce receive length of first pbuf via owned URC buffer
         char tmp[32];
         snprintf(tmp, sizeof(tmp), "+RECV:%u", (unsigned)p->len);
@@ -204,12 +524,195 @@ static void tel_dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
     }
 }
 
+static int tel_caller_find(const struct tcp_pcb *pcb)
+{
+    for (int i = 0; i < tel_caller_count; i++)
+        if (tel_callers[i].pcb == pcb)
+            return i;
+    return -1;
+}
+
+static tel_caller_t tel_caller_take(int i)
+{
+    tel_caller_t caller = tel_callers[i];
+    for (--tel_caller_count; i < tel_caller_count; i++)
+        tel_callers[i] = tel_callers[i + 1];
+    return caller;
+}
+
+static void tel_caller_hangup(int i)
+{
+    tel_caller_t caller = tel_caller_take(i);
+    DBG("NET TEL caller dropped\n");
+    if (caller.rx)
+        pbuf_free(caller.rx);
+    tcp_arg(caller.pcb, NULL);
+    tcp_recv(caller.pcb, NULL);
+    tcp_err(caller.pcb, NULL);
+    if (tcp_close(caller.pcb) != ERR_OK)
+        tcp_abort(caller.pcb);
+}
+
+static err_t tel_caller_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+{
+    (void)arg;
+    (void)err;
+    int i = tel_caller_find(tpcb);
+    if (!p)
+    {
+        // Hung up while ringing.
+        if (i >= 0)
+            tel_caller_hangup(i);
+        return ERR_OK;
+    }
+    if (i < 0)
+    {
+        pbuf_free(p);
+        return ERR_OK;
+    }
+    tel_caller_t *caller = &tel_callers[i];
+    if (!caller->rx)
+        caller->rx = p;
+    else if (caller->rx->tot_len < TEL_CALLER_RX_MAX)
+        pbuf_cat(caller->rx, p);
+    else
+        return ERR_MEM; // lwIP keeps it for later
+    return ERR_OK;
+}
+
+static void tel_caller_err(void *arg, err_t err)
+{
+    (void)err;
+    // The pcb is already freed.
+    int i = tel_caller_find(arg);
+    if (i >= 0)
+    {
+        tel_caller_t caller = tel_caller_take(i);
+        if (caller.rx)
+            pbuf_free(caller.rx);
+    }
+}
+
+static err_t tel_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
+{
+    (void)arg;
+    if (err != ERR_OK || !newpcb)
+        return ERR_VAL;
+    if (tel_caller_count == TEL_CALLERS_MAX)
+    {
+        static const char busy[] = "BUSY\r\n";
+        DBG("NET TEL caller busy\n");
+        tcp_write(newpcb, busy, sizeof(busy) - 1, 0);
+        if (tcp_close(newpcb) != ERR_OK)
+        {
+            tcp_abort(newpcb);
+            return ERR_ABRT;
+        }
+        return ERR_OK;
+    }
+    DBG("NET TEL caller waiting\n");
+    tel_callers[tel_caller_count++] = (tel_caller_t){newpcb, NULL};
+    tcp_arg(newpcb, newpcb);
+    tcp_nagle_disable(newpcb);
+    tcp_recv(newpcb, tel_caller_recv);
+    tcp_err(newpcb, tel_caller_err);
+    return ERR_OK;
+}
+
+bool tel_listen(u16_t port)
+{
+    if (tel_listen_pcb)
+    {
+        tcp_close(tel_listen_pcb);
+        tel_listen_pcb = NULL;
+    }
+    while (tel_caller_count)
+        tel_caller_hangup(0);
+    tel_listen_port = 0;
+    mdn_set_telnet_port(0);
+    if (!port)
+        return true;
+    struct tcp_pcb *pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+    if (!pcb)
+        return false;
+    if (tcp_bind(pcb, IP_ANY_TYPE, port) != ERR_OK)
+    {
+        DBG("NET TEL tcp_bind failed\n");
+        tcp_close(pcb);
+        return false;
+    }
+    tel_listen_pcb = tcp_listen(pcb);
+    if (!tel_listen_pcb)
+    {
+        tcp_close(pcb);
+        return false;
+    }
+    tcp_accept(tel_listen_pcb, tel_accept);
+    tel_listen_port = port;
+    mdn_set_telnet_port(port);
+    return true;
+}
+
+u16_t tel_get_listen_port(void)
+{
+    return tel_listen_port;
+}
+
+unsigned tel_waiting(void)
+{
+    return tel_caller_count;
+}
+
+bool tel_answer(void)
+{
+    if (!tel_caller_count || tel_state != tel_state_closed)
+        return false;
+    tel_caller_t caller = tel_caller_take(0);
+    DBG("NET TEL answered\n");
+    tel_pcb = caller.pcb;
+    tcp_arg(tel_pcb, NULL);
+    tcp_err(tel_pcb, tel_err);
+    tcp_recv(tel_pcb, tel_recv);
+    tel_state = tel_state_connected;
+    tel_telnet_reset(tel_telnet_for_port(tel_listen_port), true);
+    tel_reply_flush();
+    mdm_urc("CONNECT");
+    if (caller.rx)
+    {
+        tel_pbufs[tel_pbuf_head] = caller.rx;
+        tel_pbuf_head = (tel_pbuf_head + 1) % PBUF_POOL_SIZE;
+        char tmp[32];
+        snprintf(tmp, sizeof(tmp), "+RECV:%u", (unsigned)caller.rx->len);
+        mdm_urc_line(tmp);
+    }
+    return true;
+}
+
+unsigned tel_pbufs_queued(void)
+{
+    return (tel_pbuf_head + PBUF_POOL_SIZE - tel_pbuf_tail) % PBUF_POOL_SIZE;
+}
+
+unsigned tel_pbufs_max(void)
+{
+    return tel_pbuf_max;
+}
+
+size_t tel_rx_pending(void)
+{
+    size_t bytes = 0;
+    for (uint8_t i = tel_pbuf_tail; i != tel_pbuf_head; i = (i + 1) % PBUF_POOL_SIZE)
+        bytes += tel_pbufs[i]->tot_len;
+    return bytes ? bytes - tel_pbuf_pos : 0;
+}
+
 bool tel_open(const char *hostname, u16_t port)
 {
     assert(tel_state == tel_state_closed);
     ip_addr_t ipaddr;
     tel_port = port;
-    err_t err = dns_gethostbyname(hostname, &ipaddr, tel_dns_found, NULL);
+    tel_telnet_reset(tel_telnet_for_port(port), false);
+    err_t err = rsv_gethostbyname(hostname, &ipaddr, tel_dns_found, NULL);
     if (err == ERR_INPROGRESS)
     {
         DBG("NET TEL DNS looking up\n");
@@ -223,7 +726,7 @@ bool tel_open(const char *hostname, u16_t port)
         tel_dns_found(hostname, &ipaddr, NULL);
         return tel_state == tel_state_connecting;
     }
-    DBG("NET TEL dns_gethostbyname (%d)\n", err);
+    DBG("NET TEL rsv_gethostbyname (%d)\n", err);
     return false;
 }
 
@@ -19,8 +19,20 @@
  */
 
 int tel_rx(char *ch);
-bool tel_tx(char *ch, u16_t len);
+// Returns bytes taken, the rest must be sent again.
+u16_t tel_tx(char *ch, u16_t len);
 bool tel_open(const char *hostname, u16_t port);
 err_t tel_close(void);
 
+// Telnet server. Callers queue until answered, port 0 stops.
+bool tel_listen(u16_t port);
+u16_t tel_get_listen_port(void);
+unsigned tel_waiting(void);
+bool tel_answer(void);
+
+// Receive ring statistics.
+unsigned tel_pbufs_queued(void);
+unsigned tel_pbufs_max(void);
+size_t tel_rx_pending(void);
+
 #endif /* _RIA_NET_TEL_H_ */
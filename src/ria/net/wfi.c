@@ -8,12 +8,15 @@
 #include "net/wfi.h"
 void wfi_task() {}
 void wfi_print_status() {}
+int wfi_get_rssi(void) { return 0; }
 #else
 
 #include "net/cyw.h"
 #include "net/wfi.h"
 #include "sys/cfg.h"
+#include "sys/sys.h"
 #include <pico/cyw43_arch.h>
+#include <lwip/priv/tcp_priv.h>
 
 #if defined(DEBUG_RIA_NET) || defined(DEBUG_RIA_NET_WFI)
 #include <stdio.h>
@@ -40,6 +43,31 @@ static absolute_time_t wfi_retry_timer;
 #define WFI_RETRY_INITIAL_SECS 2
 #define WFI_RETRY_SECS 60
 
+// Rejoin the last access point directly, skipping the scan.
+// One failure falls back to a full scan.
+static bool wfi_join_direct;
+static bool wfi_join_cached;
+static absolute_time_t wfi_join_start;
+static uint32_t wfi_join_ms;
+
+// Look for a better access point when the signal degrades.
+#define WFI_RSSI_CHECK_MS 5000
+#define WFI_ROAM_RSSI -75
+#define WFI_ROAM_SCAN_SECS 30
+#define WFI_ROAM_MARGIN 8
+static absolute_time_t wfi_rssi_timer;
+static absolute_time_t wfi_roam_timer;
+static int32_t wfi_rssi;
+static bool wfi_roam_scanning;
+static int16_t wfi_roam_rssi;
+static uint16_t wfi_roam_channel;
+static uint8_t wfi_roam_bssid[6];
+static uint8_t wfi_bssid[6];
+
+// Power management is off while TCP connections are open.
+#define WFI_PM_LATENCY (CYW43_DEFAULT_PM & ~0xf)
+static uint32_t wfi_pm;
+
 void wfi_shutdown(void)
 {
     switch (wfi_state)
@@ -57,6 +85,7 @@ void wfi_shutdown(void)
         break;
     }
     wfi_retry_initial_retry_count = 0;
+    wfi_roam_scanning = false;
 }
 
 static int wfi_retry_connect(void)
@@ -70,32 +99,147 @@ static int wfi_retry_connect(void)
     return secs;
 }
 
+static uint32_t wfi_auth(void)
+{
+    return strlen(cfg_get_pass()) ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN;
+}
+
+static int wfi_join(const uint8_t *bssid, uint32_t channel, uint32_t auth)
+{
+    const char *ssid = cfg_get_ssid();
+    const char *pass = cfg_get_pass();
+    wfi_join_start = get_absolute_time();
+    return cyw43_wifi_join(&cyw43_state, strlen(ssid), (const uint8_t *)ssid,
+                           strlen(pass), (const uint8_t *)pass,
+                           auth, bssid, channel);
+}
+
+static void wfi_joined(void)
+{
+    wfi_join_ms = absolute_time_diff_us(wfi_join_start, get_absolute_time()) / 1000;
+    wfi_join_cached = wfi_join_direct;
+    wfi_join_direct = false;
+    wfi_pm = WFI_PM_LATENCY;
+    wfi_rssi = 0;
+    wfi_rssi_timer = get_absolute_time();
+    wfi_roam_timer = get_absolute_time();
+    uint8_t buf[4] = {0};
+    cyw43_wifi_get_bssid(&cyw43_state, wfi_bssid);
+    if (!cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(buf), buf, CYW43_ITF_STA))
+        cfg_set_wifi_join(buf[0], wfi_auth(), wfi_bssid);
+}
+
+static void wfi_set_pm(void)
+{
+    uint32_t pm = WFI_PM_LATENCY;
+    if (!tcp_active_pcbs)
+        switch (cfg_get_rfpm())
+        {
+        case 1:
+            pm = CYW43_PERFORMANCE_PM;
+            break;
+        case 2:
+            pm = CYW43_AGGRESSIVE_PM;
+            break;
+        }
+    if (pm != wfi_pm && !cyw43_wifi_pm(&cyw43_state, pm))
+        wfi_pm = pm;
+}
+
+static int wfi_roam_result(void *env, const cyw43_ev_scan_result_t *result)
+{
+    (void)env;
+    if (result && result->rssi > wfi_roam_rssi &&
+        memcmp(result->bssid, wfi_bssid, sizeof(wfi_bssid)))
+    {
+        wfi_roam_rssi = result->rssi;
+        wfi_roam_channel = result->channel;
+        memcpy(wfi_roam_bssid, result->bssid, sizeof(wfi_roam_bssid));
+    }
+    return 0;
+}
+
+static void wfi_roam_start(void)
+{
+    const char *ssid = cfg_get_ssid();
+    cyw43_wifi_scan_options_t opts = {0};
+    opts.ssid_len = strlen(ssid);
+    memcpy(opts.ssid, ssid, opts.ssid_len);
+    wfi_roam_rssi = wfi_rssi + WFI_ROAM_MARGIN;
+    wfi_roam_channel = 0;
+    if (!cyw43_wifi_scan(&cyw43_state, &opts, NULL, wfi_roam_result))
+    {
+        DBG("NET WFI roam scan, rssi %ld\n", (long)wfi_rssi);
+        wfi_roam_scanning = true;
+    }
+    wfi_roam_timer = make_timeout_time_ms(WFI_ROAM_SCAN_SECS * 1000);
+}
+
+// Returns true when leaving for a better access point.
+static bool wfi_roam_task(void)
+{
+    if (wfi_roam_scanning)
+    {
+        if (cyw43_wifi_scan_active(&cyw43_state))
+            return false;
+        wfi_roam_scanning = false;
+        if (!wfi_roam_channel)
+            return false;
+        DBG("NET WFI roaming to channel %u, rssi %d\n", wfi_roam_channel, wfi_roam_rssi);
+        cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+        if (wfi_join(wfi_roam_bssid, wfi_roam_channel, wfi_auth()))
+            wfi_state = wfi_state_connect;
+        else
+        {
+            wfi_join_direct = true;
+            wfi_state = wfi_state_connecting;
+        }
+        return true;
+    }
+    if (absolute_time_diff_us(get_absolute_time(), wfi_rssi_timer) < 0)
+    {
+        wfi_rssi_timer = make_timeout_time_ms(WFI_RSSI_CHECK_MS);
+        cyw43_wifi_get_rssi(&cyw43_state, &wfi_rssi);
+        if (wfi_rssi < WFI_ROAM_RSSI &&
+            absolute_time_diff_us(get_absolute_time(), wfi_roam_timer) < 0)
+            wfi_roam_start();
+    }
+    return false;
+}
+
 void wfi_task(void)
 {
     switch (wfi_state)
     {
     case wfi_state_off:
-        if (!cfg_get_rf() || !cfg_get_ssid()[0])
+        if (!cyw_ready() || !cfg_get_rf() || !cfg_get_ssid()[0])
             break;
         cyw43_arch_enable_sta_mode(); // cyw43_wifi_set_up
         wfi_state = wfi_state_connect;
         break;
     case wfi_state_connect:
         DBG("NET WFI connecting\n");
-        // Power management may be buggy, turn it off
-        if (cyw43_wifi_pm(&cyw43_state, CYW43_DEFAULT_PM & ~0xf))
+        // Power management may be buggy, off until connected
+        if (cyw43_wifi_pm(&cyw43_state, WFI_PM_LATENCY))
         {
             int secs = wfi_retry_connect();
             (void)secs;
             DBG("NET WFI cyw43_wifi_pm failed, retry %ds\n", secs);
+            break;
         }
-        else if (cyw43_arch_wifi_connect_async(
-                     cfg_get_ssid(), cfg_get_pass(),
-                     strlen(cfg_get_pass()) ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN))
+        uint32_t auth;
+        uint8_t bssid[6];
+        uint8_t channel = cfg_get_wifi_join(&auth, bssid);
+        wfi_join_direct = channel && !wfi_retry_initial_retry_count;
+        int err = wfi_join_direct
+                      ? wfi_join(bssid, channel, auth)
+                      : wfi_join(NULL, CYW43_CHANNEL_NONE, wfi_auth());
+        if (err)
         {
+            wfi_join_direct = false;
             int secs = wfi_retry_connect();
             (void)secs;
-            DBG("NET WFI cyw43_arch_wifi_connect_async failed, retry %ds\n", secs);
+            DBG("NET WFI cyw43_wifi_join failed, retry %ds\n", secs);
         }
         else
             wfi_state = wfi_state_connecting;
@@ -111,10 +255,21 @@ void wfi_task(void)
         case CYW43_LINK_UP:
             DBG("NET WFI connected\n");
             wfi_state = wfi_state_connected;
+            wfi_joined();
+            sys_boot_mark("wifi");
             break;
         case CYW43_LINK_FAIL:
         case CYW43_LINK_NONET:
         case CYW43_LINK_BADAUTH:
+            if (wfi_join_direct)
+            {
+                // The access point moved, scan for it now.
+                DBG("NET WFI direct join failed (%d)\n", link_status);
+                cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+                wfi_retry_initial_retry_count++;
+                wfi_state = wfi_state_connect;
+                break;
+            }
             int secs = wfi_retry_connect();
             (void)secs;
             DBG("NET WFI connect failed (%d), retry %ds\n", link_status, secs);
@@ -129,6 +284,23 @@ void wfi_task(void)
         }
         break;
     case wfi_state_connected:
+        switch (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA))
+        {
+        case CYW43_LINK_UP:
+            if (!wfi_roam_task())
+                wfi_set_pm();
+            break;
+        case CYW43_LINK_JOIN:
+        case CYW43_LINK_NOIP:
+            break;
+        default:
+            // Dropped, rejoin right away without backoff.
+            DBG("NET WFI link lost\n");
+            cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+            wfi_retry_initial_retry_count = 0;
+            wfi_state = wfi_state_connect;
+            break;
+        }
         break;
     }
 }
@@ -165,7 +337,12 @@ void wfi_print_status(void)
         }
         break;
     case wfi_state_connected:
-        puts("connected");
+        printf("connected, joined in %lu ms%s\n", (unsigned long)wfi_join_ms,
+               wfi_join_cached ? " from cache" : "");
+        printf("AP  : %02X:%02X:%02X:%02X:%02X:%02X, %ld dBm, power saving %s\n",
+               wfi_bssid[0], wfi_bssid[1], wfi_bssid[2],
+               wfi_bssid[3], wfi_bssid[4], wfi_bssid[5],
+               (long)wfi_rssi, wfi_pm == WFI_PM_LATENCY ? "off" : "on");
         break;
     case wfi_state_connect_failed:
         switch (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA))
@@ -222,4 +399,9 @@ bool wfi_ready(void)
     return wfi_state == wfi_state_connected;
 }
 
+int wfi_get_rssi(void)
+{
+    return wfi_state == wfi_state_connected ? wfi_rssi : 0;
+}
+
 #endif /* RP6502_RIA_W */
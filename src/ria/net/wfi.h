@@ -25,5 +25,7 @@ void wfi_task(void);
 void wfi_print_status(void);
 void wfi_shutdown(void);
 bool wfi_ready(void);
+// Last sample in dBm, 0 when not connected.
+int wfi_get_rssi(void);
 
 #endif /* _RIA_NET_WFI_H_ */
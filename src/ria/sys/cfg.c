@@ -10,6 +10,8 @@
 #include "hid/kbd.h"
 #include "net/ble.h"
 #include "net/cyw.h"
+#include "net/rfs.h"
+#include "net/scr.h"
 #include "net/wfi.h"
 #include "sys/cfg.h"
 #include "sys/cpu.h"
@@ -39,6 +41,12 @@ static inline void DBG(const char *fmt, ...) { (void)fmt; }
 // +WMyWiFi    | WiFi SSID
 // +KsEkRiT    | WiFi Password
 // +B1         | Bluetooth Enabled
+// +N0         | Network Profile (retired)
+// +X0         | Remote Screen Port
+// +Yhost:6503 | Network Volume Server
+// +M0         | RF Power Management
+// +J6 4194308 | WiFi Channel, Auth and BSSID of last join
+//   1A2B3C4D5E6F
 // BASIC       | Boot ROM - Must be last
 
 #define CFG_VERSION 1
@@ -56,6 +64,13 @@ static char cfg_net_rfcc[3];
 static char cfg_net_ssid[33];
 static char cfg_net_pass[65];
 static uint8_t cfg_net_ble;
+static uint16_t cfg_net_screen_port;
+static char cfg_net_volume[65];
+static uint8_t cfg_net_rfpm;
+static uint8_t cfg_net_join_channel;
+static uint32_t cfg_net_join_auth;
+static uint8_t cfg_net_join_bssid[6];
+static bool cfg_net_join_changed;
 #endif /* RP6502_RIA_W */
 
 // Optional string can replace boot string
@@ -101,6 +116,10 @@ static void cfg_save_with_boot_opt(char *opt_str)
                                "+W%s\n"
                                "+K%s\n"
                                "+B%u\n"
+                               "+X%u\n"
+                               "+Y%s\n"
+                               "+M%u\n"
+                               "+J%u %u %02X%02X%02X%02X%02X%02X\n"
 #endif /* RP6502_RIA_W */
                                "%s",
                                CFG_VERSION,
@@ -115,6 +134,14 @@ static void cfg_save_with_boot_opt(char *opt_str)
                                cfg_net_ssid,
                                cfg_net_pass,
                                cfg_net_ble,
+                               cfg_net_screen_port,
+                               cfg_net_volume,
+                               cfg_net_rfpm,
+                               cfg_net_join_channel,
+                               cfg_net_join_auth,
+                               cfg_net_join_bssid[0], cfg_net_join_bssid[1],
+                               cfg_net_join_bssid[2], cfg_net_join_bssid[3],
+                               cfg_net_join_bssid[4], cfg_net_join_bssid[5],
 #endif /* RP6502_RIA_W */
                                opt_str);
         if (lfsresult < 0)
@@ -185,6 +212,28 @@ static void cfg_load_with_boot_opt(bool boot_only)
         case 'B':
             str_parse_uint8(&str, &len, &cfg_net_ble);
             break;
+        case 'X':
+            str_parse_uint16(&str, &len, &cfg_net_screen_port);
+            break;
+        case 'Y':
+            str_parse_string(&str, &len, cfg_net_volume, sizeof(cfg_net_volume));
+            break;
+        case 'M':
+            str_parse_uint8(&str, &len, &cfg_net_rfpm);
+            break;
+        case 'J':
+            if (!str_parse_uint8(&str, &len, &cfg_net_join_channel) ||
+                !str_parse_uint32(&str, &len, &cfg_net_join_auth) ||
+                len != 2 * sizeof(cfg_net_join_bssid))
+                cfg_net_join_channel = 0;
+            for (size_t i = 0; cfg_net_join_channel && i < len; i++)
+            {
+                if (!str_char_is_hex(str[i]))
+                    cfg_net_join_channel = 0;
+                cfg_net_join_bssid[i / 2] = (cfg_net_join_bssid[i / 2] << 4) |
+                                            str_char_to_int(str[i]);
+            }
+            break;
 #endif /* RP6502_RIA_W */
         default:
             break;
@@ -205,6 +254,18 @@ void cfg_init(void)
     cfg_load_with_boot_opt(false);
 }
 
+// Saves deferred from main_task(), which must not touch the file systems.
+void cfg_task(void)
+{
+#ifdef RP6502_RIA_W
+    if (cfg_net_join_changed)
+    {
+        cfg_net_join_changed = false;
+        cfg_save_with_boot_opt(NULL);
+    }
+#endif /* RP6502_RIA_W */
+}
+
 bool cfg_set_phi2_khz(uint32_t freq_khz)
 {
     if (freq_khz > CPU_PHI2_MAX_KHZ)
@@ -372,6 +433,7 @@ bool cfg_set_ssid(const char *ssid)
         if (strcmp(cfg_net_ssid, ssid))
         {
             cfg_net_pass[0] = 0;
+            cfg_net_join_channel = 0;
             strcpy(cfg_net_ssid, ssid);
             wfi_shutdown();
             cfg_save_with_boot_opt(NULL);
@@ -393,6 +455,7 @@ bool cfg_set_pass(const char *pass)
         if (strcmp(cfg_net_pass, pass))
         {
             strcpy(cfg_net_pass, pass);
+            cfg_net_join_channel = 0;
             wfi_shutdown();
             cfg_save_with_boot_opt(NULL);
         }
@@ -426,4 +489,76 @@ uint8_t cfg_get_ble(void)
     return cfg_net_ble;
 }
 
+void cfg_set_screen_port(uint16_t port)
+{
+    scr_set_port(port);
+    if (cfg_net_screen_port != port)
+    {
+        cfg_net_screen_port = port;
+        cfg_save_with_boot_opt(NULL);
+    }
+}
+
+uint16_t cfg_get_screen_port(void)
+{
+    return cfg_net_screen_port;
+}
+
+bool cfg_set_net_volume(const char *server)
+{
+    if (strlen(server) >= sizeof(cfg_net_volume) - 1)
+        return false;
+    if (strcmp(cfg_net_volume, server))
+    {
+        strcpy(cfg_net_volume, server);
+        rfs_reset();
+        cfg_save_with_boot_opt(NULL);
+    }
+    return true;
+}
+
+const char *cfg_get_net_volume(void)
+{
+    return cfg_net_volume;
+}
+
+bool cfg_set_rfpm(uint8_t rfpm)
+{
+    if (rfpm > 2)
+        return false;
+    if (cfg_net_rfpm != rfpm)
+    {
+        cfg_net_rfpm = rfpm;
+        cfg_save_with_boot_opt(NULL);
+    }
+    return true;
+}
+
+uint8_t cfg_get_rfpm(void)
+{
+    return cfg_net_rfpm;
+}
+
+// Channel 0 forgets the last join.
+void cfg_set_wifi_join(uint8_t channel, uint32_t auth, const uint8_t *bssid)
+{
+    if (cfg_net_join_channel == channel && cfg_net_join_auth == auth &&
+        (!channel || !memcmp(cfg_net_join_bssid, bssid, sizeof(cfg_net_join_bssid))))
+        return;
+    cfg_net_join_channel = channel;
+    cfg_net_join_auth = auth;
+    if (channel)
+        memcpy(cfg_net_join_bssid, bssid, sizeof(cfg_net_join_bssid));
+    // Called from wfi_task(), cfg_task() saves later.
+    cfg_net_join_changed = true;
+}
+
+// Returns channel, 0 when there's no last join.
+uint8_t cfg_get_wifi_join(uint32_t *auth, uint8_t *bssid)
+{
+    *auth = cfg_net_join_auth;
+    memcpy(bssid, cfg_net_join_bssid, sizeof(cfg_net_join_bssid));
+    return cfg_net_join_channel;
+}
+
 #endif /* RP6502_RIA_W */
@@ -18,6 +18,7 @@
  */
 
 void cfg_init(void);
+void cfg_task(void);
 
 // These setters will auto save on change and
 // reconfigure the system as necessary.
@@ -44,5 +45,13 @@ bool cfg_set_time_zone(const char *pass);
 const char *cfg_get_time_zone(void);
 bool cfg_set_ble(uint8_t bt);
 uint8_t cfg_get_ble(void);
+void cfg_set_screen_port(uint16_t port);
+uint16_t cfg_get_screen_port(void);
+bool cfg_set_net_volume(const char *server);
+const char *cfg_get_net_volume(void);
+bool cfg_set_rfpm(uint8_t rfpm);
+uint8_t cfg_get_rfpm(void);
+void cfg_set_wifi_join(uint8_t channel, uint32_t auth, const uint8_t *bssid);
+uint8_t cfg_get_wifi_join(uint32_t *auth, uint8_t *bssid);
 
 #endif /* _RIA_SYS_CFG_H_ */
@@ -42,6 +42,8 @@ uint8_t *const xram __attribute__((aligned(4))) =
     (uint8_t *)&xram_blocks;
 #endif
 
+volatile uint8_t xram_dirty[XRAM_PAGES];
+
 uint8_t xstack[XSTACK_SIZE + 1];
 size_t volatile xstack_ptr;
 
@@ -22,6 +22,11 @@ extern uint8_t xram[];
 extern uint8_t *const xram;
 #endif
 
+// One flag per 256 byte page of XRAM sent to the VGA. PIX
+// sets them, the remote screen clears them as it sends.
+#define XRAM_PAGES (XRAM_SIZE >> 8)
+extern volatile uint8_t xram_dirty[XRAM_PAGES];
+
 // The xstack is:
 // 512 bytes, enough to hold a CC65 stack frame, two strings for a
 // file rename, or a disk sector
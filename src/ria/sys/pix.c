@@ -6,6 +6,7 @@
 
 #include "main.h"
 #include "api/api.h"
+#include "mon/snp.h"
 #include "sys/pix.h"
 #include "ria.pio.h"
 #include <pico/time.h>
@@ -140,6 +141,7 @@ bool pix_api_xreg(void)
         pix_send_count = 0;
         return api_return_errno(API_EINVAL);
     }
+    snp_xreg(&xstack[xstack_ptr], XSTACK_SIZE - xstack_ptr);
 
     // Local PIX device $0
     if (pix_device == PIX_DEVICE_RIA)
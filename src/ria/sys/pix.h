@@ -10,6 +10,7 @@
 /* Pico Information eXchange bus driver.
  */
 
+#include "sys/mem.h"
 #include <hardware/pio.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -46,8 +47,9 @@ void pix_nak(void);
     (0x10000000u | (dev << 29u) | (ch << 24) | ((byte) << 16) | (word))
 
 // Macro for the RIA. Use the inline functions elsewhere.
-#define PIX_SEND_XRAM(addr, data) \
-    PIX_PIO->txf[PIX_SM] = (PIX_MESSAGE(PIX_DEVICE_XRAM, 0, (data), (addr)))
+#define PIX_SEND_XRAM(addr, data)                 \
+    (xram_dirty[(uint16_t)(addr) >> 8] = 1,       \
+     PIX_PIO->txf[PIX_SM] = (PIX_MESSAGE(PIX_DEVICE_XRAM, 0, (data), (addr))))
 
 // Test for free space in the PIX transmit FIFO.
 static inline bool pix_ready(void)
@@ -67,6 +69,8 @@ static inline bool pix_fifo_empty(void)
 static inline void pix_send(uint8_t dev3, uint8_t ch4, uint8_t byte, uint16_t word)
 {
     assert(ch4 < 16);
+    if (dev3 == PIX_DEVICE_XRAM)
+        xram_dirty[word >> 8] = 1;
     pio_sm_put(PIX_PIO, PIX_SM, PIX_MESSAGE(dev3, ch4, byte, word));
 }
 
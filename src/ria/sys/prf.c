@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mon/str.h"
+#include "sys/cpu.h"
+#include "sys/prf.h"
+#include "sys/ria.h"
+#include <fatfs/ff.h>
+#include <pico/stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(DEBUG_RIA_SYS) || defined(DEBUG_RIA_SYS_PRF)
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+#define PRF_DEFAULT_HZ 1000
+#define PRF_MAX_HZ 10000
+#define PRF_TOP_COUNT 10
+
+// Open addressed by PC. A count of zero marks an empty slot.
+// Probes are short, prf_sample runs in the action loop.
+#define PRF_SLOTS 1024
+#define PRF_PROBES 8
+static uint16_t prf_pc[PRF_SLOTS];
+static volatile uint32_t prf_count[PRF_SLOTS];
+
+static bool prf_enabled;
+static uint32_t prf_hz = PRF_DEFAULT_HZ;
+static absolute_time_t prf_timer;
+static uint32_t prf_ticks;
+static volatile uint32_t prf_samples;
+static volatile uint32_t prf_dropped;
+
+static void prf_clear(void)
+{
+    memset((void *)prf_count, 0, sizeof(prf_count));
+    prf_ticks = 0;
+    prf_samples = 0;
+    prf_dropped = 0;
+}
+
+void prf_task(void)
+{
+    if (!prf_enabled || !cpu_active())
+        return;
+    if (absolute_time_diff_us(get_absolute_time(), prf_timer) < 0)
+    {
+        prf_timer = delayed_by_us(prf_timer, 1000000 / prf_hz);
+        // Don't queue up ticks after a long stall in the main loop.
+        if (absolute_time_diff_us(get_absolute_time(), prf_timer) < 0)
+            prf_timer = make_timeout_time_us(1000000 / prf_hz);
+        prf_ticks++;
+        ria_trigger_irq();
+    }
+}
+
+void prf_run(void)
+{
+    prf_timer = make_timeout_time_us(1000000 / prf_hz);
+}
+
+void __not_in_flash_func(prf_sample)(uint16_t pc)
+{
+    if (!prf_enabled)
+        return;
+    prf_samples++;
+    unsigned slot = (pc * 40503u >> 6) % PRF_SLOTS;
+    for (unsigned i = 0; i < PRF_PROBES; i++)
+    {
+        if (!prf_count[slot])
+        {
+            prf_pc[slot] = pc;
+            prf_count[slot] = 1;
+            return;
+        }
+        if (prf_pc[slot] == pc)
+        {
+            prf_count[slot]++;
+            return;
+        }
+        slot = (slot + 1) % PRF_SLOTS;
+    }
+    prf_dropped++;
+}
+
+static void prf_print_top(void)
+{
+    static bool shown[PRF_SLOTS];
+    memset(shown, 0, sizeof(shown));
+    for (int n = 0; n < PRF_TOP_COUNT; n++)
+    {
+        int best = -1;
+        for (int i = 0; i < PRF_SLOTS; i++)
+            if (prf_count[i] && !shown[i] &&
+                (best < 0 || prf_count[i] > prf_count[best]))
+                best = i;
+        if (best < 0)
+            break;
+        shown[best] = true;
+        printf("  $%04X %5lu %3lu%%\n", prf_pc[best], prf_count[best],
+               prf_count[best] * 100 / prf_samples);
+    }
+}
+
+static void prf_print_status(void)
+{
+    printf("Profiler %s, %lu Hz\n", prf_enabled ? "on" : "off", prf_hz);
+    printf("%lu samples of %lu ticks", prf_samples, prf_ticks);
+    if (prf_dropped)
+        printf(", %lu dropped", prf_dropped);
+    putchar('\n');
+    if (prf_samples)
+        prf_print_top();
+}
+
+static void prf_save(const char *path)
+{
+    FIL fil;
+    FRESULT result = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+    if (result != FR_OK)
+    {
+        printf("?Unable to open file (%d)\n", result);
+        return;
+    }
+    f_printf(&fil, "# RP6502 profile %lu Hz %lu samples %lu ticks %lu dropped\n",
+             prf_hz, prf_samples, prf_ticks, prf_dropped);
+    for (int i = 0; i < PRF_SLOTS; i++)
+        if (prf_count[i])
+            f_printf(&fil, "%04X %lu\n", prf_pc[i], prf_count[i]);
+    result = f_close(&fil);
+    if (result != FR_OK)
+        printf("?Unable to write file (%d)\n", result);
+}
+
+void prf_mon_profile(const char *args, size_t len)
+{
+    if (!len)
+        return prf_print_status();
+    if (len >= 2 && !strncasecmp(args, "on", 2) && (len == 2 || args[2] == ' '))
+    {
+        args += 2;
+        len -= 2;
+        while (len && *args == ' ')
+            args++, len--;
+        uint32_t hz = PRF_DEFAULT_HZ;
+        if (len && !str_parse_uint32(&args, &len, &hz))
+            hz = 0;
+        if (!str_parse_end(args, len) || !hz || hz > PRF_MAX_HZ)
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+        prf_clear();
+        prf_hz = hz;
+        prf_enabled = true;
+        return;
+    }
+    if (len == 3 && !strncasecmp(args, "off", 3))
+    {
+        prf_enabled = false;
+        return;
+    }
+    if (len >= 5 && !strncasecmp(args, "save ", 5))
+        return prf_save(args + 5);
+    printf("?invalid argument\n");
+}
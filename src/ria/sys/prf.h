@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_SYS_PRF_H_
+#define _RIA_SYS_PRF_H_
+
+/* Sampling profiler for 6502 programs. The RIA raises IRQ at a
+ * fixed rate and a small 6502 handler returns the interrupted PC.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// OS call the 6502 handler makes with the PC on the xstack.
+// Handled in the action loop so it returns immediately.
+#define PRF_API_OP 0x07
+
+/* Main events
+ */
+
+void prf_task(void);
+void prf_run(void);
+
+/* Utility
+ */
+
+// Called from the action loop on core 1.
+void prf_sample(uint16_t pc);
+
+/* Monitor commands
+ */
+
+void prf_mon_profile(const char *args, size_t len);
+
+#endif /* _RIA_SYS_PRF_H_ */
@@ -9,11 +9,14 @@
 #include "sys/com.h"
 #include "sys/cpu.h"
 #include "sys/pix.h"
+#include "sys/prf.h"
 #include "sys/ria.h"
+#include "sys/trc.h"
 #include "ria.pio.h"
 #include <pico/stdio.h>
 #include <pico/multicore.h>
 #include <hardware/dma.h>
+#include <hardware/sync.h>
 #include <littlefs/lfs_util.h>
 
 #if defined(DEBUG_RIA_SYS) || defined(DEBUG_RIA_SYS_RIA)
@@ -42,11 +45,21 @@ static uint16_t rw_addr;
 static volatile int32_t rw_pos;
 static volatile int32_t rw_end;
 static volatile bool irq_enabled;
+static volatile bool rw_refresh;
 
 void ria_trigger_irq(void)
 {
     if (irq_enabled & 0x01)
+    {
+        trc_irq_raised();
         gpio_put(CPU_IRQB_PIN, false);
+    }
+}
+
+void ria_refresh_rw(void)
+{
+    __dmb();
+    rw_refresh = true;
 }
 
 uint32_t ria_buf_crc32(void)
@@ -246,6 +259,8 @@ __attribute__((optimize("O1"))) static void __no_inline_not_in_flash_func(act_lo
             uint32_t rw_addr_data = RIA_ACT_PIO->rxf[RIA_ACT_SM];
             if (((1u << CPU_RESB_PIN) & sio_hw->gpio_in))
             {
+                if (trc_capturing)
+                    trc_capture(rw_addr_data);
                 uint32_t data = rw_addr_data & 0xFF;
                 switch (rw_addr_data >> 8)
                 {
@@ -314,6 +329,19 @@ __attribute__((optimize("O1"))) static void __no_inline_not_in_flash_func(act_lo
                         gpio_put(CPU_RESB_PIN, false);
                         main_stop();
                     }
+                    else if (data == PRF_API_OP) // profiler sample
+                    {
+                        uint16_t pc = 0;
+                        if (xstack_ptr <= XSTACK_SIZE - 2)
+                        {
+                            pc = xstack[xstack_ptr] | xstack[xstack_ptr + 1] << 8;
+                            xstack_ptr += 2;
+                        }
+                        prf_sample(pc);
+                        // The IRQ may land between a program's writes to
+                        // RIA.a/RIA.x and its own OS call, leave them be.
+                        api_return();
+                    }
                     break;
                 case CASE_WRITE(0xFFEC): // xstack
                     if (xstack_ptr)
@@ -401,6 +429,13 @@ __attribute__((optimize("O1"))) static void __no_inline_not_in_flash_func(act_lo
                 }
             }
         }
+        else if (rw_refresh)
+        {
+            // Only core1 writes the RW registers. Core0 asks.
+            rw_refresh = false;
+            RIA_RW0 = xram[RIA_ADDR0];
+            RIA_RW1 = xram[RIA_ADDR1];
+        }
     }
 }
 
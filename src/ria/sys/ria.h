@@ -41,6 +41,10 @@ void ria_post_reclock(uint16_t clkdiv_int, uint8_t clkdiv_frac);
 // Trigger IRQ when enabled
 void ria_trigger_irq(void);
 
+// Core0 changed XRAM under the RW ports. Core1 reloads
+// the RW data registers the next time it is idle.
+void ria_refresh_rw(void);
+
 // Move data from the 6502 to mbuf.
 void ria_read_buf(uint16_t addr);
 
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "sys/stk.h"
+#include <pico/stdlib.h>
+#include <malloc.h>
+#include <stdio.h>
+
+#define STK_PAINT 0x5AA55AA5u
+
+// Leave room for stk_init's own frame when painting core 0.
+#define STK_PAINT_MARGIN 64
+
+// From the SDK linker scripts.
+extern uint32_t __StackBottom;
+extern uint32_t __StackTop;
+extern uint32_t __StackOneBottom;
+extern uint32_t __StackOneTop;
+extern uint8_t __end__;
+extern uint8_t __HeapLimit;
+
+static void stk_paint(uint32_t *bottom, uint32_t *top)
+{
+    while (bottom < top)
+        *bottom++ = STK_PAINT;
+}
+
+// Unused bytes at the bottom of a painted stack.
+static size_t stk_unused(const uint32_t *bottom, const uint32_t *top)
+{
+    const uint32_t *p = bottom;
+    while (p < top && *p == STK_PAINT)
+        p++;
+    return (p - bottom) * sizeof(uint32_t);
+}
+
+void stk_init(void)
+{
+    uint32_t *sp = (uint32_t *)__builtin_frame_address(0) - STK_PAINT_MARGIN / sizeof(uint32_t);
+    stk_paint(&__StackBottom, sp);
+    stk_paint(&__StackOneBottom, &__StackOneTop);
+}
+
+static void stk_print(int core, uint32_t *bottom, uint32_t *top)
+{
+    size_t size = (top - bottom) * sizeof(uint32_t);
+    size_t used = size - stk_unused(bottom, top);
+    printf("Core %d stack: %u of %u bytes used\n", core, (unsigned)used, (unsigned)size);
+}
+
+void stk_mon_stack(const char *args, size_t len)
+{
+    (void)(args);
+    (void)(len);
+    stk_print(0, &__StackBottom, &__StackTop);
+    stk_print(1, &__StackOneBottom, &__StackOneTop);
+    struct mallinfo info = mallinfo();
+    size_t heap_size = &__HeapLimit - &__end__;
+    printf("Static RAM  : %u bytes\n", (unsigned)(&__end__ - (uint8_t *)SRAM_BASE));
+    printf("Heap        : %u of %u bytes used, %u extent\n",
+           (unsigned)info.uordblks, (unsigned)heap_size, (unsigned)info.arena);
+}
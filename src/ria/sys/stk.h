@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_SYS_STK_H_
+#define _RIA_SYS_STK_H_
+
+/* Stack painting and memory high-water marks.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+// Must run before core 1 is launched.
+void stk_init(void);
+
+/* Monitor commands
+ */
+
+void stk_mon_stack(const char *args, size_t len);
+
+#endif /* _RIA_SYS_STK_H_ */
@@ -7,12 +7,19 @@
 #include "main.h"
 #include "api/clk.h"
 #include "net/ble.h"
+#include "net/lwp.h"
+#include "net/mdn.h"
+#include "net/nst.h"
 #include "net/ntp.h"
+#include "net/rfs.h"
+#include "net/rsv.h"
+#include "net/scr.h"
 #include "net/wfi.h"
 #include "sys/sys.h"
 #include "sys/vga.h"
 #include "usb/usb.h"
 #include <hardware/watchdog.h>
+#include <pico/time.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -35,12 +42,44 @@ __in_flash("ria_sys_sys") static const char SYS_VERSION[] =
 #endif
     ;
 
+#define SYS_BOOT_MARKS_MAX 12
+
+static struct
+{
+    const char *event;
+    uint32_t us;
+} sys_boot_marks[SYS_BOOT_MARKS_MAX];
+static size_t sys_boot_mark_count;
+
 static void sys_print_status(void)
 {
     puts(RP6502_NAME);
     puts(SYS_VERSION);
 }
 
+void sys_boot_mark(const char *event)
+{
+    uint32_t us = time_us_32();
+    for (size_t i = 0; i < sys_boot_mark_count; i++)
+        if (!strcmp(sys_boot_marks[i].event, event))
+            return;
+    if (sys_boot_mark_count < SYS_BOOT_MARKS_MAX)
+    {
+        sys_boot_marks[sys_boot_mark_count].event = event;
+        sys_boot_marks[sys_boot_mark_count].us = us;
+        sys_boot_mark_count++;
+    }
+}
+
+static void sys_print_boot(void)
+{
+    printf("BOOT:");
+    for (size_t i = 0; i < sys_boot_mark_count; i++)
+        printf("%s %s %lums", i ? "," : "", sys_boot_marks[i].event,
+               (unsigned long)(sys_boot_marks[i].us / 1000));
+    printf("\n");
+}
+
 void sys_mon_reboot(const char *args, size_t len)
 {
     (void)(args);
@@ -57,11 +96,23 @@ void sys_mon_reset(const char *args, size_t len)
 
 void sys_mon_status(const char *args, size_t len)
 {
-    (void)(args);
-    (void)(len);
+    if (len)
+    {
+        if (len == 3 && !strncasecmp(args, "net", 3))
+            nst_print_status();
+        else
+            printf("?invalid argument\n");
+        return;
+    }
     sys_print_status();
+    sys_print_boot();
     vga_print_status();
     wfi_print_status();
+    lwp_print_status();
+    rsv_print_status();
+    mdn_print_status();
+    scr_print_status();
+    rfs_print_status();
     ntp_print_status();
     clk_print_status();
     ble_print_status();
@@ -19,6 +19,9 @@
 
 void sys_init(void);
 
+// Record a boot milestone for STATUS. Only the first of each is kept.
+void sys_boot_mark(const char *event);
+
 /* Monitor commands
  */
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mon/str.h"
+#include "sys/ria.h"
+#include "sys/trc.h"
+#include <fatfs/ff.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(DEBUG_RIA_SYS) || defined(DEBUG_RIA_SYS_TRC)
+#define DBG(...) fprintf(stderr, __VA_ARGS__)
+#else
+static inline void DBG(const char *fmt, ...) { (void)fmt; }
+#endif
+
+// File header, records follow oldest first.
+#define TRC_MAGIC "RP6502T1"
+typedef struct
+{
+    char magic[8];
+    uint32_t count;
+    uint32_t overwritten;
+} trc_header_t;
+
+trc_record_t *volatile trc_buf;
+volatile bool trc_capturing;
+volatile uint32_t trc_head;
+uint64_t trc_mask;
+volatile uint32_t trc_irq_us;
+volatile bool trc_irq_pending;
+
+static void trc_clear(void)
+{
+    trc_head = 0;
+    trc_irq_pending = false;
+}
+
+// Each program run starts a fresh trace. Monitor actions also
+// run the 6502 but must not disturb the last program's trace.
+void trc_run(void)
+{
+    if (!trc_buf || ria_active())
+        return;
+    trc_clear();
+    trc_capturing = true;
+}
+
+void trc_stop(void)
+{
+    trc_capturing = false;
+}
+
+static void trc_off(void)
+{
+    trc_capturing = false;
+    trc_record_t *buf = trc_buf;
+    trc_buf = NULL;
+    free(buf);
+}
+
+// Hex like the memory command, with an optional $.
+static bool trc_parse_addr(const char **args, size_t *len, uint32_t *addr)
+{
+    if (*len && **args == '$')
+        ++*args, --*len;
+    *addr = 0;
+    size_t i = 0;
+    for (; i < *len && str_char_is_hex((*args)[i]); i++)
+        *addr = *addr * 16 + str_char_to_int((*args)[i]);
+    *args += i;
+    *len -= i;
+    return i && *addr <= 0xFFFF;
+}
+
+// Ranges like FFE4-FFEB select both reads and writes.
+static bool trc_parse_mask(const char *args, size_t len, uint64_t *mask)
+{
+    *mask = 0;
+    while (len)
+    {
+        uint32_t first, last;
+        if (!trc_parse_addr(&args, &len, &first))
+            return false;
+        last = first;
+        if (len && *args == '-')
+        {
+            args++, len--;
+            if (!trc_parse_addr(&args, &len, &last))
+                return false;
+        }
+        if (first < 0xFFE0 || last < first || (len && *args != ' '))
+            return false;
+        for (uint32_t addr = first; addr <= last; addr++)
+            *mask |= (1ull << (addr & 0x1F)) | (1ull << (0x20 | (addr & 0x1F)));
+        while (len && *args == ' ')
+            args++, len--;
+    }
+    return true;
+}
+
+static void trc_save(const char *path)
+{
+    uint32_t head = trc_head;
+    trc_header_t header;
+    memcpy(header.magic, TRC_MAGIC, sizeof(header.magic));
+    header.count = head < TRC_RECORDS ? head : TRC_RECORDS;
+    header.overwritten = head - header.count;
+    FIL fil;
+    FRESULT result = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+    if (result != FR_OK)
+    {
+        printf("?Unable to open file (%d)\n", result);
+        return;
+    }
+    UINT bw;
+    result = f_write(&fil, &header, sizeof(header), &bw);
+    uint32_t first = header.overwritten & (TRC_RECORDS - 1);
+    uint32_t split = TRC_RECORDS - first;
+    if (split > header.count)
+        split = header.count;
+    if (result == FR_OK)
+        result = f_write(&fil, &trc_buf[first], split * sizeof(trc_record_t), &bw);
+    if (result == FR_OK)
+        result = f_write(&fil, &trc_buf[0], (header.count - split) * sizeof(trc_record_t), &bw);
+    FRESULT close_result = f_close(&fil);
+    if (result == FR_OK)
+        result = close_result;
+    if (result != FR_OK)
+        printf("?Unable to write file (%d)\n", result);
+}
+
+static void trc_print_status(void)
+{
+    if (!trc_buf)
+    {
+        puts("Trace off");
+        return;
+    }
+    uint32_t head = trc_head;
+    printf("Trace on, %lu records", head < TRC_RECORDS ? head : TRC_RECORDS);
+    if (head > TRC_RECORDS)
+        printf(", %lu overwritten", head - TRC_RECORDS);
+    putchar('\n');
+}
+
+void trc_mon_trace(const char *args, size_t len)
+{
+    if (!len)
+        return trc_print_status();
+    if (len >= 2 && !strncasecmp(args, "on", 2) && (len == 2 || args[2] == ' '))
+    {
+        args += 2;
+        len -= 2;
+        while (len && *args == ' ')
+            args++, len--;
+        uint64_t mask = UINT64_MAX;
+        if (len && !trc_parse_mask(args, len, &mask))
+        {
+            printf("?invalid argument\n");
+            return;
+        }
+        if (!trc_buf)
+        {
+            trc_record_t *buf = malloc(TRC_RECORDS * sizeof(trc_record_t));
+            if (!buf)
+            {
+                printf("?Out of memory\n");
+                return;
+            }
+            trc_buf = buf;
+        }
+        trc_mask = mask;
+        trc_clear();
+        return;
+    }
+    if (len == 3 && !strncasecmp(args, "off", 3))
+        return trc_off();
+    if (len >= 5 && !strncasecmp(args, "save ", 5))
+    {
+        if (!trc_buf)
+            printf("?Trace is off\n");
+        else
+            trc_save(args + 5);
+        return;
+    }
+    printf("?invalid argument\n");
+}
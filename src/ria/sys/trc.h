@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RIA_SYS_TRC_H_
+#define _RIA_SYS_TRC_H_
+
+/* Bus trace of 6502 register accesses seen by the action loop.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <hardware/timer.h>
+
+// Must be a power of two.
+#define TRC_RECORDS 8192
+
+// One event, saved to file as is.
+typedef struct
+{
+    uint32_t time_us;
+    uint8_t reg;  // bits 0-4 address, bit 5 write
+    uint8_t data; // byte read or written
+    uint16_t aux; // $FFF0 only: us since RIA raised IRQ, else $FFFF
+} trc_record_t;
+
+// NULL when tracing is off.
+extern trc_record_t *volatile trc_buf;
+// Set only while a program runs, not for monitor actions.
+extern volatile bool trc_capturing;
+extern volatile uint32_t trc_head;
+extern uint64_t trc_mask;
+extern volatile uint32_t trc_irq_us;
+extern volatile bool trc_irq_pending;
+
+/* Main events
+ */
+
+void trc_run(void);
+void trc_stop(void);
+
+/* Utility
+ */
+
+// Called when the RIA pulls IRQ low.
+static inline void trc_irq_raised(void)
+{
+    if (trc_capturing && !trc_irq_pending)
+    {
+        trc_irq_us = time_us_32();
+        trc_irq_pending = true;
+    }
+}
+
+// Called from the action loop with the raw PIO event.
+static inline void trc_capture(uint32_t rw_addr_data)
+{
+    uint32_t now = time_us_32();
+    uint32_t reg = (rw_addr_data >> 8) & 0x3F;
+    uint16_t aux = 0xFFFF;
+    if ((reg & 0x1F) == 0x10 && trc_irq_pending)
+    {
+        uint32_t latency = now - trc_irq_us;
+        aux = latency < 0xFFFF ? latency : 0xFFFE;
+        trc_irq_pending = false;
+    }
+    if (!((trc_mask >> reg) & 1))
+        return;
+    trc_record_t *record = &trc_buf[trc_head++ & (TRC_RECORDS - 1)];
+    record->time_us = now;
+    record->reg = reg;
+    record->data = rw_addr_data;
+    record->aux = aux;
+}
+
+/* Monitor commands
+ */
+
+void trc_mon_trace(const char *args, size_t len);
+
+#endif /* _RIA_SYS_TRC_H_ */
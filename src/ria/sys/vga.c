@@ -14,6 +14,7 @@
 #include "ria.pio.h"
 #include <pico/stdlib.h>
 #include <hardware/clocks.h>
+#include <string.h>
 #include <strings.h>
 #include <stdio.h>
 
@@ -43,6 +44,27 @@ static enum {
 static absolute_time_t vga_vsync_timer;
 static absolute_time_t vga_version_timer;
 
+static uint32_t vga_backchannel_baudrate = VGA_BACKCHANNEL_BAUDRATE;
+
+// Frames are a 0xC0|type start then 7-bit data. Each group of up
+// to seven bytes follows a byte holding their top bits. The data is
+// a 16-bit length, the payload and a CRC-16/CCITT of type, length
+// and payload. Vsync, ack and nak may land anywhere in a frame.
+#define VGA_FRAME_MAX_PAYLOAD 256
+#define VGA_FRAME_SPRITE_REPORT 0
+static bool vga_frame_active;
+static uint8_t vga_frame_type;
+static uint8_t vga_frame_group;
+static uint8_t vga_frame_msb;
+static uint16_t vga_frame_pos;
+static uint16_t vga_frame_len;
+static uint16_t vga_frame_crc;
+static uint8_t vga_frame_data[VGA_FRAME_MAX_PAYLOAD + 2];
+
+// Sprite reports arrive in a frame after each vsync.
+#define VGA_REPORT_SIZE 8
+static uint16_t vga_report_xram = 0xFFFF;
+
 #define VGA_VERSION_MESSAGE_SIZE 80
 char vga_version_message[VGA_VERSION_MESSAGE_SIZE];
 size_t vga_version_message_length;
@@ -64,6 +86,85 @@ static inline void vga_pix_backchannel_request(void)
     pix_send_blocking(PIX_DEVICE_VGA, 0xF, 0x04, 2);
 }
 
+static inline void vga_pix_backchannel_enable_fast(void)
+{
+    pix_send_blocking(PIX_DEVICE_VGA, 0xF, 0x04, 3);
+}
+
+static void vga_set_baudrate(uint32_t baudrate)
+{
+    vga_backchannel_baudrate = baudrate;
+    float div = (float)clock_get_hz(clk_sys) / (8 * baudrate);
+    pio_sm_set_clkdiv(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM, div);
+    pio_sm_clear_fifos(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM);
+}
+
+static uint16_t vga_crc16(uint16_t crc, uint8_t byte)
+{
+    crc ^= byte << 8;
+    for (int i = 0; i < 8; i++)
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    return crc;
+}
+
+static void vga_frame_dispatch(uint8_t type, const uint8_t *data, uint16_t len)
+{
+    switch (type)
+    {
+    case VGA_FRAME_SPRITE_REPORT:
+        if (len == VGA_REPORT_SIZE && vga_report_xram != 0xFFFF)
+            memcpy(&xram[vga_report_xram], data, VGA_REPORT_SIZE);
+        break;
+    default:
+        DBG("VGA frame type %d ignored\n", type);
+        break;
+    }
+}
+
+// Unpacked bytes: length, payload, then CRC.
+static void vga_frame_byte(uint8_t byte)
+{
+    uint16_t pos = vga_frame_pos++;
+    if (pos < 2 + vga_frame_len)
+        vga_frame_crc = vga_crc16(vga_frame_crc, byte);
+    if (pos == 0)
+        vga_frame_len = byte;
+    else if (pos == 1)
+    {
+        vga_frame_len |= byte << 8;
+        if (vga_frame_len > VGA_FRAME_MAX_PAYLOAD)
+            vga_frame_active = false;
+    }
+    else
+    {
+        vga_frame_data[pos - 2] = byte;
+        if (pos == vga_frame_len + 3)
+        {
+            vga_frame_active = false;
+            if (vga_frame_crc == (vga_frame_data[vga_frame_len] |
+                                  vga_frame_data[vga_frame_len + 1] << 8))
+                vga_frame_dispatch(vga_frame_type, vga_frame_data, vga_frame_len);
+            else
+                DBG("VGA frame CRC failed\n");
+        }
+    }
+}
+
+static void vga_frame_packed(uint8_t byte)
+{
+    if (!vga_frame_group)
+    {
+        vga_frame_msb = byte;
+        vga_frame_group = 7;
+        return;
+    }
+    if (vga_frame_msb & 1)
+        byte |= 0x80;
+    vga_frame_msb >>= 1;
+    vga_frame_group--;
+    vga_frame_byte(byte);
+}
+
 static void vga_backchannel_command(uint8_t byte)
 {
     uint8_t scalar = byte & 0xF;
@@ -84,9 +185,28 @@ static void vga_backchannel_command(uint8_t byte)
     case 0xA0:
         pix_nak();
         break;
+    case 0xC0:
+        vga_frame_active = true;
+        vga_frame_type = scalar;
+        vga_frame_group = 0;
+        vga_frame_pos = 0;
+        vga_frame_len = 0;
+        vga_frame_crc = vga_crc16(0xFFFF, scalar);
+        break;
+    default: // reserved, resync at the next frame
+        vga_frame_active = false;
+        break;
     }
 }
 
+static void vga_backchannel_byte(uint8_t byte)
+{
+    if (byte & 0x80)
+        vga_backchannel_command(byte);
+    else if (vga_frame_active)
+        vga_frame_packed(byte);
+}
+
 static void vga_rln_callback(bool timeout, const char *buf, size_t length)
 {
     // VGA1 means VGA on PIX 1
@@ -96,25 +216,8 @@ static void vga_rln_callback(bool timeout, const char *buf, size_t length)
         vga_state = VGA_NOT_FOUND;
 }
 
-static void vga_connect(void)
+static bool vga_read_version(void)
 {
-    // Test if VGA connected
-    uint8_t vga_test_buf[4];
-    while (stdio_getchar_timeout_us(0) != PICO_ERROR_TIMEOUT)
-        tight_loop_contents();
-    rln_read_binary(VGA_BACKCHANNEL_ACK_MS, vga_rln_callback, vga_test_buf, sizeof(vga_test_buf));
-    vga_pix_backchannel_request();
-    vga_state = VGA_TESTING;
-    while (vga_state == VGA_TESTING)
-        rln_task();
-    if (vga_state == VGA_NOT_FOUND)
-        return vga_pix_backchannel_disable();
-
-    // Turn on the backchannel
-    pio_gpio_init(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_PIN);
-    vga_pix_backchannel_enable();
-
-    // Wait for version
     vga_version_message_length = 0;
     vga_version_timer = make_timeout_time_ms(VGA_VERSION_WATCHDOG_MS);
     while (true)
@@ -128,11 +231,7 @@ static void vga_connect(void)
                 if (byte == '\r' || byte == '\n')
                 {
                     if (vga_version_message_length > 0)
-                    {
-                        vga_vsync_timer = make_timeout_time_ms(VGA_VSYNC_WATCHDOG_MS);
-                        vga_state = VGA_CONNECTED;
-                        break;
-                    }
+                        return true;
                 }
                 else if (vga_version_message_length < VGA_VERSION_MESSAGE_SIZE - 1u)
                 {
@@ -142,14 +241,41 @@ static void vga_connect(void)
             }
         }
         if (absolute_time_diff_us(get_absolute_time(), vga_version_timer) < 0)
-        {
-            vga_vsync_timer = make_timeout_time_ms(VGA_VSYNC_WATCHDOG_MS);
-            vga_state = VGA_NO_VERSION;
-            break;
-        }
+            return false;
     }
 }
 
+static void vga_connect(void)
+{
+    // Test if VGA connected
+    uint8_t vga_test_buf[4];
+    while (stdio_getchar_timeout_us(0) != PICO_ERROR_TIMEOUT)
+        tight_loop_contents();
+    rln_read_binary(VGA_BACKCHANNEL_ACK_MS, vga_rln_callback, vga_test_buf, sizeof(vga_test_buf));
+    vga_pix_backchannel_request();
+    vga_state = VGA_TESTING;
+    while (vga_state == VGA_TESTING)
+        rln_task();
+    if (vga_state == VGA_NOT_FOUND)
+        return vga_pix_backchannel_disable();
+
+    // Turn on the backchannel. Older VGA firmware ignores
+    // the fast request and never sends a version.
+    pio_gpio_init(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_PIN);
+    vga_frame_active = false;
+    vga_set_baudrate(VGA_BACKCHANNEL_FAST_BAUDRATE);
+    vga_pix_backchannel_enable_fast();
+    bool has_version = vga_read_version();
+    if (!has_version)
+    {
+        vga_set_baudrate(VGA_BACKCHANNEL_BAUDRATE);
+        vga_pix_backchannel_enable();
+        has_version = vga_read_version();
+    }
+    vga_vsync_timer = make_timeout_time_ms(VGA_VSYNC_WATCHDOG_MS);
+    vga_state = has_version ? VGA_CONNECTED : VGA_NO_VERSION;
+}
+
 void vga_init(void)
 {
     // Disable backchannel for the case where RIA reboots and VGA doesn't
@@ -164,7 +290,7 @@ void vga_init(void)
     sm_config_set_in_pins(&c, VGA_BACKCHANNEL_PIN); // for WAIT, IN
     sm_config_set_in_shift(&c, true, true, 8);
     sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
-    float div = (float)clock_get_hz(clk_sys) / (8 * VGA_BACKCHANNEL_BAUDRATE);
+    float div = (float)clock_get_hz(clk_sys) / (8 * vga_backchannel_baudrate);
     sm_config_set_clkdiv(&c, div);
     pio_sm_init(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM, offset, &c);
     pio_sm_set_enabled(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM, true);
@@ -181,18 +307,15 @@ void vga_init(void)
 
 void vga_post_reclock(uint32_t sys_clk_khz)
 {
-    float div = (float)sys_clk_khz * 1000 / (8 * VGA_BACKCHANNEL_BAUDRATE);
+    float div = (float)sys_clk_khz * 1000 / (8 * vga_backchannel_baudrate);
     pio_sm_set_clkdiv(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM, div);
 }
 
 void vga_task(void)
 {
-    if (!pio_sm_is_rx_fifo_empty(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM))
-    {
-        uint8_t byte = pio_sm_get(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM) >> 24;
-        if (byte & 0x80)
-            vga_backchannel_command(byte);
-    }
+    // Drain the FIFO, the fast baud rate can fill it between calls.
+    while (!pio_sm_is_rx_fifo_empty(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM))
+        vga_backchannel_byte(pio_sm_get(VGA_BACKCHANNEL_PIO, VGA_BACKCHANNEL_SM) >> 24);
 
     if ((vga_state == VGA_CONNECTED || vga_state == VGA_NO_VERSION) &&
         absolute_time_diff_us(get_absolute_time(), vga_vsync_timer) < 0)
@@ -225,6 +348,7 @@ void vga_stop(void)
     // otherwise video flickers after every ria job.
     if (!ria_active())
         vga_needs_reset = true;
+    vga_report_xram = 0xFFFF;
 }
 
 void vga_break(void)
@@ -232,6 +356,16 @@ void vga_break(void)
     vga_needs_reset = true;
 }
 
+bool vga_xreg(uint16_t word)
+{
+    if (word != 0xFFFF && word > 0x10000 - VGA_REPORT_SIZE)
+        return false;
+    vga_report_xram = word;
+    if (vga_report_xram != 0xFFFF)
+        memset(&xram[vga_report_xram], 0, VGA_REPORT_SIZE);
+    return true;
+}
+
 bool vga_set_vga(uint32_t display_type)
 {
     pix_send_blocking(PIX_DEVICE_VGA, 0xF, 0x00, display_type);
@@ -16,6 +16,7 @@
 
 #define VGA_BACKCHANNEL_PIN COM_UART_TX_PIN
 #define VGA_BACKCHANNEL_BAUDRATE 115200
+#define VGA_BACKCHANNEL_FAST_BAUDRATE 921600
 #define VGA_BACKCHANNEL_PIO pio1
 #define VGA_BACKCHANNEL_SM 2
 
@@ -38,4 +39,7 @@ void vga_print_status(void);
 // Config handler.
 bool vga_set_vga(uint32_t display_type);
 
+// Set the XRAM address of the sprite report registers.
+bool vga_xreg(uint16_t word);
+
 #endif /* _RIA_SYS_VGA_H_ */
@@ -7,6 +7,8 @@
 #include "main.h"
 #include "tusb.h"
 #include "usb/msc.h"
+#include "mon/rom.h"
+#include "sys/sys.h"
 #include "fatfs/ff.h"
 #include "fatfs/diskio.h"
 #include "pico/aon_timer.h"
@@ -72,6 +74,7 @@ typedef enum
 {
     msc_volume_free = 0,
     msc_volume_inquiring,
+    msc_volume_mount_deferred,
     msc_volume_mounted,
     msc_volume_inquiry_failed,
     msc_volume_mount_failed,
@@ -111,6 +114,7 @@ void msc_print_status(void)
         switch (msc_volume_status[vol])
         {
         case msc_volume_inquiring:
+        case msc_volume_mount_deferred:
             printf(MSC_PRINT_INQUIRING, VolumeStr[vol]);
             break;
         case msc_volume_mounted:
@@ -149,6 +153,33 @@ void msc_print_status(void)
     }
 }
 
+static bool msc_mount(uint8_t vol)
+{
+    TCHAR volstr[6] = "USB0:";
+    volstr[3] += vol;
+    msc_mount_result[vol] = f_mount(&msc_fatfs_volumes[vol], volstr, 1);
+    if (msc_mount_result[vol] == FR_OK)
+    {
+        msc_volume_status[vol] = msc_volume_mounted;
+        sys_boot_mark("usb");
+    }
+    else
+    {
+        msc_volume_status[vol] = msc_volume_mount_failed;
+        return false;
+    }
+
+    // If current directory invalid, change to root of this drive
+    char s[2];
+    if (FR_OK != f_getcwd(s, 2))
+    {
+        f_chdrive(volstr);
+        f_chdir("/");
+    }
+
+    return true;
+}
+
 static bool inquiry_complete_cb(uint8_t dev_addr, tuh_msc_complete_data_t const *cb_data)
 {
     uint8_t vol;
@@ -168,26 +199,20 @@ static bool inquiry_complete_cb(uint8_t dev_addr, tuh_msc_complete_data_t const
     const uint32_t block_size = tuh_msc_get_block_size(dev_addr, cb_data->cbw->lun);
     msc_volume_size[vol] = (uint64_t)block_count * (uint64_t)block_size;
 
-    TCHAR volstr[6] = "USB0:";
-    volstr[3] += vol;
-    msc_mount_result[vol] = f_mount(&msc_fatfs_volumes[vol], volstr, 1);
-    if (msc_mount_result[vol] == FR_OK)
-        msc_volume_status[vol] = msc_volume_mounted;
-    else
-    {
-        msc_volume_status[vol] = msc_volume_mount_failed;
-        return false;
-    }
-
-    // If current directory invalid, change to root of this drive
-    char s[2];
-    if (FR_OK != f_getcwd(s, 2))
+    // Mounting reads the drive. Don't slow down the boot ROM.
+    if (rom_booting())
     {
-        f_chdrive(volstr);
-        f_chdir("/");
+        msc_volume_status[vol] = msc_volume_mount_deferred;
+        return true;
     }
+    return msc_mount(vol);
+}
 
-    return true;
+void msc_task(void)
+{
+    for (uint8_t vol = 0; vol < FF_VOLUMES; vol++)
+        if (msc_volume_status[vol] == msc_volume_mount_deferred && !rom_booting())
+            msc_mount(vol);
 }
 
 void tuh_msc_mount_cb(uint8_t dev_addr)
@@ -209,7 +234,8 @@ void tuh_msc_umount_cb(uint8_t dev_addr)
 {
     for (uint8_t vol = 0; vol < FF_VOLUMES; vol++)
     {
-        if (msc_volume_status[vol] == msc_volume_mounted &&
+        if ((msc_volume_status[vol] == msc_volume_mounted ||
+             msc_volume_status[vol] == msc_volume_mount_deferred) &&
             msc_volume_dev_addr[vol] == dev_addr)
         {
             msc_volume_status[vol] = msc_volume_free;
@@ -14,6 +14,12 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/* Main events
+ */
+
+// Finishes mounts deferred during boot. Calls FatFs.
+void msc_task(void);
+
 // For monitor status command.
 void msc_print_status(void);
 
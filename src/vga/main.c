@@ -30,6 +30,12 @@ static void init(void)
     led_init();
     ria_init();
     pix_init();
+#ifdef MODE1_BENCHMARK
+    mode1_benchmark();
+#endif
+#ifdef MODE4_BENCHMARK
+    mode4_benchmark();
+#endif
 }
 
 static void task(void)
@@ -8,8 +8,11 @@
 #include "modes/modes.h"
 #include "sys/vga.h"
 #include "sys/mem.h"
+#include "sys/pal.h"
 #include "term/color.h"
 #include "term/font.h"
+#include "scanvideo/scanvideo.h"
+#include <pico/stdlib.h>
 #include <string.h>
 
 // tree-slp-vectorize causes the example mode1.c to stutter
@@ -61,6 +64,28 @@ typedef struct
     uint16_t bg_color;
 } mode1_16bpp_data_t;
 
+#define MODE1_ATTR_REVERSE 0x01
+#define MODE1_ATTR_UNDERLINE 0x02
+#define MODE1_ATTR_BLINK 0x04
+#define MODE1_ATTR_DIM 0x08
+#define MODE1_ATTR_MASK 0x0F
+
+// Blink toggles every 16 frames like a VGA text mode.
+#define MODE1_BLINK_FRAMES 16
+
+static volatile uint32_t mode1_frame_no;
+
+// Whether a row of cells uses attributes, scanned once per frame
+// per row so plain rows stay on the fast path.
+typedef struct
+{
+    volatile const void *row_data;
+    uint32_t frame_no;
+    uint8_t attributes;
+} mode1_attr_cache_t;
+
+static mode1_attr_cache_t mode1_attr_cache[2];
+
 static volatile const uint8_t *
 mode1_scanline_to_data(int16_t scanline_id, mode1_config_t *config, size_t cell_size, int16_t font_height, int16_t *row)
 {
@@ -85,12 +110,13 @@ mode1_scanline_to_data(int16_t scanline_id, mode1_config_t *config, size_t cell_
 static volatile const uint16_t *
 mode1_get_palette(mode1_config_t *config, int16_t bpp)
 {
+    const uint16_t entries = 1u << bpp;
     if (!(config->xram_palette_ptr & 1) &&
-        config->xram_palette_ptr <= 0x10000 - sizeof(uint16_t) * (2 ^ bpp))
-        return (uint16_t *)&xram[config->xram_palette_ptr];
+        config->xram_palette_ptr <= 0x10000 - sizeof(uint16_t) * entries)
+        return pal_lookup((uint16_t *)&xram[config->xram_palette_ptr], entries);
     if (bpp == 1)
-        return color_2;
-    return color_256;
+        return pal_lookup(color_2, entries);
+    return pal_lookup(color_256, entries);
 }
 
 static volatile const uint8_t *
@@ -515,19 +541,59 @@ mode1_render_8bpp_8x16(int16_t scanline_id, int16_t width, uint16_t *rgb, uint16
     return mode1_render_8bpp(scanline_id, width, rgb, config_ptr, 16);
 }
 
-static bool
-mode1_render_16bpp(int16_t scanline_id, int16_t width, uint16_t *rgb,
-                   uint16_t config_ptr, int16_t font_height)
+static uint8_t
+mode1_row_attributes(mode1_config_t *config, volatile const mode1_16bpp_data_t *row_data)
+{
+    mode1_attr_cache_t *cache = &mode1_attr_cache[get_core_num()];
+    uint32_t frame_no = mode1_frame_no;
+    if (cache->row_data != row_data || cache->frame_no != frame_no)
+    {
+        uint8_t attributes = 0;
+        for (int16_t i = 0; i < config->width_chars; i++)
+            attributes |= row_data[i].attributes;
+        cache->row_data = row_data;
+        cache->frame_no = frame_no;
+        cache->attributes = attributes & MODE1_ATTR_MASK;
+    }
+    return cache->attributes;
+}
+
+static inline __attribute__((always_inline)) uint8_t
+mode1_apply_attributes(volatile const mode1_16bpp_data_t *data, uint8_t glyph,
+                       bool underline, bool blink_off, uint16_t *colors)
+{
+    const uint8_t attributes = data->attributes;
+    uint16_t bg = data->bg_color;
+    uint16_t fg = data->fg_color;
+    if (attributes & MODE1_ATTR_DIM)
+        fg = (fg & PICO_SCANVIDEO_ALPHA_MASK) |
+             PICO_SCANVIDEO_PIXEL_FROM_RGB5(PICO_SCANVIDEO_R5_FROM_PIXEL(fg) >> 1,
+                                            PICO_SCANVIDEO_G5_FROM_PIXEL(fg) >> 1,
+                                            PICO_SCANVIDEO_B5_FROM_PIXEL(fg) >> 1);
+    if (underline && (attributes & MODE1_ATTR_UNDERLINE))
+        glyph = 0xFF;
+    if (blink_off && (attributes & MODE1_ATTR_BLINK))
+        glyph = 0;
+    if (attributes & MODE1_ATTR_REVERSE)
+    {
+        colors[0] = fg;
+        colors[1] = bg;
+    }
+    else
+    {
+        colors[0] = bg;
+        colors[1] = fg;
+    }
+    return glyph;
+}
+
+// With attr false this is the plain renderer, the attribute
+// handling compiles away.
+static inline __attribute__((always_inline)) void
+mode1_render_16bpp_row(mode1_config_t *config, volatile const mode1_16bpp_data_t *row_data,
+                       volatile const uint8_t *font, int16_t width, uint16_t *rgb,
+                       bool attr, bool underline, bool blink_off)
 {
-    if (config_ptr > 0x10000 - sizeof(mode1_config_t))
-        return false;
-    mode1_config_t *config = (void *)&xram[config_ptr];
-    int16_t row;
-    volatile const mode1_16bpp_data_t *row_data =
-        (void *)mode1_scanline_to_data(scanline_id, config, sizeof(mode1_16bpp_data_t), font_height, &row);
-    if (!row_data)
-        return false;
-    volatile const uint8_t *font = mode1_get_font(config, font_height) + 256 * (row & (font_height - 1));
     int16_t col = -config->x_pos_px;
     while (width)
     {
@@ -535,6 +601,8 @@ mode1_render_16bpp(int16_t scanline_id, int16_t width, uint16_t *rgb,
         volatile const mode1_16bpp_data_t *data = &row_data[col / 8];
         uint8_t glyph = font[data->glyph_code];
         uint16_t colors[2] = {data->bg_color, data->fg_color};
+        if (attr)
+            glyph = mode1_apply_attributes(data, glyph, underline, blink_off, colors);
         int16_t part = 8 - (col & 7);
         if (part > config->width_chars * 8 - col)
             part = config->width_chars * 8 - col;
@@ -570,13 +638,24 @@ mode1_render_16bpp(int16_t scanline_id, int16_t width, uint16_t *rgb,
         col += fill_cols;
         while (fill_cols > 7)
         {
-            modes_render_1bpp(rgb, glyph, data->bg_color, data->fg_color);
+            if (attr)
+            {
+                glyph = mode1_apply_attributes(data, glyph, underline, blink_off, colors);
+                modes_render_1bpp(rgb, glyph, colors[0], colors[1]);
+            }
+            else
+                modes_render_1bpp(rgb, glyph, data->bg_color, data->fg_color);
             rgb += 8;
             fill_cols -= 8;
             glyph = font[(++data)->glyph_code];
         }
-        colors[0] = data->bg_color;
-        colors[1] = data->fg_color;
+        if (attr)
+            glyph = mode1_apply_attributes(data, glyph, underline, blink_off, colors);
+        else
+        {
+            colors[0] = data->bg_color;
+            colors[1] = data->fg_color;
+        }
         if (fill_cols >= 1)
             *rgb++ = colors[(glyph & 0x80) >> 7];
         if (fill_cols >= 2)
@@ -592,6 +671,28 @@ mode1_render_16bpp(int16_t scanline_id, int16_t width, uint16_t *rgb,
         if (fill_cols >= 7)
             *rgb++ = colors[(glyph & 0x02) >> 1];
     }
+}
+
+static bool
+mode1_render_16bpp(int16_t scanline_id, int16_t width, uint16_t *rgb,
+                   uint16_t config_ptr, int16_t font_height)
+{
+    if (config_ptr > 0x10000 - sizeof(mode1_config_t))
+        return false;
+    mode1_config_t *config = (void *)&xram[config_ptr];
+    int16_t row;
+    volatile const mode1_16bpp_data_t *row_data =
+        (void *)mode1_scanline_to_data(scanline_id, config, sizeof(mode1_16bpp_data_t), font_height, &row);
+    if (!row_data)
+        return false;
+    row &= font_height - 1;
+    volatile const uint8_t *font = mode1_get_font(config, font_height) + 256 * row;
+    if (!mode1_row_attributes(config, row_data))
+        mode1_render_16bpp_row(config, row_data, font, width, rgb, false, false, false);
+    else
+        mode1_render_16bpp_row(config, row_data, font, width, rgb, true,
+                               row == font_height - 1,
+                               mode1_frame_no & MODE1_BLINK_FRAMES);
     return true;
 }
 
@@ -607,6 +708,64 @@ mode1_render_16bpp_8x16(int16_t scanline_id, int16_t width, uint16_t *rgb, uint1
     return mode1_render_16bpp(scanline_id, width, rgb, config_ptr, 16);
 }
 
+void mode1_frame(void)
+{
+    mode1_frame_no++;
+}
+
+#ifdef MODE1_BENCHMARK
+#include <pico/time.h>
+#include <stdio.h>
+
+// Renders an 80 column 16bpp row with and without attributes.
+// Plain rows should match the renderer from before attributes.
+void mode1_benchmark(void)
+{
+    static uint16_t line[640];
+    const uint16_t config_ptr = 0xF000;
+    const uint16_t data_ptr = 0x0000;
+    const uint16_t iterations = 1000;
+    mode1_config_t *config = (void *)&xram[config_ptr];
+    memset(config, 0, sizeof(mode1_config_t));
+    config->width_chars = 80;
+    config->height_chars = 60;
+    config->xram_data_ptr = data_ptr;
+    config->xram_palette_ptr = 0xFFFF;
+    config->xram_font_ptr = 0xFFFF;
+    mode1_16bpp_data_t *data = (void *)&xram[data_ptr];
+    for (int i = 0; i < 80 * 60; i++)
+    {
+        data[i].glyph_code = 'A' + i % 26;
+        data[i].attributes = 0;
+        data[i].fg_color = 0xFFFF;
+        data[i].bg_color = PICO_SCANVIDEO_ALPHA_MASK;
+    }
+    // Rows 0-7 plain, rows 8-15 with one attribute cell each.
+    for (int row = 8; row < 16; row++)
+        data[row * 80].attributes = MODE1_ATTR_REVERSE << (row & 3);
+    static const struct
+    {
+        const char *name;
+        int16_t first_scanline;
+    } runs[] = {
+        {"plain", 0},
+        {"attributes", 64},
+    };
+    for (size_t r = 0; r < sizeof(runs) / sizeof(runs[0]); r++)
+    {
+        uint64_t start = time_us_64();
+        for (uint16_t n = 0; n < iterations; n++)
+        {
+            if (!(n & 63))
+                mode1_frame(); // defeat the row cache now and then
+            mode1_render_16bpp_8x8(runs[r].first_scanline + (n & 63), 640, line, config_ptr);
+        }
+        uint32_t ns_per_line = (time_us_64() - start) * 1000 / iterations;
+        printf("mode1 16bpp %-10s %5lu ns/line\n", runs[r].name, (unsigned long)ns_per_line);
+    }
+}
+#endif
+
 bool mode1_prog(uint16_t *xregs)
 {
     const uint16_t attributes = xregs[2];
@@ -13,4 +13,11 @@
 
 bool mode1_prog(uint16_t *xregs);
 
+// Call once per frame, advances the blink phase.
+void mode1_frame(void);
+
+#ifdef MODE1_BENCHMARK
+void mode1_benchmark(void);
+#endif
+
 #endif /* _VGA_MODES_MODE1_H_ */
@@ -8,6 +8,7 @@
 #include "modes/modes.h"
 #include "sys/vga.h"
 #include "sys/mem.h"
+#include "sys/pal.h"
 #include "term/color.h"
 #include <string.h>
 
@@ -50,12 +51,13 @@ mode3_scanline_to_data(int16_t scanline_id, mode3_config_t *config, int16_t bpp)
 static volatile const uint16_t *
 mode3_get_palette(mode3_config_t *config, int16_t bpp)
 {
+    const uint16_t entries = 1u << bpp;
     if (!(config->xram_palette_ptr & 1) &&
-        config->xram_palette_ptr <= 0x10000 - sizeof(uint16_t) * (2 ^ bpp))
-        return (uint16_t *)&xram[config->xram_palette_ptr];
+        config->xram_palette_ptr <= 0x10000 - sizeof(uint16_t) * entries)
+        return pal_lookup((uint16_t *)&xram[config->xram_palette_ptr], entries);
     if (bpp == 1)
-        return color_2;
-    return color_256;
+        return pal_lookup(color_2, entries);
+    return pal_lookup(color_256, entries);
 }
 
 static inline __attribute__((always_inline)) int16_t
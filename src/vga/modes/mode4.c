@@ -12,8 +12,12 @@
 #include "modes/mode4.h"
 #include "sys/mem.h"
 #include "sys/vga.h"
+#include "term/color.h"
+#include "scanvideo/scanvideo.h"
 #include <hardware/interp.h>
+#include <pico/stdlib.h>
 #include <stdint.h>
+#include <string.h>
 
 #pragma GCC push_options
 #pragma GCC optimize("O3")
@@ -37,6 +41,41 @@ typedef struct
     bool has_opacity_metadata;
 } mode4_asprite_t;
 
+// Rectangular 16bpp sprites of any size up to 512 pixels.
+// Optional opacity metadata is one word per row, see sprite_opacity.py.
+typedef struct
+{
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    uint16_t xram_sprite_ptr;
+    int16_t width_px;
+    int16_t height_px;
+    bool has_opacity_metadata;
+} mode4_rsprite_t;
+
+// Indexed colour sprites are 8bpp or 4bpp (high nibble first).
+// Palette is RGB565 like mode 3, system palette if invalid.
+typedef struct
+{
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    uint16_t xram_sprite_ptr;
+    uint16_t xram_palette_ptr;
+    uint8_t log_size;
+    uint8_t transparent_index;
+} mode4_isprite_t;
+
+typedef struct
+{
+    int16_t transform[6];
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    uint16_t xram_sprite_ptr;
+    uint16_t xram_palette_ptr;
+    uint8_t log_size;
+    uint8_t transparent_index;
+} mode4_iasprite_t;
+
 // Note some of the sprite routines are quite large (unrolled), so trying to
 // keep everything in separate sections so the linker can garbage collect
 // unused sprite code. In particular we usually need 8bpp xor 16bpp functions!
@@ -56,6 +95,16 @@ void sprite_blit16_alpha(uint16_t *dst, const uint16_t *src, uint len);
 void sprite_ablit16_loop(uint16_t *dst, uint len);
 void sprite_ablit16_alpha_loop(uint16_t *dst, uint len, uint mask);
 
+// Indexed colour, skipping the transparent index
+void sprite_blit8_pal(uint16_t *dst, const uint8_t *src, uint len,
+                      const uint16_t *palette, uint transparent);
+void sprite_blit4_pal(uint16_t *dst, const uint8_t *src, uint len,
+                      const uint16_t *palette, uint transparent);
+void sprite_ablit8_pal_loop(uint16_t *dst, uint len, uint mask,
+                            const uint16_t *palette, uint transparent);
+void sprite_ablit4_pal_loop(uint16_t *dst, uint len, uint mask,
+                            const uint16_t *palette, uint transparent);
+
 // Store unpacked affine transforms as signed 16.16 fixed point in the following order:
 // a00, a01, b0,   a10, a11, b1
 // i.e. the top two rows of the matrix
@@ -269,21 +318,228 @@ static inline __attribute__((always_inline)) void __ram_func(sprite_sprite16)(
     }
 }
 
-static void mode4_render_sprite(int16_t scanline, int16_t width, uint16_t *rgb, uint16_t config_ptr, uint16_t length)
+// Collision tracking. Each core keeps a scanline of sprite owners so
+// the render functions stay reentrant. The first 16 sprites are tracked.
+// Bits 0-15 are sprite vs sprite, bits 16-31 are sprite vs playfield.
+#define MODE4_ATTR_COLLIDE 0x8
+#define MODE4_COLLIDE_SPRITES 16
+
+typedef struct
 {
-    const mode4_sprite_t *sprites = (void *)&xram[config_ptr];
-    for (uint16_t i = 0; i < length; i++)
+    uint8_t owner[640];
+    uint32_t bits;
+} mode4_collide_t;
+
+static mode4_collide_t mode4_collide[2];
+static mode4_collide_t *mode4_collide_active[2];
+static uint32_t mode4_collide_bits;
+static volatile bool mode4_report_pending;
+
+static inline mode4_collide_t *mode4_collide_get(void)
+{
+    return mode4_collide_active[get_core_num()];
+}
+
+// Playfield is anything opaque already in the scanline buffer.
+static inline __attribute__((always_inline)) void mode4_collide_pixel(
+    mode4_collide_t *col, const uint16_t *rgb, uint x, uint id)
+{
+    uint owner = col->owner[x];
+    if (owner)
+        col->bits |= (1u << (owner - 1)) | (1u << (id - 1));
+    else if (rgb[x] & PICO_SCANVIDEO_ALPHA_MASK)
+        col->bits |= 1u << (id + 15);
+    col->owner[x] = id;
+}
+
+static void __ram_func(mode4_collide16)(
+    mode4_collide_t *col, const uint16_t *rgb, uint x, const uint16_t *src, uint len, uint id)
+{
+    for (uint j = 0; j < len; j++)
+        if (src[j] & PICO_SCANVIDEO_ALPHA_MASK)
+            mode4_collide_pixel(col, rgb, x + j, id);
+}
+
+static void __ram_func(mode4_collide8)(
+    mode4_collide_t *col, const uint16_t *rgb, uint x, const uint8_t *src, uint len,
+    uint transparent_index, uint id)
+{
+    for (uint j = 0; j < len; j++)
+        if (src[j] != transparent_index)
+            mode4_collide_pixel(col, rgb, x + j, id);
+}
+
+// pix is the nibble offset of the first pixel, high nibble first.
+static void __ram_func(mode4_collide4)(
+    mode4_collide_t *col, const uint16_t *rgb, uint x, const uint8_t *img, uint32_t pix, uint len,
+    uint transparent_index, uint id)
+{
+    for (uint j = 0; j < len; j++, pix++)
     {
-        const unsigned px_size = 2 ^ sprites[i].log_size;
-        unsigned byte_size = px_size * px_size * sizeof(uint16_t);
-        if (sprites[i].has_opacity_metadata)
-            byte_size += px_size * sizeof(uint32_t);
-        if (sprites[i].xram_sprite_ptr <= 0x10000 - byte_size)
-        {
-            const void *img = (void *)&xram[sprites[i].xram_sprite_ptr];
-            sprite_sprite16(rgb, &sprites[i], img, scanline, width);
-        }
+        uint8_t byte = img[pix / 2];
+        uint index = (pix & 1) ? byte & 0xF : byte >> 4;
+        if (index != transparent_index)
+            mode4_collide_pixel(col, rgb, x + j, id);
+    }
+}
+
+// Walks the interpolator exactly like the blit loops, then rewinds it.
+static void __ram_func(mode4_collide_affine)(
+    mode4_collide_t *col, const uint16_t *rgb, uint x, uint len, uint mask, uint bpp,
+    uint transparent_index, uint id)
+{
+    interp_hw_t *interp = interp0;
+    const uint32_t accum0 = interp->accum[0];
+    const uint32_t accum1 = interp->accum[1];
+    for (uint j = len; j-- > 0;)
+    {
+        uint32_t u = interp->accum[0];
+        uint32_t v = interp->accum[1];
+        const uint8_t *src = (const uint8_t *)interp->pop[2];
+        if ((u | v) & mask)
+            continue;
+        bool opaque;
+        if (bpp == 16)
+            opaque = *(const uint16_t *)src & PICO_SCANVIDEO_ALPHA_MASK;
+        else if (bpp == 8)
+            opaque = *src != transparent_index;
+        else
+            opaque = ((u & 0x10000) ? *src & 0xF : *src >> 4) != transparent_index;
+        if (opaque)
+            mode4_collide_pixel(col, rgb, x + j, id);
     }
+    interp->accum[0] = accum0;
+    interp->accum[1] = accum1;
+}
+
+static void mode4_collide_begin(int16_t width)
+{
+    mode4_collide_t *col = &mode4_collide[get_core_num()];
+    memset(col->owner, 0, MIN((uint)width, sizeof(col->owner)));
+    col->bits = 0;
+    mode4_collide_active[get_core_num()] = col;
+}
+
+static void mode4_collide_end(void)
+{
+    mode4_collide_t *col = &mode4_collide[get_core_num()];
+    mode4_collide_active[get_core_num()] = NULL;
+    if (col->bits)
+        __atomic_fetch_or(&mode4_collide_bits, col->bits, __ATOMIC_RELAXED);
+    mode4_report_pending = true;
+}
+
+// Sprite budgets are set per plane. Render functions find theirs by
+// config_ptr and format since they aren't told the plane.
+#define MODE4_ATTR_BUDGET 0x10
+#define MODE4_BUDGET_CANDIDATES 64
+
+// Measures (draw false) or draws one sprite.
+typedef int (*mode4_one_fn)(const void *config, uint16_t i, int16_t scanline, int16_t width,
+                            uint16_t *rgb, mode4_collide_t *col, bool draw);
+
+typedef struct
+{
+    mode4_one_fn one;
+    uint16_t config_ptr;
+    uint16_t z_ptr;
+    uint16_t max_sprites;
+    uint16_t max_pixels;
+    bool collide;
+} mode4_budget_t;
+
+static mode4_budget_t mode4_budget[PICO_SCANVIDEO_PLANE_COUNT];
+static uint32_t mode4_frame_count;
+static uint32_t mode4_dropped_sprites;
+static uint32_t mode4_overflow_lines;
+
+void mode4_frame(void)
+{
+    mode4_frame_count++;
+}
+
+bool mode4_frame_report(mode4_report_t *report)
+{
+    if (!mode4_report_pending)
+        return false;
+    mode4_report_pending = false;
+    uint32_t bits = __atomic_exchange_n(&mode4_collide_bits, 0, __ATOMIC_RELAXED);
+    uint32_t dropped = __atomic_exchange_n(&mode4_dropped_sprites, 0, __ATOMIC_RELAXED);
+    uint32_t lines = __atomic_exchange_n(&mode4_overflow_lines, 0, __ATOMIC_RELAXED);
+    report->collide_sprites = bits;
+    report->collide_playfield = bits >> 16;
+    report->dropped_sprites = MIN(dropped, UINT16_MAX);
+    report->overflow_lines = MIN(lines, UINT16_MAX);
+    return true;
+}
+
+static inline __attribute__((always_inline)) int mode4_one_rsprite(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    const mode4_rsprite_t *sp = &((const mode4_rsprite_t *)config)[i];
+    const int16_t w = sp->width_px;
+    const int16_t h = sp->height_px;
+    if (w < 1 || h < 1 || w > 512 || h > 512)
+        return 0;
+    uint32_t byte_size = (uint32_t)w * h * sizeof(uint16_t);
+    if (sp->has_opacity_metadata)
+        byte_size += h * sizeof(uint32_t);
+    if (byte_size > 0x10000 || sp->xram_sprite_ptr > 0x10000 - byte_size)
+        return 0;
+    intersect_t isct = {0};
+    isct.tex_offs_y = scanline - sp->y_pos_px;
+    if (isct.tex_offs_y < 0 || isct.tex_offs_y >= h)
+        return 0;
+    int x_start_clipped = MAX(0, sp->x_pos_px);
+    isct.tex_offs_x = x_start_clipped - sp->x_pos_px;
+    isct.size_x = MIN(sp->x_pos_px + w, (int)width) - x_start_clipped;
+    if (isct.size_x <= 0 || !draw)
+        return MAX(0, isct.size_x);
+    const int size_x = isct.size_x;
+    const uint16_t *img = (void *)&xram[sp->xram_sprite_ptr];
+    const uint16_t *row = img + isct.tex_offs_y * w;
+    if (col)
+        mode4_collide16(col, rgb, x_start_clipped, row + isct.tex_offs_x, isct.size_x, i + 1);
+    bool span_continuous = false;
+    if (sp->has_opacity_metadata)
+    {
+        uint32_t meta = ((uint32_t *)(img + w * h))[isct.tex_offs_y];
+        isct = _intersect_with_metadata(isct, meta);
+        if (isct.size_x <= 0)
+            return size_x;
+        span_continuous = !!(meta & (1u << 31));
+    }
+    if (span_continuous)
+        sprite_blit16(rgb + sp->x_pos_px + isct.tex_offs_x, row + isct.tex_offs_x, isct.size_x);
+    else
+        sprite_blit16_alpha(rgb + sp->x_pos_px + isct.tex_offs_x, row + isct.tex_offs_x, isct.size_x);
+    return size_x;
+}
+
+static inline __attribute__((always_inline)) int mode4_one_sprite(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    const mode4_sprite_t *sp = &((const mode4_sprite_t *)config)[i];
+    if (sp->log_size > 8)
+        return 0;
+    const uint32_t px_size = 1u << sp->log_size;
+    uint32_t byte_size = px_size * px_size * sizeof(uint16_t);
+    if (sp->has_opacity_metadata)
+        byte_size += px_size * sizeof(uint32_t);
+    if (byte_size > 0x10000 || sp->xram_sprite_ptr > 0x10000 - byte_size)
+        return 0;
+    const void *img = (void *)&xram[sp->xram_sprite_ptr];
+    if (col || !draw)
+    {
+        intersect_t isct = _get_sprite_intersect(sp, scanline, width);
+        if (isct.size_x <= 0 || !draw)
+            return MAX(0, isct.size_x);
+        mode4_collide16(col, rgb, MAX(0, sp->x_pos_px),
+                        (const uint16_t *)img + isct.tex_offs_x + (isct.tex_offs_y << sp->log_size),
+                        isct.size_x, i + 1);
+    }
+    sprite_sprite16(rgb, sp, img, scanline, width);
+    return 0;
 }
 
 // We're defining the affine transform as:
@@ -348,7 +604,7 @@ static inline __attribute__((always_inline)) void _setup_interp_pix_coordgen(
 // optimize-sibling-calls breaks sprite_ablit16_alpha_loop
 __attribute__((optimize("no-optimize-sibling-calls"))) void __ram_func(sprite_asprite16)(
     uint16_t *scanbuf, const mode4_asprite_t *sp, const void *sp_img,
-    uint raster_y, uint raster_w)
+    uint raster_y, uint raster_w, mode4_collide_t *col, uint id)
 {
     intersect_t isct = _get_asprite_intersect(sp, raster_y, raster_w);
     if (isct.size_x <= 0)
@@ -359,25 +615,400 @@ __attribute__((optimize("no-optimize-sibling-calls"))) void __ram_func(sprite_as
         atrans[j] = (int32_t)sp->transform[j] << 8;
     _setup_interp_affine(interp, isct, atrans);
     _setup_interp_pix_coordgen(interp, sp, sp_img, 1);
+    if (col)
+        mode4_collide_affine(col, scanbuf, MAX(0, sp->x_pos_px), isct.size_x,
+                             0xFFFF0000 << sp->log_size, 16, 0, id);
     sprite_ablit16_alpha_loop(scanbuf + MAX(0, sp->x_pos_px), isct.size_x, 0xFFFF0000 << sp->log_size);
 }
 
-static void mode4_render_asprite(int16_t scanline, int16_t width, uint16_t *rgb, uint16_t config_ptr, uint16_t length)
+static inline __attribute__((always_inline)) int mode4_one_asprite(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
 {
-    mode4_asprite_t *sprites = (void *)&xram[config_ptr];
+    const mode4_asprite_t *sp = &((const mode4_asprite_t *)config)[i];
+    if (sp->log_size > 8)
+        return 0;
+    const uint32_t px_size = 1u << sp->log_size;
+    uint32_t byte_size = px_size * px_size * sizeof(uint16_t);
+    if (sp->has_opacity_metadata)
+        byte_size += px_size * sizeof(uint32_t);
+    if (byte_size > 0x10000 || sp->xram_sprite_ptr > 0x10000 - byte_size)
+        return 0;
+    if (!draw)
+        return MAX(0, _get_asprite_intersect(sp, scanline, width).size_x);
+    const void *img = (void *)&xram[sp->xram_sprite_ptr];
+    sprite_asprite16(rgb, sp, img, scanline, width, col, i + 1);
+    return 0;
+}
+
+static inline intersect_t _get_isprite_intersect(int16_t x_pos_px, int16_t y_pos_px, uint8_t log_size,
+                                                 uint raster_y, uint raster_w)
+{
+    intersect_t isct = {0};
+    isct.tex_offs_y = (int)raster_y - y_pos_px;
+    int size = 1u << log_size;
+    uint upper_mask = -size;
+    if ((uint)isct.tex_offs_y & upper_mask)
+        return isct;
+    int x_start_clipped = MAX(0, x_pos_px);
+    isct.tex_offs_x = x_start_clipped - x_pos_px;
+    isct.size_x = MIN(x_pos_px + size, (int)raster_w) - x_start_clipped;
+    return isct;
+}
+
+static inline const uint16_t *mode4_get_palette(uint16_t xram_palette_ptr, unsigned entries)
+{
+    if (!(xram_palette_ptr & 1) &&
+        xram_palette_ptr <= 0x10000 - sizeof(uint16_t) * entries)
+        return (const uint16_t *)&xram[xram_palette_ptr];
+    return color_256;
+}
+
+// 4bpp needs log_size >= 1 so rows are whole bytes.
+static inline bool mode4_isprite_fits(uint16_t xram_sprite_ptr, uint8_t log_size, uint bpp)
+{
+    if (log_size > 8 || (bpp == 4 && !log_size))
+        return false;
+    uint32_t byte_size = (1u << (2 * log_size)) * bpp / 8;
+    return xram_sprite_ptr <= 0x10000 - byte_size;
+}
+
+static inline __attribute__((always_inline)) int mode4_one_sprite8(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    const mode4_isprite_t *sp = &((const mode4_isprite_t *)config)[i];
+    if (!mode4_isprite_fits(sp->xram_sprite_ptr, sp->log_size, 8))
+        return 0;
+    intersect_t isct = _get_isprite_intersect(sp->x_pos_px, sp->y_pos_px, sp->log_size, scanline, width);
+    if (isct.size_x <= 0 || !draw)
+        return MAX(0, isct.size_x);
+    const uint8_t *img = &xram[sp->xram_sprite_ptr];
+    if (col)
+        mode4_collide8(col, rgb, MAX(0, sp->x_pos_px),
+                       img + (isct.tex_offs_y << sp->log_size) + isct.tex_offs_x,
+                       isct.size_x, sp->transparent_index, i + 1);
+    sprite_blit8_pal(rgb + MAX(0, sp->x_pos_px),
+                     img + (isct.tex_offs_y << sp->log_size) + isct.tex_offs_x,
+                     isct.size_x, mode4_get_palette(sp->xram_palette_ptr, 256),
+                     sp->transparent_index);
+    return isct.size_x;
+}
+
+static inline __attribute__((always_inline)) int mode4_one_sprite4(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    const mode4_isprite_t *sp = &((const mode4_isprite_t *)config)[i];
+    if (!mode4_isprite_fits(sp->xram_sprite_ptr, sp->log_size, 4))
+        return 0;
+    intersect_t isct = _get_isprite_intersect(sp->x_pos_px, sp->y_pos_px, sp->log_size, scanline, width);
+    if (isct.size_x <= 0 || !draw)
+        return MAX(0, isct.size_x);
+    const uint16_t *palette = mode4_get_palette(sp->xram_palette_ptr, 16);
+    uint32_t pix = (isct.tex_offs_y << sp->log_size) + isct.tex_offs_x;
+    if (col)
+        mode4_collide4(col, rgb, MAX(0, sp->x_pos_px), &xram[sp->xram_sprite_ptr], pix,
+                       isct.size_x, sp->transparent_index, i + 1);
+    const uint8_t *src = &xram[sp->xram_sprite_ptr + pix / 2];
+    uint16_t *dst = rgb + MAX(0, sp->x_pos_px);
+    uint len = isct.size_x;
+    if (pix & 1)
+    {
+        uint8_t index = *src++ & 0xF;
+        if (index != sp->transparent_index)
+            *dst = palette[index];
+        dst++;
+        len--;
+    }
+    sprite_blit4_pal(dst, src, len, palette, sp->transparent_index);
+    return isct.size_x;
+}
+
+// Lane 0 and 1 concatenate u and v into a byte index. For 4bpp the
+// low bit of u is dropped and the loop reads it from ACCUM0 instead.
+static inline __attribute__((always_inline)) void _setup_interp_pix_coordgen_indexed(
+    interp_hw_t *interp, uint8_t log_size, const void *sp_img, uint bpp)
+{
+    uint u_bits = bpp == 4 ? log_size - 1 : log_size;
+    uint u_shift = bpp == 4 ? 17 : 16;
+    assert(u_bits > 0 && u_bits + log_size <= 16);
+
+    interp_config c0 = interp_default_config();
+    interp_config_set_add_raw(&c0, true);
+    interp_config_set_shift(&c0, u_shift);
+    interp_config_set_mask(&c0, 0, u_bits - 1);
+    interp_set_config(interp, 0, &c0);
+
+    interp_config c1 = interp_default_config();
+    interp_config_set_add_raw(&c1, true);
+    interp_config_set_shift(&c1, 16 - u_bits);
+    interp_config_set_mask(&c1, u_bits, u_bits + log_size - 1);
+    interp_set_config(interp, 1, &c1);
+
+    interp_set_base(interp, 2, (uint32_t)sp_img);
+}
+
+// Note we do NOT save/restore the interpolator!
+static void __ram_func(sprite_iasprite)(
+    uint16_t *scanbuf, const mode4_iasprite_t *sp, uint raster_y, uint raster_w, uint bpp,
+    mode4_collide_t *col, uint id)
+{
+    intersect_t isct = _get_isprite_intersect(sp->x_pos_px, sp->y_pos_px, sp->log_size, raster_y, raster_w);
+    if (isct.size_x <= 0)
+        return;
+    interp_hw_t *interp = interp0;
+    affine_transform_t atrans;
+    for (uint16_t j = 0; j < 6; j++)
+        atrans[j] = (int32_t)sp->transform[j] << 8;
+    _setup_interp_affine(interp, isct, atrans);
+    _setup_interp_pix_coordgen_indexed(interp, sp->log_size, &xram[sp->xram_sprite_ptr], bpp);
+    const uint mask = 0xFFFF0000 << sp->log_size;
+    if (col)
+        mode4_collide_affine(col, scanbuf, MAX(0, sp->x_pos_px), isct.size_x, mask, bpp,
+                             sp->transparent_index, id);
+    if (bpp == 4)
+        sprite_ablit4_pal_loop(scanbuf + MAX(0, sp->x_pos_px), isct.size_x, mask,
+                               mode4_get_palette(sp->xram_palette_ptr, 16), sp->transparent_index);
+    else
+        sprite_ablit8_pal_loop(scanbuf + MAX(0, sp->x_pos_px), isct.size_x, mask,
+                               mode4_get_palette(sp->xram_palette_ptr, 256), sp->transparent_index);
+}
+
+// Affine 4bpp needs 4x4 or larger so u keeps a bit after the nibble select.
+static inline __attribute__((always_inline)) int mode4_one_iasprite(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw,
+    uint bpp)
+{
+    const mode4_iasprite_t *sp = &((const mode4_iasprite_t *)config)[i];
+    if (sp->log_size < (bpp == 4 ? 2 : 1) ||
+        !mode4_isprite_fits(sp->xram_sprite_ptr, sp->log_size, bpp))
+        return 0;
+    if (!draw)
+        return MAX(0, _get_isprite_intersect(sp->x_pos_px, sp->y_pos_px, sp->log_size, scanline, width).size_x);
+    sprite_iasprite(rgb, sp, scanline, width, bpp, col, i + 1);
+    return 0;
+}
+
+static inline __attribute__((always_inline)) int mode4_one_asprite8(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    return mode4_one_iasprite(config, i, scanline, width, rgb, col, draw, 8);
+}
+
+static inline __attribute__((always_inline)) int mode4_one_asprite4(
+    const void *config, uint16_t i, int16_t scanline, int16_t width, uint16_t *rgb, mode4_collide_t *col, bool draw)
+{
+    return mode4_one_iasprite(config, i, scanline, width, rgb, col, draw, 4);
+}
+
+// Per line budget and priority. Sprites on the line are put in z order,
+// then the budget is filled starting from a sprite that rotates each
+// frame. Sprites over budget flicker instead of overrunning the line.
+static void __ram_func(mode4_render_budget)(int16_t scanline, int16_t width, uint16_t *rgb, uint16_t config_ptr,
+                                            uint16_t length, mode4_one_fn one)
+{
+    const mode4_budget_t *budget = NULL;
+    for (uint p = 0; p < PICO_SCANVIDEO_PLANE_COUNT; p++)
+        if (mode4_budget[p].config_ptr == config_ptr && mode4_budget[p].one == one)
+            budget = &mode4_budget[p];
+    if (!budget)
+        return;
+    const void *config = &xram[config_ptr];
+    uint16_t order[MODE4_BUDGET_CANDIDATES];
+    uint16_t span[MODE4_BUDGET_CANDIDATES];
+    uint count = 0, dropped = 0;
     for (uint16_t i = 0; i < length; i++)
     {
-        const unsigned px_size = 2 ^ sprites[i].log_size;
-        unsigned byte_size = px_size * px_size * sizeof(uint16_t);
-        if (sprites[i].has_opacity_metadata)
-            byte_size += px_size * sizeof(uint32_t);
-        if (sprites[i].xram_sprite_ptr <= 0x10000 - byte_size)
+        int w = one(config, i, scanline, width, rgb, NULL, false);
+        if (w <= 0)
+            continue;
+        if (count == MODE4_BUDGET_CANDIDATES)
+        {
+            dropped++;
+            continue;
+        }
+        order[count] = i;
+        span[count++] = w;
+    }
+    if (budget->z_ptr != 0xFFFF && budget->z_ptr <= 0x10000 - length)
+    {
+        // Stable insertion sort, low z draws first and ends up behind.
+        const uint8_t *z = &xram[budget->z_ptr];
+        for (uint j = 1; j < count; j++)
+        {
+            uint16_t o = order[j], w = span[j];
+            uint k = j;
+            for (; k > 0 && z[order[k - 1]] > z[o]; k--)
+            {
+                order[k] = order[k - 1];
+                span[k] = span[k - 1];
+            }
+            order[k] = o;
+            span[k] = w;
+        }
+    }
+    uint64_t keep = count < 64 ? (1ull << count) - 1 : ~0ull;
+    uint32_t pixels = 0;
+    for (uint j = 0; j < count; j++)
+        pixels += span[j];
+    if ((budget->max_sprites && count > budget->max_sprites) ||
+        (budget->max_pixels && pixels > budget->max_pixels))
+    {
+        keep = 0;
+        uint sprites = 0;
+        pixels = 0;
+        uint start = mode4_frame_count % count;
+        for (uint j = 0; j < count; j++)
+        {
+            uint k = (start + j) % count;
+            if ((budget->max_sprites && sprites >= budget->max_sprites) ||
+                (budget->max_pixels && pixels + span[k] > budget->max_pixels))
+            {
+                dropped++;
+                continue;
+            }
+            keep |= 1ull << k;
+            sprites++;
+            pixels += span[k];
+        }
+    }
+    mode4_collide_t *col = NULL;
+    if (budget->collide)
+    {
+        mode4_collide_begin(width);
+        col = mode4_collide_get();
+    }
+    for (uint j = 0; j < count; j++)
+        if (keep & (1ull << j))
+            one(config, order[j], scanline, width, rgb,
+                order[j] < MODE4_COLLIDE_SPRITES ? col : NULL, true);
+    if (col)
+        mode4_collide_end();
+    if (dropped)
+    {
+        __atomic_fetch_add(&mode4_dropped_sprites, dropped, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&mode4_overflow_lines, 1, __ATOMIC_RELAXED);
+    }
+    mode4_report_pending = true;
+}
+
+// Plain, collision and budget variants of each render function.
+#define MODE4_RENDER_FNS(name)                                                         \
+    static void mode4_render_##name(int16_t scanline, int16_t width, uint16_t *rgb,    \
+                                    uint16_t config_ptr, uint16_t length)              \
+    {                                                                                  \
+        const void *config = &xram[config_ptr];                                        \
+        for (uint16_t i = 0; i < length; i++)                                          \
+            mode4_one_##name(config, i, scanline, width, rgb, NULL, true);             \
+    }                                                                                  \
+    static void mode4_render_##name##_collide(int16_t scanline, int16_t width,         \
+                                              uint16_t *rgb, uint16_t config_ptr,      \
+                                              uint16_t length)                         \
+    {                                                                                  \
+        const void *config = &xram[config_ptr];                                        \
+        mode4_collide_begin(width);                                                    \
+        mode4_collide_t *col = mode4_collide_get();                                    \
+        for (uint16_t i = 0; i < length; i++)                                          \
+            mode4_one_##name(config, i, scanline, width, rgb,                          \
+                             i < MODE4_COLLIDE_SPRITES ? col : NULL, true);            \
+        mode4_collide_end();                                                           \
+    }                                                                                  \
+    static int mode4_one_##name##_fn(const void *config, uint16_t i, int16_t scanline, \
+                                     int16_t width, uint16_t *rgb,                     \
+                                     mode4_collide_t *col, bool draw)                  \
+    {                                                                                  \
+        return mode4_one_##name(config, i, scanline, width, rgb, col, draw);           \
+    }                                                                                  \
+    static void mode4_render_##name##_budget(int16_t scanline, int16_t width,          \
+                                             uint16_t *rgb, uint16_t config_ptr,       \
+                                             uint16_t length)                          \
+    {                                                                                  \
+        mode4_render_budget(scanline, width, rgb, config_ptr, length,                  \
+                            mode4_one_##name##_fn);                                    \
+    }
+
+MODE4_RENDER_FNS(sprite)
+MODE4_RENDER_FNS(asprite)
+MODE4_RENDER_FNS(sprite8)
+MODE4_RENDER_FNS(asprite8)
+MODE4_RENDER_FNS(sprite4)
+MODE4_RENDER_FNS(asprite4)
+MODE4_RENDER_FNS(rsprite)
+
+#ifdef MODE4_BENCHMARK
+#include <pico/time.h>
+#include <stdio.h>
+
+// Renders 32x32 sprites across one scanline buffer and reports how
+// many fit in a 640x480 line (31.78us) on one core.
+void mode4_benchmark(void)
+{
+    static uint16_t line[640];
+    static const struct
+    {
+        const char *name;
+        void (*fn)(int16_t, int16_t, uint16_t *, uint16_t, uint16_t);
+        size_t config_size;
+        uint bpp;
+        bool affine;
+    } formats[] = {
+        {"16bpp", mode4_render_sprite, sizeof(mode4_sprite_t), 16, false},
+        {"8bpp", mode4_render_sprite8, sizeof(mode4_isprite_t), 8, false},
+        {"4bpp", mode4_render_sprite4, sizeof(mode4_isprite_t), 4, false},
+        {"16bpp affine", mode4_render_asprite, sizeof(mode4_asprite_t), 16, true},
+        {"8bpp affine", mode4_render_asprite8, sizeof(mode4_iasprite_t), 8, true},
+        {"4bpp affine", mode4_render_asprite4, sizeof(mode4_iasprite_t), 4, true},
+    };
+    const uint16_t count = 16;
+    const uint16_t iterations = 1000;
+    const uint16_t config_ptr = 0xF000;
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+    {
+        // Build configs in a scratch area, image data at 0.
+        for (uint16_t i = 0; i < count; i++)
         {
-            const void *img = (void *)&xram[sprites[i].xram_sprite_ptr];
-            sprite_asprite16(rgb, &sprites[i], img, scanline, width);
+            uint8_t *cfg = &xram[config_ptr + i * formats[f].config_size];
+            memset(cfg, 0, formats[f].config_size);
+            int16_t *pos = (int16_t *)(formats[f].affine ? cfg + 12 : cfg);
+            if (formats[f].affine)
+            {
+                int16_t *transform = (int16_t *)cfg;
+                transform[0] = 0x100;
+                transform[4] = 0x100;
+            }
+            pos[0] = i * 32 + 64; // x
+            pos[1] = 0;           // y
+            cfg[formats[f].config_size - 2] = 5; // log_size
+            if (formats[f].bpp != 16)
+                cfg[formats[f].config_size - 1] = 0xFF; // transparent
         }
+        uint64_t start = time_us_64();
+        for (uint16_t n = 0; n < iterations; n++)
+            formats[f].fn(n & 31, 640, line, config_ptr, count);
+        uint32_t ns_per_sprite = (time_us_64() - start) * 1000 / ((uint32_t)iterations * count);
+        printf("%-12s %4lu ns/sprite, %2lu sprites/line\n", formats[f].name,
+               (unsigned long)ns_per_sprite, (unsigned long)(31780 / (ns_per_sprite ? ns_per_sprite : 1)));
     }
 }
+#endif
+
+#define MODE4_FORMAT(name, type) \
+    {mode4_render_##name, mode4_render_##name##_collide, mode4_render_##name##_budget, mode4_one_##name##_fn, sizeof(type)}
+
+static const struct
+{
+    void *render_fn;
+    void *collide_fn;
+    void *budget_fn;
+    mode4_one_fn one;
+    size_t size;
+} mode4_formats[] = {
+    MODE4_FORMAT(sprite, mode4_sprite_t),     // 0
+    MODE4_FORMAT(asprite, mode4_asprite_t),   // 1
+    MODE4_FORMAT(sprite8, mode4_isprite_t),   // 2
+    MODE4_FORMAT(asprite8, mode4_iasprite_t), // 3
+    MODE4_FORMAT(sprite4, mode4_isprite_t),   // 4
+    MODE4_FORMAT(asprite4, mode4_iasprite_t), // 5
+    MODE4_FORMAT(rsprite, mode4_rsprite_t),   // 6
+};
 
 bool mode4_prog(uint16_t *xregs)
 {
@@ -387,26 +1018,36 @@ bool mode4_prog(uint16_t *xregs)
     const int16_t plane = xregs[5];
     const int16_t scanline_begin = xregs[6];
     const int16_t scanline_end = xregs[7];
+    const uint16_t max_sprites = xregs[8];
+    const uint16_t max_pixels = xregs[9];
+    const uint16_t z_ptr = xregs[10];
 
     if (config_ptr & 1)
         return false;
 
-    void *render_fn;
-    switch (attributes)
+    const uint16_t format = attributes & ~(MODE4_ATTR_COLLIDE | MODE4_ATTR_BUDGET);
+    if (format >= sizeof(mode4_formats) / sizeof(mode4_formats[0]))
+        return false;
+    if (config_ptr > 0x10000 - mode4_formats[format].size * length)
+        return false;
+
+    void *render_fn = mode4_formats[format].render_fn;
+    if (attributes & MODE4_ATTR_COLLIDE)
+        render_fn = mode4_formats[format].collide_fn;
+    if (attributes & MODE4_ATTR_BUDGET)
     {
-    case 0:
-        render_fn = mode4_render_sprite;
-        if (config_ptr > 0x10000 - sizeof(mode4_sprite_t) * length)
-            return false;
-        break;
-    case 1:
-        render_fn = mode4_render_asprite;
-        if (config_ptr > 0x10000 - sizeof(mode4_asprite_t) * length)
+        if (plane < 0 || plane >= PICO_SCANVIDEO_PLANE_COUNT)
             return false;
-        break;
-    default:
-        return false;
-    };
+        // Unhook the plane while its budget changes.
+        mode4_budget[plane].one = NULL;
+        mode4_budget[plane].config_ptr = config_ptr;
+        mode4_budget[plane].z_ptr = z_ptr;
+        mode4_budget[plane].max_sprites = max_sprites;
+        mode4_budget[plane].max_pixels = max_pixels;
+        mode4_budget[plane].collide = attributes & MODE4_ATTR_COLLIDE;
+        mode4_budget[plane].one = mode4_formats[format].one;
+        render_fn = mode4_formats[format].budget_fn;
+    }
 
     return vga_prog_sprite(plane, scanline_begin, scanline_end, config_ptr, length, render_fn);
 }
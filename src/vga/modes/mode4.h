@@ -13,4 +13,22 @@
 
 bool mode4_prog(uint16_t *xregs);
 
+typedef struct
+{
+    uint16_t collide_sprites;
+    uint16_t collide_playfield;
+    uint16_t dropped_sprites;
+    uint16_t overflow_lines;
+} mode4_report_t;
+
+// Call once per frame, advances the sprite rotation.
+void mode4_frame(void);
+
+// False when no plane tracks collisions or budgets.
+bool mode4_frame_report(mode4_report_t *report);
+
+#ifdef MODE4_BENCHMARK
+void mode4_benchmark(void);
+#endif
+
 #endif /* _VGA_MODES_MODE4_H_ */
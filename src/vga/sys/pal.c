@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "sys/pal.h"
+#include "scanvideo/scanvideo.h"
+#include <pico/stdlib.h>
+#include <string.h>
+
+#define PAL_CYCLE_COUNT 4
+#define PAL_ENTRIES 256
+
+// Register layout for PIX channel 1.
+#define PAL_XREG_FADE 0
+#define PAL_XREG_FADE_COLOR 1
+#define PAL_XREG_TINT 2  // one per plane
+#define PAL_XREG_CYCLE 5 // range then rate, per cycle
+#define PAL_XREG_COUNT (PAL_XREG_CYCLE + 2 * PAL_CYCLE_COUNT)
+
+typedef struct
+{
+    uint8_t first;
+    uint8_t last;
+    int16_t rate; // frames per step, negative runs backwards
+} pal_cycle_t;
+
+static uint16_t pal_fade;
+static uint16_t pal_fade_color;
+static uint16_t pal_tint[PICO_SCANVIDEO_PLANE_COUNT];
+static pal_cycle_t pal_cycle[PAL_CYCLE_COUNT];
+static uint32_t pal_frame_no;
+
+// Set when any transform is active, checked on every lookup.
+static volatile bool pal_active;
+
+// Double buffered so a late scanline never sees a half built palette.
+static uint16_t pal_derived[PICO_SCANVIDEO_PLANE_COUNT][2][PAL_ENTRIES];
+static volatile uint8_t pal_front[PICO_SCANVIDEO_PLANE_COUNT];
+static volatile const uint16_t *volatile pal_src[PICO_SCANVIDEO_PLANE_COUNT];
+static volatile uint16_t pal_src_entries[PICO_SCANVIDEO_PLANE_COUNT];
+static volatile bool pal_ready[PICO_SCANVIDEO_PLANE_COUNT];
+static int16_t pal_plane[2];
+
+static void pal_update_active(void)
+{
+    bool active = pal_fade != 0;
+    for (int i = 0; i < PICO_SCANVIDEO_PLANE_COUNT; i++)
+        if (pal_tint[i])
+            active = true;
+    for (int i = 0; i < PAL_CYCLE_COUNT; i++)
+        if (pal_cycle[i].rate)
+            active = true;
+    pal_active = active;
+}
+
+static inline uint16_t pal_tint_pixel(uint16_t pixel, uint16_t tint)
+{
+    uint32_t r = PICO_SCANVIDEO_R5_FROM_PIXEL(pixel) * (PICO_SCANVIDEO_R5_FROM_PIXEL(tint) + 1) >> 5;
+    uint32_t g = PICO_SCANVIDEO_G5_FROM_PIXEL(pixel) * (PICO_SCANVIDEO_G5_FROM_PIXEL(tint) + 1) >> 5;
+    uint32_t b = PICO_SCANVIDEO_B5_FROM_PIXEL(pixel) * (PICO_SCANVIDEO_B5_FROM_PIXEL(tint) + 1) >> 5;
+    return (pixel & PICO_SCANVIDEO_ALPHA_MASK) | PICO_SCANVIDEO_PIXEL_FROM_RGB5(r, g, b);
+}
+
+static inline int32_t pal_mix(int32_t from, int32_t to, int32_t amount)
+{
+    return from + (((to - from) * amount) >> 8);
+}
+
+static inline uint16_t pal_fade_pixel(uint16_t pixel)
+{
+    uint32_t r = pal_mix(PICO_SCANVIDEO_R5_FROM_PIXEL(pixel), PICO_SCANVIDEO_R5_FROM_PIXEL(pal_fade_color), pal_fade);
+    uint32_t g = pal_mix(PICO_SCANVIDEO_G5_FROM_PIXEL(pixel), PICO_SCANVIDEO_G5_FROM_PIXEL(pal_fade_color), pal_fade);
+    uint32_t b = pal_mix(PICO_SCANVIDEO_B5_FROM_PIXEL(pixel), PICO_SCANVIDEO_B5_FROM_PIXEL(pal_fade_color), pal_fade);
+    return (pixel & PICO_SCANVIDEO_ALPHA_MASK) | PICO_SCANVIDEO_PIXEL_FROM_RGB5(r, g, b);
+}
+
+// Which source entry shows at index i after cycling.
+static uint16_t pal_cycle_index(uint16_t i, uint16_t entries)
+{
+    for (int c = 0; c < PAL_CYCLE_COUNT; c++)
+    {
+        const pal_cycle_t *cy = &pal_cycle[c];
+        if (!cy->rate || cy->last <= cy->first || cy->last >= entries ||
+            i < cy->first || i > cy->last)
+            continue;
+        uint32_t len = cy->last - cy->first + 1;
+        uint32_t rate = cy->rate < 0 ? -cy->rate : cy->rate;
+        uint32_t phase = (pal_frame_no / rate) % len;
+        if (cy->rate < 0)
+            phase = len - phase;
+        return cy->first + (i - cy->first + phase) % len;
+    }
+    return i;
+}
+
+void pal_reset(void)
+{
+    pal_fade = 0;
+    pal_fade_color = 0;
+    memset(pal_tint, 0, sizeof(pal_tint));
+    memset(pal_cycle, 0, sizeof(pal_cycle));
+    pal_active = false;
+    for (int i = 0; i < PICO_SCANVIDEO_PLANE_COUNT; i++)
+    {
+        pal_src[i] = NULL;
+        pal_ready[i] = false;
+    }
+}
+
+void pal_frame(void)
+{
+    pal_frame_no++;
+    if (!pal_active)
+        return;
+    for (int p = 0; p < PICO_SCANVIDEO_PLANE_COUNT; p++)
+    {
+        volatile const uint16_t *src = pal_src[p];
+        uint16_t entries = pal_src_entries[p];
+        if (!src)
+            continue;
+        uint16_t *dst = pal_derived[p][!pal_front[p]];
+        for (uint16_t i = 0; i < entries; i++)
+        {
+            uint16_t pixel = src[pal_cycle_index(i, entries)];
+            if (pal_tint[p])
+                pixel = pal_tint_pixel(pixel, pal_tint[p]);
+            if (pal_fade)
+                pixel = pal_fade_pixel(pixel);
+            dst[i] = pixel;
+        }
+        pal_front[p] = !pal_front[p];
+        pal_ready[p] = true;
+    }
+}
+
+bool pal_xreg(uint8_t addr, uint16_t word)
+{
+    if (addr >= PAL_XREG_COUNT)
+        return false;
+    if (addr == PAL_XREG_FADE)
+        pal_fade = word > 256 ? 256 : word;
+    else if (addr == PAL_XREG_FADE_COLOR)
+        pal_fade_color = word;
+    else if (addr < PAL_XREG_CYCLE)
+        pal_tint[addr - PAL_XREG_TINT] = word;
+    else
+    {
+        pal_cycle_t *cy = &pal_cycle[(addr - PAL_XREG_CYCLE) / 2];
+        if ((addr - PAL_XREG_CYCLE) & 1)
+            cy->rate = word;
+        else
+        {
+            cy->first = word & 0xFF;
+            cy->last = word >> 8;
+        }
+    }
+    pal_update_active();
+    return false;
+}
+
+void pal_set_plane(int16_t plane)
+{
+    pal_plane[get_core_num()] = plane;
+}
+
+// A plane transforms the last palette it asked for. A new
+// palette shows untransformed until the next frame builds it.
+volatile const uint16_t *pal_lookup(volatile const uint16_t *src, uint16_t entries)
+{
+    if (!pal_active)
+        return src;
+    int16_t plane = pal_plane[get_core_num()];
+    if (plane < 0 || plane >= PICO_SCANVIDEO_PLANE_COUNT)
+        return src;
+    if (entries > PAL_ENTRIES)
+        entries = PAL_ENTRIES;
+    if (pal_src[plane] != src || pal_src_entries[plane] < entries)
+    {
+        pal_ready[plane] = false;
+        pal_src_entries[plane] = entries;
+        pal_src[plane] = src;
+        return src;
+    }
+    if (!pal_ready[plane])
+        return src;
+    return pal_derived[plane][pal_front[plane]];
+}
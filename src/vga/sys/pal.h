@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 Rumbledethumps
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _VGA_SYS_PAL_H_
+#define _VGA_SYS_PAL_H_
+
+/* Palette transforms. Fades, colour cycling and plane tints are
+ * applied once per frame to a derived copy of each plane's palette.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Main events
+ */
+
+void pal_reset(void);
+void pal_frame(void);
+
+/* Utility
+ */
+
+// PIX channel 1 registers.
+bool pal_xreg(uint8_t addr, uint16_t word);
+
+// The scanline renderer announces which plane is drawing.
+void pal_set_plane(int16_t plane);
+
+// Returns the derived palette for the current plane, or src
+// when no transform is active.
+volatile const uint16_t *pal_lookup(volatile const uint16_t *src, uint16_t entries);
+
+#endif /* _VGA_SYS_PAL_H_ */
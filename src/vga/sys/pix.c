@@ -7,6 +7,7 @@
 #include "main.h"
 #include "vga.pio.h"
 #include "sys/mem.h"
+#include "sys/pal.h"
 #include "sys/pix.h"
 #include "sys/ria.h"
 #include "sys/vga.h"
@@ -15,7 +16,7 @@
 #include <hardware/dma.h>
 #include <string.h>
 
-#define PIX_CH0_XREGS_MAX 8
+#define PIX_CH0_XREGS_MAX 11
 static uint16_t xregs[PIX_CH0_XREGS_MAX];
 
 static bool pix_ch0_xreg(uint8_t addr, uint16_t word)
@@ -52,6 +53,7 @@ static bool pix_ch15_xreg(uint8_t addr, uint16_t word)
         // Also performs a reset.
         vga_xreg_canvas(NULL);
         vga_set_display(word);
+        font_reset();
         memset(&xregs, 0, sizeof(xregs));
         return true;
     case 0x01: // CODE_PAGE
@@ -186,6 +188,10 @@ void pix_task(void)
         // allow us to stay greedy on fast ones.
         if (ch == 0 && pix_ch0_xreg(addr, word))
             break;
+        if (ch == 1 && pal_xreg(addr, word))
+            break;
+        if (ch == 2 && font_xreg(addr, word))
+            break;
         if (ch == 15 && pix_ch15_xreg(addr, word))
             break;
     }
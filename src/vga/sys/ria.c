@@ -10,10 +10,72 @@
 #include "sys/sys.h"
 #include <pico/stdlib.h>
 #include <hardware/clocks.h>
+#include <hardware/sync.h>
 #include <string.h>
 #include <stdio.h>
 
 static const char *version_pos;
+static uint32_t ria_backchan_baudrate = RIA_BACKCHAN_BAUDRATE;
+
+// Frames are a 0xC0|type start then 7-bit data. Each group of up
+// to seven bytes follows a byte holding their top bits. The data is
+// a 16-bit length, the payload and a CRC-16/CCITT of type, length
+// and payload. Vsync, ack and nak may land anywhere in a frame.
+// Frames trickle out so the FIFO always has room for vsync.
+#define RIA_FRAME_FIFO_MAX 4
+#define RIA_FRAME_BUF_SIZE 512
+static uint8_t ria_frame_buf[RIA_FRAME_BUF_SIZE];
+static volatile uint16_t ria_frame_head;
+static volatile uint16_t ria_frame_tail;
+
+typedef struct
+{
+    uint16_t pos;
+    uint16_t msb_pos;
+    uint8_t group;
+    uint16_t crc;
+} ria_frame_enc_t;
+
+static uint16_t ria_crc16(uint16_t crc, uint8_t byte)
+{
+    crc ^= byte << 8;
+    for (int i = 0; i < 8; i++)
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    return crc;
+}
+
+static void ria_frame_put(ria_frame_enc_t *enc, uint8_t byte)
+{
+    ria_frame_buf[enc->pos] = byte;
+    enc->pos = (enc->pos + 1) % RIA_FRAME_BUF_SIZE;
+}
+
+static void ria_frame_pack(ria_frame_enc_t *enc, uint8_t byte)
+{
+    if (!enc->group)
+    {
+        enc->msb_pos = enc->pos;
+        ria_frame_put(enc, 0);
+    }
+    if (byte & 0x80)
+        ria_frame_buf[enc->msb_pos] |= 1u << enc->group;
+    ria_frame_put(enc, byte & 0x7F);
+    if (++enc->group == 7)
+        enc->group = 0;
+}
+
+static void ria_frame_pack_crc(ria_frame_enc_t *enc, uint8_t byte)
+{
+    enc->crc = ria_crc16(enc->crc, byte);
+    ria_frame_pack(enc, byte);
+}
+
+static void ria_set_baudrate(uint32_t baudrate)
+{
+    ria_backchan_baudrate = baudrate;
+    float div = (float)clock_get_hz(clk_sys) / (8 * baudrate);
+    pio_sm_set_clkdiv(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, div);
+}
 
 void ria_init(void)
 {
@@ -26,7 +88,7 @@ void ria_init(void)
     sm_config_set_out_pins(&c, RIA_BACKCHAN_PIN, 1);
     sm_config_set_sideset_pins(&c, RIA_BACKCHAN_PIN);
     sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
-    float div = (float)clock_get_hz(clk_sys) / (8 * RIA_BACKCHAN_BAUDRATE);
+    float div = (float)clock_get_hz(clk_sys) / (8 * ria_backchan_baudrate);
     sm_config_set_clkdiv(&c, div);
     pio_sm_init(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, offset, &c);
     pio_sm_set_enabled(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, true);
@@ -34,15 +96,27 @@ void ria_init(void)
 
 void ria_task(void)
 {
-    if (version_pos && pio_sm_is_tx_fifo_empty(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM))
+    if (version_pos)
     {
-        char ch = *version_pos++;
-        if (!ch)
+        if (pio_sm_is_tx_fifo_empty(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM))
         {
-            ch = '\r';
-            version_pos = NULL;
+            char ch = *version_pos++;
+            if (!ch)
+            {
+                ch = '\r';
+                version_pos = NULL;
+            }
+            pio_sm_put(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, ch);
         }
-        pio_sm_put(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, ch);
+        return;
+    }
+    uint16_t head = ria_frame_head;
+    __dmb();
+    while (ria_frame_tail != head &&
+           pio_sm_get_tx_fifo_level(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM) < RIA_FRAME_FIFO_MAX)
+    {
+        pio_sm_put(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, ria_frame_buf[ria_frame_tail]);
+        ria_frame_tail = (ria_frame_tail + 1) % RIA_FRAME_BUF_SIZE;
     }
 }
 
@@ -52,14 +126,12 @@ void ria_pre_reclock(void)
     while (pio_sm_get_tx_fifo_level(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM))
         tight_loop_contents();
     // Wait for shift register too
-    float clock = (float)clock_get_hz(clk_sys);
-    busy_wait_us_32(clock / RIA_BACKCHAN_BAUDRATE / clock * 10 * 1000000);
+    busy_wait_us_32(10 * 1000000 / ria_backchan_baudrate + 1);
 }
 
 void ria_post_reclock(void)
 {
-    float div = (float)clock_get_hz(clk_sys) / (8 * RIA_BACKCHAN_BAUDRATE);
-    pio_sm_set_clkdiv_int_frac(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, div, 0);
+    ria_set_baudrate(ria_backchan_baudrate);
 }
 
 void ria_backchan(uint16_t word)
@@ -68,14 +140,21 @@ void ria_backchan(uint16_t word)
     {
     case 0: // disable
         gpio_set_function(RIA_BACKCHAN_PIN, GPIO_FUNC_UART);
+        ria_set_baudrate(RIA_BACKCHAN_BAUDRATE);
         break;
     case 1: // enable
+        ria_set_baudrate(RIA_BACKCHAN_BAUDRATE);
         pio_gpio_init(RIA_BACKCHAN_PIO, RIA_BACKCHAN_PIN);
         version_pos = sys_version();
         break;
     case 2: // request
         uart_write_blocking(COM_UART_INTERFACE, (uint8_t *)"VGA1", 4);
         break;
+    case 3: // enable fast, older RIA firmware never asks
+        ria_set_baudrate(RIA_BACKCHAN_FAST_BAUDRATE);
+        pio_gpio_init(RIA_BACKCHAN_PIO, RIA_BACKCHAN_PIN);
+        version_pos = sys_version();
+        break;
     }
 }
 
@@ -85,6 +164,37 @@ void ria_vsync(void)
     pio_sm_put(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, (++frame_no & 0xF) | 0x80);
 }
 
+bool ria_frame_idle(void)
+{
+    return ria_frame_head == ria_frame_tail;
+}
+
+// Queued whole or not at all, sent from ria_task as FIFO space allows.
+// Only one context may queue frames.
+bool ria_frame(uint8_t type, const void *data, size_t size)
+{
+    if (type > 0xF || size > RIA_FRAME_MAX_PAYLOAD)
+        return false;
+    size_t packed = size + 4;
+    size_t need = 1 + packed + (packed + 6) / 7;
+    size_t space = (ria_frame_tail - ria_frame_head - 1u + RIA_FRAME_BUF_SIZE) % RIA_FRAME_BUF_SIZE;
+    if (need > space)
+        return false;
+    ria_frame_enc_t enc = {ria_frame_head, 0, 0, 0xFFFF};
+    ria_frame_put(&enc, 0xC0 | type);
+    enc.crc = ria_crc16(enc.crc, type);
+    ria_frame_pack_crc(&enc, size & 0xFF);
+    ria_frame_pack_crc(&enc, size >> 8);
+    for (size_t i = 0; i < size; i++)
+        ria_frame_pack_crc(&enc, ((const uint8_t *)data)[i]);
+    uint16_t crc = enc.crc;
+    ria_frame_pack(&enc, crc & 0xFF);
+    ria_frame_pack(&enc, crc >> 8);
+    __dmb();
+    ria_frame_head = enc.pos;
+    return true;
+}
+
 void ria_ack(void)
 {
     pio_sm_put(RIA_BACKCHAN_PIO, RIA_BACKCHAN_SM, 0x90);
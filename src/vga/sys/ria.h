@@ -20,9 +20,14 @@
 // reconfigure that pin for a return channel.
 #define RIA_BACKCHAN_PIN COM_UART_RX_PIN
 #define RIA_BACKCHAN_BAUDRATE 115200
+#define RIA_BACKCHAN_FAST_BAUDRATE 921600
 #define RIA_BACKCHAN_PIO pio1
 #define RIA_BACKCHAN_SM 3
 
+// Framed messages to the RIA, see BACKCHANNEL.md.
+#define RIA_FRAME_MAX_PAYLOAD 256
+#define RIA_FRAME_SPRITE_REPORT 0
+
 /* Main events
  */
 
@@ -36,6 +41,8 @@ void ria_post_reclock(void);
 
 void ria_backchan(uint16_t word);
 void ria_vsync(void);
+bool ria_frame_idle(void);
+bool ria_frame(uint8_t type, const void *data, size_t size);
 void ria_ack(void);
 void ria_nak(void);
 
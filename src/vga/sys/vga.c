@@ -5,9 +5,12 @@
  */
 
 #include "main.h"
+#include "modes/mode1.h"
+#include "modes/mode4.h"
 #include "sys/ria.h"
 #include "sys/vga.h"
 #include "sys/mem.h"
+#include "sys/pal.h"
 #include "term/term.h"
 #include "scanvideo/scanvideo.h"
 #include "scanvideo/composable_scanline.h"
@@ -311,6 +314,12 @@ static void vga_render_scanline(void)
     {
         if (vga_scanline_num >= vga_scanvideo_mode_current->height)
         {
+            mode4_report_t report;
+            mode4_frame();
+            if (ria_frame_idle() && mode4_frame_report(&report))
+                ria_frame(RIA_FRAME_SPRITE_REPORT, &report, sizeof(report));
+            pal_frame();
+            mode1_frame();
             ria_vsync();                 // send to RIA
             mutex_exit(&vga_mode_mutex); // ok to mode switch
             vga_scanline_num = -1;       // do once
@@ -341,6 +350,7 @@ static void vga_render_scanline(void)
     vga_prog_t prog = vga_prog[scanline_id];
     for (int8_t i = 0; i < 3; i++)
     {
+        pal_set_plane(i);
         if (prog.fill_fn[i])
         {
             filled[i] = prog.fill_fn[i](scanline_id,
@@ -481,6 +491,7 @@ bool vga_xreg_canvas(uint16_t *xregs)
         return false;
     }
     memset(&vga_prog, 0, sizeof(vga_prog));
+    pal_reset();
     if (canvas == vga_console)
         vga_reset_console_prog();
     return true;
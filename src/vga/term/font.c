@@ -6,14 +6,18 @@
 
 #include "term/font.h"
 #include "term/term.h"
+#include "sys/mem.h"
 #include <pico/stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 // 8x8 and 8x16 fonts based on the IBM VGA typeface.
 // ASCII glyphs 0-127 are common to all code pages.
-// Code Page 437-999 data is only glyphs 128-255.
+// Code Page 437-999 data is only glyphs 128-255, kept as indices
+// into tables of unique glyphs. Single code page builds only carry
+// the glyphs of that page. See font_pack.py in the repo root.
 // Setting a code page builds the complete font in RAM.
+// A user font loaded from XRAM replaces the whole font until reset.
 
 uint8_t __not_in_flash("font") font8[2048] = {};
 uint8_t __not_in_flash("font") font16[4096] = {};
@@ -216,3316 +220,6799 @@ static const __in_flash("font") uint8_t FONT16_ASCII[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-static const __in_flash("font") uint8_t FONT8_CP437[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0xc6, 0x30, 0x30, 0x00, 0x7c, 0xc6, 0x30, 0x66, 0x7c, 0x30, 0xc6, 0x38,
-    0x18, 0x00, 0x3e, 0x7c, 0xc6, 0x30, 0x78, 0x60, 0xc6, 0xc6, 0xc6, 0x18, 0x38, 0x66, 0xf8, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x3c, 0x38, 0x18, 0x00, 0x00, 0x63, 0x63, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x0e, 0x00, 0x06, 0x1e, 0x00,
-    0x00, 0x18, 0x30, 0x0c, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0x00, 0x18, 0x30, 0x00, 0x82, 0x00, 0x18, 0x00, 0x82, 0x18, 0x38, 0x6c,
-    0x30, 0x00, 0x6c, 0x82, 0x00, 0x18, 0x84, 0x30, 0x00, 0x38, 0x00, 0x18, 0x6c, 0x66, 0xcc, 0x1b,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x76, 0x18, 0x6c, 0x6c, 0x18, 0x00, 0x0c, 0x30, 0x7c,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7e, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x00, 0x6c, 0x7c,
-    0xfe, 0x7e, 0xcc, 0x7c, 0x7c, 0x7c, 0x00, 0xcc, 0xc6, 0x6c, 0xc6, 0x7e, 0x64, 0x3c, 0xcc, 0x18,
-    0x78, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x60, 0x7e, 0x66, 0xdc, 0x3c, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc0, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x38, 0xc6, 0xc6,
-    0xc0, 0x18, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0xf0, 0x7e, 0xfa, 0x3c,
-    0x0c, 0x38, 0xc6, 0xcc, 0xdc, 0xe6, 0x3e, 0x38, 0x18, 0xfe, 0xfe, 0x7e, 0x7a, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7e, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x0c, 0x36, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0xf8, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0x18, 0xc6, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0x00, 0x00, 0x30, 0xc0, 0x06, 0x33, 0x36, 0x3c, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xcc, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0xec, 0x36, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0xc0, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x7e, 0x6c, 0xc6, 0x7e, 0x66, 0x7e, 0xcf, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x63, 0xc0, 0x06, 0x66, 0x6a, 0x3c, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x3c, 0x6c, 0x6c, 0x66, 0x7e, 0x7e, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x0c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x7e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x06, 0x38, 0x7c, 0x18, 0xfc, 0x18, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xce, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xcc, 0xdf, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x18, 0x38, 0xee, 0x3c, 0x00, 0x60, 0x1e, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x18, 0x00, 0x18, 0xc7, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP437[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0x38, 0x00, 0x10, 0x00, 0x60, 0x00, 0x18, 0x60, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x10, 0x00, 0x60, 0x30, 0x60, 0x00, 0xc6, 0xc6, 0x18, 0x38, 0x00, 0xf8, 0x0e,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0x30, 0x6c, 0x00, 0x38, 0xc6, 0x30, 0x66, 0x3c, 0x30, 0x00, 0x38,
-    0x00, 0x00, 0x3e, 0x38, 0xc6, 0x30, 0x78, 0x30, 0xc6, 0x00, 0x00, 0x18, 0x6c, 0x66, 0xcc, 0x1b,
-    0x30, 0x18, 0x30, 0x30, 0x76, 0x00, 0x3c, 0x38, 0x30, 0x00, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x18, 0x38, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x66, 0x18, 0x10, 0x10,
-    0xfe, 0x00, 0x6c, 0x6c, 0x00, 0x18, 0xcc, 0x18, 0x00, 0x7c, 0xc6, 0x7c, 0x64, 0x66, 0xcc, 0x18,
-    0x60, 0x30, 0x60, 0x60, 0xdc, 0xc6, 0x6c, 0x6c, 0x30, 0x00, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0x7c,
-    0x00, 0x00, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x66, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x60, 0x3c, 0xf8, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x76, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x6c, 0x6c,
-    0x62, 0xec, 0xcc, 0x7c, 0x7c, 0x7c, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0xf0, 0x18, 0xc4, 0x18,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xf6, 0x3e, 0x38, 0x30, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0xdc, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x18, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x68, 0x36, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0x7e, 0xcc, 0x7e,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xfe, 0x00, 0x00, 0x30, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0x00, 0x7e, 0x06, 0x60, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xc6, 0xfe,
-    0x78, 0x36, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0x18, 0xde, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x60, 0xc0, 0x06, 0x30, 0x30, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0xfe, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x18, 0x18, 0xec, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xfe, 0xc6,
-    0x68, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x60, 0x7e, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x00, 0x00, 0xc0, 0xc0, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x7c, 0x60, 0x18, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc0, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x18, 0xe6, 0x18, 0xcc, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc0, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x7e, 0x7c, 0x7c, 0x18, 0xfc, 0x18, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+// Generated by font_pack.py, do not edit.
 
-static const __in_flash("font") uint8_t FONT8_CP737[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0xfc, 0xfe, 0x10, 0xfe, 0xfe, 0xc6, 0x7c, 0x3c, 0xe6, 0x10, 0xc6, 0xc6, 0xfe, 0x7c, 0xfe,
-    0xfc, 0xfe, 0x7e, 0x66, 0x10, 0xc6, 0xd6, 0x38, 0x00, 0x7c, 0xc6, 0x3c, 0x00, 0xfe, 0x00, 0x78,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x10, 0x10, 0x10, 0x66, 0x10, 0x10, 0x10, 0x66, 0x10, 0xb8, 0xbe, 0xb6, 0xbc, 0xbc, 0xb6,
-    0xb8, 0x18, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x6c, 0x78, 0x00, 0x00,
-    0x6c, 0x66, 0x62, 0x38, 0x62, 0xc6, 0xc6, 0xc6, 0x18, 0x66, 0x38, 0xee, 0xe6, 0x82, 0xc6, 0xc6,
-    0x66, 0xc6, 0x7e, 0x66, 0x7c, 0xc6, 0xd6, 0x6c, 0x00, 0xc6, 0x6c, 0x60, 0x00, 0x38, 0x00, 0xcc,
-    0x00, 0x00, 0xcc, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x30, 0x36, 0x18, 0x66, 0x36,
-    0x6c, 0x18, 0x18, 0x18, 0x3c, 0x66, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x3c, 0x00,
-    0xc6, 0x66, 0x60, 0x38, 0x68, 0x8c, 0xc6, 0xc6, 0x18, 0x6c, 0x38, 0xfe, 0xf6, 0x00, 0xc6, 0xc6,
-    0x66, 0x60, 0x5a, 0x66, 0xd6, 0x6c, 0xd6, 0xc6, 0x76, 0xfc, 0x38, 0x38, 0x7c, 0x60, 0xdc, 0x7e,
-    0x30, 0xc6, 0x0c, 0xcc, 0xe6, 0x38, 0x7c, 0xfe, 0x7c, 0x7e, 0x7e, 0xfe, 0xe6, 0x5c, 0xc6, 0xd6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x44, 0x76, 0x7c, 0xdc, 0x18, 0x30, 0x7c, 0xe6, 0xe6, 0x44, 0xc6, 0x30, 0x36, 0x18, 0x66, 0x36,
-    0xc6, 0x7e, 0x0c, 0x30, 0x18, 0x66, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0xfe, 0x7c, 0x60, 0x6c, 0x78, 0x18, 0xfe, 0xfe, 0x18, 0x78, 0x6c, 0xfe, 0xde, 0x38, 0xc6, 0xc6,
-    0x7c, 0x30, 0x18, 0x3c, 0xd6, 0x38, 0xd6, 0xc6, 0xdc, 0xc6, 0x6c, 0x7c, 0xc6, 0xc0, 0x66, 0x0c,
-    0x30, 0xcc, 0x3c, 0xcc, 0x66, 0xe0, 0xc6, 0x6c, 0xc6, 0xd8, 0xc0, 0x30, 0x66, 0xd6, 0x6c, 0xd6,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd6, 0xdc, 0xc6, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xd6, 0xfe, 0x3c, 0x3e, 0x18, 0x66, 0x1c,
-    0xc6, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x7e, 0x00, 0x38, 0x18, 0x18, 0xec, 0x36, 0x30, 0x3c, 0x00,
-    0xc6, 0x66, 0x60, 0x6c, 0x68, 0x32, 0xc6, 0xc6, 0x18, 0x6c, 0x6c, 0xd6, 0xce, 0x00, 0xc6, 0xc6,
-    0x60, 0x60, 0x18, 0x18, 0xd6, 0x6c, 0x7c, 0x6c, 0xd8, 0xfc, 0xc6, 0xc6, 0x70, 0x7c, 0x66, 0xcc,
-    0x30, 0xf8, 0x6c, 0xcc, 0x66, 0x7c, 0xc6, 0x6c, 0xfc, 0xd8, 0x7c, 0x30, 0x66, 0xd6, 0x38, 0xd6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd6, 0xd8, 0x70, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xd6, 0xc6, 0x30, 0x36, 0x18, 0x66, 0x08,
-    0x6c, 0x18, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x7c, 0x3c, 0x00,
-    0xc6, 0x66, 0x60, 0xc6, 0x62, 0x66, 0xc6, 0xc6, 0x18, 0x66, 0xc6, 0xc6, 0xc6, 0x82, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0x18, 0x7c, 0xc6, 0x10, 0x28, 0xdc, 0xc0, 0xc6, 0xc6, 0xc6, 0x06, 0x66, 0xcc,
-    0x30, 0xcc, 0xc6, 0xf6, 0x6c, 0x06, 0xc6, 0x6c, 0xc0, 0xd8, 0x06, 0x36, 0x66, 0x7c, 0x6c, 0x7c,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xfe, 0xdc, 0xc6, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xfe, 0xc6, 0x30, 0x36, 0x18, 0x66, 0x08,
-    0x28, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0xc6, 0xfc, 0xf0, 0xfe, 0xfe, 0xfe, 0xc6, 0x7c, 0x3c, 0xe6, 0xc6, 0xc6, 0xc6, 0xfe, 0x7c, 0xc6,
-    0xf0, 0xfe, 0x3c, 0x3c, 0x10, 0xc6, 0x38, 0xee, 0x76, 0x80, 0x7c, 0x7c, 0x7c, 0x1c, 0x06, 0x78,
-    0x1c, 0xc6, 0xc6, 0xc0, 0x38, 0x1c, 0x7c, 0x6c, 0xc0, 0x70, 0x1c, 0x1c, 0x3c, 0x10, 0xc6, 0x10,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x6c, 0x76, 0x7c, 0x06, 0x0e, 0x1c, 0x7c, 0x3c, 0x3c, 0x6c, 0xc6, 0x3e, 0x36, 0x3c, 0x3c, 0x1c,
-    0xee, 0x7e, 0x7e, 0x7e, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP737[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0xfc, 0xfe, 0x10, 0xfe, 0xfe, 0xc6, 0x7c, 0x3c, 0xe6, 0x10, 0xc6, 0xc6, 0xfe, 0x7c, 0xfe,
-    0xfc, 0xfe, 0x7e, 0x66, 0x38, 0xc6, 0xd6, 0x38, 0x00, 0x78, 0x00, 0x3c, 0x00, 0xfe, 0x00, 0x3c,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x04, 0x00, 0x08, 0x10, 0x7e, 0x66, 0x3c, 0x7c, 0x66,
-    0x38, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x6c, 0x3c, 0x00, 0x00,
-    0x38, 0x66, 0x62, 0x10, 0x66, 0xc6, 0xc6, 0xc6, 0x18, 0x66, 0x10, 0xee, 0xc6, 0xfe, 0xc6, 0xc6,
-    0x66, 0xc6, 0x7e, 0x66, 0x10, 0xc6, 0xd6, 0x6c, 0x00, 0xcc, 0x00, 0x66, 0x00, 0x0c, 0x00, 0x66,
-    0x00, 0x00, 0xcc, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x10, 0x10, 0x10, 0x66, 0x10, 0x10, 0x08, 0x66, 0x10, 0x38, 0x60, 0x66, 0x18, 0xc6, 0x66,
-    0x6c, 0x18, 0x30, 0x0c, 0x18, 0x66, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x6c, 0x66, 0x60, 0x38, 0x62, 0x86, 0xc6, 0xc6, 0x18, 0x66, 0x38, 0xfe, 0xe6, 0x82, 0xc6, 0xc6,
-    0x66, 0x62, 0x5a, 0x66, 0x7c, 0x6c, 0xd6, 0xc6, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x18, 0x00, 0x66,
-    0x00, 0x00, 0x0c, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x60, 0x66, 0x18, 0xc6, 0x66,
-    0xc6, 0x18, 0x18, 0x18, 0x18, 0x66, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x7e, 0x00,
-    0xc6, 0x66, 0x60, 0x38, 0x68, 0x0c, 0xc6, 0xc6, 0x18, 0x6c, 0x38, 0xfe, 0xf6, 0x00, 0xc6, 0xc6,
-    0x66, 0x30, 0x18, 0x66, 0xd6, 0x7c, 0xd6, 0xc6, 0x76, 0xcc, 0xc6, 0x18, 0x7c, 0x30, 0xdc, 0x3e,
-    0x30, 0xc6, 0x0c, 0xcc, 0xe6, 0x60, 0x7c, 0xfe, 0x7c, 0x7e, 0x3c, 0xfe, 0xe6, 0x5c, 0xc6, 0xd6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x44, 0x76, 0x7c, 0xdc, 0x18, 0x30, 0x7c, 0xe6, 0xe6, 0x44, 0xc6, 0x60, 0x66, 0x18, 0xc6, 0x66,
-    0xc6, 0x7e, 0x0c, 0x30, 0x18, 0x66, 0x00, 0xdc, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc6, 0x7c, 0x60, 0x6c, 0x78, 0x18, 0xfe, 0xfe, 0x18, 0x78, 0x6c, 0xd6, 0xfe, 0x7c, 0xc6, 0xc6,
-    0x7c, 0x18, 0x18, 0x3c, 0xd6, 0x38, 0xd6, 0xc6, 0xdc, 0xd8, 0x6c, 0x7c, 0xc6, 0x60, 0x66, 0x06,
-    0x30, 0xcc, 0x0c, 0xcc, 0x66, 0x3c, 0xc6, 0x6c, 0xc6, 0xd8, 0x66, 0x30, 0x66, 0xd6, 0x6c, 0xd6,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xdc, 0xc6, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xc6, 0xc6, 0x78, 0x7e, 0x18, 0xc6, 0x3c,
-    0xc6, 0x18, 0x06, 0x60, 0x18, 0x3c, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xfe, 0x66, 0x60, 0x6c, 0x68, 0x30, 0xc6, 0xc6, 0x18, 0x78, 0x6c, 0xc6, 0xde, 0x7c, 0xc6, 0xc6,
-    0x60, 0x18, 0x18, 0x18, 0xd6, 0x38, 0xd6, 0xc6, 0xd8, 0xfc, 0x38, 0xc6, 0xc0, 0xc0, 0x66, 0xc6,
-    0x30, 0xf8, 0x3c, 0xcc, 0x66, 0x60, 0xc6, 0x6c, 0xc6, 0xd8, 0xc0, 0x30, 0x66, 0xd6, 0x38, 0xd6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd6, 0xd8, 0xc0, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xd6, 0xfe, 0x60, 0x66, 0x18, 0xc6, 0x18,
-    0xc6, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x18, 0xec, 0x36, 0x7e, 0x7e, 0x00,
-    0xc6, 0x66, 0x60, 0xc6, 0x60, 0x60, 0xc6, 0xc6, 0x18, 0x6c, 0xc6, 0xc6, 0xce, 0x00, 0xc6, 0xc6,
-    0x60, 0x30, 0x18, 0x18, 0xd6, 0x7c, 0x7c, 0xc6, 0xd8, 0xc6, 0x38, 0xc6, 0x78, 0xc0, 0x66, 0x66,
-    0x30, 0xf8, 0x6c, 0xcc, 0x66, 0xc0, 0xc6, 0x6c, 0xc6, 0xd8, 0xc0, 0x30, 0x66, 0xd6, 0x38, 0xd6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd6, 0xd8, 0x78, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xd6, 0xc6, 0x60, 0x66, 0x18, 0xc6, 0x18,
-    0xc6, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0xdc, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc6, 0x66, 0x60, 0xc6, 0x62, 0xc2, 0xc6, 0xc6, 0x18, 0x66, 0xc6, 0xc6, 0xc6, 0x82, 0xc6, 0xc6,
-    0x60, 0x62, 0x18, 0x18, 0x7c, 0x6c, 0x10, 0x6c, 0xd8, 0xc6, 0x6c, 0xc6, 0xc0, 0xc0, 0x66, 0x66,
-    0x30, 0xcc, 0xcc, 0xcc, 0x6c, 0xc0, 0xc6, 0x6c, 0xc6, 0xd8, 0xc0, 0x30, 0x66, 0xd6, 0x38, 0xd6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd6, 0xd8, 0xc0, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xd6, 0xc6, 0x60, 0x66, 0x18, 0xc6, 0x18,
-    0x6c, 0x00, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc6, 0x66, 0x60, 0xc6, 0x66, 0xc6, 0xc6, 0xc6, 0x18, 0x66, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0x18, 0x10, 0xc6, 0x10, 0x28, 0xdc, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0x66, 0x66,
-    0x30, 0xc6, 0xc6, 0xcc, 0x78, 0xc0, 0xc6, 0x6c, 0xc6, 0xd8, 0x60, 0x36, 0x66, 0xd6, 0x6c, 0xd6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xfe, 0xdc, 0xc6, 0x66, 0x18, 0x30, 0xc6, 0x66, 0x66, 0xfe, 0xc6, 0x60, 0x66, 0x18, 0xc6, 0x18,
-    0x28, 0x7e, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0xc6, 0xfc, 0xf0, 0xfe, 0xfe, 0xfe, 0xc6, 0x7c, 0x3c, 0xe6, 0xc6, 0xc6, 0xc6, 0xfe, 0x7c, 0xc6,
-    0xf0, 0xfe, 0x3c, 0x3c, 0x38, 0xc6, 0x38, 0xee, 0x76, 0xfc, 0xc6, 0x7c, 0x7c, 0x7c, 0x66, 0x3c,
-    0x1c, 0xc6, 0xc6, 0xf6, 0x30, 0x7c, 0x7c, 0x6c, 0xfc, 0x70, 0x3c, 0x1c, 0x3c, 0x7c, 0xc6, 0x7c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x6c, 0x76, 0x7c, 0x66, 0x0e, 0x1c, 0x7c, 0x3c, 0x3c, 0x6c, 0xc6, 0x7e, 0x66, 0x3c, 0x7c, 0x3c,
-    0xee, 0x00, 0x7e, 0x7e, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc6, 0x00, 0x00, 0x06, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0x00, 0x00, 0xc0, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x10,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7c, 0x00, 0x00, 0x3c, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0x10, 0x00, 0x10,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+#if RP6502_CODE_PAGE == 0
 
-static const __in_flash("font") uint8_t FONT8_CP771[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x38, 0x00, 0x36, 0x6c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfe, 0x00, 0x18, 0x18, 0x3c, 0x18, 0x6c, 0x36, 0xc6, 0x00, 0xfe, 0x00, 0x6c, 0x36, 0x00, 0x00,
-    0x3e, 0xfe, 0xfc, 0xfe, 0x1c, 0xfe, 0xd6, 0x7c, 0xc6, 0x7c, 0xe6, 0x1e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0xfc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0xf0, 0x7c, 0xcc, 0x7e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x6c, 0x78, 0x1c, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xc0, 0x7c, 0x18, 0x18, 0x18, 0x00, 0x38, 0x1c, 0xc6, 0xcc, 0x00, 0xfc, 0x38, 0x1c, 0x00, 0x00,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x62, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0x60, 0xc6, 0xd6, 0xcc,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0xc6, 0x0c, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xf8, 0xc6, 0xfe, 0x00, 0x18, 0x38, 0x7e, 0x00, 0xc6, 0xcc, 0xc6, 0x00, 0xfe, 0x00, 0x3c, 0x00,
-    0xc6, 0x60, 0x66, 0x60, 0x6c, 0x68, 0x7c, 0x0c, 0xce, 0xce, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x6c, 0xcc, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xd6, 0xcc,
-    0x78, 0xc0, 0xfc, 0xfe, 0x3c, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0x3e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0xfe, 0x7c, 0x66, 0x7c,
-    0xfc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0xf0, 0xfc, 0xcc, 0x7e,
-    0xc0, 0xfe, 0xc0, 0x7c, 0x18, 0x18, 0xc2, 0x3e, 0xc6, 0xcc, 0xc6, 0xcc, 0x86, 0x7e, 0x3c, 0x00,
-    0xc6, 0x7c, 0x7c, 0x60, 0x6c, 0x78, 0x38, 0x3c, 0xde, 0xde, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0x7e, 0xd6, 0x38, 0xcc, 0x7e, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x3e, 0xf6, 0x7c,
-    0x0c, 0xfc, 0x66, 0x66, 0x6c, 0xc6, 0x7c, 0xc6, 0xce, 0xce, 0x6c, 0x66, 0xee, 0xc6, 0xc6, 0xc6,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xc6, 0xcc, 0xc0, 0xc6,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0x6c, 0xcc, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xd6, 0xcc,
-    0xc0, 0xc0, 0xf8, 0xc6, 0x18, 0x18, 0x70, 0x60, 0xc6, 0xcc, 0xc6, 0xcc, 0x1c, 0x0c, 0x3c, 0x00,
-    0xfe, 0x66, 0x66, 0x60, 0x6c, 0x68, 0x7c, 0x0c, 0xf6, 0xf6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x7c, 0xc0, 0x18, 0x06, 0x7c, 0x6c, 0xcc, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x06, 0xd6, 0x6c,
-    0x7c, 0xc6, 0x7c, 0x60, 0x6c, 0xfe, 0x38, 0x1c, 0xde, 0xde, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xc6, 0x76, 0xc0, 0xc0,
-    0x7c, 0xc0, 0x18, 0x7e, 0xd6, 0x38, 0xcc, 0x7e, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x3e, 0xf6, 0x7c,
-    0xfe, 0x7c, 0xc0, 0xfe, 0x3c, 0x3c, 0x1c, 0x3c, 0x7c, 0x76, 0xc6, 0xcc, 0x70, 0x18, 0x3c, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0xfe, 0x62, 0xd6, 0xc6, 0xe6, 0xe6, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0xc6, 0x10, 0xc6, 0xfe, 0x06, 0xd6, 0xff, 0x36, 0xde, 0x66, 0xc6, 0xd6, 0xcc,
-    0xcc, 0xc6, 0x66, 0x60, 0xfe, 0xc0, 0x7c, 0xc6, 0xf6, 0xf6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0x18, 0x18, 0x66, 0xc6,
-    0x60, 0xc6, 0x18, 0x06, 0x7c, 0x6c, 0xfe, 0x06, 0xd6, 0xff, 0x36, 0xde, 0x66, 0x06, 0xd6, 0x6c,
-    0x18, 0x18, 0xc0, 0xc0, 0x18, 0x18, 0x86, 0x06, 0x18, 0x18, 0xc6, 0xcc, 0xc2, 0x30, 0x00, 0x00,
-    0xc6, 0xfc, 0xfc, 0xf0, 0xc6, 0xfe, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0xf0, 0x7c, 0x3c, 0x7c, 0x38, 0xc6, 0x06, 0x06, 0xfe, 0x03, 0x7c, 0xf6, 0xfc, 0x7c, 0xcc, 0xce,
-    0x76, 0x7c, 0xfc, 0xf0, 0xc6, 0x7c, 0xd6, 0x7c, 0xe6, 0xe6, 0xe6, 0xe6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0x0e, 0x0e, 0x3c, 0x7c,
-    0xf0, 0x7c, 0x3c, 0x7c, 0x10, 0xc6, 0x06, 0x06, 0xfe, 0x03, 0x3c, 0xf6, 0xfc, 0xfc, 0xcc, 0xce,
-    0x0e, 0x0e, 0xfe, 0x7c, 0x0e, 0x0e, 0xfc, 0x7c, 0x0e, 0x0e, 0x7c, 0x76, 0xfe, 0x7e, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP771[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00,
-    0x1e, 0xfe, 0xfc, 0xfe, 0x1e, 0xfe, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0x1e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0xfc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xf8, 0xc6, 0xf0, 0x7c, 0xcc, 0x7e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x10, 0x00, 0x3c, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfe, 0x00, 0xfe, 0x18, 0x3c, 0x18, 0x7c, 0x38, 0xc6, 0x00, 0xc6, 0x00, 0xfe, 0x38, 0x00, 0x00,
-    0x36, 0x62, 0x66, 0x66, 0x36, 0x66, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0x7e, 0xc6, 0xd6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0xc6, 0xd6, 0xcc,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x38, 0x00, 0x66, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x66, 0x00, 0x66, 0x18, 0x18, 0x18, 0xc6, 0x10, 0xc6, 0x00, 0xc6, 0xfc, 0xc6, 0x10, 0x00, 0x00,
-    0x66, 0x60, 0x66, 0x62, 0x66, 0x62, 0x54, 0x06, 0xc6, 0xc6, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xd6, 0xcc,
-    0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x6c, 0x00, 0xc2, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x62, 0x00, 0x62, 0x00, 0x18, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x86, 0x00, 0x7e, 0x00,
-    0xc6, 0x60, 0x66, 0x60, 0x66, 0x68, 0x54, 0x0c, 0xce, 0xce, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x7c, 0xc6, 0xc6, 0xd6, 0xd6, 0x30, 0xc6, 0x60, 0x26, 0xd6, 0xcc,
-    0x78, 0xc0, 0xfc, 0xfe, 0x1e, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0x1e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0xc6, 0x78, 0xc0, 0x7c,
-    0xdc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xf8, 0xc6, 0xf0, 0x7c, 0xcc, 0x7e,
-    0x68, 0x7c, 0x68, 0x7c, 0x18, 0x38, 0x60, 0x7c, 0xc6, 0xcc, 0xc6, 0xcc, 0x0c, 0xfe, 0x7e, 0x00,
-    0xc6, 0x7c, 0x7c, 0x60, 0x66, 0x78, 0x7c, 0x3c, 0xde, 0xde, 0x78, 0x66, 0xd6, 0xfe, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x38, 0xc6, 0xc6, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x3e, 0xf6, 0x7c,
-    0x0c, 0xfc, 0x66, 0x62, 0x36, 0xc6, 0xd6, 0xc6, 0xc6, 0xc6, 0x6c, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xc6, 0x0c, 0xc0, 0xc6,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0xc6, 0xd6, 0xcc,
-    0x78, 0xc6, 0x78, 0xc6, 0x18, 0x18, 0x38, 0xc6, 0xc6, 0xcc, 0xc6, 0xcc, 0x18, 0xcc, 0x7e, 0x00,
-    0xfe, 0x66, 0x66, 0x60, 0x66, 0x68, 0x7c, 0x0c, 0xf6, 0xf6, 0x78, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x7c, 0xc0, 0x18, 0x7e, 0xd6, 0x38, 0xc6, 0x7e, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x26, 0xd6, 0x6c,
-    0x7c, 0xc6, 0x66, 0x62, 0x66, 0xc6, 0x54, 0x06, 0xce, 0xce, 0x78, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xfe, 0x7c, 0xc0, 0xc0,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x38, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xd6, 0xcc,
-    0x68, 0xfe, 0x68, 0xfe, 0x18, 0x18, 0x0c, 0x60, 0xc6, 0xcc, 0xc6, 0xcc, 0x30, 0x18, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x60, 0x54, 0x06, 0xe6, 0xe6, 0x6c, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc0, 0x18, 0x06, 0xd6, 0x7c, 0xc6, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x06, 0xd6, 0xcc,
-    0xcc, 0xc6, 0x7c, 0x60, 0x66, 0xfe, 0x7c, 0x3c, 0xde, 0xde, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xc6, 0xcc, 0xc0, 0xc0,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x38, 0xc6, 0x7e, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x3e, 0xf6, 0x7c,
-    0x60, 0xc0, 0x60, 0xc0, 0x18, 0x18, 0x06, 0x38, 0xc6, 0xcc, 0xc6, 0xcc, 0x60, 0x30, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x62, 0x54, 0x06, 0xc6, 0xc6, 0x6c, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc2, 0x18, 0x06, 0x7c, 0x6c, 0xc6, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x06, 0xd6, 0xcc,
-    0xcc, 0xc6, 0x66, 0x60, 0x66, 0xc0, 0x54, 0x06, 0xf6, 0xf6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xc6, 0xcc, 0xc2, 0xc0,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x38, 0xc6, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x06, 0xd6, 0x6c,
-    0x62, 0xc0, 0x62, 0xc0, 0x18, 0x18, 0xc6, 0x0c, 0xc6, 0xcc, 0xc6, 0xcc, 0xc2, 0x60, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0xc6, 0x10, 0xc6, 0xc6, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0xc6, 0xd6, 0xcc,
-    0xcc, 0xc6, 0x66, 0x60, 0x66, 0xc6, 0xd6, 0xc6, 0xe6, 0xe6, 0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xc6, 0xcc, 0x66, 0xc6,
-    0x66, 0xc6, 0x18, 0xc6, 0xd6, 0x6c, 0xc6, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0xc6, 0xd6, 0xcc,
-    0x66, 0xc6, 0x66, 0xc6, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xcc, 0xc6, 0xcc, 0xc6, 0xc6, 0x7e, 0x00,
-    0xc6, 0xfc, 0xfc, 0xf0, 0xff, 0xfe, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0xf0, 0x7c, 0x3c, 0x7c, 0x38, 0xc6, 0xff, 0x06, 0xfe, 0xff, 0x7c, 0xf6, 0xfc, 0x7c, 0xcc, 0xce,
-    0x76, 0x7c, 0xfc, 0xf0, 0xff, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0xe6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xc6, 0x76, 0x3c, 0x7c,
-    0x7c, 0x7c, 0x3c, 0x7e, 0x7c, 0xc6, 0xff, 0x06, 0xfe, 0xfe, 0x7c, 0xf6, 0xfc, 0x7c, 0xcc, 0xce,
-    0xfe, 0x7c, 0xfe, 0x7c, 0x3c, 0x3c, 0x7c, 0x7c, 0x7c, 0x76, 0x7c, 0x76, 0xfe, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0x18, 0x18, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x06, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0x30, 0x30, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0xc6, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0x1e, 0x1e, 0x00, 0x00,
-    0xf0, 0x00, 0x00, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP775[] = {
-    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x3c, 0x38, 0x0c, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x0c, 0xc6, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x18, 0x0c, 0x06, 0xc6, 0xc6, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xfe, 0x7e, 0x0c, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x63, 0x63, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x38, 0x36, 0xfe, 0x18, 0x36, 0x36, 0x00, 0x36, 0x3c, 0x6c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xfe, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x6c,
-    0x00, 0x6c, 0x00, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x0c, 0x00, 0xfe, 0x0c, 0x76, 0x76, 0x00, 0x0c, 0xe6, 0x60, 0xf0, 0x38, 0x00, 0xfe, 0xc6, 0x00,
-    0x00, 0x00, 0x00, 0xe1, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0xcc, 0x18, 0xfe, 0xcc, 0x60, 0x6c, 0x18, 0x30, 0xfe, 0x66, 0xdc, 0x7e, 0x18, 0x10, 0x6c,
-    0x18, 0x00, 0x3e, 0xfe, 0xc6, 0x66, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x02, 0x6c, 0x3a, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xcc, 0x18, 0x82, 0x82, 0x00, 0xe6, 0xe6, 0x30, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x6c, 0x1c, 0xc0, 0x18, 0x36, 0x36, 0x00, 0x36, 0x18, 0x38, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x38,
-    0x78, 0x38, 0x7c, 0x18, 0x00, 0x1c, 0xcc, 0xfc, 0x1c, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x18, 0x78, 0x00, 0x18, 0xdc, 0xdc, 0x00, 0x18, 0x6c, 0x66, 0x60, 0x18, 0xdc, 0x00, 0xe6, 0x18,
-    0x00, 0x18, 0x66, 0x32, 0x7f, 0x61, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x78, 0x78, 0x00, 0x00,
-    0x3c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x00, 0x36, 0x00, 0x66, 0x76, 0x00, 0xfe, 0x38, 0x38,
-    0xfe, 0x00, 0x6c, 0x00, 0x00, 0xc0, 0x7e, 0x7e, 0x00, 0x38, 0xc6, 0x7c, 0x64, 0x6c, 0xc6, 0xc6,
-    0x38, 0x3c, 0x00, 0xfe, 0x00, 0x00, 0x66, 0x18, 0x9a, 0xb2, 0x00, 0x6c, 0x6c, 0x30, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xc6, 0x3c, 0xf8, 0xfe, 0xf6, 0x36, 0xfe, 0xf6, 0x18, 0x7e, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xfe,
-    0x0c, 0x00, 0xc6, 0x00, 0x38, 0x00, 0xcc, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x38, 0xcc, 0x38, 0xc6, 0x00, 0x38, 0x00, 0x00, 0x78, 0x6c, 0x60, 0x18, 0xe6, 0xfe, 0xf6, 0x0c,
-    0x00, 0x18, 0xcc, 0xe4, 0xdb, 0x3c, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x3c, 0x00,
-    0x66, 0xcc, 0x7c, 0x78, 0x78, 0x76, 0x78, 0x7c, 0x3c, 0x7c, 0x7c, 0x60, 0x38, 0x86, 0x6c, 0x7c,
-    0xc0, 0xec, 0xcc, 0x7c, 0x7c, 0xce, 0xc0, 0xc2, 0x3e, 0x6c, 0xc6, 0xce, 0xf0, 0xce, 0x6c, 0x7c,
-    0x6c, 0x18, 0x7c, 0x86, 0x7e, 0x7e, 0xcc, 0x18, 0xa2, 0xaa, 0xfe, 0x7e, 0x7a, 0x3c, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0xfe, 0x66, 0xc0, 0xc0, 0x06, 0x36, 0x06, 0x06, 0x18, 0xc2, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x86,
-    0x7c, 0x7c, 0xfe, 0x7c, 0x18, 0x3e, 0xcc, 0xcc, 0x7e, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x6c, 0xd8, 0x6c, 0xe6, 0x7c, 0x6c, 0x66, 0xdc, 0x78, 0x78, 0x62, 0x18, 0xc6, 0xc0, 0xde, 0x18,
-    0x00, 0x7e, 0x66, 0x3a, 0xdb, 0x66, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x38, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0xcc, 0x0c, 0xc6, 0x38, 0xc6, 0x66, 0x60, 0x18, 0x1c, 0xc6, 0xc6,
-    0xf8, 0x36, 0xfe, 0xc6, 0xc6, 0x66, 0xc0, 0x70, 0x60, 0xc6, 0xc6, 0xd6, 0x60, 0xd6, 0x38, 0xc6,
-    0xc6, 0x18, 0xc6, 0x1c, 0x0c, 0x0c, 0x00, 0x00, 0xa2, 0xb2, 0x06, 0x33, 0x36, 0x78, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xc6, 0xc0, 0xc0, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0x18, 0x70, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc6, 0xc6, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0x1c,
-    0xcc, 0xc6, 0xc0, 0xc6, 0x18, 0x60, 0xcc, 0xcc, 0x0c, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xcc, 0xc6, 0xf6, 0xc6, 0xc6, 0x66, 0xe6, 0x6c, 0x6c, 0x66, 0x18, 0xc6, 0xf8, 0xce, 0x00,
-    0x7e, 0x18, 0x00, 0xf6, 0x7b, 0x66, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x18, 0x0c, 0x30, 0x3c, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0x30, 0xfe, 0xe6, 0xf0, 0x18, 0x70, 0xfe, 0xfe,
-    0xc0, 0x7e, 0xcc, 0xc6, 0xc6, 0x3a, 0x7e, 0x1c, 0x3c, 0xc6, 0xc6, 0xe6, 0x60, 0xe6, 0x6c, 0xc6,
-    0xfe, 0x18, 0xc6, 0x70, 0x18, 0x18, 0x00, 0x18, 0x9a, 0xaa, 0x06, 0x66, 0x6a, 0xf0, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0xc6, 0xc0, 0xfe, 0xc0, 0x36, 0x36, 0x36, 0x00, 0x3c, 0x1c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x7c, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x70,
-    0x76, 0xc0, 0x7c, 0xfe, 0x3c, 0x3c, 0x76, 0xcc, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xc6, 0xc6, 0xde, 0xc6, 0xc6, 0x66, 0xc6, 0xe6, 0x66, 0xfe, 0x3c, 0xc6, 0xc0, 0xc6, 0x00,
-    0x00, 0x18, 0x00, 0x2a, 0x1b, 0x3c, 0x00, 0xcc, 0x00, 0x18, 0x00, 0x3c, 0x78, 0x7c, 0x3c, 0x00,
-    0x66, 0xcc, 0xc0, 0xcc, 0xcc, 0x0c, 0xcc, 0xc6, 0x70, 0xc0, 0x18, 0x18, 0x18, 0xc2, 0xc6, 0xc6,
-    0xc0, 0xd8, 0xcc, 0xc6, 0xc6, 0x0c, 0x18, 0x86, 0x06, 0x6c, 0xc6, 0x7c, 0x66, 0x6c, 0xc6, 0x7c,
-    0xc6, 0x18, 0xc6, 0xc2, 0x30, 0x30, 0x00, 0x18, 0x82, 0x82, 0x00, 0xcc, 0xdf, 0x30, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x66, 0x18, 0xc0, 0x36, 0x36, 0x36, 0x00, 0x18, 0x86, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc2,
-    0x18, 0xc6, 0x18, 0xc0, 0x18, 0x06, 0x18, 0xcc, 0x30, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x6c, 0xc6, 0x6c, 0xce, 0xc6, 0x6c, 0x7c, 0xc6, 0x18, 0x18, 0x18, 0x18, 0x18, 0xc0, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x5f, 0x1b, 0x86, 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0xf8, 0x76, 0x7c, 0xdc, 0x7c, 0x70, 0x70, 0x3c, 0xfe, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x38, 0x18, 0xfc, 0x7c, 0x38, 0x7c, 0x80, 0xfc, 0xb8, 0x00, 0xc6,
-    0xc6, 0x3c, 0x7c, 0xfe, 0x7e, 0x7e, 0x00, 0x18, 0x7c, 0x7c, 0x00, 0x0f, 0x06, 0x3e, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x0e, 0x3c, 0x0e, 0xfe, 0x36, 0x36, 0x36, 0x00, 0x0e, 0xfc, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x0e, 0x7c, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xfe,
-    0x0e, 0x7c, 0x0e, 0x7c, 0x0e, 0x7c, 0x0e, 0x76, 0x7e, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x38, 0xcc, 0x38, 0xc6, 0x7c, 0x38, 0xc0, 0xc6, 0x70, 0x70, 0x70, 0x70, 0x70, 0xfe, 0x70, 0x00,
-    0x00, 0x7e, 0x00, 0x86, 0x1b, 0x7c, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP775[] = {
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x36, 0x00, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x6c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x6c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x0c, 0x00, 0x00, 0x0c, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfe, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x1c, 0x00, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xfe, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x18, 0x00, 0xfe, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe0, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x6c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x6c, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3c, 0x00, 0x0c, 0x00, 0x00, 0x3c, 0x6c, 0x0c, 0x38, 0x00, 0xfc, 0x00, 0x00, 0xfe, 0x10, 0x10,
-    0xfe, 0x00, 0x3e, 0x00, 0x00, 0x3c, 0x18, 0x7c, 0x0c, 0x7c, 0xc6, 0x00, 0x38, 0x7c, 0x00, 0x00,
-    0x10, 0x3c, 0x0c, 0xfe, 0x18, 0x0c, 0x66, 0x18, 0x7c, 0x7c, 0x00, 0x62, 0x62, 0xf0, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x10, 0x3c, 0xfe, 0xfe, 0x36, 0x36, 0x00, 0x36, 0x3c, 0x7c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xfe,
-    0x00, 0x38, 0x00, 0x18, 0x18, 0x38, 0x00, 0x00, 0x38, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x7c, 0x78, 0x7c, 0xc6, 0x76, 0x7c, 0x00, 0x0c, 0xe6, 0xe0, 0xf0, 0x38, 0x00, 0xfe, 0xc6, 0x18,
-    0x00, 0x00, 0x22, 0x62, 0x7f, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x7c, 0x3c, 0x00, 0x00,
-    0x66, 0xcc, 0x18, 0xfe, 0xcc, 0x60, 0x38, 0x18, 0x1a, 0xfe, 0x66, 0x00, 0x7e, 0xc6, 0x38, 0x38,
-    0x66, 0x00, 0x6c, 0xfe, 0xc6, 0x66, 0x18, 0xc6, 0x18, 0xc6, 0xc6, 0x00, 0x6c, 0xce, 0x00, 0x00,
-    0x38, 0x18, 0x18, 0xc6, 0x18, 0x18, 0x66, 0x18, 0x82, 0x82, 0x00, 0x66, 0x66, 0x64, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x38, 0x66, 0x66, 0x66, 0x36, 0x36, 0x00, 0x36, 0x18, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x10, 0x00, 0x18, 0x18, 0x10, 0x00, 0xfc, 0x10, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xc6, 0xcc, 0xc6, 0xe6, 0xdc, 0xc6, 0x00, 0x18, 0x66, 0x60, 0x60, 0x18, 0x00, 0x66, 0xe6, 0x18,
-    0x00, 0x18, 0x44, 0x36, 0xdb, 0x38, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x38, 0x06, 0x66, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1e, 0x00, 0x66, 0x00, 0x00, 0x86, 0x6c, 0x6c,
-    0x62, 0x00, 0xcc, 0x00, 0x00, 0xc2, 0x7c, 0xc6, 0x00, 0xc6, 0xc6, 0x04, 0x64, 0xce, 0xc6, 0xc6,
-    0x6c, 0x18, 0x00, 0x86, 0x00, 0x00, 0x22, 0x18, 0x9a, 0xb2, 0x00, 0x6c, 0x6c, 0x6c, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x6c, 0xc2, 0x62, 0x62, 0xf6, 0x36, 0xfe, 0xf6, 0x18, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x86,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xc6, 0xcc, 0xc6, 0xf6, 0x00, 0xc6, 0x00, 0x00, 0x66, 0x60, 0x60, 0x18, 0x00, 0x62, 0xf6, 0x08,
-    0x00, 0x18, 0x66, 0xec, 0xdb, 0x6c, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x3c, 0x0c, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x76, 0x78, 0x7c, 0x1c, 0x7c, 0x66, 0xdc, 0x38, 0x0c, 0xc6, 0xc6,
-    0x68, 0xec, 0xcc, 0x7c, 0x7c, 0xc0, 0xc6, 0x60, 0x7c, 0xc6, 0xc6, 0x7c, 0x60, 0xd6, 0x6c, 0x7c,
-    0xc6, 0x18, 0x7c, 0x0c, 0xfe, 0xfe, 0x44, 0x00, 0xa2, 0xaa, 0xfe, 0x18, 0x18, 0x78, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc0, 0x68, 0x68, 0x06, 0x36, 0x06, 0x06, 0x18, 0x60, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0c,
-    0x78, 0x7c, 0x7c, 0x7c, 0x38, 0x7c, 0xcc, 0xcc, 0xfe, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xc6, 0xcc, 0xc6, 0xfe, 0x7c, 0xc6, 0x66, 0xdc, 0x6c, 0x66, 0x60, 0x18, 0xdc, 0x68, 0xfe, 0x10,
-    0x00, 0x7e, 0x66, 0x18, 0xdb, 0xc6, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x06, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0xcc, 0x0c, 0xc6, 0x18, 0xc6, 0x7c, 0x76, 0x18, 0x18, 0xc6, 0xc6,
-    0x78, 0x36, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0x38, 0xc6, 0xc6, 0xc6, 0xce, 0xf0, 0xd6, 0x38, 0xc6,
-    0xc6, 0x18, 0xc6, 0x18, 0xcc, 0xcc, 0x00, 0x00, 0xa2, 0xaa, 0x06, 0x30, 0x30, 0x70, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xc6, 0xc0, 0x78, 0x78, 0xf6, 0x36, 0xf6, 0xfe, 0x18, 0x38, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc6, 0xc6, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0x18,
-    0x0c, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0xcc, 0xcc, 0xcc, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xd8, 0xc6, 0xde, 0xc6, 0xc6, 0x66, 0x66, 0x78, 0x6c, 0x60, 0x18, 0x66, 0x78, 0xde, 0x00,
-    0x00, 0x18, 0x00, 0x30, 0x7b, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0xcc, 0x7c, 0xc0, 0x38, 0xfe, 0x6c, 0x66, 0x18, 0x30, 0xfe, 0xfe,
-    0x68, 0x36, 0xcc, 0xc6, 0xc6, 0xde, 0xc0, 0x0c, 0x60, 0xc6, 0xc6, 0xd6, 0x60, 0xd6, 0x38, 0xc6,
-    0xfe, 0x18, 0xc6, 0x30, 0x18, 0x18, 0x00, 0x18, 0xa2, 0xb2, 0x06, 0x60, 0x66, 0xe0, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xfe, 0xc0, 0x68, 0x68, 0x36, 0x36, 0x36, 0x00, 0x18, 0x0c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x30,
-    0x7c, 0xc0, 0xfe, 0xfe, 0x18, 0x60, 0xcc, 0xcc, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xcc, 0xc6, 0xce, 0xc6, 0xc6, 0x66, 0x66, 0x78, 0x78, 0x60, 0x18, 0x66, 0x68, 0xce, 0x00,
-    0xfe, 0x18, 0x00, 0x66, 0x1b, 0x6c, 0x00, 0x00, 0x00, 0x18, 0x18, 0x3c, 0x7c, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0x78, 0xc0, 0x66, 0x60, 0x18, 0x60, 0xc6, 0xc6,
-    0x60, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x06, 0x38, 0xc6, 0xc6, 0xd6, 0x60, 0xd6, 0x6c, 0xc6,
-    0xc6, 0x18, 0xc6, 0x60, 0x30, 0x30, 0x00, 0x18, 0xa2, 0xaa, 0x06, 0xdc, 0xce, 0xe0, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc0, 0x60, 0x60, 0x36, 0x36, 0x36, 0x00, 0x18, 0x06, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x60,
-    0xcc, 0xc0, 0xc0, 0xc0, 0x18, 0x38, 0xcc, 0xcc, 0x30, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x6c, 0x78, 0x60, 0x18, 0x66, 0x60, 0xc6, 0x00,
-    0x00, 0x00, 0x00, 0xce, 0x1b, 0x38, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0x58, 0xc0, 0x66, 0x60, 0x18, 0xc2, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x0c, 0xc6, 0xc6, 0xd6, 0x60, 0xe6, 0xc6, 0xc6,
-    0xc6, 0x18, 0xc6, 0xc2, 0x60, 0x60, 0x00, 0x18, 0x9a, 0xaa, 0x06, 0x86, 0x9a, 0x62, 0xd8, 0x36,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc2, 0x62, 0x62, 0x36, 0x36, 0x36, 0x00, 0x18, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc2,
-    0xcc, 0xc0, 0xc0, 0xc0, 0x18, 0x0c, 0xcc, 0xcc, 0x60, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x66, 0x6c, 0x62, 0x18, 0x66, 0x62, 0xc6, 0x00,
-    0x00, 0x00, 0x00, 0x9a, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0x18, 0xc6, 0x66, 0x60, 0x18, 0xc6, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0x66, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0x66, 0xe6, 0x00, 0x7c,
-    0xc6, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x18, 0x82, 0x82, 0x00, 0x0c, 0x3f, 0x66, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0x66, 0x66, 0x66, 0x36, 0x36, 0x36, 0x00, 0x18, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0xcc, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0xcc, 0xcc, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x66, 0x66, 0xc6, 0x00,
-    0x00, 0x7e, 0x00, 0x3f, 0x1b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x7c, 0x76, 0x7c, 0x3c, 0x7c, 0xe6, 0xf0, 0x3c, 0xfe, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x3a, 0x18, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0x00, 0xc6,
-    0xc6, 0x3c, 0x7c, 0xfe, 0xfe, 0xfe, 0x00, 0x18, 0x7c, 0x7c, 0x00, 0x18, 0x06, 0xfe, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0x3c, 0xfe, 0xfe, 0x36, 0x36, 0x36, 0x00, 0x3c, 0x7c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x7c, 0x7c, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xfe,
-    0x76, 0x7c, 0x7c, 0x7c, 0x3c, 0x7c, 0x76, 0x76, 0xfe, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x7c, 0xcc, 0x7c, 0xc6, 0x7c, 0x7c, 0x7c, 0x66, 0xe6, 0xe6, 0xfe, 0x3c, 0x66, 0xfe, 0xc6, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x1b, 0x7c, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x36, 0x36, 0x36, 0x00, 0x18, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x30, 0x00, 0x30, 0x00, 0x36, 0x36, 0x36, 0x00, 0x30, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x30, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x1e, 0x00, 0x1e, 0x00, 0x36, 0x36, 0x36, 0x00, 0x1e, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x1e, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP850[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0xc6, 0x30, 0x30, 0x00, 0x7c, 0xc6, 0x30, 0x66, 0x7c, 0x30, 0xc6, 0x38,
-    0x18, 0x00, 0x3e, 0x7c, 0xc6, 0x30, 0x78, 0x60, 0xc6, 0xc6, 0xc6, 0x00, 0x38, 0x3a, 0x00, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x3c, 0x38, 0x18, 0x7e, 0x00, 0x63, 0x63, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x30, 0x7c, 0x18, 0x7e, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x76, 0x76, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x30, 0xf8, 0x7c, 0xc6, 0x30, 0x1e, 0x0c, 0x3c, 0x66, 0x18, 0x00, 0xff, 0x00, 0x18, 0x30, 0xff,
-    0x30, 0x78, 0x7c, 0x0c, 0x76, 0x76, 0x00, 0xe0, 0xf0, 0x18, 0x7c, 0x60, 0x18, 0x0c, 0xff, 0x0c,
-    0x00, 0x18, 0x00, 0xe1, 0x7f, 0x3e, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x78, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0x00, 0x18, 0x30, 0x00, 0x82, 0x00, 0x18, 0x00, 0x82, 0x18, 0x38, 0x6c,
-    0x30, 0x00, 0x6c, 0x82, 0x00, 0x18, 0x84, 0x30, 0x00, 0x38, 0x00, 0x02, 0x6c, 0x6c, 0xc6, 0x1b,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x6c, 0x6c, 0x00, 0x81, 0x00, 0xe6, 0xe6, 0x00, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x60, 0x82, 0x0c, 0x81, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xdc, 0xdc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x7e, 0x6c, 0x82, 0x00, 0x18, 0x21, 0x18, 0x42, 0x00, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0x60, 0xcc, 0x82, 0x06, 0xdc, 0xdc, 0x00, 0x60, 0x60, 0x30, 0x82, 0x30, 0x30, 0x18, 0x00, 0x18,
-    0x00, 0x18, 0x00, 0x32, 0xdb, 0x61, 0x18, 0x00, 0x6c, 0xc6, 0x00, 0x38, 0x0c, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7e, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x00, 0x6c, 0x7c,
-    0xfe, 0x7e, 0xcc, 0x7c, 0x7c, 0x7c, 0x00, 0xcc, 0xc6, 0x6c, 0xc6, 0x7c, 0x64, 0xce, 0x6c, 0x18,
-    0x78, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0xb9, 0x00, 0x6c, 0x6c, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x38, 0x38, 0x38, 0x9d, 0xf6, 0x36, 0xfe, 0xf6, 0x7e, 0x3c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x7c, 0x38, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x7c,
-    0x0c, 0x66, 0xfe, 0xfe, 0xfe, 0x7c, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0xff, 0x00, 0x18, 0x3c, 0xff,
-    0x38, 0xcc, 0x38, 0x38, 0x7c, 0x38, 0x66, 0x7c, 0x7c, 0xc6, 0x00, 0xc6, 0xc6, 0x66, 0x00, 0x30,
-    0x00, 0x7e, 0x00, 0xe4, 0xdb, 0x3c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x38, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc0, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x38, 0xc6, 0xc6,
-    0xc0, 0x12, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xce, 0xf0, 0xd6, 0x38, 0x3c,
-    0x0c, 0x38, 0xc6, 0xcc, 0xdc, 0xe6, 0x3e, 0x38, 0x18, 0xa5, 0xfe, 0x7e, 0x7a, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x6c, 0x6c, 0x6c, 0xa1, 0x06, 0x36, 0x06, 0x06, 0xc0, 0x7e, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x06, 0x6c, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x7c, 0xf6, 0xc0, 0xc0, 0xc0, 0x20, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x18, 0xff,
-    0x6c, 0xd8, 0x6c, 0x6c, 0xc6, 0x6c, 0x66, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x00,
-    0x7e, 0x18, 0x00, 0x3a, 0x7b, 0x66, 0x7e, 0x00, 0x38, 0x00, 0x18, 0x18, 0x0c, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0xf8, 0xfe, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xd6, 0x60, 0xe6, 0x6c, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0x00, 0x00, 0x30, 0xb9, 0x06, 0x33, 0x36, 0x3c, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xc6, 0xc6, 0xc6, 0xa1, 0xf6, 0x36, 0xf6, 0xfe, 0xc0, 0x18, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7e, 0xc6, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0xcc, 0x66, 0xfc, 0xfc, 0xfc, 0x7c, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xff, 0xff, 0x00, 0x18, 0x00,
-    0xc6, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x3c, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0xf6, 0x1b, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0xc0, 0x90, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x7e, 0x6c, 0xc6, 0xe6, 0x66, 0x6c, 0xc6, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x63, 0xa5, 0x06, 0x66, 0x6a, 0x3c, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0xfe, 0xfe, 0xfe, 0x9d, 0x36, 0x36, 0x36, 0x00, 0x7e, 0x7e, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xfe, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0xcc, 0x6c, 0xc0, 0xc0, 0xc0, 0x21, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0x6c, 0xc6, 0x6c, 0x6c, 0xc6, 0x6c, 0x66, 0x7c, 0x60, 0xc6, 0xc6, 0xc6, 0x7e, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x2a, 0x1b, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x0c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0xfe, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x06, 0x38, 0x7c, 0x7c, 0xfc, 0xb8, 0x00, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xce, 0x00, 0x00, 0x3e, 0x81, 0x00, 0xcc, 0xdf, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x81, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x7e, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x78, 0xf8, 0xfe, 0xfe, 0xfe, 0x1e, 0x3c, 0x3c, 0x3c, 0x00, 0x18, 0xff, 0xff, 0x18, 0x3c, 0x00,
-    0x38, 0xcc, 0x38, 0x38, 0x7c, 0x38, 0x7c, 0x60, 0xf0, 0x7c, 0x7c, 0x7c, 0x06, 0x3c, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x5f, 0x1b, 0x86, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x7e, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x86, 0x00, 0x7c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP850[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x60, 0x7c, 0x0c, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x76, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x0c, 0x3c, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x30, 0xff,
-    0x18, 0x00, 0x38, 0x30, 0x00, 0x76, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x0c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0x38, 0x00, 0x10, 0x00, 0x60, 0x00, 0x18, 0x60, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x10, 0x00, 0x60, 0x30, 0x60, 0x00, 0xc6, 0xc6, 0x00, 0x38, 0x04, 0x00, 0x0e,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc0, 0xc6, 0x06, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xdc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x6c, 0xc6, 0x18, 0x00, 0x18, 0x66, 0x66, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0x30, 0x00, 0x6c, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x30, 0x6c, 0x18, 0x0c, 0x18, 0xff, 0x0c,
-    0x00, 0x00, 0x00, 0xe0, 0x00, 0x7c, 0x00, 0x00, 0x38, 0xc6, 0x00, 0x18, 0x7c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0x30, 0x6c, 0x00, 0x38, 0xc6, 0x30, 0x66, 0x3c, 0x30, 0x00, 0x38,
-    0x00, 0x00, 0x3e, 0x38, 0xc6, 0x30, 0x78, 0x30, 0xc6, 0x00, 0x00, 0x00, 0x6c, 0x7c, 0x00, 0x1b,
-    0x30, 0x18, 0x30, 0x30, 0x76, 0x00, 0x3c, 0x38, 0x30, 0x7c, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x10, 0x10, 0x10, 0x7c, 0x36, 0x36, 0x00, 0x36, 0x18, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x76, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x34, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x18, 0x00, 0xff,
-    0x00, 0x78, 0x00, 0x00, 0x76, 0x00, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x30, 0x7f, 0xc6, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x38, 0x06, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x18, 0x38, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x66, 0x18, 0x10, 0x10,
-    0xfe, 0x00, 0x6c, 0x6c, 0x00, 0x18, 0xcc, 0x18, 0x00, 0x7c, 0xc6, 0x00, 0x64, 0xce, 0x00, 0x18,
-    0x60, 0x30, 0x60, 0x60, 0xdc, 0xc6, 0x6c, 0x6c, 0x30, 0x82, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x38, 0x38, 0x38, 0x82, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xdc, 0x38, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x18, 0x6c, 0xfe, 0xfe, 0xfe, 0x1e, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0xff, 0x00, 0x18, 0x3c, 0xff,
-    0x7c, 0xcc, 0x7c, 0x7c, 0xdc, 0x7c, 0x00, 0x60, 0x60, 0xc6, 0xc6, 0xc6, 0x30, 0x66, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x62, 0xdb, 0x60, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x3c, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x66, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x00, 0x60, 0xce, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x6c, 0x00, 0xb2, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x6c, 0x6c, 0x6c, 0x9a, 0x36, 0x36, 0x00, 0x36, 0x7c, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x2c, 0x66, 0x66, 0x66, 0x66, 0x33, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0xc6, 0xcc, 0xc6, 0xc6, 0x00, 0xc6, 0x00, 0x60, 0x7c, 0xc6, 0xc6, 0xc6, 0x00, 0x66, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x36, 0xdb, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x06, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x6c, 0x6c,
-    0x62, 0xec, 0xcc, 0x7c, 0x7c, 0x7c, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x7c, 0xf0, 0xd6, 0xc6, 0x18,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xf6, 0x3e, 0x38, 0x30, 0xaa, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xa2, 0xf6, 0x36, 0xfe, 0xf6, 0xc6, 0x3c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x78, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x7c,
-    0x06, 0x66, 0x62, 0x62, 0x62, 0x60, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0xc6, 0xcc, 0xc6, 0xc6, 0x7c, 0xc6, 0x66, 0x7c, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0xec, 0xdb, 0x6c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x68, 0x36, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xce, 0x60, 0xd6, 0x6c, 0x7e,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xfe, 0x00, 0x00, 0x30, 0xb2, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xa2, 0x06, 0x36, 0x06, 0x06, 0xc0, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x0c, 0xc6, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x3e, 0xf6, 0x68, 0x68, 0x68, 0xfe, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x18, 0xff,
-    0xc6, 0xd8, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x18, 0x7b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7c, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x78, 0x36, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xde, 0x60, 0xd6, 0x38, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x60, 0xaa, 0x06, 0x30, 0x30, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xfe, 0xfe, 0xfe, 0xa2, 0xf6, 0x36, 0xf6, 0xfe, 0xc0, 0x7e, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7c, 0xfe, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x66, 0x66, 0x78, 0x78, 0x78, 0x60, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xff, 0xff, 0x00, 0x18, 0x00,
-    0xc6, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x3c, 0x00, 0x00,
-    0xfe, 0x18, 0x00, 0x30, 0x1b, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0x68, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xf6, 0x60, 0xd6, 0x38, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x00, 0x00, 0xc0, 0xaa, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x9a, 0x36, 0x36, 0x36, 0x00, 0xc6, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x66, 0x66, 0x68, 0x68, 0x68, 0xfc, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x66, 0x1b, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xe6, 0x60, 0xe6, 0x6c, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0x82, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x82, 0x36, 0x36, 0x36, 0x00, 0x7c, 0x7e, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x66, 0x66, 0x62, 0x62, 0x62, 0x60, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xce, 0x1b, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xe6, 0xc6, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0x7c, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x7c, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0x66, 0x6c, 0x66, 0x66, 0x66, 0x33, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x60, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x9a, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x7e, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0x00, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x00, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x76, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x3c, 0xf8, 0xfe, 0xfe, 0xfe, 0x1e, 0x3c, 0x3c, 0x3c, 0x00, 0x18, 0xff, 0xff, 0x18, 0x3c, 0x00,
-    0x7c, 0xcc, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xf0, 0x7c, 0x7c, 0x7c, 0x7e, 0x3c, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x3f, 0x1b, 0xc6, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x06, 0x00, 0x7c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+typedef uint16_t font_index_t;
 
-static const __in_flash("font") uint8_t FONT8_CP852[] = {
-    0x3c, 0xcc, 0x18, 0x78, 0xcc, 0x30, 0x18, 0x00, 0x30, 0xcc, 0x66, 0x00, 0x70, 0x0c, 0xc6, 0x0c,
-    0x0c, 0xcc, 0xcc, 0x78, 0xcc, 0xf6, 0xf6, 0x0c, 0x0c, 0xc6, 0xc6, 0xcc, 0xcc, 0x60, 0x00, 0x66,
-    0x0c, 0x0c, 0x00, 0x00, 0x38, 0x00, 0x66, 0x66, 0xfe, 0x00, 0x00, 0x0c, 0x66, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0x0c, 0x7c, 0xcc, 0x78, 0x36, 0x36, 0x00, 0x36, 0x18, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0xcc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x0c, 0x7c, 0xcc, 0xcc, 0x96, 0x24, 0x18, 0x78, 0xcc, 0x18, 0x00, 0xff, 0x00, 0x7e, 0x10, 0xff,
-    0x0c, 0x00, 0x7c, 0x0c, 0x0c, 0x66, 0x6c, 0x6c, 0x0c, 0x0c, 0x18, 0x66, 0x0c, 0x0c, 0x30, 0x0c,
-    0x00, 0x66, 0x00, 0xd8, 0xc6, 0x3c, 0x18, 0x00, 0x38, 0x66, 0x18, 0x66, 0xd8, 0xd8, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x84, 0x00, 0xcc, 0x30, 0x00, 0x36, 0x00, 0xcc, 0x66, 0x88, 0x18, 0x38, 0x18,
-    0x18, 0xd8, 0xd8, 0xcc, 0x00, 0xdc, 0xdc, 0x18, 0x18, 0x7c, 0x00, 0x78, 0x78, 0x6c, 0xc6, 0x3c,
-    0x18, 0x18, 0x0c, 0x18, 0x6c, 0x00, 0x3c, 0x3c, 0xc0, 0x00, 0x00, 0x18, 0x3c, 0x00, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x82, 0x78, 0xcc, 0x36, 0x36, 0x00, 0x36, 0xfe, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x7c, 0x78, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x42,
-    0x3e, 0x66, 0x78, 0x00, 0x66, 0x18, 0x30, 0x84, 0x78, 0x18, 0x00, 0xff, 0x00, 0x18, 0x28, 0xff,
-    0x18, 0x78, 0x82, 0x18, 0x18, 0x3c, 0x38, 0x38, 0x18, 0x18, 0x30, 0xcc, 0x18, 0xde, 0x78, 0x18,
-    0x00, 0xcc, 0x00, 0x70, 0x7c, 0x66, 0x18, 0x00, 0x6c, 0x00, 0x00, 0xcc, 0x70, 0x70, 0x00, 0x00,
-    0xc0, 0xcc, 0x78, 0x78, 0x78, 0x30, 0x78, 0x78, 0x3c, 0x78, 0x7c, 0xcc, 0x70, 0xfe, 0x6c, 0x7c,
-    0xfc, 0xc0, 0xc0, 0x00, 0x78, 0xc0, 0xc0, 0x7e, 0x3e, 0xc6, 0xc6, 0xfc, 0x30, 0x78, 0x6c, 0x3c,
-    0x78, 0x38, 0x18, 0x30, 0xc6, 0x78, 0xfe, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x7c, 0x7c, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0x7c, 0x7c, 0xfe, 0x60, 0xf6, 0x36, 0xfe, 0xf6, 0xc6, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x7c, 0x78, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x3c,
-    0x0c, 0x66, 0xfc, 0xfc, 0x06, 0xe6, 0x78, 0x78, 0x78, 0x18, 0x00, 0xff, 0x00, 0x18, 0xd6, 0xff,
-    0x7c, 0xcc, 0x7c, 0xe6, 0xdc, 0xdc, 0x7e, 0x7c, 0xfc, 0xc6, 0xce, 0xc6, 0xc6, 0xc6, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xfc, 0xce, 0x3c, 0x00,
-    0xc0, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0x38, 0xcc, 0xc6, 0x78, 0x30, 0x0c, 0xc6, 0xc6,
-    0x60, 0xc0, 0xc0, 0x78, 0xcc, 0xc0, 0xc0, 0xc0, 0x60, 0xc6, 0xc6, 0x30, 0xfc, 0x70, 0x38, 0x66,
-    0x0c, 0x18, 0x78, 0xcc, 0xfe, 0x0c, 0x0c, 0x7e, 0xf8, 0xcc, 0x00, 0x7e, 0xc6, 0xc0, 0xcc, 0x33,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0xc6, 0xc6, 0xc0, 0x30, 0x06, 0x36, 0x06, 0x06, 0x0c, 0x7c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0x0c, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x66,
-    0x7c, 0xf6, 0x66, 0x60, 0x7e, 0xf6, 0x30, 0x30, 0xcc, 0x18, 0x00, 0xff, 0x00, 0x18, 0xc6, 0xff,
-    0xc6, 0xf8, 0xc6, 0xf6, 0xe6, 0xe6, 0xe0, 0x40, 0xc6, 0xc6, 0xf0, 0xc6, 0xc6, 0x66, 0x30, 0x00,
-    0x3c, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x7e, 0x00, 0x38, 0x00, 0x00, 0xcc, 0xc6, 0xd8, 0x3c, 0x00,
-    0x66, 0xcc, 0xfc, 0x7c, 0x7c, 0xcc, 0xc0, 0xc0, 0x30, 0xfc, 0xc6, 0xcc, 0x30, 0x30, 0xfe, 0xc0,
-    0x78, 0xc0, 0xc0, 0xcc, 0xcc, 0xc0, 0xc0, 0x7c, 0x3c, 0xc6, 0xc6, 0x30, 0x30, 0x60, 0x6c, 0x60,
-    0x7c, 0x18, 0xcc, 0xcc, 0xc6, 0x7c, 0x18, 0x0c, 0xc0, 0xfc, 0x00, 0x0c, 0xc0, 0x78, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0xf8, 0xfe, 0xfe, 0xf8, 0x18, 0xf6, 0x36, 0xf6, 0xfe, 0x30, 0x18, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfe, 0x7c, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0x66,
-    0xcc, 0x66, 0x66, 0x78, 0xc6, 0xde, 0x30, 0x30, 0xfc, 0xf8, 0x1f, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xcc, 0xc6, 0xde, 0xc6, 0xc6, 0x38, 0x38, 0xfc, 0xc6, 0xe0, 0xc6, 0x66, 0x3c, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xfc, 0xe0, 0x3c, 0x00,
-    0x3c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x70, 0xc0, 0xc6, 0xcc, 0x30, 0x60, 0xc6, 0xc6,
-    0x60, 0xc0, 0xc0, 0xcc, 0xcc, 0xc0, 0xc0, 0x06, 0x06, 0xc6, 0xc6, 0x30, 0x30, 0xe0, 0xc6, 0x66,
-    0xcc, 0x18, 0xcc, 0xcc, 0xd6, 0xcc, 0x60, 0x30, 0xc0, 0xc0, 0x00, 0x30, 0xc6, 0x0c, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc0, 0xcc, 0x36, 0x36, 0x36, 0x00, 0xc6, 0x30, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xcc, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x3c,
-    0xcc, 0x66, 0x66, 0x60, 0xc6, 0xce, 0x30, 0x30, 0xc0, 0x00, 0x18, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xf8, 0xc6, 0xce, 0xc6, 0xc6, 0x0e, 0x04, 0xd8, 0xc6, 0xc0, 0xc6, 0x3e, 0x18, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd8, 0xc0, 0x3c, 0x00,
-    0x0c, 0x76, 0x78, 0x76, 0x7e, 0x76, 0x78, 0x78, 0xdc, 0x78, 0x7c, 0x78, 0x78, 0xfe, 0xc6, 0x7c,
-    0xfc, 0xfe, 0x78, 0x78, 0x78, 0xfe, 0x78, 0xfc, 0x7c, 0x7c, 0x7c, 0x30, 0x1e, 0x7e, 0x00, 0x3c,
-    0x7e, 0x3c, 0x78, 0x7e, 0x18, 0x76, 0xfe, 0x7e, 0xfe, 0x78, 0x00, 0x7e, 0x7c, 0xf8, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xc6, 0xc6, 0xfe, 0x78, 0x36, 0x36, 0x36, 0x00, 0xfe, 0x7c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0x76, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x42,
-    0x76, 0x7c, 0xfc, 0xfc, 0x7e, 0xc6, 0x78, 0x78, 0x78, 0x00, 0x18, 0xff, 0xff, 0x04, 0x7c, 0x00,
-    0x7c, 0xc0, 0x7c, 0xc6, 0xc6, 0xc6, 0xfc, 0x7c, 0xcc, 0x7c, 0xc0, 0x7c, 0x0c, 0x30, 0x18, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0xcc, 0x18, 0x04, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xc0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x00, 0x00, 0x00, 0x30, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x1c, 0x00, 0x00,
-    0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x1c, 0x00, 0x00, 0x78, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP852[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x18, 0x00, 0x0c,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x38, 0x6c, 0x00, 0x36, 0x36, 0x00, 0x36, 0x18, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x6c, 0x6c, 0x6c, 0x6c, 0x0c, 0x3c, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x38, 0xff,
-    0x0c, 0x00, 0x38, 0x0c, 0x00, 0x00, 0x6c, 0x00, 0x18, 0x18, 0x00, 0x36, 0x00, 0x0c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x78, 0x0c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x18, 0x30, 0xc6, 0x18,
-    0x30, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x1b, 0x30, 0x00, 0xc6, 0xc6, 0x3c, 0x38, 0x00, 0x00, 0x00,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x30, 0x6c, 0x38, 0x00, 0x36, 0x36, 0x00, 0x36, 0x18, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x7c, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x38, 0x38, 0x18, 0x66, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x6c, 0xff,
-    0x18, 0x00, 0x6c, 0x18, 0x0c, 0x00, 0x38, 0x00, 0x30, 0x30, 0x0c, 0x6c, 0x0c, 0x18, 0x00, 0x0c,
-    0x00, 0x36, 0x00, 0x6c, 0xc6, 0x7c, 0x00, 0x00, 0x38, 0x6c, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0xcc, 0x18, 0x00, 0x38, 0xc6, 0x00, 0x36, 0x3c, 0x00, 0x10, 0x00,
-    0x60, 0xf6, 0xe6, 0x38, 0xc6, 0xee, 0xee, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x6c,
-    0x30, 0x18, 0x30, 0x30, 0x10, 0x00, 0x00, 0x6c, 0xfe, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x7c, 0x36, 0x36, 0x00, 0x36, 0x00, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x18, 0x00, 0xff, 0x00, 0x7e, 0x38, 0xff,
-    0x00, 0x78, 0x00, 0x00, 0x18, 0x6c, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x18,
-    0x00, 0x6c, 0x00, 0x38, 0x7c, 0xc6, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0x00, 0x6c, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x78, 0x30, 0x00, 0x1a, 0x00, 0x7c, 0x6c, 0x66, 0xfe, 0x38, 0x3c,
-    0x00, 0x6c, 0x6c, 0x6c, 0x00, 0x60, 0x60, 0x7c, 0x18, 0x7c, 0xc6, 0x7e, 0x10, 0x64, 0x00, 0x38,
-    0x60, 0x30, 0x60, 0x60, 0x38, 0x00, 0xfe, 0x38, 0x66, 0x00, 0x00, 0x30, 0x3c, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x10, 0x10, 0xfe, 0xc6, 0x36, 0x36, 0x00, 0x36, 0xfe, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x10, 0x7c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x0c, 0x6c, 0xf8, 0xfe, 0x1c, 0xc6, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0xff, 0x00, 0x7e, 0x00, 0xff,
-    0x7c, 0xcc, 0x7c, 0xc6, 0x30, 0x38, 0x7c, 0x38, 0xfc, 0xc6, 0x30, 0xc6, 0x30, 0x66, 0x30, 0x30,
-    0x00, 0xd8, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x6c, 0xfc, 0x38, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xc6, 0x00, 0x00, 0x86, 0x6c, 0x66,
-    0xfe, 0x60, 0x60, 0x00, 0x00, 0x60, 0x60, 0xc6, 0x00, 0xc6, 0xc6, 0x7e, 0x30, 0x6c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xc6, 0x00, 0x62, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x38, 0x38, 0x66, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x86, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x7e, 0x66, 0x6c, 0x66, 0x0c, 0xe6, 0x18, 0x18, 0x00, 0x18, 0x00, 0xff, 0x00, 0x5a, 0xc6, 0xff,
-    0xc6, 0xcc, 0xc6, 0xe6, 0x00, 0x00, 0xc6, 0x00, 0x66, 0xc6, 0x00, 0xc6, 0x00, 0x66, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x66, 0x00, 0x7c, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0xcc, 0x7c, 0x7c, 0x1c, 0x7c, 0xc6, 0x7c, 0x38, 0x0c, 0xc6, 0xc2,
-    0x66, 0x60, 0x60, 0x7c, 0x7c, 0x60, 0x60, 0xc6, 0x7c, 0xc6, 0xc6, 0x5a, 0x30, 0x78, 0x00, 0x7c,
-    0x78, 0x38, 0x7c, 0xcc, 0xc6, 0x78, 0x8c, 0xfe, 0x68, 0x7c, 0x00, 0xfe, 0xc2, 0x7c, 0x36, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x6c, 0x6c, 0x62, 0x60, 0xf6, 0x36, 0xfe, 0xf6, 0x0c, 0xfe, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x6c, 0x78, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xc6,
-    0x0c, 0x66, 0x66, 0x62, 0x0c, 0xf6, 0x18, 0x18, 0x7c, 0x18, 0x00, 0xff, 0x00, 0x18, 0xc6, 0xff,
-    0xc6, 0xcc, 0xc6, 0xf6, 0xdc, 0xdc, 0xc0, 0x7c, 0x66, 0xc6, 0xdc, 0xc6, 0xc6, 0x66, 0xfc, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x18, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0xdc, 0x7c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0xcc, 0xc6, 0xc6, 0x18, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0xc6, 0xc0,
-    0x60, 0x60, 0x60, 0xc6, 0xc6, 0x60, 0x60, 0x60, 0xc6, 0xc6, 0xc6, 0x18, 0xfc, 0x70, 0xc6, 0xc6,
-    0x0c, 0x18, 0xc6, 0xcc, 0xc6, 0x0c, 0x18, 0xcc, 0x78, 0xc6, 0x00, 0xcc, 0xc0, 0xc6, 0x6c, 0x36,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0x68, 0x38, 0x06, 0x36, 0x06, 0x06, 0x18, 0xcc, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xc6, 0x0c, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x7c,
-    0x3c, 0xf6, 0x66, 0x68, 0x3c, 0xfe, 0x18, 0x18, 0xc6, 0x18, 0x00, 0xff, 0x00, 0x18, 0xc6, 0xff,
-    0xc6, 0xd8, 0xc6, 0xfe, 0x66, 0x66, 0x60, 0xc6, 0x66, 0xc6, 0x76, 0xc6, 0xc6, 0x66, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x76, 0x7c, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0xcc, 0xc0, 0xc0, 0x38, 0xfe, 0xc6, 0xc6, 0x18, 0x30, 0xfe, 0xc0,
-    0x78, 0x60, 0x60, 0xc6, 0xc6, 0x60, 0x60, 0x38, 0x60, 0xc6, 0xc6, 0x18, 0x30, 0xe0, 0x6c, 0xc0,
-    0x7c, 0x18, 0xc6, 0xcc, 0xfe, 0x7c, 0x30, 0x18, 0x68, 0xfe, 0x00, 0x18, 0xc0, 0x60, 0xd8, 0x1b,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xc6, 0xc6, 0x78, 0x0c, 0xf6, 0x36, 0xf6, 0xfe, 0x30, 0x18, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc6, 0x7c, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x6c, 0x66, 0x66, 0x78, 0x6c, 0xde, 0x18, 0x18, 0xfe, 0xf8, 0x1f, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xcc, 0xc6, 0xde, 0x66, 0x66, 0x38, 0x60, 0x7c, 0xc6, 0x66, 0xc6, 0xc6, 0x3c, 0x30, 0x00,
-    0x7e, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x7c, 0x66, 0x7c, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0x78, 0xc0, 0xc6, 0xc6, 0x18, 0x60, 0xc6, 0xc0,
-    0x60, 0x60, 0x60, 0xc6, 0xc6, 0x60, 0x60, 0x0c, 0x38, 0xc6, 0xc6, 0x18, 0x30, 0xe0, 0x38, 0xc0,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0xcc, 0x60, 0x30, 0x60, 0xc0, 0x00, 0x30, 0xc0, 0x38, 0x6c, 0x36,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xfe, 0xfe, 0x68, 0x06, 0x36, 0x36, 0x36, 0x00, 0x60, 0x30, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xfe, 0xcc, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0xcc, 0x66, 0x66, 0x68, 0xcc, 0xce, 0x18, 0x18, 0xc0, 0x00, 0x18, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xc6, 0xc6, 0xce, 0x66, 0x66, 0x0c, 0x38, 0x6c, 0xc6, 0x60, 0xc6, 0xc6, 0x18, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x6c, 0x60, 0x7c, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0x58, 0xc0, 0xc6, 0xc6, 0x18, 0xc2, 0xc6, 0xc2,
-    0x62, 0x62, 0x60, 0xc6, 0xc6, 0x62, 0x60, 0xc6, 0x0c, 0xc6, 0xc6, 0x18, 0x30, 0x62, 0x6c, 0xc0,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0xcc, 0xc2, 0x60, 0x62, 0xc0, 0x00, 0x60, 0xc2, 0x0c, 0x36, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0x62, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc2, 0x60, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xcc, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0xcc, 0x66, 0x66, 0x62, 0xcc, 0xc6, 0x18, 0x18, 0xc0, 0x00, 0x18, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0x06, 0x0c, 0x66, 0xc6, 0x60, 0xc6, 0xc6, 0x18, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x60, 0x7c, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0x18, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0xc6, 0x66,
-    0x66, 0x66, 0x60, 0xc6, 0xc6, 0x66, 0x60, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x36, 0x66, 0xc6, 0xc6,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0xcc, 0xc6, 0xc6, 0x66, 0xc6, 0x00, 0xc6, 0x66, 0xc6, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0x66, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xcc, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0xcc, 0x6c, 0x6c, 0x66, 0xcc, 0xc6, 0x18, 0x18, 0xc6, 0x00, 0x18, 0xff, 0xff, 0x18, 0xc6, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0xc6, 0xc6, 0x66, 0xc6, 0x60, 0xc6, 0xc6, 0x18, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x60, 0x7c, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x3c, 0x7c, 0x7c, 0x7c, 0x3c, 0xfe, 0xc6, 0x3c,
-    0xfe, 0xfe, 0xf0, 0x7c, 0x7c, 0xfe, 0xf0, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x1c, 0xfe, 0x00, 0x7c,
-    0x76, 0x3c, 0x7c, 0x76, 0xc6, 0x76, 0xfe, 0xfe, 0xfe, 0x7c, 0x00, 0xfe, 0x3c, 0x7c, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xfe, 0x7c, 0x36, 0x36, 0x36, 0x00, 0xfe, 0xfe, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0x76, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x76, 0xf8, 0xf8, 0xfe, 0x76, 0xc6, 0x3c, 0x3c, 0x7c, 0x00, 0x18, 0xff, 0xff, 0x3c, 0x7c, 0x00,
-    0x7c, 0xcc, 0x7c, 0xc6, 0x66, 0x66, 0x7c, 0x7c, 0xf6, 0x7c, 0xf0, 0x7c, 0x7e, 0x3c, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xf6, 0xf0, 0x00, 0x00,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x7c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x0c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x3c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x78, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x38, 0x6c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x7e, 0xd8, 0x7e, 0x00},
+    {0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x66, 0x66, 0x3c, 0x7e, 0x18, 0x7e, 0x18, 0x18},
+    {0xf8, 0xcc, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x7e},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0xf0},
+    {0x00, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xfe},
+    {0x00, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe},
+    {0x00, 0xfe, 0xc6, 0x8c, 0x18, 0x32, 0x66, 0xfe},
+    {0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6},
+    {0x00, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6},
+    {0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6},
+    {0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6},
+    {0x00, 0xfe, 0x82, 0x00, 0x38, 0x00, 0x82, 0xfe},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0},
+    {0x00, 0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe},
+    {0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c},
+    {0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xdc, 0x76},
+    {0x00, 0x7c, 0xc6, 0xfc, 0xc6, 0xfc, 0xc0, 0x80},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x3c, 0x60, 0x38, 0x7c, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x70, 0xc6, 0x7c},
+    {0x00, 0xfe, 0x38, 0x60, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x06},
+    {0x00, 0x78, 0xcc, 0x7e, 0x0c, 0xcc, 0xcc, 0x78},
+    {0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c},
+    {0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xcc, 0xc6},
+    {0x00, 0x78, 0xcc, 0x0c, 0x3c, 0x6c, 0xc6, 0xc6},
+    {0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xf6, 0xc0},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x38},
+    {0x7e, 0x38, 0x60, 0x38, 0xe0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfc, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70},
+    {0x00, 0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0xfe, 0x30, 0x30, 0x36, 0x1c},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x00, 0x00, 0x00, 0x5c, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6},
+    {0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0x00, 0x44, 0xd6, 0xd6, 0xfe, 0x6c},
+    {0x08, 0x10, 0x00, 0x76, 0xdc, 0xd8, 0xdc, 0x76},
+    {0x08, 0x10, 0x00, 0x7c, 0xc6, 0x70, 0xc6, 0x7c},
+    {0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x06},
+    {0x00, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x0e},
+    {0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c},
+    {0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x08, 0x10, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x08, 0x10, 0x00, 0x44, 0xd6, 0xd6, 0xfe, 0x6c},
+    {0x40, 0xb8, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x40, 0xbe, 0x30, 0x30, 0x3c, 0x30, 0x30, 0x3e},
+    {0x40, 0xb6, 0x36, 0x36, 0x3e, 0x36, 0x36, 0x36},
+    {0x40, 0xbc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x40, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c},
+    {0x40, 0xb6, 0x36, 0x36, 0x1c, 0x08, 0x08, 0x1c},
+    {0x40, 0xb8, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee},
+    {0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e},
+    {0x00, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e},
+    {0x00, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x66, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c},
+    {0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00},
+    {0x00, 0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00},
+    {0x00, 0x3e, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x00, 0xfe, 0x66, 0x60, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0xfe, 0x66, 0x60, 0x60, 0x60, 0x60, 0xf0},
+    {0x00, 0x1c, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x00, 0xd6, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0xd6},
+    {0x00, 0x7c, 0xc6, 0x0c, 0x3c, 0x0c, 0xc6, 0x7c},
+    {0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6},
+    {0xc6, 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6},
+    {0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c},
+    {0x00, 0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0xf0, 0xf0, 0xb0, 0x3c, 0x36, 0x36, 0x7c},
+    {0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6},
+    {0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c},
+    {0x00, 0xcc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xcc},
+    {0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xce},
+    {0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x00, 0x06, 0x7c, 0xc0, 0xfc, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x60, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x00, 0x00, 0x00, 0xd6, 0x7c, 0x38, 0x7c, 0xd6},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x1c, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6},
+    {0xc6, 0x7c, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6},
+    {0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0xe6},
+    {0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0xe6},
+    {0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xd6, 0xc6},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x18, 0x0e},
+    {0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x18, 0x0e},
+    {0x36, 0x1c, 0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x7c, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x3c},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0x00, 0x00, 0xf0, 0xb0, 0x3c, 0x36, 0x3c},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xf6, 0xde, 0xf6},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0xfc},
+    {0x00, 0x00, 0x00, 0xfc, 0x06, 0x3e, 0x06, 0xfc},
+    {0x00, 0x00, 0x00, 0xcc, 0xd6, 0xf6, 0xd6, 0xcc},
+    {0x00, 0x00, 0x00, 0x7e, 0xcc, 0x7c, 0x6c, 0xce},
+    {0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x18, 0x0e},
+    {0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x18, 0x0e},
+    {0x18, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x6c, 0x38, 0x7e, 0xc2, 0x70, 0x1c, 0x86, 0xfc},
+    {0x36, 0x1c, 0x00, 0x3e, 0x60, 0x3c, 0x06, 0x7c},
+    {0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x0e},
+    {0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x0e},
+    {0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x6c, 0x38, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0x36, 0x1c, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x0c, 0x18, 0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c},
+    {0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x00, 0xfe, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x00, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x3c, 0x60, 0x30, 0x76, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0x38, 0x6c, 0x38, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x30, 0x36, 0x3c, 0x38, 0x30, 0x70, 0xdc},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0xe6, 0x18, 0x70},
+    {0x00, 0xdc, 0x76, 0x60, 0x60, 0xf0, 0x18, 0x70},
+    {0x00, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c},
+    {0x0c, 0x18, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x38, 0x6c, 0x38, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x0c, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0x00, 0x00, 0x00, 0xec, 0x36, 0x7e, 0xd8, 0x6e},
+    {0x00, 0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x3c, 0x66, 0xc0, 0xce, 0x66, 0x3a, 0x0c, 0x38},
+    {0x0c, 0x18, 0x7e, 0xc2, 0x70, 0x1c, 0x86, 0xfc},
+    {0x06, 0x0c, 0x00, 0x3e, 0x60, 0x3c, 0x06, 0x7c},
+    {0xc6, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x60, 0x66, 0xfc},
+    {0x00, 0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6},
+    {0xfe, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x7e, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x18, 0x18, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0x18, 0x18, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x0c, 0x18, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x00, 0xcc, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18},
+    {0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0x9a, 0x82, 0x7c},
+    {0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0x82, 0x7c},
+    {0x00, 0x30, 0x30, 0x3c, 0x78, 0xf0, 0x30, 0x3e},
+    {0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33},
+    {0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc},
+    {0x0c, 0x18, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x00, 0x78, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xcc},
+    {0xfe, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x0c, 0x18, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x0c, 0x18, 0x00, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6},
+    {0xe6, 0x6c, 0x78, 0x78, 0x6c, 0xe6, 0x18, 0x70},
+    {0x60, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0x18, 0x70},
+    {0xf0, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x70},
+    {0x38, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x70},
+    {0x00, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x18, 0x70},
+    {0xfe, 0x00, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x18, 0x70},
+    {0x00, 0x18, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0xcc, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0xe1, 0x32, 0xe4, 0x3a, 0xf6, 0x2a, 0x5f, 0x86},
+    {0x00, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0xcc},
+    {0x00, 0x18, 0x38, 0x18, 0x18, 0x3c, 0x00, 0x00},
+    {0x00, 0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x12, 0xfe, 0x90, 0xfe, 0x00},
+    {0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8, 0x00},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00},
+    {0x7e, 0x81, 0xb9, 0xa5, 0xb9, 0xa5, 0x81, 0x7e},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x18, 0x0c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7e, 0x81, 0x9d, 0xa1, 0xa1, 0x9d, 0x81, 0x7e},
+    {0x76, 0xdc, 0x7c, 0x06, 0x7e, 0xc6, 0x7e, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x30, 0x7e, 0x0c, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00},
+    {0x7c, 0x82, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0xc6, 0x00, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x1e, 0x21, 0x7c, 0x20, 0x7c, 0x21, 0x1e, 0x00},
+    {0x0c, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x3c, 0x42, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x30, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x0c, 0x06, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0xf0, 0x60, 0x7c, 0x66, 0x7c, 0x60, 0xf0, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0x82, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x60, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0x0c, 0x18, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x00},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff},
+    {0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x38},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x38, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c, 0x0c, 0x38},
+    {0x18, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x78, 0x84, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x30, 0xcc, 0x30, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x18, 0x30, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x18},
+    {0x30, 0x36, 0x3c, 0x38, 0x30, 0x70, 0xdc, 0x00},
+    {0xcc, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x66, 0xcc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x66, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0x70, 0x88, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x0c, 0x18, 0xfe, 0x0c, 0x30, 0x60, 0xfe, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00},
+    {0xcc, 0xd8, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xcc, 0xd8, 0xc0, 0xc0, 0xc0, 0xc0, 0x78, 0x00},
+    {0x78, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0xcc, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0xf6, 0xdc, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xf6, 0xdc, 0xc0, 0xc0, 0xc0, 0xc0, 0x78, 0x00},
+    {0x0c, 0x18, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00},
+    {0x0c, 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x00},
+    {0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xcc, 0x78, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00},
+    {0xcc, 0x78, 0x30, 0xfc, 0x30, 0x30, 0x1e, 0x00},
+    {0x60, 0x6c, 0x78, 0x70, 0x60, 0xe0, 0x7e, 0x00},
+    {0x66, 0x3c, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00},
+    {0x0c, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x0c, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x0c, 0x18, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x18, 0x30, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xd6, 0x18, 0x0e},
+    {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x0f},
+    {0x66, 0x3c, 0xfe, 0x0c, 0x18, 0x60, 0xfe, 0x00},
+    {0x66, 0x3c, 0x00, 0x7e, 0x0c, 0x30, 0x7e, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x1c},
+    {0x00, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x1c},
+    {0x0c, 0x18, 0x00, 0x7e, 0x0c, 0x30, 0x7e, 0x00},
+    {0x66, 0x3c, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x38},
+    {0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xcc, 0x78, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x78, 0xcc, 0x60, 0x30, 0x18, 0xcc, 0x78, 0x30},
+    {0x18, 0xfe, 0xc6, 0x0c, 0x30, 0xc6, 0xfe, 0x00},
+    {0x00, 0x18, 0x00, 0x7c, 0x18, 0x30, 0x7c, 0x00},
+    {0xc6, 0x7c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xcc, 0x78, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x42, 0x3c, 0x66, 0x66, 0x3c, 0x42, 0x00},
+    {0x0c, 0x3e, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00},
+    {0x7c, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x7c, 0x00},
+    {0xcc, 0x78, 0xfc, 0x66, 0x66, 0x66, 0xfc, 0x00},
+    {0xcc, 0x00, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00},
+    {0x96, 0x66, 0x06, 0x7e, 0xc6, 0xc6, 0x7e, 0x00},
+    {0x24, 0x18, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00},
+    {0x18, 0x30, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x78, 0x84, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0xcc, 0x78, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x1c},
+    {0x10, 0x28, 0xd6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x78, 0xcc, 0xf8, 0xcc, 0xf8, 0xc0, 0xc0},
+    {0x0c, 0x18, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00},
+    {0x0c, 0x18, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x66, 0x3c, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x6c, 0x38, 0x7e, 0xe0, 0x38, 0x0e, 0xfc, 0x00},
+    {0x6c, 0x38, 0x7c, 0x40, 0x38, 0x04, 0x7c, 0x00},
+    {0x0c, 0x18, 0xfc, 0xc6, 0xfc, 0xd8, 0xcc, 0x00},
+    {0x0c, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xce, 0xf0, 0xe0, 0xc0, 0xc0, 0x00},
+    {0x66, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xc6, 0xc6, 0x66, 0x3e, 0x0c, 0x78},
+    {0x0c, 0xde, 0xc6, 0x66, 0x3c, 0x18, 0x30, 0x00},
+    {0x30, 0x78, 0x30, 0x30, 0x30, 0x38, 0x18, 0x78},
+    {0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c},
+    {0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x38, 0x6c, 0x6c, 0x38, 0xcc, 0x78},
+    {0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1c},
+    {0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xd8, 0x70, 0xfc, 0xc6, 0xfc, 0xd8, 0xcc, 0x00},
+    {0xd8, 0x70, 0xce, 0xd8, 0xe0, 0xc0, 0xc0, 0x00},
+    {0x60, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x0c},
+    {0xfc, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x6c, 0x00},
+    {0x1c, 0x10, 0x00, 0x7e, 0x60, 0x60, 0x60, 0x00},
+    {0x38, 0x20, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x6c, 0xfe, 0x62, 0x78, 0x60, 0x62, 0xfe, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xf0, 0xc6, 0x7c, 0x00},
+    {0x3c, 0x66, 0xc0, 0xf8, 0xc0, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00},
+    {0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00},
+    {0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70},
+    {0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0xf8, 0x58, 0x5c, 0x5a, 0xdc, 0x00},
+    {0xf8, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0xdc, 0x00},
+    {0x00, 0x00, 0xd8, 0xd8, 0xfc, 0xda, 0xdc, 0x00},
+    {0xd8, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xdc, 0x00},
+    {0x60, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x00},
+    {0xf8, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0x1c, 0x10, 0xc6, 0xd8, 0xf8, 0xcc, 0xc6, 0x00},
+    {0x18, 0xd6, 0xcc, 0xf8, 0xf8, 0xcc, 0xc6, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x38, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10},
+    {0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10},
+    {0x00, 0x00, 0xdc, 0xd6, 0xf6, 0xd6, 0xdc, 0x00},
+    {0xdc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xdc, 0x00},
+    {0x00, 0x00, 0xf0, 0xb0, 0x3c, 0x36, 0x3c, 0x00},
+    {0xf0, 0xf0, 0xb0, 0x3c, 0x36, 0x36, 0x3c, 0x00},
+    {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x3e, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x06, 0x7c, 0xc0, 0x7c, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xfe, 0x66, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3},
+    {0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00},
+    {0x00, 0x30, 0x10, 0x7c, 0xd6, 0x7c, 0x10, 0x38},
+    {0x38, 0x10, 0x7c, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x60, 0x60, 0xf0, 0x00},
+    {0xfe, 0x66, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00},
+    {0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0x00, 0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0xe6, 0x00},
+    {0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00},
+    {0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0xe6, 0x00},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xfe, 0xfe, 0xd6, 0xc6, 0x00},
+    {0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0x7e, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x3c, 0x00},
+    {0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0x7c, 0xd6, 0xd6, 0x00},
+    {0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc, 0x00},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0xfc, 0x00},
+    {0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x00},
+    {0x8f, 0xcd, 0xef, 0xfc, 0xdc, 0xcc, 0xcc, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xf6, 0xde, 0xf6, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1c, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1e, 0xc6, 0x7c, 0x00},
+    {0x78, 0x8c, 0x06, 0x3e, 0x06, 0x8c, 0x78, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00},
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30},
+    {0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7c, 0xc0, 0xc0, 0x7c, 0x30, 0x60},
+    {0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x38, 0x00, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0x70, 0x1c, 0xc6, 0x7c, 0x18, 0x30},
+    {0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x30, 0x60},
+    {0x66, 0x3c, 0x66, 0xc0, 0xce, 0xc6, 0x7c, 0x00},
+    {0x6c, 0x38, 0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0x76, 0xdc, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x7c, 0x82, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x60, 0x30, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x30, 0x18, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x18, 0x0c, 0x78},
+    {0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x18, 0x20, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x7e, 0xc3, 0x3c, 0x06, 0x3e, 0x66, 0x3f, 0x00},
+    {0x60, 0x10, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x00, 0x00, 0x78, 0xc0, 0xc0, 0x78, 0x0c, 0x38},
+    {0x7e, 0xc3, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00},
+    {0x60, 0x10, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x30, 0x7c, 0x18, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0xe0, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf8, 0x00},
+    {0x30, 0x30, 0x00, 0x78, 0xcc, 0xfc, 0xcc, 0x00},
+    {0x18, 0x30, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00},
+    {0x00, 0x00, 0x76, 0x1b, 0x7f, 0xcc, 0x77, 0x00},
+    {0x3e, 0x58, 0x98, 0x9e, 0xf8, 0x98, 0x9e, 0x00},
+    {0x00, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xe0},
+    {0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0x7c, 0x38, 0x7c, 0x00},
+    {0x18, 0x10, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0xe6, 0xfc, 0x00},
+    {0x7a, 0xc4, 0xce, 0xd6, 0xe6, 0x46, 0xbc, 0x00},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0x18, 0xd8, 0x70},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x18, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00},
+    {0x18, 0x30, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x18, 0x30, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x60, 0xd8, 0x24, 0x66, 0x66, 0x24, 0x18, 0x00},
+    {0x18, 0xb2, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x00, 0x30, 0x60, 0xc0, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0x00, 0x00},
+    {0xc3, 0xc6, 0xcc, 0xde, 0x33, 0x66, 0xcc, 0x0f},
+    {0xc3, 0xc6, 0xcc, 0xdb, 0x37, 0x6f, 0xcf, 0x03},
+    {0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0xfc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfc, 0xcc, 0x60, 0x30, 0x60, 0xcc, 0xfc, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xc0},
+    {0xfc, 0x30, 0x78, 0xcc, 0xcc, 0x78, 0x30, 0xfc},
+    {0x1c, 0x30, 0x18, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0x38, 0x60, 0xc0, 0xf8, 0xc0, 0x60, 0x38, 0x00},
+    {0x78, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00},
+    {0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00},
+    {0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0xfc, 0x00},
+    {0x60, 0x30, 0x18, 0x30, 0x60, 0x00, 0xfc, 0x00},
+    {0x18, 0x30, 0x60, 0x30, 0x18, 0x00, 0xfc, 0x00},
+    {0x30, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x30, 0x00},
+    {0x78, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00},
+    {0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x66, 0x76, 0xdc, 0xcc, 0xc6, 0x00},
+    {0x00, 0xf8, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x1c, 0x34, 0xe6, 0x00},
+    {0x00, 0xfe, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00},
+    {0x00, 0xfc, 0x06, 0x06, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0xfc, 0x36, 0x30, 0x30, 0x30, 0x30, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xcc, 0xd6, 0xd6, 0xc6, 0xcc, 0x78, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0xfc, 0x00},
+    {0xc0, 0xfc, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xfe, 0x00},
+    {0x00, 0xdc, 0x76, 0x66, 0xc6, 0xc6, 0xde, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c},
+    {0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x7c, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xcc, 0x78, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x66, 0x36, 0xfc, 0x00},
+    {0x00, 0xfc, 0x46, 0xc6, 0xe6, 0x06, 0x06, 0x06},
+    {0x00, 0xfc, 0x46, 0xc6, 0xe6, 0x06, 0xfe, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x70},
+    {0x00, 0x66, 0x36, 0x1c, 0x0c, 0x06, 0x7e, 0x00},
+    {0x00, 0xfc, 0x06, 0x66, 0x6c, 0x6e, 0x60, 0x60},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xf6, 0xc6, 0x7c, 0x00},
+    {0x00, 0xfc, 0x66, 0x66, 0x66, 0xe6, 0xe6, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0x7e, 0x18, 0x18, 0x00},
+    {0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x00},
+    {0xf8, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7, 0x00},
+    {0x18, 0x30, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c},
+    {0x18, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0xc6},
+    {0x00, 0x3c, 0x6c, 0x6c, 0x36, 0x00, 0x7e, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00},
+    {0x00, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc6, 0x7c},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18},
+    {0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00},
+    {0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00},
+    {0x78, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xcc, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0xc0, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x3c, 0x18, 0x7e, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70, 0x00},
+    {0x0f, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00},
+    {0x38, 0x44, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78},
+    {0x7e, 0x81, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xe1, 0x32, 0x64, 0x3a, 0xf6, 0x2a, 0x5f, 0x82},
+    {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55},
+    {0x60, 0x80, 0x64, 0x8a, 0x08, 0x84, 0x82, 0x7c},
+    {0x60, 0x80, 0x60, 0x80, 0x06, 0x49, 0x84, 0x78},
+    {0x61, 0x89, 0x65, 0x82, 0x05, 0x0f, 0x00, 0x00},
+    {0x61, 0x89, 0x65, 0x85, 0x02, 0x1d, 0x00, 0x00},
+    {0x01, 0x09, 0x05, 0x02, 0x65, 0x8f, 0x60, 0x80},
+    {0x01, 0x09, 0x05, 0x05, 0x62, 0x8d, 0x60, 0x80},
+    {0x01, 0x09, 0x05, 0x02, 0x05, 0x0f, 0x00, 0x00},
+    {0x01, 0x09, 0x05, 0x05, 0x02, 0x1d, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x3f},
+    {0x32, 0x4c, 0x00, 0x08, 0x08, 0x07, 0x00, 0x00},
+    {0x00, 0x68, 0x88, 0x68, 0x88, 0x07, 0x00, 0x00},
+    {0x04, 0x06, 0x04, 0x04, 0x34, 0x44, 0x30, 0x40},
+    {0x00, 0x08, 0x08, 0x08, 0x68, 0x87, 0x60, 0x80},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x10},
+    {0x00, 0x00, 0x28, 0x81, 0x81, 0x7e, 0x00, 0x00},
+    {0x10, 0x00, 0x28, 0x81, 0x81, 0x7e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x44, 0x93, 0x80, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0x44, 0x83, 0x80, 0x7c},
+    {0x00, 0x10, 0x00, 0xfe, 0x44, 0x83, 0x80, 0x7c},
+    {0x00, 0x00, 0x18, 0x3c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x10, 0x08, 0x08, 0x08, 0x00, 0x00},
+    {0x00, 0x3c, 0x42, 0x20, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x4a, 0x4a, 0x34, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x3c, 0x40, 0x38, 0x42, 0x3c, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x42, 0x3c, 0x00, 0x00},
+    {0x00, 0x42, 0x3e, 0x04, 0x04, 0x02, 0x00, 0x00},
+    {0x00, 0x42, 0x42, 0x24, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x24, 0x42, 0x42, 0x00, 0x00},
+    {0x00, 0x38, 0x44, 0x3c, 0x04, 0x02, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x89, 0x87, 0x7e, 0x00, 0x00},
+    {0x00, 0x08, 0x10, 0x18, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x49, 0x49, 0x76, 0x80, 0x00},
+    {0x08, 0x22, 0x00, 0x49, 0x49, 0x76, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x91, 0x7e, 0x80, 0x00},
+    {0x1c, 0x22, 0x10, 0x08, 0x00, 0x08, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x20, 0x1c, 0x20, 0x00, 0x00},
+    {0x32, 0x4c, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00},
+    {0x00, 0x1a, 0x22, 0x1a, 0x22, 0x02, 0x00, 0x00},
+    {0x60, 0x80, 0x66, 0x89, 0x0f, 0x01, 0x11, 0x0e},
+    {0x00, 0x00, 0x0e, 0x11, 0x0e, 0x31, 0x40, 0x3e},
+    {0x0c, 0x10, 0x0c, 0x11, 0x01, 0xfe, 0x00, 0x00},
+    {0x10, 0x18, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x08},
+    {0x14, 0x00, 0x0c, 0x12, 0x11, 0x0e, 0x00, 0x00},
+    {0x00, 0x14, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x29, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x10},
+    {0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00},
+    {0x10, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00},
+    {0x00, 0x04, 0x02, 0x01, 0x21, 0x3f, 0x00, 0x00},
+    {0x10, 0x04, 0x02, 0x01, 0x21, 0x3f, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x22, 0x1c},
+    {0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x22, 0x1c},
+    {0x00, 0x00, 0x00, 0x29, 0x29, 0xd6, 0x00, 0x00},
+    {0x08, 0x22, 0x00, 0x29, 0x29, 0xd6, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x49, 0x51, 0xfe, 0x00, 0x00},
+    {0x00, 0x10, 0x06, 0x49, 0x51, 0xfe, 0x00, 0x00},
+    {0x20, 0x20, 0x20, 0x2e, 0x31, 0xfe, 0x00, 0x00},
+    {0x20, 0x24, 0x20, 0x2e, 0x31, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x12, 0x10, 0xfe, 0x00, 0x00},
+    {0x08, 0x00, 0x0c, 0x12, 0x10, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x40, 0x38, 0x40, 0x42, 0x3c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00},
+    {0x0a, 0x00, 0x06, 0x09, 0x07, 0xfe, 0x00, 0x00},
+    {0x02, 0x04, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x06, 0x09, 0xf9, 0x06, 0x00},
+    {0x00, 0x08, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x0c, 0x12, 0x0d, 0x11, 0xee, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x42, 0x3c},
+    {0x00, 0x00, 0x04, 0x0a, 0x08, 0x84, 0x82, 0x7c},
+    {0x00, 0x00, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x14},
+    {0x00, 0x08, 0x00, 0x0e, 0x91, 0x7e, 0x80, 0x00},
+    {0x00, 0x00, 0x1e, 0x22, 0x1c, 0xf7, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x11, 0x0e, 0x31, 0x40, 0x3e},
+    {0x10, 0x00, 0x3c, 0x40, 0x38, 0x40, 0x42, 0x3c},
+    {0x00, 0x00, 0x0c, 0x12, 0x01, 0x3e, 0x40, 0x40},
+    {0x00, 0x92, 0x6c, 0x00, 0x00, 0xfe, 0x00, 0x00},
+    {0x00, 0x92, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x42, 0x91, 0x81, 0x7e},
+    {0x00, 0x00, 0x0c, 0x12, 0x11, 0x0e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x24, 0xff, 0x24, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x81, 0x7e},
+    {0x00, 0x00, 0x4c, 0x92, 0x8a, 0x79, 0x00, 0x24},
+    {0x08, 0x00, 0x1e, 0x22, 0x1c, 0xf7, 0x00, 0x00},
+    {0x0a, 0x00, 0x06, 0x09, 0x0f, 0x81, 0x81, 0x7e},
+    {0x49, 0xb1, 0x05, 0x02, 0x05, 0x0f, 0x00, 0x00},
+    {0x49, 0xb1, 0x05, 0x05, 0x02, 0x1d, 0x00, 0x00},
+    {0x01, 0x01, 0x01, 0x01, 0x21, 0x41, 0x41, 0x3e},
+    {0x0d, 0x11, 0x0d, 0x91, 0x81, 0x7e, 0x00, 0x00},
+    {0x08, 0x14, 0x10, 0x8c, 0x82, 0x7c, 0x00, 0x28},
+    {0xd6, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0xd6, 0x00},
+    {0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00},
+    {0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x00, 0x00, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0x00, 0x3e, 0x63, 0x78, 0x63, 0x3e, 0x00},
+    {0x48, 0x78, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x0e, 0x0c, 0x0c, 0x0c, 0x6c, 0x3c, 0x1c, 0x00},
+    {0x5c, 0xb6, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x00, 0x00, 0x00},
+    {0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x5f, 0x90, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00},
+    {0xb3, 0xb3, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x00},
+    {0x5e, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00},
+    {0xc3, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x5c, 0xb6, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00},
+    {0xb3, 0xb3, 0x33, 0x1e, 0x0c, 0x0c, 0x1e, 0x00},
+    {0x66, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x00},
+    {0x5c, 0xb6, 0x63, 0x63, 0x36, 0x14, 0x77, 0x00},
+    {0x78, 0x0c, 0x18, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0x08, 0x10, 0x76, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x08, 0x10, 0x7e, 0xc0, 0x7c, 0xc0, 0x7e, 0x00},
+    {0x08, 0x10, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x06},
+    {0x08, 0x10, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00},
+    {0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00},
+    {0x08, 0xd3, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x00},
+    {0x08, 0x10, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x08, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xfe, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xfe, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xfe, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00},
+    {0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00},
+    {0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00},
+    {0xfe, 0xc6, 0x00, 0x38, 0x00, 0xc6, 0xfe, 0x00},
+    {0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0xfc, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0x00},
+    {0xfe, 0xc0, 0x60, 0x30, 0x60, 0xc0, 0xfe, 0x00},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x00},
+    {0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x10, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00},
+    {0x00, 0x00, 0x7a, 0xcc, 0xcc, 0xcc, 0x7a, 0x00},
+    {0x78, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xfc, 0x80},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x7c},
+    {0x7e, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0x7c, 0xc0, 0x7e, 0x00},
+    {0x7e, 0x06, 0x1c, 0x30, 0x60, 0x3e, 0x02, 0x1c},
+    {0x00, 0x00, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x06},
+    {0x7c, 0xc6, 0xe6, 0x3e, 0x86, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00},
+    {0x00, 0x00, 0xc6, 0xdc, 0xf0, 0xdc, 0xc6, 0x00},
+    {0x7c, 0xc6, 0x06, 0x1e, 0x36, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xe6, 0xdd, 0xc0},
+    {0x00, 0x00, 0x82, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0x7e, 0x18, 0x30, 0x3c, 0x60, 0x3e, 0x02, 0x1c},
+    {0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0},
+    {0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00},
+    {0x0c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x1c, 0x56, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0xc2, 0x6c, 0x38, 0x6c, 0x86, 0x00},
+    {0x08, 0x10, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x44, 0xd6, 0xd6, 0xd6, 0x6c, 0x00},
+    {0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0xcb, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x08, 0x10, 0x44, 0xd6, 0xd6, 0xd6, 0x6c, 0x00}};
 
-static const __in_flash("font") uint8_t FONT8_CP855[] = {
-    0x60, 0xfc, 0x1c, 0x38, 0x6c, 0x6c, 0x00, 0x3c, 0x00, 0x7c, 0x30, 0x78, 0xcc, 0x66, 0x18, 0x1e,
-    0x00, 0xf8, 0x00, 0xd8, 0x60, 0xf8, 0x1c, 0x18, 0x6c, 0x38, 0x00, 0xc6, 0x00, 0xdc, 0x00, 0xf0,
-    0x00, 0x3e, 0x06, 0xfe, 0x00, 0xcc, 0x00, 0x1e, 0x00, 0xfe, 0x00, 0x38, 0x00, 0xfe, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0x00, 0xc6, 0x00, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xe6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x1e, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00, 0x18, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xff,
-    0x7e, 0x00, 0xfc, 0x00, 0x7c, 0x00, 0x7e, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xfc, 0x00, 0xf0, 0x8f,
-    0x00, 0x00, 0xc6, 0x00, 0x7c, 0x00, 0xd6, 0x00, 0x78, 0x00, 0xd6, 0x00, 0xc6, 0x3e, 0x00, 0x00,
-    0xf0, 0x60, 0x10, 0x20, 0x00, 0xfe, 0x00, 0x66, 0x00, 0xc6, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x0c,
-    0x00, 0x58, 0x00, 0xd8, 0xf0, 0x60, 0x10, 0xd6, 0x38, 0xc6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xf0,
-    0x00, 0x66, 0x7c, 0x66, 0x00, 0xcc, 0x00, 0x36, 0x00, 0x62, 0x30, 0x10, 0x00, 0x66, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0x00, 0xc6, 0x00, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x38, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x36, 0x00, 0xee, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x18, 0x00, 0xff, 0x00, 0xc6, 0x00, 0xff,
-    0xc6, 0x00, 0x66, 0x00, 0xc6, 0x00, 0x5a, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0x66, 0x00, 0x60, 0xcd,
-    0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0x8c, 0x00, 0xd6, 0x00, 0xc6, 0x61, 0x00, 0x00,
-    0x60, 0x7c, 0x00, 0xfe, 0x7c, 0x62, 0x7c, 0xc0, 0x7e, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0c,
-    0xf8, 0x5c, 0xd8, 0xd8, 0x60, 0x7c, 0xc6, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0xdc, 0xd6, 0xf0, 0xb0,
-    0x78, 0xc6, 0xc0, 0x60, 0xcc, 0xcc, 0x3c, 0x66, 0x7c, 0x68, 0x10, 0x7c, 0xfe, 0x60, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xc6, 0x6c, 0xc6, 0xce, 0xf6, 0x36, 0xfe, 0xf6, 0xc6, 0xce, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xe6, 0x78, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x7c,
-    0x3e, 0x66, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0xc6, 0xfe, 0x18, 0x00, 0xff, 0x00, 0xc6, 0x7e, 0xff,
-    0xc6, 0xfc, 0x66, 0x7c, 0xc0, 0x7e, 0x18, 0xc6, 0xc6, 0xd6, 0x54, 0xfc, 0x66, 0xf0, 0x60, 0xef,
-    0x00, 0xc6, 0xc6, 0x7c, 0x06, 0xd6, 0xd6, 0x7c, 0x06, 0xd6, 0xd6, 0xc6, 0xc6, 0x3c, 0x3c, 0x00,
-    0x7c, 0x66, 0x7e, 0xc0, 0xc6, 0x78, 0xc6, 0xf8, 0xc0, 0x38, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0c,
-    0x58, 0x5a, 0xd8, 0xfc, 0x7c, 0x66, 0xd8, 0xf8, 0xc6, 0x7e, 0xc6, 0xc6, 0xd6, 0xf6, 0xb0, 0x3c,
-    0x0c, 0xc6, 0x7c, 0x7c, 0xcc, 0xcc, 0x6c, 0x66, 0xc6, 0x78, 0x7c, 0xd6, 0x66, 0x60, 0xcc, 0x33,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x6c, 0x38, 0xce, 0xde, 0x06, 0x36, 0x06, 0x06, 0xce, 0xde, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x6c, 0x78, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x66, 0x66, 0xfe, 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0xff, 0x00, 0xc6, 0xc6, 0xff,
-    0xc6, 0x66, 0x66, 0xc6, 0xc0, 0x5a, 0x18, 0xc6, 0x7e, 0xd6, 0x7c, 0x66, 0x7c, 0x60, 0x7c, 0xfc,
-    0x7c, 0xc6, 0xf6, 0xc6, 0x3c, 0xd6, 0xd6, 0xc6, 0x3e, 0xd6, 0xd6, 0xc6, 0x7e, 0x66, 0x3c, 0x00,
-    0x66, 0x66, 0x60, 0xc0, 0xfe, 0x60, 0xf0, 0xc0, 0x7c, 0x0c, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0c,
-    0x5c, 0x5a, 0xfc, 0xda, 0x66, 0x66, 0xf8, 0xf8, 0xc6, 0x06, 0xc6, 0xc6, 0xf6, 0xd6, 0x3c, 0x36,
-    0x7c, 0xfe, 0xc6, 0x66, 0xcc, 0xcc, 0x6c, 0x66, 0xfe, 0x68, 0xd6, 0x7c, 0x60, 0x60, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0xf8, 0x38, 0x6c, 0xde, 0xf6, 0xf6, 0x36, 0xf6, 0xfe, 0xde, 0xf6, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x78, 0x6c, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x66, 0x66, 0xfe, 0xd6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xf8, 0x1f, 0xff, 0xff, 0xc6, 0x7e, 0x00,
-    0x7e, 0x66, 0x7c, 0xc0, 0xc0, 0x18, 0x18, 0xc6, 0x06, 0x7c, 0x54, 0x7c, 0x66, 0x7c, 0x66, 0xdc,
-    0x7c, 0xf6, 0xde, 0x1c, 0x06, 0xd6, 0xd6, 0x1e, 0x06, 0xd6, 0xd6, 0x7e, 0x06, 0x66, 0x3c, 0x00,
-    0x66, 0x66, 0x60, 0xc0, 0xc0, 0x62, 0xc6, 0x66, 0x06, 0xc6, 0x30, 0x30, 0x30, 0x18, 0x18, 0xcc,
-    0x5a, 0x5a, 0xda, 0xda, 0x66, 0x66, 0xcc, 0xcc, 0x7e, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0x36, 0x36,
-    0xcc, 0xc6, 0xc6, 0x66, 0xcc, 0xcc, 0x6c, 0x66, 0xc0, 0x62, 0x7c, 0x10, 0x60, 0x60, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0x6c, 0xc6, 0xf6, 0xe6, 0x36, 0x36, 0x36, 0x00, 0xf6, 0xe6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x6c, 0x66, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0x66, 0x00,
-    0x66, 0x7c, 0x60, 0xc6, 0xc6, 0x18, 0x18, 0x7e, 0xc6, 0xd6, 0xd6, 0x66, 0x66, 0x66, 0x66, 0xcc,
-    0x00, 0xde, 0xde, 0xc6, 0xc6, 0xd6, 0xd6, 0xc6, 0x8c, 0xd6, 0xd6, 0x06, 0x06, 0x3c, 0x3c, 0x00,
-    0x66, 0x6c, 0x60, 0xc0, 0x7c, 0xfe, 0x7c, 0x3c, 0xfc, 0x7c, 0x78, 0x78, 0x78, 0x3c, 0x18, 0x78,
-    0xdc, 0xdc, 0xdc, 0xdc, 0x66, 0x66, 0xc6, 0xc6, 0x06, 0x7c, 0xfe, 0xfe, 0xdc, 0xdc, 0x3c, 0x3c,
-    0x76, 0xc6, 0x7c, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0x7c, 0xfe, 0x10, 0x38, 0xf0, 0xf0, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xc6, 0xc6, 0xe6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xe6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xe6, 0xe6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0xe6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x7c, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0xc6, 0x00,
-    0xc6, 0x60, 0xf0, 0x7c, 0x7c, 0x3c, 0x3c, 0x06, 0x7c, 0xd6, 0xd6, 0xfc, 0xfc, 0xfc, 0x7c, 0xcc,
-    0x00, 0xf6, 0xf6, 0x7c, 0x7c, 0xfe, 0xfe, 0x7c, 0x78, 0xff, 0xff, 0x06, 0x06, 0x86, 0x00, 0x00,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xc6, 0xc3, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7c, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP855[] = {
-    0x00, 0x00, 0x00, 0x0c, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x6c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00,
-    0x60, 0xfc, 0x0c, 0x00, 0x00, 0xfe, 0x00, 0x7c, 0x00, 0x7c, 0x18, 0x3c, 0x00, 0x3c, 0x06, 0x1e,
-    0x00, 0xfc, 0x00, 0xd8, 0x60, 0xfc, 0x0c, 0x00, 0x00, 0xc6, 0x00, 0xee, 0x00, 0xce, 0x00, 0xf8,
-    0x00, 0x1e, 0x06, 0xfe, 0x00, 0xc6, 0x00, 0x1e, 0x00, 0xfe, 0x00, 0x3c, 0x00, 0xfe, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0xc6, 0x00, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x00, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xe6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x1e, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00, 0x18, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xff,
-    0x3f, 0x00, 0xfc, 0x00, 0x7c, 0x00, 0x7e, 0x00, 0xc6, 0x00, 0xdb, 0x00, 0xfc, 0x00, 0xf0, 0xcf,
-    0x00, 0x00, 0xc3, 0x00, 0x7c, 0x00, 0xd6, 0x00, 0x7c, 0x00, 0xd6, 0x00, 0xc6, 0xc6, 0x00, 0x00,
-    0x60, 0x60, 0x18, 0xfe, 0x6c, 0x66, 0x00, 0xc6, 0x00, 0xc6, 0x18, 0x18, 0x6c, 0x18, 0x06, 0x0c,
-    0x00, 0x58, 0x00, 0xd8, 0xf8, 0x60, 0x18, 0xe6, 0x6c, 0xc6, 0x00, 0x6c, 0x00, 0xdb, 0x00, 0xf0,
-    0x00, 0x36, 0x7c, 0x62, 0x00, 0xc6, 0x00, 0x36, 0x00, 0x66, 0x38, 0x18, 0x00, 0x66, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0xc6, 0x00, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x6c, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x66, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x36, 0x00, 0xee, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x18, 0x00, 0xff, 0x00, 0xc6, 0x00, 0xff,
-    0x66, 0x00, 0x66, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0xc6, 0x00, 0xdb, 0x00, 0x66, 0x00, 0x60, 0xcd,
-    0x00, 0x00, 0xc3, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xc6, 0x00, 0xd6, 0x00, 0xc6, 0x60, 0x00, 0x00,
-    0xf8, 0x60, 0x00, 0x66, 0x00, 0x62, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0c,
-    0x00, 0x58, 0x00, 0xd8, 0x60, 0x60, 0x00, 0x66, 0x38, 0xc6, 0x00, 0x6c, 0x00, 0xdb, 0x00, 0xb0,
-    0x00, 0x66, 0xc0, 0x62, 0x00, 0xc6, 0x00, 0x66, 0x00, 0x62, 0x18, 0x7e, 0x00, 0x62, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x6c, 0x00, 0xc6, 0x36, 0x36, 0x00, 0x36, 0x38, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x7c,
-    0x00, 0x66, 0x00, 0xfe, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x18, 0x00, 0xff, 0x00, 0xc6, 0x00, 0xff,
-    0x66, 0x00, 0x66, 0x00, 0xc6, 0x00, 0x5a, 0x00, 0xc6, 0x00, 0x5a, 0x00, 0x66, 0x00, 0x60, 0xef,
-    0x00, 0x00, 0xc3, 0x00, 0x06, 0x00, 0xd6, 0x00, 0x06, 0x00, 0xd6, 0x00, 0xc6, 0x38, 0x7c, 0x00,
-    0x60, 0x60, 0xfe, 0x62, 0x7c, 0x68, 0x7c, 0xc8, 0x7c, 0x60, 0x38, 0x18, 0x38, 0x18, 0x0e, 0x0c,
-    0xfc, 0x58, 0xd8, 0xd8, 0x60, 0x60, 0xe6, 0x6c, 0xc6, 0xc6, 0xee, 0x6c, 0xce, 0xdb, 0xf8, 0x30,
-    0x78, 0xc6, 0xc0, 0x60, 0xc6, 0xc6, 0x1e, 0x66, 0x7c, 0x68, 0x18, 0xdb, 0xfe, 0x60, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0x7c, 0xc6, 0xce, 0x36, 0x36, 0x00, 0x36, 0xc6, 0xce, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xe6, 0x6c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x1e, 0x66, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0xc6, 0xfe, 0x18, 0x00, 0xff, 0x00, 0xc6, 0x7e, 0xff,
-    0x66, 0xdc, 0x66, 0x7c, 0xc0, 0x7e, 0x18, 0xc6, 0xc6, 0xd6, 0x5a, 0xfc, 0x66, 0xf0, 0x60, 0xec,
-    0x00, 0xc6, 0xc3, 0x7c, 0x06, 0xd6, 0xd6, 0x7c, 0x26, 0xd6, 0xd6, 0xc6, 0xc6, 0x6c, 0x7c, 0x00,
-    0x60, 0x6c, 0x62, 0x60, 0xc6, 0x78, 0xc6, 0xf8, 0xc6, 0x38, 0x18, 0x18, 0x18, 0x18, 0x06, 0x0c,
-    0x58, 0x5c, 0xd8, 0xfc, 0x7c, 0x7c, 0x6c, 0x78, 0xc6, 0xc6, 0x6c, 0x6c, 0xdb, 0xfb, 0xb0, 0x3e,
-    0x0c, 0xc6, 0xfc, 0x7c, 0xc6, 0xc6, 0x36, 0x66, 0xc6, 0x78, 0x7e, 0xdb, 0x62, 0x60, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x6c, 0x38, 0xc6, 0xde, 0xf6, 0x36, 0xfe, 0xf6, 0xc6, 0xde, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x6c, 0x78, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xc6,
-    0x36, 0x66, 0xee, 0xd6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0xff, 0x00, 0xc6, 0xc6, 0xff,
-    0x3e, 0x66, 0x66, 0xc6, 0xc0, 0x5a, 0x18, 0xc6, 0xc6, 0xd6, 0x7e, 0x66, 0x7c, 0x60, 0x7c, 0xff,
-    0x00, 0xc6, 0xf3, 0xc6, 0x3c, 0xd6, 0xd6, 0xc6, 0x3e, 0xd6, 0xd6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
-    0x7c, 0x76, 0x60, 0x60, 0xc6, 0x68, 0xc0, 0xc8, 0x60, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x06, 0x0c,
-    0x5c, 0x5a, 0xfc, 0xda, 0x66, 0x66, 0x78, 0x78, 0xc6, 0x7e, 0x6c, 0x6c, 0xdb, 0xdb, 0xb0, 0x33,
-    0x7c, 0xfe, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x66, 0xc6, 0x68, 0xdb, 0xdb, 0x62, 0x60, 0xd8, 0x36,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x38, 0x38, 0xce, 0xf6, 0x06, 0x36, 0x06, 0x06, 0xce, 0xf6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x78, 0x78, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x66, 0x66, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0xff, 0x00, 0xc6, 0xc6, 0xff,
-    0x3e, 0x66, 0x7c, 0xc0, 0xc0, 0x18, 0x18, 0xc6, 0x7e, 0x54, 0x7e, 0x66, 0x66, 0x60, 0x66, 0xdc,
-    0x7e, 0xc6, 0xdb, 0x06, 0x06, 0xd6, 0xd6, 0x06, 0x26, 0xd6, 0xd6, 0xc6, 0x7e, 0xc6, 0x7c, 0x00,
-    0x66, 0x66, 0x60, 0x60, 0xfc, 0x60, 0xf8, 0xc0, 0x38, 0x06, 0x18, 0x18, 0x18, 0x18, 0x06, 0xcc,
-    0x5a, 0x5a, 0xda, 0xda, 0x66, 0x66, 0x78, 0x6c, 0xc6, 0x06, 0x6c, 0x6c, 0xfb, 0xdb, 0x3e, 0x33,
-    0xcc, 0xc6, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x66, 0xfe, 0x60, 0xdb, 0xdb, 0x60, 0x60, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0x38, 0x7c, 0xd6, 0xe6, 0xf6, 0x36, 0xf6, 0xfe, 0xd6, 0xe6, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x78, 0x6c, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x66, 0x66, 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xf8, 0x1f, 0xff, 0xff, 0xc6, 0x7e, 0x00,
-    0x66, 0x66, 0x60, 0xc0, 0xc0, 0x18, 0x18, 0xc6, 0x06, 0x7c, 0x5a, 0x7c, 0x66, 0x7c, 0x66, 0xdc,
-    0x00, 0xf6, 0xdb, 0x3c, 0x06, 0xd6, 0xd6, 0x3e, 0x06, 0xd6, 0xd6, 0xc6, 0x06, 0x6c, 0x7c, 0x00,
-    0x66, 0x66, 0x60, 0x60, 0xc0, 0x62, 0xc0, 0xc0, 0x0c, 0xc6, 0x18, 0x18, 0x18, 0x18, 0x06, 0xcc,
-    0x5a, 0x5a, 0xda, 0xda, 0x66, 0x66, 0x6c, 0x6c, 0xc6, 0x06, 0x6c, 0x6c, 0xdb, 0xdb, 0x33, 0x33,
-    0xcc, 0xc6, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x66, 0xc0, 0x62, 0xdb, 0x7e, 0x60, 0x60, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x38, 0x6c, 0xe6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xe6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x6c, 0x6c, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0x36, 0x00,
-    0x66, 0x66, 0x60, 0xc0, 0xc2, 0x18, 0x18, 0xc6, 0x06, 0x54, 0xdb, 0x66, 0x66, 0x66, 0x66, 0xcc,
-    0x00, 0xde, 0xdb, 0x06, 0x06, 0xd6, 0xd6, 0x06, 0x06, 0xd6, 0xd6, 0x7e, 0x06, 0x38, 0x7c, 0x00,
-    0x66, 0x66, 0x60, 0x60, 0xc6, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0x18, 0x06, 0xcc,
-    0x5a, 0x5a, 0xda, 0xda, 0x66, 0x66, 0x66, 0x66, 0x7e, 0xc6, 0x6c, 0x6c, 0xdb, 0xdb, 0x33, 0x33,
-    0xcc, 0xc6, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x66, 0xc6, 0x66, 0xdb, 0x18, 0x60, 0x60, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x6c, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0x66, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0x66, 0x00,
-    0x66, 0x66, 0x60, 0xc6, 0xc6, 0x18, 0x18, 0x7e, 0xc6, 0xd6, 0xdb, 0x66, 0x66, 0x66, 0x66, 0xcc,
-    0x00, 0xde, 0xdb, 0xc6, 0xc6, 0xd6, 0xd6, 0xc6, 0xc6, 0xd6, 0xd6, 0x06, 0x06, 0x0c, 0x7c, 0x00,
-    0xe6, 0xec, 0xf0, 0xf0, 0x7c, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0x3c, 0x06, 0x78,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0x06, 0x7c, 0xfe, 0xfe, 0xce, 0xce, 0x7e, 0x7e,
-    0x76, 0xc6, 0x7c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xfe, 0x7e, 0x3c, 0xf0, 0xf0, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xe6, 0xe6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0xe6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x7c, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0xc6, 0x00,
-    0xe7, 0x7c, 0xf0, 0x7c, 0x7c, 0x3c, 0x3c, 0x06, 0x7c, 0xd6, 0xdb, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc,
-    0x00, 0xf6, 0xf3, 0x7c, 0x7c, 0xfe, 0xfe, 0x7c, 0x7c, 0xfe, 0xfe, 0x06, 0x06, 0xc6, 0x7c, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xc3, 0xc3, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7c, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xc3, 0x81, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP437[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
 
-static const __in_flash("font") uint8_t FONT8_CP857[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0xc6, 0x30, 0x38, 0x00, 0x7c, 0xc6, 0x30, 0x66, 0x7c, 0x00, 0xc6, 0x38,
-    0x18, 0x00, 0x3e, 0x7c, 0xc6, 0x30, 0x78, 0x60, 0x18, 0xc6, 0xc6, 0x00, 0x38, 0x7c, 0x7c, 0x00,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x66, 0x6c, 0x18, 0x7e, 0x00, 0x63, 0x63, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x30, 0x7c, 0x18, 0x7e, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x76, 0x76, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x38, 0x3c, 0x7c, 0xc6, 0x30, 0x00, 0x0c, 0x3c, 0x66, 0x18, 0x00, 0xff, 0x00, 0x18, 0x30, 0xff,
-    0x30, 0x78, 0x7c, 0x0c, 0x76, 0x76, 0x00, 0x00, 0x00, 0x18, 0x7c, 0x60, 0x30, 0xc6, 0xff, 0x0c,
-    0x00, 0x18, 0x00, 0xe1, 0x7f, 0x3e, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x78, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0x00, 0x18, 0x00, 0x00, 0x82, 0x00, 0x18, 0x00, 0x82, 0x00, 0x38, 0x00,
-    0x30, 0x00, 0x6c, 0x82, 0x00, 0x18, 0x84, 0x30, 0x00, 0x38, 0x00, 0x00, 0x6c, 0xc6, 0xc6, 0x7e,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x3c, 0x38, 0x00, 0x81, 0x00, 0xe6, 0xe6, 0x00, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x60, 0x82, 0x0c, 0x81, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xdc, 0xdc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x6c, 0x6c, 0x82, 0x00, 0x18, 0x00, 0x18, 0x42, 0x00, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0x60, 0xcc, 0x82, 0x06, 0xdc, 0xdc, 0x00, 0x00, 0xc6, 0x30, 0x82, 0x30, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x18, 0x00, 0x32, 0xdb, 0x61, 0x18, 0x00, 0x6c, 0xc6, 0x00, 0x38, 0x0c, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x6c, 0x7c,
-    0xfe, 0x7e, 0xcc, 0x7c, 0x7c, 0x7c, 0x00, 0xcc, 0x3c, 0x6c, 0xc6, 0x7c, 0x64, 0xce, 0x70, 0xc0,
-    0x78, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x66, 0x76, 0x18, 0xb9, 0x00, 0x6c, 0x6c, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x38, 0x38, 0x38, 0x9d, 0xf6, 0x36, 0xfe, 0xf6, 0x7e, 0x3c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x7c, 0x38, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x7c,
-    0x6c, 0x6c, 0xfe, 0xfe, 0xfe, 0x00, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0xff, 0x00, 0x18, 0x3c, 0xff,
-    0x38, 0xcc, 0x38, 0x38, 0x7c, 0x38, 0x66, 0x00, 0x6c, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x30,
-    0x00, 0x7e, 0x00, 0xe4, 0xdb, 0x3c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x38, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc0, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0xc0, 0x18, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xce, 0xf0, 0xd6, 0x1c, 0x7c,
-    0x0c, 0x38, 0xc6, 0xcc, 0xdc, 0xe6, 0xc0, 0xcc, 0x18, 0xa5, 0xfe, 0x7e, 0x7a, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x6c, 0x6c, 0x6c, 0xa1, 0x06, 0x36, 0x06, 0x06, 0xc0, 0x7e, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x06, 0x6c, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x38, 0x3e, 0xc0, 0xc0, 0xc0, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x18, 0xff,
-    0x6c, 0xd8, 0x6c, 0x6c, 0xc6, 0x6c, 0x66, 0x00, 0x38, 0xc6, 0xc6, 0xc6, 0x38, 0xc6, 0x00, 0x00,
-    0x7e, 0x18, 0x00, 0x3a, 0x7b, 0x66, 0x7e, 0x00, 0x38, 0x00, 0x18, 0x18, 0x0c, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0xf8, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xd6, 0x60, 0xe6, 0xc6, 0x06,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0xce, 0xcc, 0x30, 0xb9, 0x06, 0x33, 0x36, 0x3c, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xc6, 0xc6, 0xc6, 0xa1, 0xf6, 0x36, 0xf6, 0xfe, 0xc0, 0x18, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7e, 0xc6, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xff, 0xff, 0x00, 0x18, 0x00,
-    0xc6, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x6c, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0xf6, 0x1b, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0xc0, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0x6c, 0xc6, 0xe6, 0x66, 0xc6, 0x7c, 0xfc,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0xc6, 0x7c, 0x63, 0xa5, 0x06, 0x66, 0x6a, 0x3c, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0xfe, 0xfe, 0xfe, 0x9d, 0x36, 0x36, 0x36, 0x00, 0x7e, 0x7e, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xc6, 0xfe, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0x7c, 0x7e, 0xc0, 0xc0, 0xc0, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0x6c, 0xc6, 0x6c, 0x6c, 0xc6, 0x6c, 0x66, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x7e, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2a, 0x1b, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
-    0x18, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x30, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x7e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x3c, 0x38, 0x7c, 0x7c, 0xfc, 0x7c, 0x18, 0x30,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xce, 0x7c, 0x0c, 0x3e, 0x81, 0x00, 0xcc, 0xdf, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x81, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x7e, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x3c, 0x3c, 0x3c, 0x00, 0x18, 0xff, 0xff, 0x18, 0x3c, 0x00,
-    0x38, 0xcc, 0x38, 0x38, 0x7c, 0x38, 0x7c, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x3c, 0x06, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x5f, 0x1b, 0x86, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x7e, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x7e, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x86, 0x00, 0x7c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP857[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x60, 0x7c, 0x0c, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x76, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x0c, 0x3c, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x30, 0xff,
-    0x18, 0x00, 0x38, 0x30, 0x00, 0x76, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0x38, 0x00, 0x10, 0x00, 0x60, 0x00, 0x18, 0x00, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x10, 0x00, 0x60, 0x30, 0x60, 0x18, 0xc6, 0xc6, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0xdc, 0x66, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc0, 0xc6, 0x06, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xdc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x6c, 0xc6, 0x18, 0x00, 0x18, 0x66, 0x66, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0x30, 0x00, 0x6c, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x30, 0x6c, 0x18, 0x60, 0x00, 0xff, 0x0c,
-    0x00, 0x00, 0x00, 0xe0, 0x00, 0x7c, 0x00, 0x00, 0x38, 0xc6, 0x00, 0x18, 0x7c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0x30, 0x6c, 0x00, 0x38, 0xc6, 0x30, 0x66, 0x3c, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x3e, 0x38, 0xc6, 0x30, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x7c, 0x7c, 0x00,
-    0x30, 0x18, 0x30, 0x30, 0x76, 0x00, 0x7e, 0xcc, 0x30, 0x7c, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x10, 0x10, 0x10, 0x7c, 0x36, 0x36, 0x00, 0x36, 0x18, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x76, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x38, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x18, 0x00, 0xff,
-    0x00, 0x78, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc6, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x30, 0x7f, 0xc6, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x38, 0x06, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x18, 0x38, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x66, 0x00, 0x10, 0x10,
-    0xfe, 0x00, 0x6c, 0x6c, 0x00, 0x18, 0xcc, 0x18, 0x3c, 0x7c, 0xc6, 0x00, 0x64, 0xc6, 0xc6, 0x00,
-    0x60, 0x30, 0x60, 0x60, 0xdc, 0xc6, 0x3c, 0x78, 0x30, 0x82, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x38, 0x38, 0x38, 0x82, 0x36, 0x36, 0x00, 0x36, 0x18, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xdc, 0x38, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x6c, 0x6c, 0xfe, 0xfe, 0xfe, 0x00, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0xff, 0x00, 0x18, 0x3c, 0xff,
-    0x7c, 0xcc, 0x7c, 0x7c, 0xdc, 0x7c, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x18, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x62, 0xdb, 0x60, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x18, 0x3c, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x66, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xc6, 0x00, 0x60, 0xc6, 0xc6, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x00, 0x00, 0xb2, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x6c, 0x6c, 0x6c, 0x9a, 0x36, 0x36, 0x00, 0x36, 0x7c, 0x66, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc6,
-    0x6c, 0x6c, 0x66, 0x66, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0xc6, 0xcc, 0xc6, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x36, 0xdb, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x06, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x6c, 0x6c,
-    0x62, 0xcc, 0xcc, 0x7c, 0x7c, 0x7c, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0x7c, 0xf0, 0xce, 0x60, 0x7c,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xf6, 0xc2, 0x76, 0x30, 0xaa, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xa2, 0xf6, 0x36, 0xfe, 0xf6, 0xc6, 0x3c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x78, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x7c,
-    0x38, 0x3e, 0x62, 0x62, 0x62, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x18, 0x18, 0xff,
-    0xc6, 0xcc, 0xc6, 0xc6, 0x7c, 0xc6, 0x66, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x38, 0xc6, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0xec, 0xdb, 0x6c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x68, 0x76, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xce, 0x60, 0xde, 0x38, 0xc6,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xfe, 0xc0, 0xcc, 0x30, 0xb2, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xa2, 0x06, 0x36, 0x06, 0x06, 0xc0, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x0c, 0xc6, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc6,
-    0x00, 0x00, 0x68, 0x68, 0x68, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0xff, 0x00, 0x00, 0x18, 0xff,
-    0xc6, 0xd8, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x6c, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x18, 0x7b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7c, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xc6, 0xfe,
-    0x78, 0x36, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xde, 0x60, 0xf6, 0x0c, 0x60,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0xc0, 0xcc, 0x60, 0xaa, 0x06, 0x30, 0x30, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xfe, 0xfe, 0xfe, 0xa2, 0xf6, 0x36, 0xf6, 0xfe, 0xc0, 0x7e, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7c, 0xfe, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xc6,
-    0x7c, 0x7e, 0x78, 0x78, 0x78, 0x00, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xff, 0xff, 0x00, 0x18, 0x00,
-    0xc6, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x38, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0xfe, 0x18, 0x00, 0x30, 0x1b, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xfe, 0xc6,
-    0x68, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xf6, 0x60, 0xe6, 0x06, 0x38,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0xde, 0xcc, 0xc0, 0xaa, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x9a, 0x36, 0x36, 0x36, 0x00, 0xc6, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x00, 0x68, 0x68, 0x68, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x38, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x66, 0x1b, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xe6, 0x60, 0xc6, 0xc6, 0x0c,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0xc6, 0xcc, 0xc6, 0x82, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x82, 0x36, 0x36, 0x36, 0x00, 0x7c, 0x7e, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x00, 0x62, 0x62, 0x62, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0x6c, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xce, 0x1b, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x18, 0xc6, 0xc6, 0xc6, 0xe6, 0xc6, 0xc6, 0xc6,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x6e, 0xcc, 0xc6, 0x7c, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x7c, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0xcc, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x7c,
-    0x00, 0x00, 0x66, 0x66, 0x66, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0xff, 0xff, 0x18, 0x18, 0x00,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x9a, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x3c, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0x7c, 0x7c,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x3a, 0x7c, 0x7c, 0x00, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0x00, 0x36, 0x36, 0x36, 0x00, 0x18, 0x18, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x76, 0xc6, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc6,
-    0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x3c, 0x3c, 0x3c, 0x00, 0x18, 0xff, 0xff, 0x18, 0x3c, 0x00,
-    0x7c, 0xcc, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x3c, 0x7e, 0x00, 0x00,
-    0x00, 0x7e, 0x00, 0x3f, 0x1b, 0xc6, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x7c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP737[] = {
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 123, 203, 204, 126, 127};
 
-static const __in_flash("font") uint8_t FONT8_CP860[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0x76, 0x30, 0x30, 0x00, 0x7c, 0x7c, 0x30, 0x0c, 0x7c, 0x30, 0x76, 0x7c,
-    0x18, 0x60, 0x30, 0x7c, 0x76, 0x30, 0x0c, 0x60, 0x30, 0x76, 0xc6, 0x18, 0x38, 0x30, 0xf8, 0x0c,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x3c, 0x38, 0x18, 0x30, 0x00, 0x63, 0x63, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x0e, 0x00, 0x06, 0x1e, 0x00,
-    0x00, 0x18, 0x30, 0x0c, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0xdc, 0x18, 0x60, 0x00, 0x82, 0x82, 0x18, 0x18, 0x82, 0x18, 0xdc, 0x82,
-    0x30, 0x30, 0x18, 0x82, 0xdc, 0x18, 0x18, 0x30, 0x18, 0xdc, 0x00, 0x18, 0x6c, 0x18, 0xcc, 0x18,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x6c, 0x6c, 0x00, 0x18, 0x00, 0xe6, 0xe6, 0x00, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x76, 0x18, 0x6c, 0x6c, 0x18, 0x00, 0x0c, 0x30, 0x7c,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x38, 0x7e, 0x7c, 0xfe, 0x7c, 0x3c, 0x38, 0x00, 0x38, 0x38,
-    0xfe, 0x38, 0xfe, 0x7c, 0x7c, 0x7c, 0xc6, 0xcc, 0x3c, 0x38, 0xc6, 0x7e, 0x64, 0xc6, 0xcc, 0x38,
-    0x78, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x38, 0x00, 0x6c, 0x6c, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x60, 0x7e, 0x66, 0xdc, 0x3c, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x6c, 0xc0, 0xc6, 0xc0, 0xc6, 0x18, 0x6c, 0x38, 0x6c, 0x6c,
-    0xc0, 0x6c, 0xc0, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0x6c, 0xc6, 0xc0, 0xf0, 0xc6, 0xfa, 0x6c,
-    0x0c, 0x38, 0xc6, 0xcc, 0xdc, 0xe6, 0x3e, 0x38, 0x18, 0x6c, 0xfe, 0x7e, 0x7a, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7e, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x0c, 0x36, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0xc6, 0xc0, 0xfe, 0xf8, 0xfe, 0x18, 0xc6, 0x18, 0xc6, 0xc6,
-    0xf8, 0xc6, 0xf8, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xc6, 0xc6,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0x00, 0x00, 0x30, 0xc6, 0x06, 0x33, 0x36, 0x3c, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xcc, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0xec, 0x36, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xfe, 0x7e, 0xc0, 0xc0, 0xc0, 0x18, 0x6c, 0x18, 0xfe, 0xfe,
-    0xc0, 0xfe, 0xc0, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0x6c, 0xc6, 0x7e, 0x66, 0xc6, 0xcf, 0x6c,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x63, 0x6c, 0x06, 0x66, 0x6a, 0x3c, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x3c, 0x6c, 0x6c, 0x66, 0x7e, 0x7e, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0xc6, 0x0c, 0x7c, 0xfe, 0x7c, 0x3c, 0x38, 0x3c, 0xc6, 0xc6,
-    0xfe, 0xc6, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0x76, 0x3c, 0x38, 0x7c, 0x18, 0xfc, 0x7c, 0xc6, 0x38,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xce, 0x00, 0x00, 0x3e, 0x38, 0x00, 0xcc, 0xdf, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x18, 0x38, 0xee, 0x3c, 0x00, 0x60, 0x1e, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xc7, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP860[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x0c, 0x38, 0x00, 0x76, 0x38,
-    0x0c, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x76, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0xc0, 0x00, 0x10, 0x6c, 0x60, 0x18, 0x6c, 0x60, 0xdc, 0x6c,
-    0x18, 0x06, 0x18, 0x10, 0x00, 0x60, 0x30, 0x60, 0x18, 0xdc, 0xc6, 0x18, 0x38, 0x18, 0xf8, 0x30,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0x76, 0x30, 0x10, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0xc6,
-    0x00, 0x10, 0x00, 0x38, 0x76, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x00, 0xcc, 0x00,
-    0x30, 0x18, 0x30, 0x30, 0x76, 0x00, 0x3c, 0x38, 0x30, 0x00, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0xdc, 0x18, 0x38, 0x00, 0x6c, 0xfe, 0x18, 0x3c, 0x7c, 0x18, 0x38, 0x38,
-    0xfe, 0x38, 0xfe, 0x6c, 0xdc, 0x18, 0xc6, 0x18, 0x3c, 0x7c, 0xc6, 0x7c, 0x64, 0xc6, 0xcc, 0x7c,
-    0x60, 0x30, 0x60, 0x60, 0xdc, 0xc6, 0x6c, 0x6c, 0x30, 0x7c, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0x7c,
-    0x00, 0x00, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x66, 0x00, 0x18, 0xc6, 0x00, 0x6c, 0x6c,
-    0x66, 0x6c, 0x66, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x18, 0xc6, 0xc6, 0xc6, 0x60, 0xc6, 0xf8, 0xc6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x6c, 0x00, 0xc6, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x76, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0xc6, 0x7c, 0x7c, 0x62, 0x7c, 0x18, 0xc6, 0x38, 0xc6, 0xc6,
-    0x62, 0xc6, 0x62, 0x7c, 0x7c, 0x7c, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0xc0, 0xf0, 0xc6, 0xc4, 0xc6,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xf6, 0x3e, 0x38, 0x30, 0xc6, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0xdc, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x18, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0x68, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xc6,
-    0x68, 0xc6, 0x68, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xcc, 0xc6,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xfe, 0x00, 0x00, 0x30, 0xc6, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0x00, 0x7e, 0x06, 0x60, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0xfe, 0xc0, 0xfe, 0x78, 0xfe, 0x18, 0xc6, 0x18, 0xfe, 0xfe,
-    0x78, 0xfe, 0x78, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xde, 0xc6,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x60, 0xc6, 0x06, 0x30, 0x30, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0xfe, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x18, 0x18, 0xec, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xc6, 0xc0, 0xc0, 0x68, 0xc0, 0x18, 0xc6, 0x18, 0xc6, 0xc6,
-    0x68, 0xc6, 0x68, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0xc6, 0x60, 0xc6, 0xcc, 0xc6,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x00, 0x00, 0xc0, 0xc6, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xc6, 0xc0, 0xc0, 0x62, 0xc0, 0x18, 0xc6, 0x18, 0xc6, 0xc6,
-    0x62, 0xc6, 0x62, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0x7c, 0x60, 0xc6, 0xcc, 0xc6,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x66, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xc6,
-    0x66, 0xc6, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x18, 0xc6, 0xc6, 0x18, 0xe6, 0xc6, 0xcc, 0xc6,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0xc6, 0x7c, 0x7c, 0xfe, 0x7c, 0x3c, 0x7c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0xc6, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0x76, 0x3c, 0x7c, 0x7c, 0x18, 0xfc, 0x7c, 0xc6, 0x7c,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP861[] = {
-    0x78, 0x00, 0x18, 0x7e, 0xcc, 0x60, 0x30, 0x00, 0x7e, 0xcc, 0x60, 0xf8, 0x30, 0xe0, 0xc6, 0x30,
-    0x18, 0x00, 0x3e, 0x78, 0x00, 0xe0, 0x78, 0x18, 0x18, 0xc6, 0xcc, 0x00, 0x38, 0x7a, 0xf8, 0x0e,
-    0x18, 0x18, 0x18, 0x18, 0x30, 0x18, 0x60, 0x18, 0x30, 0x00, 0x00, 0xc3, 0xc3, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x38, 0x38, 0x1c, 0x00, 0x06, 0x38, 0x78,
-    0x00, 0x30, 0x60, 0x18, 0x0e, 0x18, 0x30, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x78, 0x70, 0x00, 0x00,
-    0xcc, 0xcc, 0x20, 0xc3, 0x00, 0x10, 0x30, 0x00, 0xc3, 0x00, 0x10, 0x6c, 0x7c, 0x7c, 0x38, 0x30,
-    0x30, 0x00, 0x58, 0xcc, 0xcc, 0x60, 0xcc, 0x30, 0x10, 0x38, 0x00, 0x02, 0x6c, 0xc4, 0xcc, 0x1b,
-    0x30, 0x30, 0x30, 0x30, 0x60, 0x30, 0xd8, 0xb2, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x18, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfc, 0xfe, 0xcc, 0x00, 0x66, 0x76, 0x30, 0x6c, 0x6c, 0x30, 0x00, 0x0c, 0x60, 0xcc,
-    0xfc, 0x30, 0x30, 0x30, 0x1b, 0x18, 0x30, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x6c, 0x18, 0x00, 0x00,
-    0xc0, 0x00, 0x78, 0x3c, 0x78, 0x78, 0x78, 0x78, 0x3c, 0x78, 0x78, 0x66, 0x18, 0x66, 0x6c, 0x00,
-    0xfe, 0x76, 0x98, 0x00, 0x00, 0x7c, 0x00, 0xc6, 0xcc, 0x6c, 0xcc, 0x7c, 0x64, 0xce, 0xcc, 0x18,
-    0x78, 0x00, 0x78, 0xcc, 0x38, 0x3c, 0x24, 0xc6, 0x30, 0x00, 0x00, 0xcc, 0xcc, 0x00, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xcc, 0x6c, 0x60, 0x7e, 0x66, 0xdc, 0x78, 0xc6, 0xc6, 0x18, 0x7e, 0x7e, 0xc0, 0xcc,
-    0x00, 0xfc, 0x18, 0x60, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x6c, 0x30, 0x3c, 0x00,
-    0xcc, 0xcc, 0xcc, 0x06, 0x0c, 0x0c, 0x0c, 0xc0, 0x66, 0xcc, 0xcc, 0xf6, 0x7c, 0x66, 0xc6, 0x78,
-    0x62, 0x1b, 0x9e, 0x78, 0x78, 0x66, 0xcc, 0xc6, 0xcc, 0xc6, 0xcc, 0xce, 0xf0, 0xd6, 0xfa, 0x3c,
-    0x0c, 0x70, 0xcc, 0xcc, 0x6c, 0x18, 0x66, 0xc6, 0x60, 0xfc, 0xfc, 0xde, 0xdb, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xf8, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0xcc, 0xfe, 0xc6, 0x7c, 0xdb, 0xdb, 0xf8, 0xcc,
-    0xfc, 0x30, 0x30, 0x30, 0x18, 0x18, 0xfc, 0x00, 0x38, 0x18, 0x00, 0x0c, 0x6c, 0x60, 0x3c, 0x00,
-    0x78, 0xcc, 0xfc, 0x3e, 0x7c, 0x7c, 0x7c, 0xc0, 0x7e, 0xfc, 0xfc, 0x66, 0xcc, 0x7c, 0xfe, 0xcc,
-    0x78, 0x7f, 0xf8, 0xcc, 0xcc, 0x66, 0xcc, 0x7c, 0xcc, 0xc6, 0xcc, 0xd6, 0x60, 0xe6, 0xc6, 0x18,
-    0x7c, 0x30, 0xcc, 0xcc, 0xc6, 0x18, 0x66, 0xc6, 0xc0, 0xc0, 0x0c, 0x33, 0x37, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xcc, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0xcc, 0xc6, 0x6c, 0xcc, 0xdb, 0xdb, 0xc0, 0xcc,
-    0x00, 0x30, 0x60, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x18, 0xec, 0x6c, 0x78, 0x3c, 0x00,
-    0x18, 0xcc, 0xc0, 0x66, 0xcc, 0xcc, 0xcc, 0x78, 0x60, 0xc0, 0xc0, 0x6c, 0xcc, 0x60, 0xc6, 0xfc,
-    0x62, 0xcc, 0x98, 0xcc, 0xcc, 0x7c, 0xcc, 0x38, 0x7c, 0x6c, 0xcc, 0xe6, 0xe6, 0x46, 0xcf, 0x18,
-    0xcc, 0x30, 0xcc, 0xcc, 0xfe, 0x18, 0x24, 0xc6, 0xcc, 0xc0, 0x0c, 0x66, 0x6f, 0x18, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xf8, 0xc0, 0x6c, 0xcc, 0xd8, 0x7c, 0x18, 0x78, 0x6c, 0x6c, 0xcc, 0x7e, 0x7e, 0x60, 0xcc,
-    0xfc, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x30, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x7e, 0x78, 0x3f, 0x7e, 0x7e, 0x7e, 0x0c, 0x3c, 0x78, 0x78, 0xf8, 0x78, 0xf8, 0xc6, 0xcc,
-    0xfe, 0x77, 0x9e, 0x78, 0x78, 0x60, 0x7e, 0x7c, 0x0c, 0x38, 0x78, 0x7c, 0xfc, 0xbc, 0xc6, 0xd8,
-    0x7e, 0x78, 0x78, 0x7e, 0xc6, 0x3c, 0x18, 0x7c, 0x78, 0x00, 0x00, 0xcc, 0xcf, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xc0, 0xc0, 0x6c, 0xfc, 0x70, 0x60, 0x18, 0x30, 0x38, 0xee, 0x78, 0x00, 0x60, 0x38, 0xcc,
-    0x00, 0xfc, 0xfc, 0xfc, 0x18, 0xd8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x80, 0x00, 0x00, 0xc7, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP861[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0x38, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00, 0xf0, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x0c, 0x0c, 0xc6, 0xc6, 0x00, 0x38, 0x00, 0xf8, 0x0e,
-    0x18, 0x0c, 0x18, 0x18, 0xc0, 0x18, 0x30, 0x30, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0x30, 0x6c, 0x00, 0x38, 0xc6, 0x30, 0xf8, 0x34, 0x60, 0x00, 0x38,
-    0x00, 0x00, 0x3e, 0x38, 0xc6, 0x00, 0x78, 0x18, 0x18, 0x00, 0x00, 0x00, 0x6c, 0x7c, 0xcc, 0x1b,
-    0x30, 0x18, 0x30, 0x30, 0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x18, 0x38, 0x00, 0x6c, 0x00, 0x18, 0x6c, 0x18, 0x7c, 0x10, 0x10,
-    0xfe, 0x00, 0x6c, 0x6c, 0x00, 0xe0, 0xcc, 0x42, 0x30, 0x7c, 0xc6, 0x00, 0x64, 0xc6, 0xcc, 0x18,
-    0x60, 0x30, 0x60, 0x60, 0x38, 0x3c, 0x7c, 0xc6, 0x30, 0x00, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0x7c,
-    0x00, 0x00, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x2c, 0x66, 0x38, 0x38,
-    0x66, 0x00, 0xcc, 0x00, 0x00, 0x60, 0x00, 0x66, 0x00, 0xc6, 0xc6, 0x00, 0x60, 0xce, 0xf8, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x6c, 0x18, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x76, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x66, 0x06, 0x66, 0x6c, 0x6c,
-    0x62, 0xec, 0xcc, 0x7c, 0x7c, 0x60, 0xcc, 0x66, 0xc6, 0xc6, 0xc6, 0x7c, 0xf0, 0xde, 0xc4, 0x18,
-    0x78, 0x38, 0x7c, 0xcc, 0xc6, 0x18, 0xc6, 0xc6, 0x30, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0xdc, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x18, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0xc6, 0x66, 0x3e, 0x66, 0xc6, 0xc6,
-    0x68, 0x36, 0xfe, 0xc6, 0xc6, 0x7c, 0xcc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x60, 0xd6, 0xcc, 0x7e,
-    0x0c, 0x18, 0xc6, 0xcc, 0xc6, 0x18, 0xc6, 0xc6, 0x30, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0x00, 0x7e, 0x06, 0x60, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0xf6, 0x66, 0x66, 0xc6, 0xfe,
-    0x78, 0x36, 0xcc, 0xc6, 0xc6, 0x66, 0xcc, 0x3c, 0xc6, 0xc6, 0xc6, 0xce, 0x60, 0xf6, 0xde, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0xfe, 0x18, 0xc6, 0xc6, 0x60, 0xc0, 0x06, 0x30, 0x30, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0xfe, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x18, 0x18, 0xec, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x66, 0x66, 0x66, 0xfe, 0xc6,
-    0x68, 0x7e, 0xcc, 0xc6, 0xc6, 0x66, 0xcc, 0x18, 0xc6, 0xc6, 0xc6, 0xd6, 0x60, 0xe6, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0x18, 0xc6, 0xc6, 0xc0, 0xc0, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x66, 0x66, 0x7c, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0x66, 0xcc, 0x18, 0xc6, 0xc6, 0xc6, 0xe6, 0x60, 0xc6, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0x18, 0xc6, 0xc6, 0xc6, 0xc0, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x66, 0x60, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0x66, 0xcc, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xc6, 0xcc, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0xc6, 0x18, 0xc6, 0xc6, 0xc6, 0xc0, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0xf8, 0x3c, 0xf0, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x3c, 0x7e, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0xc6, 0x3c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP862[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x66, 0xf8, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x0e, 0x00, 0x06, 0x1e, 0x7c,
-    0x00, 0x18, 0x30, 0x0c, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x78, 0x00, 0x00,
-    0xc6, 0xf8, 0x38, 0xfe, 0xfc, 0x70, 0xfc, 0xfc, 0xcc, 0x38, 0xfc, 0xfc, 0xfc, 0xfc, 0xdc, 0x38,
-    0x38, 0xfc, 0x66, 0xfc, 0xfc, 0x66, 0x66, 0xfc, 0xfc, 0xd6, 0xfc, 0x18, 0x6c, 0x3c, 0xcc, 0x1b,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x3c, 0x38, 0x30, 0x00, 0x00, 0xe6, 0xe6, 0x18, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x18, 0x00, 0x0c, 0x30, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0x66, 0x0c, 0x0c, 0x0c, 0x06, 0x18, 0x36, 0x66, 0xd6, 0x0c, 0x06, 0x06, 0x06, 0x66, 0x76, 0x0c,
-    0x0c, 0x66, 0x66, 0x46, 0x46, 0x66, 0x36, 0x06, 0x06, 0xd6, 0x66, 0x7e, 0x64, 0x18, 0xfa, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0xfe, 0xfe, 0x6c, 0x6c, 0x00, 0x33, 0xcc,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xd8, 0xc0, 0xfe, 0x60, 0x7e, 0x66, 0x76, 0x3c, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0x76, 0x0c, 0x0c, 0x0c, 0x06, 0x18, 0x30, 0xc6, 0xd6, 0x0c, 0x06, 0x06, 0x0c, 0xc6, 0x66, 0x0c,
-    0x0c, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x1c, 0x66, 0x06, 0xd6, 0x66, 0xc0, 0xf0, 0x7e, 0xc6, 0x3c,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xe6, 0x6c, 0x6c, 0x30, 0xc0, 0x06, 0x7e, 0x7a, 0x18, 0x66, 0x66,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xcc, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0xdc, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7e, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x38, 0x18, 0x18, 0xec, 0x36, 0x30, 0x3c, 0x00,
-    0xdc, 0x0c, 0x1c, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0xc6, 0x18, 0x06, 0x06, 0x18, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xc6, 0x66, 0xe6, 0xe6, 0x7c, 0x0c, 0x6c, 0x06, 0xf6, 0x66, 0x7e, 0x60, 0x18, 0xcf, 0x18,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0x36, 0x38, 0x30, 0xc0, 0x06, 0x33, 0x36, 0x18, 0xcc, 0x33,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x30, 0x0c, 0x18, 0xd8, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x36, 0x7c, 0x3c, 0x00,
-    0xcc, 0x0c, 0x34, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0xcc, 0x00, 0x06, 0x06, 0x18, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xcc, 0x36, 0x06, 0x06, 0x60, 0x06, 0x6e, 0x06, 0xc6, 0xe6, 0x18, 0x66, 0x7e, 0xc6, 0xd8,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x00, 0x00, 0x60, 0x00, 0x00, 0x66, 0x6a, 0x3c, 0x66, 0x66,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x7c, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x7e, 0x7e, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00,
-    0xc6, 0xfe, 0xe6, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0x78, 0x00, 0x06, 0xfc, 0x18, 0xfe, 0xde, 0x0c,
-    0x7c, 0x78, 0xfc, 0x06, 0xfe, 0x60, 0x7e, 0x60, 0x06, 0x7c, 0xe6, 0x18, 0xfc, 0x18, 0xc7, 0x70,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x7e, 0x7c, 0xc6, 0x00, 0x00, 0xcc, 0xdf, 0x3c, 0x33, 0xcc,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0xc0, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0x60, 0x1e, 0x00,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x70, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0f, 0x06, 0x18, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP771[] = {
+    205, 206, 129, 207, 208, 132, 209, 210, 211, 212, 137, 213, 139, 134, 142, 143,
+    214, 215, 216, 217, 218, 149, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 166, 243,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 174, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262,
+    263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 126, 127};
 
-static const __in_flash("font") uint8_t FONT16_CP862[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0x06, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x66, 0xf8, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0xc6, 0x3c, 0x38, 0x30, 0x00, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x7c,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x66, 0xcc, 0x1b,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xe6, 0x6c, 0x6c, 0x30, 0x00, 0x00, 0x66, 0x66, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0xc6,
-    0xfe, 0x18, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0xc6, 0xf8, 0x38, 0xfe, 0xfc, 0x70, 0xfc, 0xfc, 0xcc, 0x70, 0xfc, 0xfc, 0xfc, 0xfc, 0xdc, 0x38,
-    0x38, 0xfc, 0xee, 0xfc, 0xfc, 0xee, 0xee, 0xfc, 0xfc, 0xd6, 0xfc, 0x7c, 0x64, 0x3c, 0xcc, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x7e, 0x00,
-    0xc6, 0x0c, 0x0c, 0x0c, 0x06, 0x18, 0x36, 0x66, 0xd6, 0x18, 0x06, 0x06, 0x06, 0x66, 0x76, 0x0c,
-    0x0c, 0x66, 0x66, 0x46, 0x46, 0x66, 0x66, 0x06, 0x06, 0xd6, 0x66, 0xc6, 0x60, 0x18, 0xf8, 0x18,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xfe, 0x36, 0x38, 0x30, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0x76, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x18, 0x18, 0x00, 0xdc, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0x66, 0x0c, 0x0c, 0x0c, 0x06, 0x18, 0x36, 0xc6, 0xd6, 0x18, 0x06, 0x06, 0x06, 0xc6, 0x66, 0x0c,
-    0x0c, 0xc6, 0x66, 0xc6, 0xc6, 0x66, 0x66, 0x06, 0x06, 0xd6, 0x66, 0xc0, 0xf0, 0x7e, 0xc4, 0x7e,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x00, 0x00, 0x30, 0xc0, 0x06, 0x30, 0x30, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0xdc, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0xfe, 0x18, 0x06, 0x60, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0x76, 0x0c, 0x0c, 0x0c, 0x06, 0x18, 0x30, 0xc6, 0xc6, 0x18, 0x06, 0x06, 0x0c, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xc6, 0x66, 0xc6, 0xc6, 0x6c, 0x3c, 0x66, 0x06, 0xd6, 0x66, 0xc0, 0x60, 0x18, 0xcc, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x7e, 0x7c, 0x60, 0xc0, 0x06, 0x60, 0x66, 0x18, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x18, 0xec, 0x36, 0x7e, 0x7e, 0x00,
-    0xdc, 0x0c, 0x0c, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0xc6, 0x30, 0x06, 0x06, 0x18, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xc6, 0x66, 0xe6, 0xe6, 0x78, 0x18, 0x64, 0x06, 0xd6, 0x66, 0xc6, 0x60, 0x7e, 0xde, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc0, 0xc0, 0x06, 0xdc, 0xce, 0x3c, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x00, 0x18, 0x18, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xcc, 0x0c, 0x1c, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0xc6, 0x00, 0x06, 0x06, 0x30, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xc6, 0x36, 0x06, 0x06, 0x60, 0x0c, 0x6c, 0x06, 0xf6, 0x66, 0x7c, 0x60, 0x18, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc0, 0x06, 0x86, 0x9a, 0x3c, 0xd8, 0x36,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0xfe, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc6, 0x0c, 0x36, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0xc6, 0x00, 0x06, 0x06, 0x30, 0xc6, 0xc6, 0x0c,
-    0x0c, 0xcc, 0x1c, 0x06, 0x06, 0x60, 0x06, 0x6e, 0x06, 0xc6, 0xe6, 0x18, 0x66, 0x18, 0xcc, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x0c, 0x3f, 0x3c, 0x6c, 0x6c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0x00, 0x7e, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0xc6, 0xfe, 0xe6, 0x0c, 0xc6, 0x18, 0x30, 0xc6, 0x7c, 0x00, 0x06, 0xfc, 0x30, 0xfe, 0xde, 0x0c,
-    0x7c, 0x78, 0xf8, 0x06, 0xfc, 0x60, 0xfe, 0x60, 0x06, 0x7c, 0xe6, 0x18, 0xfc, 0x18, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x18, 0x06, 0x18, 0x36, 0xd8,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0x00,
-    0x00, 0x00, 0x7e, 0x7e, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x70, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP863[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0x7c, 0x30, 0x7f, 0x00, 0x7c, 0xc6, 0x30, 0x66, 0x7c, 0x00, 0x18, 0x3e,
-    0x18, 0x30, 0x38, 0x7c, 0xc6, 0x66, 0x78, 0x60, 0x00, 0x7c, 0xc6, 0x18, 0x38, 0x60, 0x7c, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x78, 0xff, 0x7e, 0x00, 0x00, 0x63, 0x63, 0xe1, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x0e, 0x00, 0x06, 0x1e, 0x00,
-    0x00, 0x18, 0x30, 0x0c, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0x82, 0x18, 0xdb, 0x00, 0x82, 0x00, 0x18, 0x00, 0x82, 0x00, 0x0c, 0x61,
-    0x30, 0x18, 0x44, 0x82, 0x00, 0x00, 0x84, 0x30, 0xc6, 0x82, 0x00, 0x18, 0x6c, 0x30, 0x82, 0x1b,
-    0x18, 0x18, 0x18, 0x30, 0xc6, 0x00, 0x0c, 0x00, 0x81, 0x00, 0x00, 0xe6, 0xe6, 0x32, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x76, 0x18, 0x6c, 0x6c, 0x18, 0x00, 0x0c, 0x30, 0x7c,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x38, 0x78, 0xdb, 0x7e, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x00, 0x38, 0x3c,
-    0xfe, 0xfe, 0xfe, 0x7c, 0xfe, 0x3c, 0x00, 0xcc, 0x7c, 0x38, 0xc6, 0x7e, 0x64, 0xc6, 0x00, 0x18,
-    0x18, 0x30, 0x7c, 0xcc, 0x00, 0x00, 0x38, 0x00, 0x3c, 0x00, 0x00, 0x6c, 0x6c, 0x64, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x60, 0x7e, 0x66, 0xdc, 0x3c, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x6c, 0x0c, 0x7b, 0xc0, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x00, 0x6c, 0x66,
-    0xc0, 0xc0, 0xc0, 0xc6, 0xc0, 0x18, 0xcc, 0xcc, 0xc6, 0x6c, 0xc6, 0xc0, 0xf0, 0xc6, 0xc6, 0x3c,
-    0x00, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0xfe, 0x7e, 0x7a, 0x3a, 0xcc, 0x33,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7e, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x0c, 0x36, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0xc6, 0x7c, 0x1b, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x00, 0xc6, 0x66,
-    0xf8, 0xfc, 0xfc, 0xc6, 0xfc, 0x18, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x78, 0x00, 0x18, 0xc0, 0x06, 0x33, 0x36, 0xf6, 0x66, 0x66,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xcc, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0xec, 0x36, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xfe, 0xcc, 0x1b, 0x7e, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0xff, 0xfe, 0x3c,
-    0xc0, 0xc0, 0xc0, 0xc6, 0xc0, 0x18, 0xcc, 0xcc, 0x7c, 0x6c, 0xc6, 0x7e, 0x66, 0xc6, 0xc6, 0xd8,
-    0x18, 0x00, 0xc6, 0xcc, 0x00, 0x18, 0x00, 0x00, 0x18, 0xc0, 0x06, 0x66, 0x6a, 0x2a, 0x33, 0xcc,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x3c, 0x6c, 0x6c, 0x66, 0x7e, 0x7e, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x76, 0x7c, 0x76, 0xc6, 0x76, 0x1b, 0x0c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x00, 0xc6, 0x86,
-    0xfe, 0xfe, 0xfe, 0x7c, 0xfe, 0x3c, 0x76, 0x76, 0xc6, 0x38, 0x7c, 0x18, 0xfc, 0x7c, 0x7c, 0x70,
-    0x18, 0x00, 0x7c, 0x76, 0x00, 0x0c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xcc, 0xdf, 0x5f, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x18, 0x38, 0xee, 0x3c, 0x00, 0x60, 0x1e, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x7c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x82, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP863[] = {
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x0c, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x6c, 0x60, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0c, 0x7c,
-    0x18, 0x18, 0x6c, 0x10, 0xc6, 0x66, 0x30, 0x60, 0x00, 0x6c, 0xc6, 0x18, 0x38, 0x18, 0x6c, 0x0e,
-    0x18, 0x0c, 0x18, 0x18, 0xc6, 0x00, 0x7c, 0xff, 0x66, 0x00, 0x00, 0x60, 0x60, 0xe0, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xc6, 0x30, 0x00, 0x00, 0x38, 0xc6, 0x30, 0x66, 0x3c, 0x00, 0x06, 0xc6,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x00, 0x00, 0x1b,
-    0x18, 0x18, 0x30, 0x30, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x30, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x10, 0x18, 0x7f, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x66, 0x00, 0x10, 0x60,
-    0xfe, 0xfe, 0xfe, 0x6c, 0xfe, 0x3c, 0xcc, 0x18, 0x00, 0x7c, 0xc6, 0x7c, 0x64, 0xc6, 0xc6, 0x18,
-    0x18, 0x30, 0x60, 0x60, 0x00, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x00, 0x62, 0x62, 0xe2, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0x7c,
-    0x00, 0x00, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x38, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x66, 0x66, 0x66, 0x00, 0x66, 0x18, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x60, 0xc6, 0xc6, 0x18,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x66, 0x66, 0x36, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x76, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x6c, 0x78, 0xdb, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x00, 0x6c, 0x6c,
-    0x62, 0x62, 0x62, 0x7c, 0x62, 0x18, 0xcc, 0xcc, 0x7c, 0xc6, 0xc6, 0xc0, 0xf0, 0xc6, 0xc6, 0x18,
-    0x18, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x6c, 0x6c, 0xec, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0xdc, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x18, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0xc6, 0x0c, 0xdb, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x00, 0xc6, 0xc6,
-    0x68, 0x68, 0x68, 0xc6, 0x68, 0x18, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xc6, 0x7e,
-    0x00, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x7c, 0x00, 0x18, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0x00, 0x7e, 0x06, 0x60, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0xc6, 0x7c, 0x7b, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x00, 0xc6, 0xc6,
-    0x78, 0x78, 0x78, 0xc6, 0x78, 0x18, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc0, 0x60, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x06, 0x30, 0x30, 0x30, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0xfe, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x18, 0x18, 0xec, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xfe, 0xcc, 0x1b, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x00, 0xfe, 0x6c,
-    0x68, 0x68, 0x68, 0xc6, 0x68, 0x18, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x60, 0xc6, 0xc6, 0x18,
-    0x18, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x06, 0x60, 0x66, 0x66, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xc6, 0xcc, 0x1b, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x00, 0xc6, 0x38,
-    0x62, 0x62, 0x62, 0xc6, 0x62, 0x18, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x7c, 0x60, 0xc6, 0xc6, 0x18,
-    0x18, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x06, 0xdc, 0xce, 0xce, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xc6, 0xcc, 0x1b, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x00, 0xc6, 0x0c,
-    0x66, 0x66, 0x66, 0xc6, 0x66, 0x18, 0xcc, 0xcc, 0x7c, 0xc6, 0xc6, 0x18, 0xe6, 0xc6, 0xc6, 0xd8,
-    0x18, 0x00, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x06, 0x86, 0x9a, 0x9a, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0xc6, 0x76, 0x1b, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x00, 0xc6, 0xc6,
-    0xfe, 0xfe, 0xfe, 0x7c, 0xfe, 0x3c, 0x76, 0x76, 0xc6, 0x7c, 0x7c, 0x18, 0xfc, 0x7c, 0x7c, 0x70,
-    0x18, 0x00, 0x7c, 0x76, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0c, 0x3f, 0x3f, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x7c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x06, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x06, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP864[] = {
-    0x00, 0x00, 0x00, 0x0f, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0x78, 0x00, 0x06, 0x18, 0x63, 0x63, 0x00, 0x60, 0x60, 0x61, 0x61, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x32, 0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x1c,
-    0x18, 0x00, 0x32, 0x00, 0x60, 0x00, 0x0c, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x20, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x0a, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x49, 0x49, 0x01, 0x0d, 0x08, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x0c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xcc, 0x00, 0x0c, 0x18, 0xe6, 0xe6, 0x00, 0x80, 0x80, 0x89, 0x89, 0x09, 0x09, 0x09, 0x09, 0x00,
-    0x00, 0x00, 0x4c, 0x6c, 0x00, 0x68, 0x06, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0x3c, 0x4a, 0x3c, 0x18, 0x42, 0x42, 0x18, 0x38, 0x00, 0x08, 0x00, 0x22, 0x00, 0x22,
-    0x18, 0x00, 0x4c, 0x1a, 0x80, 0x00, 0x10, 0x18, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x04,
-    0x04, 0x00, 0x02, 0x00, 0x22, 0x00, 0x10, 0x20, 0x24, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x92, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0x01, 0x11, 0x14, 0x00, 0x00,
-    0x6c, 0x00, 0x00, 0x0c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xd8, 0x7e, 0x7e, 0x7e, 0x6c, 0x6c, 0x76, 0x64, 0x60, 0x65, 0x65, 0x05, 0x05, 0x05, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x64, 0xc6, 0x88, 0x04, 0x08, 0x08, 0x00, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x10, 0x42, 0x4a, 0x40, 0x3c, 0x3e, 0x42, 0x18, 0x44, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x10,
-    0x7e, 0x1c, 0x00, 0x22, 0x66, 0x0e, 0x0c, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x18, 0x18, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x20, 0x20, 0x0c, 0x0c, 0x18, 0x00, 0x18, 0xc6, 0x3c,
-    0x00, 0x0e, 0x06, 0x02, 0x01, 0x00, 0x00, 0x12, 0x06, 0x04, 0x00, 0x00, 0x1e, 0x0e, 0x3c, 0x0c,
-    0x6c, 0x6c, 0x00, 0x0c, 0x00, 0x00, 0x4c, 0x1e, 0x06, 0x05, 0x05, 0x01, 0x0d, 0x10, 0x3c, 0x00,
-    0x6c, 0x00, 0x00, 0xec, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xcc, 0xdb, 0xdb, 0x18, 0x7e, 0x7a, 0xdc, 0x8a, 0x80, 0x82, 0x85, 0x02, 0x05, 0x02, 0x05, 0x00,
-    0x00, 0x00, 0x08, 0xf0, 0x7c, 0x68, 0x04, 0x08, 0x08, 0x81, 0x81, 0x81, 0x08, 0xfe, 0xfe, 0xfe,
-    0x3c, 0x08, 0x20, 0x34, 0x38, 0x66, 0x04, 0x24, 0x24, 0x3c, 0x89, 0x18, 0x49, 0x49, 0x0e, 0x08,
-    0xc0, 0x20, 0x08, 0x1a, 0x89, 0x11, 0x11, 0x10, 0x01, 0x12, 0x01, 0x29, 0x24, 0x24, 0x24, 0x01,
-    0x01, 0x00, 0x00, 0x29, 0x29, 0x49, 0x49, 0x2e, 0x2e, 0x12, 0x12, 0x00, 0xfe, 0x00, 0x6c, 0x40,
-    0x00, 0x09, 0x09, 0x01, 0x01, 0x06, 0x01, 0x0d, 0x09, 0x0a, 0x01, 0x0e, 0x22, 0x11, 0x40, 0x12,
-    0x00, 0x00, 0x00, 0x12, 0x18, 0x00, 0x92, 0x22, 0x09, 0x02, 0x05, 0x01, 0x91, 0x8c, 0x3c, 0x00,
-    0x38, 0x18, 0x18, 0x6c, 0xaa, 0xff, 0x18, 0xff, 0xf8, 0xff, 0x1f, 0xff, 0xf8, 0x1f, 0x1f, 0xf8,
-    0xc6, 0xdb, 0xdb, 0x18, 0x33, 0x36, 0x00, 0x08, 0x06, 0x05, 0x02, 0x65, 0x62, 0x05, 0x02, 0x20,
-    0x00, 0x7e, 0x08, 0x60, 0xc6, 0x88, 0x34, 0x68, 0x08, 0x81, 0x81, 0x81, 0x10, 0x44, 0x44, 0x44,
-    0x18, 0x08, 0x10, 0x10, 0x42, 0x42, 0x04, 0x18, 0x42, 0x04, 0x87, 0x00, 0x49, 0x49, 0x91, 0x00,
-    0x7e, 0x1c, 0x08, 0x22, 0x0f, 0x0e, 0x01, 0x10, 0x01, 0x11, 0x01, 0x01, 0x03, 0x03, 0x03, 0x21,
-    0x21, 0x01, 0x01, 0x29, 0x29, 0x51, 0x51, 0x31, 0x31, 0x10, 0x10, 0x00, 0x06, 0x7e, 0x38, 0x38,
-    0x00, 0x07, 0x07, 0x01, 0x01, 0x09, 0x01, 0x11, 0x0f, 0x08, 0x01, 0x91, 0x1c, 0x0e, 0x38, 0x01,
-    0x00, 0x00, 0x42, 0x11, 0x24, 0x00, 0x8a, 0x1c, 0x0f, 0x05, 0x02, 0x21, 0x81, 0x82, 0x3c, 0x00,
-    0x00, 0x00, 0x18, 0x3c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xc6, 0x7e, 0x7e, 0x00, 0x66, 0x6a, 0x76, 0x84, 0x49, 0x0f, 0x1d, 0x8f, 0x8d, 0x0f, 0x1d, 0x40,
-    0x00, 0x00, 0x07, 0x66, 0xc6, 0x07, 0x44, 0x87, 0x07, 0x7e, 0x7e, 0x7e, 0x18, 0x93, 0x83, 0x83,
-    0x00, 0x08, 0x10, 0x10, 0x3c, 0x3c, 0x02, 0x18, 0x42, 0x02, 0x7e, 0x18, 0x76, 0x76, 0x7e, 0x08,
-    0x18, 0x20, 0x08, 0x02, 0x01, 0x31, 0xfe, 0x10, 0xfe, 0x0e, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x3f,
-    0x3f, 0x01, 0x01, 0xd6, 0xd6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x18, 0x06, 0x00, 0x6c, 0x40,
-    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0xfe, 0xee, 0x01, 0x84, 0xfe, 0x7e, 0xf7, 0x31, 0x40, 0x3e,
-    0xfe, 0x00, 0x91, 0x0e, 0xff, 0x87, 0x79, 0xf7, 0x81, 0x0f, 0x1d, 0x41, 0x7e, 0x7c, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x1c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xcc, 0x00, 0x60, 0x7e, 0xcc, 0xdf, 0xdc, 0x82, 0x84, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0xc6, 0x42,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x42, 0x82, 0x00, 0x80, 0x00, 0x40, 0x42, 0x40,
-    0x00, 0x00, 0x81, 0x00, 0x24, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0xc0, 0x00, 0x0f, 0x06, 0x00, 0x7c, 0x78, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x3f,
-    0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x40, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x3e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7c, 0x14, 0x00, 0x00, 0x3e, 0x3c, 0x40,
-    0x00, 0x00, 0x7e, 0x00, 0x18, 0x7e, 0x24, 0x00, 0x7e, 0x00, 0x00, 0x3e, 0x00, 0x28, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP775[] = {
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 27, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 42, 43, 44, 318, 319, 320,
+    48, 49, 50, 51, 52, 244, 246, 263, 265, 57, 58, 59, 60, 267, 269, 63,
+    64, 65, 66, 67, 68, 69, 271, 273, 72, 73, 74, 75, 76, 77, 78, 275,
+    245, 247, 264, 266, 268, 270, 272, 274, 276, 89, 90, 91, 92, 93, 94, 95,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336,
+    337, 193, 338, 339, 340, 341, 198, 342, 200, 201, 202, 343, 344, 204, 126, 127};
 
-static const __in_flash("font") uint8_t FONT16_CP864[] = {
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x60, 0x00, 0x12, 0x61, 0x02, 0x01, 0x02, 0x01, 0x00,
-    0x00, 0x00, 0x32, 0x00, 0x00, 0x68, 0x10, 0x08, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x3c, 0x4a, 0x18, 0x18, 0x42, 0x42, 0x18, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3c,
-    0x00, 0x00, 0x32, 0x34, 0x0c, 0x00, 0x0c, 0x10, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x20, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00,
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x65, 0x65, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x80, 0x60, 0x0a, 0x89, 0x12, 0x09, 0x12, 0x09, 0x00,
-    0x00, 0x00, 0x4c, 0x00, 0x00, 0x88, 0x18, 0x08, 0x08, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x42, 0x4a, 0x20, 0x3c, 0x3e, 0x42, 0x18, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x66,
-    0x00, 0x00, 0x4c, 0x46, 0x10, 0x00, 0x10, 0x18, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x24, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x0a, 0x04, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x99, 0x99, 0x01, 0x0d, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x0f, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0x78, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x60, 0x80, 0x0a, 0x69, 0x12, 0x09, 0x12, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x68, 0x18, 0x08, 0x08, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x40, 0x74, 0x40, 0x24, 0x02, 0x24, 0x18, 0x44, 0x00, 0x00, 0x00, 0x28, 0x00, 0x30,
-    0x18, 0x00, 0x00, 0x36, 0x0c, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04,
-    0x04, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x11, 0x00, 0x00, 0x00,
-    0x6c, 0x00, 0x00, 0x0c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xcc, 0x00, 0x03, 0x18, 0x66, 0x66, 0x00, 0x80, 0x60, 0x6a, 0x85, 0x0a, 0x05, 0x0a, 0x05, 0x00,
-    0x00, 0x00, 0x08, 0x6c, 0x00, 0x88, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x08, 0x08, 0x40, 0x40, 0x38, 0x66, 0x04, 0x24, 0x24, 0x3c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18,
-    0x18, 0x18, 0x10, 0x44, 0x10, 0x1e, 0x10, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1e, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x1c, 0x00, 0x09, 0x09, 0x01, 0x0d, 0x00, 0x00, 0x00,
-    0x6c, 0x00, 0x00, 0x0c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xcc, 0x00, 0x06, 0x18, 0x6c, 0x6c, 0x76, 0x0c, 0x80, 0x86, 0x05, 0x0a, 0x05, 0x0a, 0x05, 0x00,
-    0x00, 0x00, 0x08, 0x64, 0xc6, 0x08, 0x10, 0x08, 0x08, 0x42, 0x42, 0x42, 0x08, 0x00, 0x00, 0x00,
-    0x1c, 0x08, 0x20, 0x20, 0x10, 0x42, 0x04, 0x24, 0x24, 0x04, 0x4e, 0x10, 0x02, 0x02, 0x0e, 0x08,
-    0x7c, 0x20, 0x18, 0x04, 0x06, 0x21, 0x02, 0x10, 0x02, 0x12, 0x02, 0x02, 0x18, 0x18, 0x18, 0x01,
-    0x01, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x0e, 0x2e, 0x2e, 0x12, 0x12, 0x18, 0x00, 0x18, 0xc6, 0x22,
-    0x00, 0x0e, 0x0e, 0x02, 0x01, 0x00, 0x02, 0x12, 0x06, 0x0c, 0x02, 0x0e, 0x22, 0x21, 0x22, 0x0c,
-    0x00, 0x00, 0x00, 0x12, 0x14, 0x00, 0x00, 0x22, 0x0e, 0x05, 0x05, 0x01, 0x51, 0x0c, 0x7e, 0x00,
-    0x38, 0x00, 0x00, 0x0c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xcc, 0x7e, 0x7e, 0x7e, 0x18, 0x18, 0xdc, 0x12, 0x00, 0x6c, 0x05, 0x0c, 0x05, 0x0c, 0x05, 0x20,
-    0x00, 0x00, 0x08, 0x60, 0x7c, 0x08, 0x10, 0x08, 0x08, 0x81, 0x81, 0x81, 0x10, 0x00, 0x00, 0x00,
-    0x08, 0x08, 0x20, 0x20, 0x20, 0x42, 0x04, 0x18, 0x24, 0x04, 0x89, 0x18, 0x91, 0x91, 0x91, 0x00,
-    0xc6, 0x18, 0x10, 0x04, 0x09, 0x12, 0x01, 0x10, 0x01, 0x21, 0x01, 0x01, 0x24, 0x24, 0x24, 0x01,
-    0x01, 0x02, 0x02, 0x21, 0x21, 0x51, 0x51, 0x31, 0x31, 0x10, 0x10, 0x00, 0xfe, 0x00, 0x6c, 0x20,
-    0x00, 0x09, 0x09, 0x01, 0x01, 0x06, 0x01, 0x0d, 0x09, 0x12, 0x01, 0x91, 0x14, 0x12, 0x20, 0x12,
-    0x00, 0x00, 0x42, 0x21, 0x24, 0x00, 0x00, 0x14, 0x49, 0x06, 0x05, 0x01, 0x81, 0x12, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x0c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18,
-    0xd8, 0xdb, 0xdb, 0x18, 0x30, 0x36, 0x00, 0x10, 0x06, 0x8a, 0x06, 0x1a, 0x06, 0x1a, 0x06, 0x40,
-    0x00, 0x00, 0x08, 0xf0, 0xc6, 0x08, 0x10, 0x08, 0x08, 0x81, 0x81, 0x81, 0x18, 0xfc, 0xfc, 0xfc,
-    0x00, 0x08, 0x10, 0x10, 0x42, 0x42, 0x02, 0x18, 0x42, 0x02, 0x87, 0x00, 0x49, 0x49, 0x61, 0x00,
-    0xc0, 0x20, 0x10, 0x04, 0x09, 0x0c, 0x01, 0x10, 0x01, 0x21, 0x01, 0x01, 0x03, 0x03, 0x03, 0x21,
-    0x21, 0x01, 0x01, 0x49, 0x49, 0x61, 0x61, 0x21, 0x21, 0x08, 0x08, 0x00, 0x06, 0x7e, 0x38, 0x10,
-    0x00, 0x07, 0x07, 0x01, 0x01, 0x09, 0x01, 0x11, 0x09, 0x10, 0x01, 0x61, 0x08, 0x0c, 0x10, 0x01,
-    0x00, 0x00, 0x81, 0x21, 0x18, 0x00, 0x06, 0x08, 0x87, 0x0d, 0x06, 0x01, 0x81, 0x10, 0x7e, 0x00,
-    0x00, 0x18, 0x18, 0x0c, 0xaa, 0xff, 0x18, 0xff, 0xf8, 0xff, 0x1f, 0xff, 0xf8, 0x1f, 0x1f, 0xf8,
-    0xcc, 0xdb, 0xdb, 0x18, 0x6e, 0x6e, 0x76, 0x4c, 0x49, 0x1e, 0x3d, 0x3e, 0x3d, 0x3e, 0x3d, 0x40,
-    0x00, 0xfe, 0x07, 0x60, 0xc6, 0x07, 0x10, 0x07, 0x07, 0x7e, 0x7e, 0x7e, 0x18, 0x23, 0x23, 0x23,
-    0x00, 0x08, 0x10, 0x10, 0x3c, 0x3c, 0x02, 0x18, 0x42, 0x02, 0x7e, 0x18, 0x76, 0x76, 0x7e, 0x08,
-    0xc0, 0x00, 0x10, 0x04, 0x07, 0x13, 0xfe, 0x10, 0xfe, 0x1e, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x3e,
-    0x3e, 0x01, 0x01, 0xb6, 0xb6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x18, 0x06, 0x00, 0x38, 0x3c,
-    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0xfe, 0xee, 0x07, 0x4c, 0xfe, 0x7e, 0xf7, 0x13, 0x3c, 0x1e,
-    0xff, 0x00, 0x91, 0x1e, 0xff, 0x0f, 0x49, 0xf7, 0x81, 0x1f, 0x3d, 0x41, 0x7e, 0x4c, 0x7e, 0x00,
-    0x00, 0x00, 0x18, 0x6c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xc6, 0xdb, 0xf3, 0x00, 0x13, 0x1a, 0xdc, 0x82, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x60, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x00,
-    0xc6, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x18, 0x6c, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x82, 0x00, 0x40, 0x00, 0x20, 0x40, 0x20,
-    0x00, 0x00, 0x81, 0x00, 0x18, 0x84, 0x84, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x82, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x6c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xc6, 0x7e, 0x7e, 0x00, 0x06, 0x3f, 0x00, 0x82, 0x82, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x60, 0xc6, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x00,
-    0x7c, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0xc6, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x00, 0x40, 0x00, 0x40, 0x80, 0x20,
-    0x00, 0x00, 0x42, 0x00, 0x24, 0x82, 0x82, 0x00, 0x7e, 0x00, 0x00, 0x81, 0x00, 0x82, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x3c, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xc6, 0x00, 0x60, 0x7e, 0x0c, 0x06, 0x00, 0x84, 0x82, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x66, 0x7c, 0x00, 0x20, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x88, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x22, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x84, 0x14, 0x80, 0x00, 0x80, 0x80, 0x20,
-    0x00, 0x00, 0x3c, 0x00, 0x14, 0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x84, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x1c, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0xdc, 0x00, 0xc0, 0x00, 0x1f, 0x06, 0x00, 0x78, 0x7c, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x1f,
-    0x00, 0x00, 0x00, 0xfc, 0xc6, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x78, 0x00, 0x00, 0x00, 0x80, 0x80, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x41,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x82, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x7c, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP850[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 345, 18, 19, 20, 21, 22, 23, 24, 25, 26, 303, 28, 346, 347, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 348, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 349, 350, 351, 352, 57, 58, 59, 60, 27, 29, 63,
+    64, 65, 66, 67, 68, 69, 353, 354, 72, 73, 74, 75, 76, 77, 78, 355,
+    356, 357, 358, 359, 360, 361, 362, 363, 364, 89, 90, 91, 92, 365, 366, 95,
+    367, 97, 368, 369, 370, 371, 102, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+    381, 113, 382, 339, 383, 341, 118, 384, 120, 385, 122, 386, 387, 125, 126, 127};
 
-static const __in_flash("font") uint8_t FONT8_CP865[] = {
-    0x7c, 0xcc, 0x0c, 0x7c, 0xc6, 0x30, 0x30, 0x00, 0x7c, 0xc6, 0x30, 0x66, 0x7c, 0x30, 0xc6, 0x38,
-    0x18, 0x00, 0x3e, 0x7c, 0xc6, 0x30, 0x78, 0x60, 0xc6, 0xc6, 0xc6, 0x00, 0x38, 0x3a, 0xf8, 0x0e,
-    0x18, 0x0c, 0x0c, 0x18, 0x76, 0x76, 0x3c, 0x38, 0x18, 0x00, 0x00, 0x63, 0x63, 0x18, 0x00, 0x00,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x0e, 0x00, 0x06, 0x1e, 0x00,
-    0x00, 0x18, 0x30, 0x0c, 0x0e, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x78, 0x00, 0x00,
-    0xc6, 0x00, 0x18, 0x82, 0x00, 0x18, 0x30, 0x00, 0x82, 0x00, 0x18, 0x00, 0x82, 0x18, 0x38, 0x6c,
-    0x30, 0x00, 0x6c, 0x82, 0x00, 0x18, 0x84, 0x30, 0x00, 0x38, 0x00, 0x02, 0x6c, 0x6c, 0xcc, 0x1b,
-    0x30, 0x18, 0x18, 0x30, 0xdc, 0xdc, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0x33, 0xc6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x76, 0x18, 0x6c, 0x6c, 0x18, 0x00, 0x0c, 0x30, 0x7c,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x76, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7e, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x00, 0x6c, 0x7c,
-    0xfe, 0x7e, 0xcc, 0x7c, 0x7c, 0x7c, 0x00, 0xcc, 0xc6, 0x6c, 0xc6, 0x7c, 0x64, 0xce, 0xcc, 0x18,
-    0x78, 0x00, 0x7c, 0xcc, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x66, 0x7c,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x60, 0x7e, 0x66, 0xdc, 0x3c, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x7e, 0x0c, 0x30, 0x1b, 0x18, 0x00, 0xdc, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x3c, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc0, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x38, 0xc6, 0xc6,
-    0xc0, 0x12, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xce, 0xf0, 0xd6, 0xfa, 0x3c,
-    0x0c, 0x38, 0xc6, 0xcc, 0xdc, 0xe6, 0x3e, 0x38, 0x18, 0xfe, 0xfe, 0x7e, 0x7a, 0x18, 0xcc, 0xc6,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7e, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x0c, 0x36, 0x30, 0x3c, 0x00,
-    0xc6, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0xf8, 0xfe, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xd6, 0x60, 0xe6, 0xc6, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xf6, 0x00, 0x00, 0x30, 0xc0, 0x06, 0x33, 0x36, 0x3c, 0x66, 0xc6,
-    0x22, 0x55, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xc8, 0xcc, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0x00, 0x18, 0x30, 0x0c, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0xec, 0x36, 0x7c, 0x3c, 0x00,
-    0x7c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0xc0, 0x90, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0x7e, 0x6c, 0xc6, 0xe6, 0x66, 0x6c, 0xcf, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x63, 0xc0, 0x06, 0x66, 0x6a, 0x3c, 0x33, 0x7c,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x3c, 0x6c, 0x6c, 0x66, 0x7e, 0x7e, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x0c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0xfe, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x06, 0x38, 0x7c, 0x7c, 0xfc, 0xb8, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xce, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xcc, 0xdf, 0x18, 0x00, 0xc6,
-    0x22, 0x55, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x18, 0x38, 0xee, 0x3c, 0x00, 0x60, 0x1e, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x80, 0x00, 0x00, 0xc7, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP865[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x10, 0x00, 0x60, 0x38, 0x00, 0x10, 0x00, 0x60, 0x00, 0x18, 0x60, 0xc6, 0x6c,
-    0x18, 0x00, 0x00, 0x10, 0x00, 0x60, 0x30, 0x60, 0x00, 0xc6, 0xc6, 0x00, 0x38, 0x04, 0xf8, 0x0e,
-    0x18, 0x0c, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x6c, 0x3c, 0x00, 0x00,
-    0x3c, 0xcc, 0x18, 0x38, 0xcc, 0x30, 0x6c, 0x00, 0x38, 0xc6, 0x30, 0x66, 0x3c, 0x30, 0x00, 0x38,
-    0x00, 0x00, 0x3e, 0x38, 0xc6, 0x30, 0x78, 0x30, 0xc6, 0x00, 0x00, 0x00, 0x6c, 0x7c, 0xcc, 0x1b,
-    0x30, 0x18, 0x30, 0x30, 0x76, 0x00, 0x3c, 0x38, 0x30, 0x00, 0x00, 0xe0, 0xe0, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x78, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x38, 0x38, 0x1e, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x66, 0x00, 0x00,
-    0x66, 0x00, 0x30, 0x6c, 0x00, 0x18, 0x38, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x66, 0x18, 0x10, 0x10,
-    0xfe, 0x00, 0x6c, 0x6c, 0x00, 0x18, 0xcc, 0x18, 0x00, 0x7c, 0xc6, 0x00, 0x64, 0xce, 0xcc, 0x18,
-    0x60, 0x30, 0x60, 0x60, 0xdc, 0xc6, 0x6c, 0x6c, 0x30, 0x00, 0x00, 0x62, 0x62, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x18, 0x6c, 0x6c, 0x30, 0x00, 0x03, 0x30, 0x7c,
-    0x00, 0x00, 0x30, 0x0c, 0x1b, 0x18, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x36, 0x0c, 0x00, 0x00,
-    0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x66, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x00, 0x60, 0xce, 0xf8, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0xcc, 0xc6, 0x00, 0x60, 0x00, 0x00, 0x76, 0x3c, 0xc6, 0xc6, 0x18, 0x00, 0x06, 0x60, 0xc6,
-    0xfe, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c, 0x36, 0x18, 0x7e, 0x00,
-    0xc0, 0xcc, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x6c, 0x6c,
-    0x62, 0xec, 0xcc, 0x7c, 0x7c, 0x7c, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0x7c, 0xf0, 0xd6, 0xc4, 0x18,
-    0x78, 0x38, 0x7c, 0xcc, 0xdc, 0xf6, 0x3e, 0x38, 0x30, 0x00, 0x00, 0x6c, 0x6c, 0x18, 0x36, 0x7c,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x76, 0xcc, 0xc0, 0xfe, 0x30, 0x7e, 0x66, 0xdc, 0x66, 0xc6, 0xc6, 0x0c, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x18, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x32, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc6, 0x0c, 0x0c, 0x0c, 0x0c, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x68, 0x36, 0xfe, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x60, 0xd6, 0xcc, 0x7e,
-    0x0c, 0x18, 0xc6, 0xcc, 0x66, 0xfe, 0x00, 0x00, 0x30, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0x6c, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0xd8, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xfe, 0xc6, 0x3e, 0xdb, 0xdb, 0x7c, 0xc6,
-    0x00, 0x7e, 0x06, 0x60, 0x18, 0x18, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x36, 0x7e, 0x7e, 0x00,
-    0xc0, 0xcc, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0xc0, 0xfe, 0xfe, 0xfe, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x78, 0x36, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xce, 0x60, 0xd6, 0xde, 0x18,
-    0x7c, 0x18, 0xc6, 0xcc, 0x66, 0xde, 0x7e, 0x7c, 0x60, 0xc0, 0x06, 0x30, 0x30, 0x18, 0xd8, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xcc, 0xc0, 0x6c, 0x18, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xdb, 0x60, 0xc6,
-    0xfe, 0x18, 0x0c, 0x30, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x18, 0x18, 0xec, 0x00, 0x00, 0x7e, 0x00,
-    0xc0, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xfe, 0xfe,
-    0x68, 0x7e, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xd6, 0x60, 0xd6, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xce, 0x00, 0x00, 0xc0, 0xc0, 0x06, 0x60, 0x66, 0x3c, 0x6c, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x30, 0xd8, 0x66, 0x18, 0x66, 0xc6, 0x6c, 0x66, 0xdb, 0xf3, 0x60, 0xc6,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x76, 0x00, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0xc2, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x62, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xe6, 0x60, 0xe6, 0xcc, 0x18,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc0, 0x06, 0xdc, 0xce, 0x3c, 0x36, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xd8, 0xc6, 0xc0, 0x6c, 0x60, 0xd8, 0x66, 0x18, 0x3c, 0xc6, 0x6c, 0x66, 0x7e, 0x7e, 0x60, 0xc6,
-    0x00, 0x00, 0x30, 0x0c, 0x18, 0xd8, 0x18, 0xdc, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7e, 0x00,
-    0x66, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0x18, 0xc6, 0xc6,
-    0x66, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xe6, 0xcc, 0xd8,
-    0xcc, 0x18, 0xc6, 0xcc, 0x66, 0xc6, 0x00, 0x00, 0xc6, 0xc0, 0x06, 0x86, 0x9a, 0x3c, 0x00, 0x7c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xdc, 0xc6, 0xc0, 0x6c, 0xc6, 0xd8, 0x66, 0x18, 0x18, 0x6c, 0x6c, 0x66, 0x00, 0x60, 0x30, 0xc6,
-    0xfe, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00,
-    0x3c, 0x76, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc6, 0xc6,
-    0xfe, 0x6e, 0xce, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x7e, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0xc6, 0x70,
-    0x76, 0x3c, 0x7c, 0x76, 0x66, 0xc6, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0c, 0x3f, 0x18, 0x00, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x76, 0xcc, 0xc0, 0x6c, 0xfe, 0x70, 0x7c, 0x18, 0x7e, 0x38, 0xee, 0x3c, 0x00, 0xc0, 0x1c, 0xc6,
-    0x00, 0x7e, 0x7e, 0x7e, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT8_CP866[] = {
-    0x3e, 0xfe, 0xfc, 0xfe, 0x1e, 0xfe, 0xd6, 0x7c, 0xc6, 0x38, 0xe6, 0x1e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0xfc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0xf0, 0x78, 0xdc, 0x7e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6c, 0x6c, 0x3c, 0x00, 0x48, 0xcc, 0x38, 0x6c, 0x38, 0x00, 0x00, 0x0e, 0x8f, 0x00, 0x00, 0x00,
-    0x66, 0x66, 0x66, 0x66, 0x36, 0x62, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0x60, 0x8c, 0xd6, 0xc6,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfe, 0x00, 0x66, 0x00, 0x78, 0x00, 0xc6, 0x38, 0x6c, 0x00, 0x00, 0x0c, 0xcd, 0xc6, 0x00, 0x00,
-    0xc6, 0x60, 0x66, 0x60, 0x66, 0x68, 0x7c, 0x06, 0xce, 0xce, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x6c, 0xcc, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xd6, 0xc6,
-    0x78, 0xc0, 0xfc, 0xfe, 0x3c, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0x3e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xfc, 0x7c, 0x7e, 0xc6, 0x7c, 0xc6, 0xcc, 0xc6, 0xd6, 0xd6, 0xf0, 0xc6, 0xf0, 0x7c, 0xdc, 0x7e,
-    0x62, 0x7c, 0xc0, 0x3e, 0x30, 0x30, 0xc6, 0xc6, 0x6c, 0x00, 0x00, 0x0c, 0xef, 0x7c, 0x3c, 0x00,
-    0xc6, 0x7c, 0x7c, 0x60, 0x66, 0x78, 0x38, 0x3c, 0xde, 0xde, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0x7e, 0xd6, 0x38, 0xcc, 0x7e, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x3e, 0xf6, 0xc6,
-    0x0c, 0x7c, 0x66, 0x66, 0x6c, 0xc6, 0x7c, 0xc6, 0xce, 0xce, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc6, 0x5a, 0xc6, 0xd6, 0x6c, 0xcc, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0xc6, 0xd6, 0xc6,
-    0x78, 0xc6, 0xf8, 0x63, 0x30, 0x30, 0x7e, 0xc6, 0x38, 0x18, 0x00, 0x0c, 0xfc, 0xc6, 0x3c, 0x00,
-    0xfe, 0x66, 0x66, 0x60, 0x66, 0x68, 0x7c, 0x06, 0xf6, 0xf6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x7c, 0xc0, 0x18, 0x06, 0x7c, 0x6c, 0xcc, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x06, 0xd6, 0x7e,
-    0x7c, 0xc6, 0x7c, 0x60, 0x6c, 0xfe, 0x38, 0x1c, 0xde, 0xde, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc0, 0x18, 0xc6, 0xd6, 0x38, 0xcc, 0x7e, 0xd6, 0xd6, 0x3c, 0xf6, 0x7c, 0x1e, 0xf6, 0x7e,
-    0x60, 0xfe, 0xc0, 0x78, 0x30, 0x30, 0x06, 0xc6, 0x00, 0x18, 0x18, 0x6c, 0xdc, 0xc6, 0x3c, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x62, 0xd6, 0xc6, 0xe6, 0xe6, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0xc6, 0x10, 0xc6, 0xcc, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0x8c, 0xd6, 0x66,
-    0xcc, 0xc6, 0x66, 0x60, 0x6c, 0xc0, 0x7c, 0xc6, 0xf6, 0xf6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x7c, 0xc6, 0x18, 0x7e, 0x7c, 0x6c, 0xcc, 0x06, 0xd6, 0xd6, 0x36, 0xde, 0x66, 0xc6, 0xd6, 0x66,
-    0x62, 0xc0, 0x66, 0x63, 0x30, 0x30, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x3c, 0xcc, 0x7c, 0x3c, 0x00,
-    0xc6, 0xfc, 0xfc, 0xf0, 0xff, 0xfe, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0xf0, 0x7c, 0x3c, 0x7c, 0x38, 0xc6, 0xfe, 0x06, 0xfe, 0xff, 0x3c, 0xf6, 0x7c, 0x78, 0xdc, 0xc6,
-    0x76, 0x7c, 0xfc, 0xf0, 0xfe, 0x7c, 0xd6, 0x7c, 0xe6, 0xe6, 0xe6, 0xe6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x60, 0x7c, 0x3c, 0x06, 0x10, 0xc6, 0xfe, 0x06, 0xfe, 0xff, 0x3c, 0xf6, 0xfc, 0x7c, 0xdc, 0xc6,
-    0xfe, 0x7c, 0x3c, 0x3e, 0x78, 0x78, 0x7c, 0x06, 0x00, 0x00, 0x00, 0x1c, 0xcc, 0xc6, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xf0, 0x00, 0x00, 0x7c, 0x38, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP866[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6c, 0x00, 0x00, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
-    0x1e, 0xfe, 0xfc, 0xfe, 0x1e, 0xfe, 0xdb, 0x7c, 0xc6, 0xc6, 0xe6, 0x1f, 0xc6, 0xc6, 0x7c, 0xfe,
-    0xfc, 0x7c, 0xff, 0xc6, 0x7e, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xf8, 0xc3, 0xf0, 0x7c, 0xce, 0x3f,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfe, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0xc6, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0xcf, 0x00, 0x00, 0x00,
-    0x36, 0x62, 0x66, 0x66, 0x36, 0x66, 0xdb, 0xc6, 0xc6, 0xc6, 0x66, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xf0, 0xc3, 0x60, 0xc6, 0xdb, 0x66,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x66, 0x6c, 0xc6, 0x00, 0x18, 0x6c, 0xc6, 0x6c, 0x6c, 0x00, 0x00, 0x0c, 0xcd, 0xc6, 0x00, 0x00,
-    0x66, 0x60, 0x66, 0x62, 0x66, 0x62, 0x5a, 0x06, 0xc6, 0xc6, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc6, 0x99, 0xc6, 0xdb, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc3, 0x60, 0x06, 0xdb, 0x66,
-    0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x18,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x62, 0x00, 0xc0, 0x00, 0x18, 0x00, 0xc6, 0x38, 0x38, 0x00, 0x00, 0x0c, 0xef, 0x7c, 0x7e, 0x00,
-    0xc6, 0x60, 0x66, 0x60, 0x66, 0x68, 0x5a, 0x06, 0xce, 0xce, 0x6c, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xdb, 0x7c, 0xc6, 0xc6, 0xd6, 0xd6, 0x30, 0xc3, 0x60, 0x26, 0xdb, 0x66,
-    0x78, 0xc0, 0xfc, 0xfe, 0x1e, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0x1e, 0xc6, 0xc6, 0x7c, 0xfe,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf8, 0x36, 0x00, 0xf8, 0xf6, 0x36, 0xfe, 0xf6, 0x36, 0xf8, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x1f, 0x36, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0xff,
-    0x36, 0xff, 0x00, 0x36, 0x1f, 0x1f, 0x00, 0x36, 0xff, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0xdc, 0x7c, 0x7e, 0xc6, 0x7e, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xf8, 0xc6, 0xf0, 0x7c, 0xce, 0x7f,
-    0x68, 0x7c, 0xc8, 0x7c, 0x18, 0x38, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x0c, 0xec, 0xc6, 0x7e, 0x00,
-    0xc6, 0x7c, 0x7c, 0x60, 0x66, 0x78, 0x7e, 0x3c, 0xde, 0xde, 0x78, 0x66, 0xd6, 0xfe, 0xc6, 0xc6,
-    0x66, 0xc0, 0x18, 0xc6, 0xdb, 0x38, 0xc6, 0xc6, 0xd6, 0xd6, 0x3e, 0xf3, 0x7c, 0x3e, 0xfb, 0x3e,
-    0x0c, 0xfc, 0x66, 0x62, 0x36, 0xc6, 0xd6, 0xc6, 0xc6, 0xc6, 0x6c, 0x36, 0xee, 0xc6, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x00, 0x18, 0x06, 0x36, 0x06, 0x06, 0x36, 0x18, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x36, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x36, 0x00, 0x00, 0x36, 0x18, 0x18, 0x00, 0x36, 0x18, 0x18, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xff,
-    0x66, 0xc6, 0x5a, 0xc6, 0xdb, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0xc6, 0xdb, 0xc6,
-    0x78, 0xc6, 0xf8, 0xc6, 0x18, 0x18, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc6, 0x7e, 0x00,
-    0xfe, 0x66, 0x66, 0x60, 0x66, 0x68, 0x7e, 0x06, 0xf6, 0xf6, 0x78, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x7c, 0xc0, 0x18, 0x7e, 0xdb, 0x38, 0xc6, 0x7e, 0xd6, 0xd6, 0x33, 0xdb, 0x66, 0x26, 0xdb, 0x3e,
-    0x7c, 0xc6, 0x66, 0x62, 0x66, 0xc6, 0x54, 0x06, 0xce, 0xce, 0x78, 0x66, 0xfe, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf8, 0xf6, 0xfe, 0xf8, 0xf6, 0x36, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x37, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc0, 0x18, 0xc6, 0xdb, 0x38, 0xc6, 0xc6, 0xd6, 0xd6, 0xb0, 0xc6, 0x60, 0x06, 0xdb, 0xc6,
-    0x68, 0xc6, 0xc8, 0xc0, 0x18, 0x18, 0x7e, 0xc6, 0x00, 0x18, 0x18, 0x0c, 0xdc, 0xc6, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x60, 0x5a, 0x06, 0xe6, 0xe6, 0x6c, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc0, 0x18, 0x06, 0xdb, 0x7c, 0xc6, 0x06, 0xd6, 0xd6, 0x33, 0xdb, 0x66, 0x06, 0xdb, 0x66,
-    0xcc, 0xc6, 0x7c, 0x60, 0x66, 0xfe, 0x7c, 0x3c, 0xd6, 0xd6, 0x78, 0x66, 0xfe, 0xfe, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc0, 0x18, 0xc6, 0xdb, 0x38, 0xc6, 0xc6, 0xd6, 0xd6, 0x3e, 0xf6, 0x7c, 0x3e, 0xfb, 0x7e,
-    0x60, 0xfc, 0xc0, 0xf8, 0x18, 0x18, 0x06, 0xc6, 0x00, 0x18, 0x00, 0xec, 0xdc, 0xc6, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x62, 0xdb, 0x06, 0xc6, 0xc6, 0x6c, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc2, 0x18, 0x06, 0x7e, 0x6c, 0xc6, 0x06, 0xd6, 0xd6, 0x33, 0xdb, 0x66, 0x06, 0xdb, 0x66,
-    0xcc, 0xc6, 0x66, 0x60, 0x66, 0xc0, 0x54, 0x06, 0xe6, 0xe6, 0x6c, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc0, 0x18, 0xc6, 0xdb, 0x38, 0xc6, 0x7e, 0xd6, 0xd6, 0x33, 0xde, 0x66, 0x06, 0xdb, 0x36,
-    0x62, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x06, 0xc6, 0x00, 0x00, 0x00, 0x6c, 0xcc, 0xc6, 0x7e, 0x00,
-    0xc6, 0x66, 0x66, 0x60, 0x66, 0x66, 0xdb, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0xc6,
-    0x60, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xc6, 0x06, 0xd6, 0xd6, 0x33, 0xdb, 0x66, 0xc6, 0xdb, 0x66,
-    0xcc, 0xc6, 0x66, 0x60, 0x66, 0xc6, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0x66, 0xd6, 0xc6, 0xc6, 0xc6,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x66, 0xc6, 0x18, 0x7e, 0xdb, 0x6c, 0xc6, 0x06, 0xd6, 0xd6, 0x33, 0xde, 0x66, 0xc6, 0xdb, 0x66,
-    0x66, 0xc6, 0xc6, 0xc6, 0x18, 0x18, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x3c, 0xcc, 0x7c, 0x7e, 0x00,
-    0xc6, 0xfc, 0xfc, 0xf0, 0xff, 0xfe, 0xdb, 0x7c, 0xc6, 0xc6, 0xe6, 0xcf, 0xc6, 0xc6, 0x7c, 0xc6,
-    0xf0, 0x7c, 0x3c, 0x7c, 0x3c, 0xc6, 0xff, 0x06, 0xfe, 0xff, 0x7e, 0xf3, 0xfc, 0x7c, 0xce, 0xe7,
-    0x76, 0x7c, 0xfc, 0xf0, 0xff, 0x7c, 0xd6, 0x7c, 0xc6, 0xc6, 0xe6, 0xe6, 0xc6, 0xc6, 0x7c, 0xc6,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x7c, 0x7c, 0x3c, 0x06, 0x7e, 0xc6, 0xff, 0x06, 0xfe, 0xfe, 0x7e, 0xf6, 0xfc, 0x7c, 0xce, 0xe7,
-    0xfe, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x7c, 0x06, 0x00, 0x00, 0x00, 0x1c, 0xcc, 0xc6, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x60, 0x00, 0x00, 0x06, 0x18, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x60, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0xf0, 0x00, 0x00, 0x7c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x18, 0x36, 0x36, 0x18, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x36, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x36, 0x36, 0x18, 0x00, 0x18, 0xff, 0xff, 0xf0, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP852[] = {
+    388, 1, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 14, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 26, 412, 413, 414, 347, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 127, 426, 427, 428, 46, 47,
+    48, 49, 429, 51, 52, 430, 431, 432, 433, 57, 58, 59, 60, 434, 435, 63,
+    64, 65, 66, 67, 68, 69, 436, 437, 72, 73, 74, 75, 76, 77, 78, 438,
+    439, 440, 441, 442, 443, 444, 445, 446, 447, 89, 90, 91, 92, 448, 449, 95,
+    34, 450, 19, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 120, 472, 473, 474, 475, 476, 126, 127};
 
-static const __in_flash("font") uint8_t FONT8_CP869[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x5f, 0x00, 0xb3,
-    0x5e, 0xc3, 0x5c, 0x00, 0x00, 0xb3, 0x66, 0x7e, 0x5c, 0x78, 0x78, 0x08, 0x38, 0x08, 0x08, 0x08,
-    0xcc, 0x08, 0x08, 0x08, 0x38, 0xfc, 0xfe, 0x10, 0xfe, 0xfe, 0xc6, 0x63, 0x7c, 0x7e, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xc6, 0x10, 0xc6, 0xc6, 0x36, 0x36, 0x00, 0x36, 0xfe, 0x7c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xff, 0xfc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xfe,
-    0x7e, 0x66, 0x10, 0xc6, 0x10, 0x38, 0x00, 0x78, 0x00, 0x18, 0x00, 0xff, 0x00, 0x7e, 0x00, 0xff,
-    0x7e, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x08, 0x38, 0x00, 0x00, 0x66, 0xcb, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x18, 0x10, 0x08, 0x90, 0x00, 0xb3,
-    0x8c, 0x3c, 0xb6, 0x00, 0x00, 0xb3, 0x00, 0x81, 0xb6, 0x0c, 0x0c, 0x10, 0x6c, 0x10, 0x10, 0x10,
-    0x00, 0xd3, 0x10, 0x10, 0x6c, 0x66, 0xc0, 0x38, 0xc0, 0x06, 0xc6, 0xe6, 0xc6, 0x18, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0xcc, 0x38, 0xee, 0xe6, 0x36, 0x36, 0x00, 0x36, 0xc6, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc0,
-    0x18, 0x66, 0x7c, 0xc6, 0xd6, 0x6c, 0x00, 0xcc, 0x00, 0x18, 0x00, 0xff, 0x00, 0x30, 0x00, 0xff,
-    0x06, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x61, 0x00, 0x10, 0x6c, 0x66, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x08, 0x10, 0x10, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x33, 0x66, 0x9d, 0x63, 0x18, 0x18, 0x76, 0x64, 0x7e, 0xbc, 0x30,
-    0x30, 0x18, 0x7c, 0xe6, 0xc6, 0x66, 0xc0, 0x6c, 0xc0, 0x0c, 0xc6, 0x6c, 0xc6, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xd8, 0x6c, 0xfe, 0xf6, 0xf6, 0x36, 0xfe, 0xf6, 0x00, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x60,
-    0x18, 0x66, 0xd6, 0x6c, 0xd6, 0xc6, 0x7a, 0xd8, 0xc6, 0x18, 0x00, 0xff, 0x00, 0x18, 0x7e, 0xff,
-    0x1c, 0xbc, 0xe6, 0x30, 0xc6, 0x06, 0xc6, 0x82, 0x30, 0x7c, 0xff, 0x7c, 0x7e, 0x7e, 0xfc, 0x10,
-    0x00, 0x7e, 0xe6, 0x1c, 0xc2, 0x3c, 0x10, 0xc3, 0x6c, 0x00, 0x44, 0xe6, 0xe6, 0x44, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x1e, 0x66, 0xa1, 0x63, 0x30, 0x0c, 0xcc, 0xf0, 0xc0, 0x66, 0x30,
-    0x30, 0x18, 0xc6, 0x66, 0xfe, 0x7c, 0xc0, 0xc6, 0xfc, 0x18, 0xfe, 0x7e, 0xfe, 0x18, 0xcc, 0x33,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0xf0, 0xc6, 0xd6, 0xde, 0x06, 0x36, 0x06, 0x06, 0x38, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xfc, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x18, 0x3c, 0xd6, 0x38, 0xd6, 0xc6, 0xcc, 0xfc, 0x6c, 0x18, 0x00, 0xff, 0x00, 0x7c, 0xc0, 0xff,
-    0x30, 0x66, 0x3e, 0x30, 0xdc, 0x1e, 0xc6, 0xc6, 0x3c, 0xc6, 0x66, 0xc6, 0xd8, 0xc0, 0x30, 0x00,
-    0x7e, 0x18, 0x66, 0x56, 0x6c, 0x66, 0xd6, 0x00, 0x38, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x3c, 0xa1, 0x36, 0x7c, 0x78, 0xcc, 0x60, 0x7c, 0x66, 0x30,
-    0x30, 0x18, 0xc6, 0x66, 0xc6, 0x66, 0xc0, 0xc6, 0xc0, 0x30, 0xc6, 0x33, 0xc6, 0x18, 0x66, 0x66,
-    0x22, 0x55, 0xdb, 0x18, 0xf8, 0xd8, 0xc6, 0xc6, 0xce, 0xf6, 0x36, 0xf6, 0xfe, 0x00, 0xc6, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x66, 0xc0, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0x60,
-    0x18, 0x18, 0x7c, 0x6c, 0x7c, 0x6c, 0xcc, 0xc6, 0x38, 0xf8, 0x1f, 0xff, 0xff, 0xc6, 0x7c, 0x00,
-    0x60, 0x66, 0x86, 0x30, 0xf0, 0x36, 0xc6, 0xc6, 0x60, 0xc6, 0x66, 0xc6, 0xcc, 0xc0, 0x30, 0x00,
-    0x00, 0x18, 0x66, 0xd6, 0x38, 0x66, 0xd6, 0x00, 0x00, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0xff, 0x33,
-    0x0c, 0x18, 0x36, 0x00, 0x00, 0x0c, 0x18, 0x9d, 0x14, 0x00, 0x00, 0xcc, 0xe6, 0xc0, 0x66, 0x30,
-    0x30, 0x18, 0xc6, 0x66, 0xc6, 0x66, 0xc0, 0xc6, 0xc0, 0x60, 0xc6, 0x66, 0xc6, 0x18, 0x33, 0xcc,
-    0x88, 0xaa, 0x77, 0x18, 0x18, 0xcc, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc0,
-    0x18, 0x18, 0x10, 0xc6, 0x10, 0x28, 0xcc, 0xc6, 0x6c, 0x00, 0x18, 0xff, 0xff, 0xc6, 0xc0, 0x00,
-    0x3e, 0x66, 0xc6, 0x30, 0xdc, 0x66, 0xe6, 0x6c, 0x3e, 0xc6, 0x66, 0xfc, 0xcc, 0x7c, 0x36, 0x00,
-    0x00, 0x00, 0x66, 0xd6, 0x6c, 0x3c, 0xd6, 0x00, 0x00, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00, 0x33,
-    0x1e, 0x3c, 0x1c, 0x00, 0x00, 0x1e, 0x3c, 0x81, 0x77, 0x00, 0x00, 0x76, 0xfc, 0x7e, 0x66, 0x3c,
-    0x3c, 0x1e, 0x7c, 0x3c, 0xc6, 0xfc, 0xc0, 0xfe, 0xfe, 0xfe, 0xc6, 0xcc, 0x7c, 0x7e, 0x00, 0x00,
-    0x22, 0x55, 0xdb, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xfe, 0x7c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xfe,
-    0x18, 0x18, 0x38, 0xc6, 0x38, 0xee, 0x7a, 0xfc, 0xc6, 0x00, 0x18, 0xff, 0xff, 0x7c, 0x7e, 0x00,
-    0x02, 0x66, 0x7c, 0x1c, 0xc6, 0xc6, 0xdd, 0x38, 0x02, 0x7c, 0x66, 0xc0, 0x78, 0x06, 0x1c, 0x00,
-    0x00, 0x7e, 0x3c, 0x7c, 0x86, 0x86, 0x7c, 0x00, 0x00, 0x00, 0x6c, 0x3c, 0x3c, 0x6c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
-    0x88, 0xaa, 0xee, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7c, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x1c, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0xc0, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const __in_flash("font") uint8_t FONT16_CP869[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x40,
-    0x20, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x38, 0x7c, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x08, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xbf, 0x00, 0xb3,
-    0x5e, 0x7e, 0xbe, 0x00, 0x00, 0xb3, 0x66, 0x3c, 0xb8, 0x6c, 0x0c, 0x08, 0x6c, 0x08, 0x08, 0x08,
-    0x00, 0x00, 0x08, 0x04, 0x10, 0xfc, 0xfe, 0x10, 0xfe, 0xfe, 0xc6, 0xe0, 0x7c, 0x7e, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0x10, 0xc6, 0xc6, 0x36, 0x36, 0x00, 0x36, 0xfe, 0x7c, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xff, 0xfc, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xfe,
-    0x7e, 0x66, 0x10, 0xc6, 0x10, 0x38, 0x00, 0x78, 0x00, 0x18, 0x00, 0xff, 0x00, 0x7e, 0x00, 0xff,
-    0x7e, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x33, 0x66, 0x42, 0x6c, 0x0c, 0x30, 0x10, 0x64, 0x10, 0x10, 0x10,
-    0xcc, 0xcc, 0x10, 0x08, 0x38, 0x66, 0xc0, 0x38, 0xc0, 0x06, 0xc6, 0x62, 0xc6, 0x18, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xcc, 0x38, 0xee, 0xe6, 0x36, 0x36, 0x00, 0x36, 0xc6, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0xc0,
-    0x18, 0x66, 0x7c, 0xc6, 0xd6, 0x6c, 0x00, 0xcc, 0x00, 0x18, 0x00, 0xff, 0x00, 0x60, 0x00, 0xff,
-    0x06, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x66, 0x6c, 0x66, 0x00, 0x66, 0x66, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x18, 0x10, 0x08, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x33, 0x66, 0x99, 0xc6, 0x18, 0x0c, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6c, 0x66, 0xc0, 0x6c, 0xc0, 0x06, 0xc6, 0x66, 0xc6, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xd8, 0x6c, 0xfe, 0xf6, 0x36, 0x36, 0x00, 0x36, 0x00, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xc6, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x60,
-    0x18, 0x66, 0xd6, 0x6c, 0xd6, 0xc6, 0x00, 0xcc, 0x00, 0x18, 0x00, 0xff, 0x00, 0x30, 0x00, 0xff,
-    0x0c, 0x00, 0xc6, 0x00, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x08, 0x10, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x33, 0x66, 0xa5, 0xc6, 0x30, 0x0c, 0x76, 0xf0, 0x7c, 0xdc, 0x30,
-    0x30, 0x30, 0x7c, 0xe6, 0xc6, 0x66, 0xc0, 0x6c, 0xc0, 0x0c, 0xc6, 0x6c, 0xc6, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xf0, 0x6c, 0xfe, 0xfe, 0xf6, 0x36, 0xfe, 0xf6, 0x00, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xc6, 0x37, 0x3f, 0xf7, 0xff, 0x37, 0xff, 0xf7, 0x30,
-    0x18, 0x66, 0xd6, 0x6c, 0xd6, 0xc6, 0x76, 0xcc, 0x82, 0x18, 0x00, 0xff, 0x00, 0x18, 0x7c, 0xff,
-    0x18, 0xdc, 0x66, 0x30, 0xc6, 0x06, 0xc6, 0x82, 0x30, 0x7c, 0xff, 0x7c, 0x7e, 0x7c, 0xfc, 0x00,
-    0x00, 0x18, 0xe6, 0x1c, 0xc2, 0x6c, 0x10, 0x00, 0x00, 0x00, 0x44, 0xe6, 0xe6, 0x44, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x3e, 0x00, 0x3f,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x1e, 0x3c, 0xa1, 0xc6, 0x7c, 0x78, 0xcc, 0x60, 0xc6, 0x66, 0x30,
-    0x30, 0x30, 0xc6, 0x66, 0xc6, 0x7c, 0xc0, 0xc6, 0xfc, 0x18, 0xfe, 0x18, 0xc6, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xe0, 0xc6, 0xd6, 0xde, 0x06, 0x36, 0x06, 0x06, 0x7c, 0xc6, 0x00,
-    0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x66, 0xfc, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18,
-    0x18, 0x3c, 0xd6, 0x38, 0xd6, 0xc6, 0xcc, 0xd8, 0xc6, 0x18, 0x00, 0xff, 0x00, 0x7c, 0xc6, 0xff,
-    0x30, 0x66, 0x36, 0x30, 0xcc, 0x3e, 0xc6, 0xc6, 0x1c, 0xc6, 0x66, 0xc6, 0xd8, 0xc6, 0x30, 0x00,
-    0x00, 0x7e, 0x66, 0x56, 0x6c, 0xc6, 0xd6, 0x00, 0x00, 0x00, 0xc6, 0x66, 0x66, 0xc6, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x30, 0xff, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x18, 0xa5, 0xc6, 0x00, 0x00, 0xcc, 0x60, 0xc0, 0x66, 0x30,
-    0x30, 0x30, 0xc6, 0x66, 0xfe, 0x66, 0xc0, 0xc6, 0xc0, 0x30, 0xc6, 0x30, 0xfe, 0x18, 0xd8, 0x36,
-    0x44, 0xaa, 0x77, 0x18, 0xf8, 0xf0, 0xc6, 0xc6, 0xce, 0xf6, 0x36, 0xf6, 0xfe, 0x7c, 0xc6, 0xf8,
-    0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x66, 0xc0, 0x3f, 0x37, 0xff, 0xf7, 0x37, 0xff, 0xf7, 0x18,
-    0x18, 0x18, 0xd6, 0x38, 0xd6, 0xc6, 0xcc, 0xfc, 0x6c, 0xf8, 0x1f, 0xff, 0xff, 0xc6, 0xc0, 0x00,
-    0x60, 0x66, 0x3e, 0x30, 0xd8, 0x66, 0xc6, 0xc6, 0x30, 0xc6, 0x66, 0xc6, 0xcc, 0xc0, 0x30, 0x00,
-    0x7e, 0x18, 0x66, 0xd6, 0x38, 0xc6, 0xd6, 0x00, 0x00, 0x00, 0xc6, 0x66, 0x66, 0xc6, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x18, 0x99, 0xc6, 0x00, 0x00, 0xcc, 0x60, 0x78, 0x66, 0x30,
-    0x30, 0x30, 0xc6, 0x66, 0xc6, 0x66, 0xc0, 0xc6, 0xc0, 0x60, 0xc6, 0x60, 0xc6, 0x18, 0x6c, 0x6c,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xd8, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0x00, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x30,
-    0x18, 0x18, 0x7c, 0x6c, 0x7c, 0xc6, 0xcc, 0xc6, 0x38, 0x00, 0x18, 0xff, 0xff, 0xc6, 0x78, 0x00,
-    0x60, 0x66, 0x86, 0x30, 0xf0, 0x66, 0xc6, 0xc6, 0x60, 0xc6, 0x66, 0xc6, 0xcc, 0xc0, 0x30, 0x00,
-    0x00, 0x18, 0x66, 0xd6, 0x38, 0x6c, 0xd6, 0x00, 0x00, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x18, 0x42, 0x6c, 0x00, 0x00, 0xcc, 0x60, 0xc0, 0x66, 0x30,
-    0x30, 0x30, 0xc6, 0x66, 0xc6, 0x66, 0xc0, 0xc6, 0xc0, 0xc0, 0xc6, 0xdc, 0xc6, 0x18, 0x36, 0xd8,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xcc, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0x00, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x60,
-    0x18, 0x18, 0x10, 0x6c, 0x10, 0x6c, 0xcc, 0xc6, 0x7c, 0x00, 0x18, 0xff, 0xff, 0xc6, 0xc0, 0x00,
-    0x60, 0x66, 0xc6, 0x30, 0xd8, 0xc6, 0xc6, 0x6c, 0x60, 0xc6, 0x66, 0xc6, 0xcc, 0x7c, 0x30, 0x00,
-    0x00, 0x00, 0x66, 0xd6, 0x38, 0x38, 0xd6, 0x00, 0x00, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x33,
-    0x0c, 0x18, 0x63, 0x00, 0x00, 0x0c, 0x18, 0x3c, 0x28, 0x00, 0x00, 0xcc, 0xe6, 0xc6, 0x66, 0x30,
-    0x30, 0x30, 0xc6, 0x66, 0xc6, 0x66, 0xc0, 0xc6, 0xc0, 0xc0, 0xc6, 0x86, 0xc6, 0x18, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xc6, 0xc6, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xc0,
-    0x18, 0x18, 0x10, 0xc6, 0x10, 0x28, 0xcc, 0xc6, 0xc6, 0x00, 0x18, 0xff, 0xff, 0xc6, 0xc6, 0x00,
-    0x60, 0x66, 0xc6, 0x30, 0xcc, 0xc6, 0xe6, 0x6c, 0x60, 0xc6, 0x66, 0xe6, 0xcc, 0x06, 0x36, 0x00,
-    0x00, 0x00, 0x66, 0xd6, 0x6c, 0x0c, 0xd6, 0x00, 0x00, 0x00, 0xd6, 0x66, 0x66, 0xd6, 0x7e, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3f, 0x00, 0x33,
-    0x1e, 0x7e, 0x3e, 0x00, 0x00, 0x0c, 0x18, 0x00, 0xee, 0x00, 0x00, 0x76, 0xfc, 0x7c, 0x66, 0x1c,
-    0x1c, 0x1c, 0x7c, 0x3c, 0xc6, 0xfc, 0xc0, 0xfe, 0xfe, 0xfe, 0xc6, 0x0c, 0x7c, 0x7e, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x36, 0x36, 0x36, 0x00, 0xfe, 0x7c, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x66, 0xc0, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0xfe,
-    0x18, 0x18, 0x38, 0xc6, 0x38, 0xee, 0x76, 0xfc, 0xc6, 0x00, 0x18, 0xff, 0xff, 0x7c, 0x7c, 0x00,
-    0x3e, 0x66, 0x7c, 0x1c, 0xc6, 0xc6, 0xdd, 0x38, 0x3e, 0x7c, 0x66, 0xdc, 0x78, 0x06, 0x1c, 0x00,
-    0x00, 0x7e, 0x3c, 0x7c, 0x86, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x6c, 0x3c, 0x3c, 0x6c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc6, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0x00, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc6, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x55, 0xdd, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x44, 0xaa, 0x77, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const __in_flash("font") font_index_t FONT8_CP855[] = {
+    477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+    493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508,
+    509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 46, 47,
+    48, 49, 429, 51, 52, 306, 523, 524, 525, 57, 58, 59, 60, 526, 527, 63,
+    64, 65, 66, 67, 68, 69, 528, 529, 72, 73, 74, 75, 76, 77, 78, 355,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 89, 90, 91, 92, 539, 540, 95,
+    541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556,
+    557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 341, 126, 127};
 
-void font_init(void)
-{
-    for (int row = 0; row < 16; row++)
-    {
-        memcpy(&font16[row * 256], &FONT16_ASCII[row * 128], 128);
-        memset(&font16[row * 256 + 128], 0, 128);
-        if (row < 8)
-        {
-            memcpy(&font8[row * 256], &FONT8_ASCII[row * 128], 128);
-            memset(&font8[row * 256 + 128], 0, 128);
-        }
-    }
-    if (RP6502_CODE_PAGE)
-        font_set_code_page(RP6502_CODE_PAGE);
-}
+static const __in_flash("font") font_index_t FONT8_CP857[] = {
+    570, 1, 2, 3, 4, 5, 571, 572, 8, 9, 10, 11, 12, 573, 14, 574,
+    16, 17, 18, 19, 20, 21, 22, 23, 575, 25, 26, 576, 28, 577, 578, 579,
+    32, 33, 34, 35, 36, 37, 580, 581, 40, 348, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 349, 350, 351, 352, 57, 58, 59, 60, 27, 29, 63,
+    64, 65, 66, 67, 68, 69, 353, 354, 72, 73, 74, 75, 76, 77, 78, 355,
+    39, 38, 358, 359, 360, 127, 362, 363, 364, 89, 90, 91, 92, 365, 366, 95,
+    367, 97, 368, 369, 370, 371, 102, 127, 347, 374, 375, 376, 13, 24, 379, 380,
+    381, 113, 127, 339, 383, 341, 118, 384, 120, 385, 122, 386, 387, 125, 126, 127};
 
-void font_set_code_page(uint16_t cp)
-{
-    static uint16_t current_cp = 0;
-    const uint8_t *font8hi = NULL;
-    const uint8_t *font16hi = NULL;
+static const __in_flash("font") font_index_t FONT8_CP860[] = {
+    0, 1, 2, 3, 582, 5, 349, 7, 8, 583, 10, 362, 368, 13, 354, 350,
+    16, 584, 585, 19, 370, 21, 457, 23, 366, 371, 26, 27, 28, 586, 30, 587,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 588, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP861[] = {
+    589, 590, 591, 592, 391, 593, 594, 595, 596, 396, 597, 357, 598, 599, 14, 600,
+    601, 602, 603, 405, 604, 605, 606, 607, 608, 25, 609, 303, 610, 611, 30, 612,
+    613, 614, 615, 616, 349, 617, 618, 619, 620, 621, 622, 623, 624, 625, 46, 47,
+    48, 49, 429, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 450, 626, 627, 628, 101, 629, 103, 630, 105, 106, 631, 108, 109, 632, 633,
+    634, 635, 636, 637, 116, 117, 638, 119, 120, 121, 202, 123, 639, 640, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP862[] = {
+    641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656,
+    657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 28, 669, 670, 31,
+    671, 672, 310, 673, 674, 675, 676, 677, 678, 679, 680, 43, 44, 681, 682, 683,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 684, 98, 99, 100, 101, 685, 686, 687, 105, 106, 107, 108, 109, 110, 688,
+    112, 113, 114, 115, 689, 690, 118, 119, 120, 121, 122, 691, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP863[] = {
+    0, 1, 2, 3, 350, 5, 383, 7, 8, 9, 10, 11, 12, 382, 351, 341,
+    16, 360, 692, 19, 359, 364, 22, 23, 355, 368, 26, 27, 28, 376, 375, 31,
+    365, 380, 34, 35, 385, 693, 387, 379, 694, 41, 42, 43, 44, 695, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP864[] = {
+    200, 202, 201, 691, 696, 68, 51, 69, 52, 66, 67, 65, 63, 90, 64, 89,
+    684, 108, 109, 113, 43, 44, 199, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    127, 337, 706, 28, 307, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+    718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+    668, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748,
+    749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 365, 42, 198, 306, 760,
+    761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776,
+    777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP865[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 345, 18, 19, 20, 21, 22, 23, 24, 25, 26, 303, 28, 346, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 355,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP866[] = {
+    510, 512, 553, 522, 516, 518, 791, 561, 525, 527, 792, 531, 533, 535, 537, 539,
+    543, 545, 547, 549, 793, 523, 514, 569, 563, 567, 508, 559, 555, 565, 506, 541,
+    509, 511, 552, 521, 515, 517, 794, 560, 524, 526, 528, 530, 532, 534, 536, 538,
+    795, 49, 796, 51, 797, 798, 799, 800, 801, 802, 58, 803, 804, 805, 806, 807,
+    808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823,
+    824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 91, 835, 93, 94, 836,
+    542, 544, 546, 548, 837, 306, 513, 568, 562, 566, 507, 558, 554, 564, 505, 540,
+    482, 481, 484, 838, 839, 489, 502, 501, 120, 121, 202, 840, 556, 355, 126, 127};
+
+static const __in_flash("font") font_index_t FONT8_CP869[] = {
+    127, 127, 127, 127, 127, 127, 841, 127, 121, 842, 365, 843, 844, 845, 761, 846,
+    847, 848, 849, 127, 127, 850, 851, 352, 852, 125, 853, 854, 610, 855, 856, 857,
+    858, 859, 860, 861, 862, 553, 863, 864, 865, 866, 535, 43, 867, 868, 46, 47,
+    48, 49, 429, 51, 52, 869, 870, 871, 872, 57, 58, 59, 60, 873, 537, 63,
+    64, 65, 66, 67, 68, 69, 874, 875, 72, 73, 74, 75, 76, 77, 78, 876,
+    877, 878, 879, 523, 880, 881, 882, 883, 884, 89, 90, 91, 92, 885, 886, 95,
+    887, 888, 889, 890, 891, 892, 893, 894, 895, 536, 896, 897, 898, 899, 900, 901,
+    381, 113, 902, 903, 904, 341, 175, 905, 120, 906, 907, 908, 909, 910, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xfe, 0x82, 0x00, 0x7c, 0x7c, 0x00, 0x82, 0xfe, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x62, 0x30, 0x18, 0x18, 0x30, 0x62, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0x7c, 0x06, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3e, 0x06, 0xc6, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xf8, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0x0c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf6, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x38, 0x60, 0x60, 0x3c, 0x60, 0xc0, 0xc0, 0xc0, 0x7c, 0x06, 0x1c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x60, 0x3c, 0x06, 0x1c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xc6, 0xd6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0xc6, 0xd6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x7e, 0x60, 0x60, 0x60, 0x78, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0x81, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x54, 0x7c, 0x7c, 0x54, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x3c, 0x0c, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0xc6, 0x7c, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x30, 0x3c, 0x36, 0x36, 0x36, 0x36, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x26, 0x3e, 0x26, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x06, 0x7c, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0xc3, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x36, 0x1c, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x3c, 0x36, 0x36, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x18, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x00, 0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x60, 0x30, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78},
+    {0x00, 0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x1a, 0x1e, 0x1c, 0x18, 0x38, 0x78, 0x58, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x30, 0x18, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0xc6, 0x66, 0x3a, 0x0c, 0x06, 0x3c},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0xce, 0xd6, 0xd6, 0xd6, 0xe6, 0x7c, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x7c, 0xce, 0xce, 0xd6, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0x7c, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0xfe, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x7e, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x22, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0xa2, 0xa2, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x82, 0xb2, 0xaa, 0xaa, 0xb2, 0xaa, 0xaa, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf0, 0x64, 0x6c, 0x78, 0x70, 0xe0, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x0c, 0x78},
+    {0x00, 0xfe, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x22, 0x44, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe0, 0x30, 0x62, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x22, 0x44},
+    {0x00, 0x00, 0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x04, 0x7c, 0xce, 0xce, 0xd6, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0x7c, 0x40, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0xaa, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x60, 0xc0, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x7c, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0xa2, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x34, 0x18, 0x2c, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x33, 0x60, 0xfe, 0x60, 0xfc, 0x60, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00},
+    {0x0c, 0x18, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00},
+    {0x00, 0x78, 0xcc, 0x78, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x00, 0x38, 0x1a, 0x1e, 0x1c, 0x18, 0x38, 0x78, 0x58, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x36, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xfe, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x78, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf6, 0x6c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x6c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1b, 0xee, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1b, 0xee, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x3c, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf0, 0x64, 0x6c, 0x78, 0x70, 0xe0, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x30, 0x1e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0xc6, 0x8c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x30, 0x1e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x30, 0x60, 0x3c, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x3c, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x36, 0x1b, 0x36, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x18, 0x18, 0x00, 0xfe, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0xc6, 0x7c, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x7c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x0c, 0x7e, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x3c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0c, 0x78, 0x00},
+    {0x38, 0x6c, 0x38, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x3c, 0x00},
+    {0x00, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x36, 0x6c, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0x60, 0xf8, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0xe6, 0x06, 0x04, 0x08, 0x00},
+    {0x00, 0x00, 0xfc, 0x60, 0x60, 0x60, 0x6c, 0x76, 0x66, 0x66, 0x66, 0xec, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xf8, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc8, 0xf8, 0xc8, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x58, 0x58, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xda, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0xf8, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xe6, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xee, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xce, 0xdb, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x3e, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0xf0, 0xb0, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x06, 0x7c, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0xc3, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0x81, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x3c, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11},
+    {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0x7e, 0x36, 0x66, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x3e, 0x3e, 0x66, 0x66, 0x66, 0xe7, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xdb, 0xdb, 0x5a, 0x5a, 0x7e, 0x7e, 0x5a, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcf, 0xcd, 0xef, 0xec, 0xff, 0xdc, 0xdc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xf3, 0xdb, 0xdb, 0xdb, 0xdb, 0xf3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x26, 0x3e, 0x26, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x66, 0x7e, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0x6e, 0x3a, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x78, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00},
+    {0x38, 0x6c, 0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x0c, 0x18, 0x42, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xce, 0xde, 0xd6, 0xf6, 0xe6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x66, 0x76, 0xdc, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x1c, 0x36, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x36, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0x06, 0x06, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xde, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x66, 0x66, 0x36, 0x1c, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x46, 0xc6, 0xc6, 0xe6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x46, 0xc6, 0xc6, 0xe6, 0x06, 0x06, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x6c, 0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x3c, 0x18, 0x0c, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x66, 0x64, 0x6c, 0x6e, 0x60, 0x60, 0x60, 0x60},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x66, 0xe6, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x1b, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x36, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe0, 0x30, 0xe2, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xdc, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x63, 0x66, 0x6c, 0x18, 0x30, 0x6e, 0x13, 0x06, 0x0c, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x63, 0x66, 0x6c, 0x18, 0x36, 0x6e, 0x1a, 0x3f, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x80, 0x60, 0x80, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0x80, 0x60, 0x80, 0x00, 0x06, 0x49, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x12, 0x0a, 0x0a, 0x6a, 0x86, 0x6c, 0x8a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x61, 0x89, 0x69, 0x85, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x12, 0x12, 0x0a, 0x0a, 0x0c, 0x1a, 0x3e, 0x00, 0x0c, 0x10, 0x0c, 0x10, 0x00, 0x00},
+    {0x00, 0x01, 0x09, 0x09, 0x05, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x06, 0x08, 0x06, 0x08, 0x00, 0x00},
+    {0x00, 0x02, 0x12, 0x12, 0x0a, 0x0a, 0x0c, 0x1a, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x09, 0x09, 0x05, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x40, 0x40, 0x20, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x32, 0x4c, 0x00, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x68, 0x88, 0x68, 0x88, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x18, 0x20, 0x18, 0x20, 0x00, 0x00},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x0c, 0x10, 0x0c, 0x10, 0x00, 0x00},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x28, 0x00, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x88, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x10, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x42, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x4a, 0x4a, 0x74, 0x40, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x20, 0x40, 0x38, 0x10, 0x20, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x24, 0x66, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x42, 0x3e, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x42, 0x42, 0x24, 0x24, 0x24, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x24, 0x24, 0x24, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x44, 0x44, 0x3c, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x00, 0x00, 0x4e, 0x89, 0x87, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x91, 0x49, 0x76, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x91, 0x49, 0x76, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x91, 0x61, 0x7e, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x30, 0x18, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x32, 0x4c, 0x00, 0x10, 0x18, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x34, 0x46, 0x36, 0x44, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x10, 0x0c, 0x10, 0x06, 0x09, 0x09, 0x07, 0x01, 0x01, 0x22, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x12, 0x0c, 0x13, 0x20, 0x40, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x0c, 0x10, 0x0c, 0x10, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x14, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x28, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x01, 0x21, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x04, 0x02, 0x01, 0x01, 0x21, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x44, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x44, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x49, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x21, 0x49, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x51, 0x61, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x0e, 0x51, 0x61, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x31, 0x21, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x24, 0x20, 0x20, 0x2e, 0x31, 0x21, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x08, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x08, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x20, 0x10, 0x3c, 0x40, 0x80, 0x80, 0x80, 0x82, 0x7c, 0x00},
+    {0x00, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0xf9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x0d, 0x11, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x07, 0x01, 0x01, 0x22, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x0e, 0x91, 0x61, 0x7e, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x14, 0x08, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1e, 0x21, 0x12, 0x0c, 0x13, 0x20, 0x40, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1c, 0x22, 0x20, 0x10, 0x3c, 0x40, 0x80, 0x80, 0x80, 0x82, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x01, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00},
+    {0x00, 0x22, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x22, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x81, 0x91, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x24, 0x18, 0xff, 0x18, 0x24, 0x14, 0x0c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x49, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x28, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1c, 0x22, 0x14, 0x08, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x49, 0x87, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x65, 0x99, 0x01, 0x09, 0x05, 0x06, 0x0d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x65, 0x99, 0x01, 0x09, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x81, 0x81, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x0d, 0x11, 0x0d, 0x51, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x50, 0x00},
+    {0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xcf, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xdb, 0x99, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc6, 0xc6, 0x7e, 0x36, 0x66, 0xe7, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x48, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xbf, 0x30, 0x30, 0x30, 0x3e, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb3, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x5e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xbe, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb3, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x42, 0x99, 0xa5, 0xa1, 0xa5, 0x99, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb8, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0x0c, 0x30, 0x0c, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x08, 0x10, 0x00, 0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x08, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x06, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc0, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0x80, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0x6c, 0x38, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0x60, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x60, 0x60, 0x60, 0x3e, 0x06, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x66, 0x36, 0x3e, 0x86, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3e, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xdd, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x30, 0x30, 0x1c, 0x30, 0x60, 0x60, 0x60, 0x3e, 0x06, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xdc, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0x7c, 0x06, 0x06, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x56, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10, 0x00},
+    {0x04, 0x08, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x04, 0x08, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP437[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP737[] = {
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 113, 193, 194, 195, 196, 118, 119, 197, 198, 199, 200, 201, 202, 203, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP771[] = {
+    204, 205, 129, 206, 207, 132, 208, 209, 210, 211, 212, 213, 139, 134, 142, 143,
+    214, 215, 146, 216, 217, 149, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 166, 242,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 243, 244, 245, 246,
+    247, 248, 249, 250, 251, 174, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261,
+    262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 203, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP775[] = {
+    276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+    292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 42, 43, 44, 318, 319, 320,
+    48, 49, 50, 51, 52, 243, 245, 262, 264, 57, 58, 59, 60, 266, 268, 63,
+    64, 65, 66, 67, 68, 69, 270, 272, 72, 73, 74, 75, 76, 77, 78, 274,
+    244, 246, 263, 265, 267, 269, 271, 273, 275, 89, 90, 91, 92, 93, 94, 95,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336,
+    337, 113, 338, 339, 340, 341, 118, 342, 197, 198, 199, 343, 344, 202, 203, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP850[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 345,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 346, 28, 347, 306, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 348, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 349, 350, 351, 352, 57, 58, 59, 60, 353, 354, 63,
+    64, 65, 66, 67, 68, 69, 355, 356, 72, 73, 74, 75, 76, 77, 78, 357,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 89, 90, 91, 92, 315, 367, 95,
+    368, 97, 369, 370, 371, 372, 102, 373, 374, 375, 376, 377, 378, 379, 380, 381,
+    382, 113, 383, 339, 384, 341, 118, 385, 120, 386, 122, 387, 388, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP852[] = {
+    389, 1, 2, 3, 4, 390, 391, 392, 393, 9, 394, 395, 12, 396, 397, 398,
+    399, 400, 401, 19, 20, 402, 403, 404, 405, 25, 26, 406, 407, 408, 409, 410,
+    32, 33, 34, 35, 411, 412, 413, 414, 415, 416, 127, 417, 418, 419, 46, 420,
+    48, 49, 50, 51, 52, 421, 422, 423, 424, 57, 58, 59, 60, 425, 426, 63,
+    64, 65, 66, 67, 68, 69, 427, 428, 72, 73, 74, 75, 76, 77, 78, 429,
+    430, 359, 431, 432, 433, 434, 364, 365, 435, 89, 90, 91, 92, 436, 437, 95,
+    438, 97, 369, 439, 440, 441, 442, 443, 444, 375, 445, 446, 378, 379, 447, 381,
+    448, 449, 450, 451, 452, 341, 453, 454, 120, 455, 456, 457, 458, 459, 460, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP855[] = {
+    461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+    477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+    493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 46, 47,
+    507, 508, 509, 51, 510, 511, 512, 513, 514, 515, 58, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+    537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 91, 548, 549, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567,
+    448, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 341, 580, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP857[] = {
+    581, 1, 2, 3, 4, 5, 6, 582, 8, 9, 10, 11, 12, 583, 14, 15,
+    16, 584, 18, 19, 20, 21, 22, 23, 585, 25, 26, 346, 28, 586, 587, 588,
+    32, 33, 34, 35, 36, 37, 589, 590, 40, 348, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 349, 350, 351, 352, 57, 58, 59, 60, 353, 354, 63,
+    64, 65, 66, 67, 68, 69, 355, 356, 72, 73, 74, 75, 76, 77, 78, 357,
+    39, 38, 360, 361, 362, 127, 364, 365, 366, 89, 90, 91, 92, 315, 367, 95,
+    368, 97, 369, 370, 371, 372, 102, 127, 306, 375, 376, 377, 13, 24, 380, 381,
+    382, 113, 127, 339, 384, 341, 118, 385, 120, 386, 122, 387, 388, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP860[] = {
+    0, 1, 2, 3, 355, 5, 349, 7, 8, 360, 10, 364, 369, 13, 356, 591,
+    16, 351, 362, 19, 371, 21, 375, 23, 367, 372, 26, 27, 28, 377, 30, 368,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 370, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP861[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 592, 358, 593, 14, 15,
+    16, 17, 18, 19, 20, 594, 22, 595, 378, 25, 26, 596, 28, 597, 30, 31,
+    32, 33, 34, 35, 349, 364, 368, 375, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP862[] = {
+    598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613,
+    614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 298, 304, 625, 626, 627,
+    628, 629, 310, 630, 631, 632, 633, 634, 635, 41, 42, 43, 44, 636, 319, 320,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    152, 322, 637, 167, 638, 169, 327, 639, 640, 641, 642, 643, 644, 645, 646, 111,
+    112, 113, 193, 194, 647, 117, 118, 119, 197, 198, 199, 648, 201, 202, 203, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP863[] = {
+    0, 1, 2, 3, 649, 5, 650, 7, 8, 9, 10, 11, 12, 383, 651, 341,
+    16, 362, 360, 19, 361, 366, 22, 23, 357, 369, 26, 27, 28, 377, 376, 31,
+    315, 381, 34, 35, 386, 385, 388, 380, 365, 41, 42, 43, 44, 652, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP864[] = {
+    197, 199, 198, 653, 508, 525, 51, 526, 510, 523, 524, 522, 520, 547, 521, 546,
+    654, 644, 645, 113, 655, 656, 119, 657, 658, 659, 660, 661, 662, 663, 664, 665,
+    127, 337, 666, 304, 307, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677,
+    678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693,
+    298, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 315, 42, 118, 306, 720,
+    525, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 203, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP865[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 345,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 596, 28, 347, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 357,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP866[] = {
+    494, 750, 564, 506, 500, 502, 562, 571, 514, 519, 528, 751, 540, 542, 544, 549,
+    554, 556, 752, 560, 753, 512, 498, 579, 573, 754, 492, 569, 566, 575, 490, 552,
+    493, 495, 563, 505, 499, 501, 561, 570, 513, 518, 527, 537, 539, 541, 543, 545,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    553, 555, 557, 559, 755, 511, 497, 578, 572, 576, 491, 568, 565, 574, 489, 756,
+    466, 465, 468, 467, 474, 473, 486, 485, 120, 121, 122, 757, 567, 536, 126, 127};
+
+static const __in_flash("font") font_index_t FONT16_CP869[] = {
+    127, 127, 127, 127, 127, 127, 758, 127, 759, 760, 761, 762, 763, 764, 68, 765,
+    766, 767, 768, 127, 127, 769, 770, 771, 772, 773, 774, 775, 28, 776, 777, 778,
+    779, 780, 781, 782, 783, 564, 784, 785, 786, 787, 542, 43, 788, 789, 46, 47,
+    48, 49, 50, 51, 52, 790, 791, 540, 792, 57, 58, 59, 60, 793, 544, 63,
+    64, 65, 66, 67, 68, 69, 794, 795, 72, 73, 74, 75, 76, 77, 78, 796,
+    797, 798, 799, 800, 801, 802, 803, 804, 805, 89, 90, 91, 92, 806, 807, 95,
+    808, 809, 810, 811, 812, 813, 814, 815, 816, 543, 817, 818, 819, 820, 821, 822,
+    448, 113, 823, 824, 825, 341, 826, 827, 120, 828, 829, 830, 831, 832, 126, 127};
+
+#elif RP6502_CODE_PAGE == 437
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x38, 0x6c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x7e, 0xd8, 0x7e, 0x00},
+    {0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x66, 0x66, 0x3c, 0x7e, 0x18, 0x7e, 0x18, 0x18},
+    {0xf8, 0xcc, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x7e},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP437[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP437[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 737
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0xf0},
+    {0x00, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xfe},
+    {0x00, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe},
+    {0x00, 0xfe, 0xc6, 0x8c, 0x18, 0x32, 0x66, 0xfe},
+    {0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6},
+    {0x00, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6},
+    {0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6},
+    {0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6},
+    {0x00, 0xfe, 0x82, 0x00, 0x38, 0x00, 0x82, 0xfe},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0},
+    {0x00, 0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe},
+    {0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c},
+    {0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xdc, 0x76},
+    {0x00, 0x7c, 0xc6, 0xfc, 0xc6, 0xfc, 0xc0, 0x80},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x3c, 0x60, 0x38, 0x7c, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x70, 0xc6, 0x7c},
+    {0x00, 0xfe, 0x38, 0x60, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x06},
+    {0x00, 0x78, 0xcc, 0x7e, 0x0c, 0xcc, 0xcc, 0x78},
+    {0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c},
+    {0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xcc, 0xc6},
+    {0x00, 0x78, 0xcc, 0x0c, 0x3c, 0x6c, 0xc6, 0xc6},
+    {0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xf6, 0xc0},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x38},
+    {0x7e, 0x38, 0x60, 0x38, 0xe0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfc, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70},
+    {0x00, 0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0x00, 0xfe, 0x30, 0x30, 0x36, 0x1c},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x00, 0x00, 0x00, 0x5c, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6},
+    {0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x44, 0xd6, 0xd6, 0xfe, 0x6c},
+    {0x08, 0x10, 0x00, 0x76, 0xdc, 0xd8, 0xdc, 0x76},
+    {0x08, 0x10, 0x00, 0x7c, 0xc6, 0x70, 0xc6, 0x7c},
+    {0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x06},
+    {0x00, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x0e},
+    {0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c},
+    {0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x08, 0x10, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c},
+    {0x08, 0x10, 0x00, 0x44, 0xd6, 0xd6, 0xfe, 0x6c},
+    {0x40, 0xb8, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x40, 0xbe, 0x30, 0x30, 0x3c, 0x30, 0x30, 0x3e},
+    {0x40, 0xb6, 0x36, 0x36, 0x3e, 0x36, 0x36, 0x36},
+    {0x40, 0xbc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x40, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c},
+    {0x40, 0xb6, 0x36, 0x36, 0x1c, 0x08, 0x08, 0x1c},
+    {0x40, 0xb8, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee},
+    {0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e},
+    {0x00, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e},
+    {0x00, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x66, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c},
+    {0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00},
+    {0x00, 0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP737[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xfe, 0x82, 0x00, 0x7c, 0x7c, 0x00, 0x82, 0xfe, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x62, 0x30, 0x18, 0x18, 0x30, 0x62, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0x7c, 0x06, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3e, 0x06, 0xc6, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xf8, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0x0c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf6, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x38, 0x60, 0x60, 0x3c, 0x60, 0xc0, 0xc0, 0xc0, 0x7c, 0x06, 0x1c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x60, 0x3c, 0x06, 0x1c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xc6, 0xd6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0xc6, 0xd6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x7e, 0x60, 0x60, 0x60, 0x78, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0x80, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP737[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 771
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x00, 0x3e, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x00, 0xfe, 0x66, 0x60, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0xfe, 0x66, 0x60, 0x60, 0x60, 0x60, 0xf0},
+    {0x00, 0x1c, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x00, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe},
+    {0x00, 0xd6, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0xd6},
+    {0x00, 0x7c, 0xc6, 0x0c, 0x3c, 0x0c, 0xc6, 0x7c},
+    {0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6},
+    {0xc6, 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6},
+    {0x00, 0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6},
+    {0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xc6},
+    {0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6},
+    {0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6},
+    {0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c},
+    {0x00, 0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6},
+    {0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0xf0, 0xf0, 0xb0, 0x3c, 0x36, 0x36, 0x7c},
+    {0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6},
+    {0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc},
+    {0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c},
+    {0x00, 0xcc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xcc},
+    {0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xce},
+    {0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x00, 0x06, 0x7c, 0xc0, 0xfc, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x60, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x00, 0x00, 0x00, 0xd6, 0x7c, 0x38, 0x7c, 0xd6},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x1c, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6},
+    {0xc6, 0x7c, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6},
+    {0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0xe6},
+    {0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0xe6},
+    {0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xd6, 0xc6},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x18, 0x0e},
+    {0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x18, 0x0e},
+    {0x36, 0x1c, 0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x7c, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x3c},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6},
+    {0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0x00, 0x00, 0xf0, 0xb0, 0x3c, 0x36, 0x3c},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xf6, 0xde, 0xf6},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0xfc},
+    {0x00, 0x00, 0x00, 0xfc, 0x06, 0x3e, 0x06, 0xfc},
+    {0x00, 0x00, 0x00, 0xcc, 0xd6, 0xf6, 0xd6, 0xcc},
+    {0x00, 0x00, 0x00, 0x7e, 0xcc, 0x7c, 0x6c, 0xce},
+    {0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x18, 0x0e},
+    {0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x18, 0x0e},
+    {0x18, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x6c, 0x38, 0x7e, 0xc2, 0x70, 0x1c, 0x86, 0xfc},
+    {0x36, 0x1c, 0x00, 0x3e, 0x60, 0x3c, 0x06, 0x7c},
+    {0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x0e},
+    {0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x0e},
+    {0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x6c, 0x38, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0x36, 0x1c, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP771[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0x81, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x54, 0x7c, 0x7c, 0x54, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x3c, 0x0c, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0xc6, 0x7c, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x30, 0x3c, 0x36, 0x36, 0x36, 0x36, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x26, 0x3e, 0x26, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x06, 0x7c, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0xc3, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x36, 0x1c, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c},
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x3c, 0x36, 0x36, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x18, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x00, 0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP771[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 775
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x0c, 0x18, 0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c},
+    {0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x00, 0xfe, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x00, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x3c, 0x60, 0x30, 0x76, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0x38, 0x6c, 0x38, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x30, 0x36, 0x3c, 0x38, 0x30, 0x70, 0xdc},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0xe6, 0x18, 0x70},
+    {0x00, 0xdc, 0x76, 0x60, 0x60, 0xf0, 0x18, 0x70},
+    {0x00, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c},
+    {0x0c, 0x18, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x38, 0x6c, 0x38, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x0c, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0x00, 0x00, 0x00, 0xec, 0x36, 0x7e, 0xd8, 0x6e},
+    {0x00, 0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x3c, 0x66, 0xc0, 0xce, 0x66, 0x3a, 0x0c, 0x38},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x0c, 0x18, 0x7e, 0xc2, 0x70, 0x1c, 0x86, 0xfc},
+    {0x06, 0x0c, 0x00, 0x3e, 0x60, 0x3c, 0x06, 0x7c},
+    {0xc6, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x60, 0x66, 0xfc},
+    {0x00, 0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6},
+    {0xfe, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6},
+    {0x7e, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x18, 0x18, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0x18, 0x18, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x0c, 0x18, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x00, 0xcc, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18},
+    {0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0x9a, 0x82, 0x7c},
+    {0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0x82, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x00, 0x30, 0x30, 0x3c, 0x78, 0xf0, 0x30, 0x3e},
+    {0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33},
+    {0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x18, 0x0e},
+    {0x36, 0x1c, 0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c},
+    {0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x18, 0x0e},
+    {0x18, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x6c, 0x38, 0x7e, 0xc2, 0x70, 0x1c, 0x86, 0xfc},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x0e},
+    {0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x6c, 0x38, 0xfe, 0x86, 0x1c, 0x70, 0xc2, 0xfe},
+    {0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x18, 0x0e},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c},
+    {0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x18, 0x0e},
+    {0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c},
+    {0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x18, 0x0e},
+    {0x36, 0x1c, 0x00, 0x3e, 0x60, 0x3c, 0x06, 0x7c},
+    {0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x0e},
+    {0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x36, 0x1c, 0x00, 0x7e, 0x0c, 0x18, 0x30, 0x7e},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x00, 0x78, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xcc},
+    {0xfe, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x0c, 0x18, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x0c, 0x18, 0x00, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6},
+    {0xe6, 0x6c, 0x78, 0x78, 0x6c, 0xe6, 0x18, 0x70},
+    {0x60, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0x18, 0x70},
+    {0xf0, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x70},
+    {0x38, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x70},
+    {0x00, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x18, 0x70},
+    {0xfe, 0x00, 0xfe, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe},
+    {0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x18, 0x70},
+    {0x00, 0x18, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e},
+    {0x00, 0x66, 0xcc, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0xe1, 0x32, 0xe4, 0x3a, 0xf6, 0x2a, 0x5f, 0x86},
+    {0x00, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0xcc},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x38, 0x18, 0x18, 0x3c, 0x00, 0x00},
+    {0x00, 0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP775[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x0c, 0x18, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x60, 0x30, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78},
+    {0x00, 0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x1a, 0x1e, 0x1c, 0x18, 0x38, 0x78, 0x58, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x30, 0x18, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0xc6, 0x66, 0x3a, 0x0c, 0x06, 0x3c},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0xce, 0xd6, 0xd6, 0xd6, 0xe6, 0x7c, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x7c, 0xce, 0xce, 0xd6, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0x7c, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0xfe, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x7e, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x22, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0xa2, 0xa2, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x82, 0xb2, 0xaa, 0xaa, 0xb2, 0xaa, 0xaa, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf0, 0x64, 0x6c, 0x78, 0x70, 0xe0, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x30, 0x1e},
+    {0x36, 0x1c, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x30, 0x1e},
+    {0x18, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x00, 0xfe, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x6c, 0x38, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x10, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0xfe, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x0c, 0x78},
+    {0x00, 0xfe, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x0c, 0x78},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x22, 0x44, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe0, 0x30, 0x62, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x22, 0x44},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP775[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 850
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x38, 0x6c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0x12, 0xfe, 0x90, 0xfe, 0x00},
+    {0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8, 0x00},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x7e, 0x81, 0xb9, 0xa5, 0xb9, 0xa5, 0x81, 0x7e},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x18, 0x0c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7e, 0x81, 0x9d, 0xa1, 0xa1, 0x9d, 0x81, 0x7e},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x66, 0x66, 0x3c, 0x7e, 0x18, 0x7e, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x76, 0xdc, 0x7c, 0x06, 0x7e, 0xc6, 0x7e, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x30, 0x7e, 0x0c, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00},
+    {0x7c, 0x82, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0xc6, 0x00, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x1e, 0x21, 0x7c, 0x20, 0x7c, 0x21, 0x1e, 0x00},
+    {0x0c, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x3c, 0x42, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x30, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x0c, 0x06, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0xf0, 0x60, 0x7c, 0x66, 0x7c, 0x60, 0xf0, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0x82, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x60, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0x0c, 0x18, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x00},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff},
+    {0xe1, 0x32, 0xe4, 0x3a, 0xf6, 0x2a, 0x5f, 0x86},
+    {0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x38},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x38, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP850[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x04, 0x7c, 0xce, 0xce, 0xd6, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0x7c, 0x40, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0xaa, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x60, 0xc0, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x7c, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0xa2, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x34, 0x18, 0x2c, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x33, 0x60, 0xfe, 0x60, 0xfc, 0x60, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00},
+    {0x0c, 0x18, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00},
+    {0x00, 0xe0, 0x30, 0x62, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP850[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 852
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c, 0x0c, 0x38},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x18, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x78, 0x84, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x30, 0xcc, 0x30, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x18, 0x30, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x18},
+    {0x30, 0x36, 0x3c, 0x38, 0x30, 0x70, 0xdc, 0x00},
+    {0xcc, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x66, 0xcc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x66, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0x70, 0x88, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x0c, 0x18, 0xfe, 0x0c, 0x30, 0x60, 0xfe, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00},
+    {0xcc, 0xd8, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xcc, 0xd8, 0xc0, 0xc0, 0xc0, 0xc0, 0x78, 0x00},
+    {0x78, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0xcc, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0xf6, 0xdc, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xf6, 0xdc, 0xc0, 0xc0, 0xc0, 0xc0, 0x78, 0x00},
+    {0x0c, 0x18, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00},
+    {0x0c, 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x00},
+    {0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xcc, 0x78, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00},
+    {0xcc, 0x78, 0x30, 0xfc, 0x30, 0x30, 0x1e, 0x00},
+    {0x60, 0x6c, 0x78, 0x70, 0x60, 0xe0, 0x7e, 0x00},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00},
+    {0x66, 0x3c, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00},
+    {0x0c, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x0c, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x0c, 0x18, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x18, 0x30, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xd6, 0x18, 0x0e},
+    {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x0f},
+    {0x66, 0x3c, 0xfe, 0x0c, 0x18, 0x60, 0xfe, 0x00},
+    {0x66, 0x3c, 0x00, 0x7e, 0x0c, 0x30, 0x7e, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0xfe, 0x1c},
+    {0x00, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x1c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7e, 0x0c, 0x30, 0x7e, 0x00},
+    {0x66, 0x3c, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x38},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xcc, 0x78, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x78, 0xcc, 0x60, 0x30, 0x18, 0xcc, 0x78, 0x30},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0xfe, 0xc6, 0x0c, 0x30, 0xc6, 0xfe, 0x00},
+    {0x00, 0x18, 0x00, 0x7c, 0x18, 0x30, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0xc6, 0x7c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xcc, 0x78, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x00, 0x42, 0x3c, 0x66, 0x66, 0x3c, 0x42, 0x00},
+    {0x0c, 0x3e, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00},
+    {0x7c, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x7c, 0x00},
+    {0xcc, 0x78, 0xfc, 0x66, 0x66, 0x66, 0xfc, 0x00},
+    {0xcc, 0x00, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00},
+    {0x96, 0x66, 0x06, 0x7e, 0xc6, 0xc6, 0x7e, 0x00},
+    {0x24, 0x18, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00},
+    {0x18, 0x30, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x78, 0x84, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0xcc, 0x78, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x1c},
+    {0x10, 0x28, 0xd6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x78, 0xcc, 0xf8, 0xcc, 0xf8, 0xc0, 0xc0},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00},
+    {0x0c, 0x18, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x66, 0x3c, 0xdc, 0xe6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x6c, 0x38, 0x7e, 0xe0, 0x38, 0x0e, 0xfc, 0x00},
+    {0x6c, 0x38, 0x7c, 0x40, 0x38, 0x04, 0x7c, 0x00},
+    {0x0c, 0x18, 0xfc, 0xc6, 0xfc, 0xd8, 0xcc, 0x00},
+    {0x0c, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xce, 0xf0, 0xe0, 0xc0, 0xc0, 0x00},
+    {0x66, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xc6, 0xc6, 0x66, 0x3e, 0x0c, 0x78},
+    {0x0c, 0xde, 0xc6, 0x66, 0x3c, 0x18, 0x30, 0x00},
+    {0x30, 0x78, 0x30, 0x30, 0x30, 0x38, 0x18, 0x78},
+    {0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c},
+    {0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x38, 0x6c, 0x6c, 0x38, 0xcc, 0x78},
+    {0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1c},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xd8, 0x70, 0xfc, 0xc6, 0xfc, 0xd8, 0xcc, 0x00},
+    {0xd8, 0x70, 0xce, 0xd8, 0xe0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP852[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 42};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x78, 0xcc, 0x78, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x00, 0x38, 0x1a, 0x1e, 0x1c, 0x18, 0x38, 0x78, 0x58, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x36, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xfe, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x78, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf6, 0x6c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x6c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1b, 0xee, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1b, 0xee, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x3c, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf0, 0x64, 0x6c, 0x78, 0x70, 0xe0, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0x30, 0x1e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x18, 0x30, 0x1e, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0xc6, 0x8c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x18, 0x30, 0x1e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x30, 0x60, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x3c, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x36, 0x1b, 0x36, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x30, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x18, 0x0c, 0x78, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x00, 0xfe, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0xfe, 0xcc, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xc6, 0x7c, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x7c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x0c, 0x7e, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x3c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x0c, 0x78, 0x00},
+    {0x38, 0x6c, 0x38, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0x7c, 0xc6, 0xc0, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00},
+    {0x0c, 0x18, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x3c, 0x00},
+    {0x00, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x36, 0x6c, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6c, 0x38, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP852[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 42};
+
+#elif RP6502_CODE_PAGE == 855
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x60, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x0c},
+    {0xfc, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x6c, 0x00},
+    {0x1c, 0x10, 0x00, 0x7e, 0x60, 0x60, 0x60, 0x00},
+    {0x38, 0x20, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x6c, 0xfe, 0x62, 0x78, 0x60, 0x62, 0xfe, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xf0, 0xc6, 0x7c, 0x00},
+    {0x3c, 0x66, 0xc0, 0xf8, 0xc0, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00},
+    {0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00},
+    {0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70},
+    {0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0xf8, 0x58, 0x5c, 0x5a, 0xdc, 0x00},
+    {0xf8, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0xdc, 0x00},
+    {0x00, 0x00, 0xd8, 0xd8, 0xfc, 0xda, 0xdc, 0x00},
+    {0xd8, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xdc, 0x00},
+    {0x60, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x00},
+    {0xf8, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0x1c, 0x10, 0xc6, 0xd8, 0xf8, 0xcc, 0xc6, 0x00},
+    {0x18, 0xd6, 0xcc, 0xf8, 0xf8, 0xcc, 0xc6, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x38, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10},
+    {0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10},
+    {0x00, 0x00, 0xdc, 0xd6, 0xf6, 0xd6, 0xdc, 0x00},
+    {0xdc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xdc, 0x00},
+    {0x00, 0x00, 0xf0, 0xb0, 0x3c, 0x36, 0x3c, 0x00},
+    {0xf0, 0xf0, 0xb0, 0x3c, 0x36, 0x36, 0x3c, 0x00},
+    {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x3e, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x06, 0x7c, 0xc0, 0x7c, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xfe, 0x66, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3},
+    {0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00},
+    {0x00, 0x30, 0x10, 0x7c, 0xd6, 0x7c, 0x10, 0x38},
+    {0x38, 0x10, 0x7c, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x60, 0x60, 0xf0, 0x00},
+    {0xfe, 0x66, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00},
+    {0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0xe6, 0x00},
+    {0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0xe6, 0x00},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xfe, 0xfe, 0xd6, 0xc6, 0x00},
+    {0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0x7e, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x3c, 0x00},
+    {0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0x7c, 0xd6, 0xd6, 0x00},
+    {0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc, 0x00},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0xfc, 0x00},
+    {0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x00},
+    {0x8f, 0xcd, 0xef, 0xfc, 0xdc, 0xcc, 0xcc, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xf6, 0xde, 0xf6, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1c, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1e, 0xc6, 0x7c, 0x00},
+    {0x78, 0x8c, 0x06, 0x3e, 0x06, 0x8c, 0x78, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP855[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x60, 0x60, 0xf8, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0xe6, 0x06, 0x04, 0x08, 0x00},
+    {0x00, 0x00, 0xfc, 0x60, 0x60, 0x60, 0x6c, 0x76, 0x66, 0x66, 0x66, 0xec, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xf8, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc8, 0xf8, 0xc8, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x58, 0x58, 0x58, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xda, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xd8, 0xfc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0xf8, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xe6, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xee, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xce, 0xdb, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x3e, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0xf0, 0xb0, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x06, 0x7c, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0xc3, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0x81, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x3c, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11},
+    {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0x7e, 0x36, 0x66, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x3e, 0x3e, 0x66, 0x66, 0x66, 0xe7, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xdb, 0xdb, 0x5a, 0x5a, 0x7e, 0x7e, 0x5a, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcf, 0xcd, 0xef, 0xec, 0xff, 0xdc, 0xdc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xf3, 0xdb, 0xdb, 0xdb, 0xdb, 0xf3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x26, 0x3e, 0x26, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP855[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 857
+
+typedef uint8_t font_index_t;
 
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7c, 0xc0, 0xc0, 0x7c, 0x30, 0x60},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x38, 0x00, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x7e, 0xd8, 0x7e, 0x00},
+    {0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x00},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xc6, 0x70, 0x1c, 0xc6, 0x7c, 0x18, 0x30},
+    {0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x30, 0x60},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x66, 0x3c, 0x66, 0xc0, 0xce, 0xc6, 0x7c, 0x00},
+    {0x6c, 0x38, 0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x7e, 0x81, 0xb9, 0xa5, 0xb9, 0xa5, 0x81, 0x7e},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x18, 0x0c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7e, 0x81, 0x9d, 0xa1, 0xa1, 0x9d, 0x81, 0x7e},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x66, 0x66, 0x3c, 0x7e, 0x18, 0x7e, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x76, 0xdc, 0x7c, 0x06, 0x7e, 0xc6, 0x7e, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x7c, 0x82, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0xc6, 0x00, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x3c, 0x42, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x30, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x0c, 0x06, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0x82, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x60, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0xe1, 0x32, 0xe4, 0x3a, 0xf6, 0x2a, 0x5f, 0x86},
+    {0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x38},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x38, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP857[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 85, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 85, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 85};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x0c, 0xc6, 0x7c, 0x18, 0x30, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x7e, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0x6e, 0x3a, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x78, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0xaa, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x60, 0xc0, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x7c, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0xa2, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe0, 0x30, 0x62, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP857[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 85, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 85, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 85};
+
+#elif RP6502_CODE_PAGE == 860
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x0c, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x60, 0x30, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0c, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x76, 0xdc, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x30, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xf8, 0xcc, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7},
+    {0x0c, 0x18, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x30, 0x18, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x7e},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP860[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x60, 0xc0, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP860[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 861
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x18, 0x0c, 0x78},
+    {0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x18, 0x20, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x7e, 0xc3, 0x3c, 0x06, 0x3e, 0x66, 0x3f, 0x00},
+    {0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x60, 0x10, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x00, 0x00, 0x78, 0xc0, 0xc0, 0x78, 0x0c, 0x38},
+    {0x7e, 0xc3, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00},
+    {0xcc, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0x60, 0x10, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00},
+    {0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00},
+    {0x30, 0x7c, 0x18, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0xe0, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf8, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x30, 0x30, 0x00, 0x78, 0xcc, 0xfc, 0xcc, 0x00},
+    {0x18, 0x30, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00},
+    {0x00, 0x00, 0x76, 0x1b, 0x7f, 0xcc, 0x77, 0x00},
+    {0x3e, 0x58, 0x98, 0x9e, 0xf8, 0x98, 0x9e, 0x00},
+    {0x78, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00},
+    {0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xe0},
+    {0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x18, 0x30, 0xc6, 0xc6, 0x7c, 0x38, 0x7c, 0x00},
+    {0x18, 0x10, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0xe6, 0xfc, 0x00},
+    {0x7a, 0xc4, 0xce, 0xd6, 0xe6, 0x46, 0xbc, 0x00},
+    {0xf8, 0xcc, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0x18, 0xd8, 0x70},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00},
+    {0x18, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00},
+    {0x18, 0x30, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00},
+    {0x30, 0x60, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x18, 0x30, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x60, 0xd8, 0x24, 0x66, 0x66, 0x24, 0x18, 0x00},
+    {0x18, 0xb2, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x00, 0x30, 0x60, 0xc0, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0x00, 0x00},
+    {0xc3, 0xc6, 0xcc, 0xde, 0x33, 0x66, 0xcc, 0x0f},
+    {0xc3, 0xc6, 0xcc, 0xdb, 0x37, 0x6f, 0xcf, 0x03},
+    {0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x00, 0x78, 0xcc, 0xf8, 0xcc, 0xf8, 0xc0, 0xc0},
+    {0x00, 0xfc, 0xcc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfc, 0xcc, 0x60, 0x30, 0x60, 0xcc, 0xfc, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0xfc, 0x30, 0x78, 0xcc, 0xcc, 0x78, 0x30, 0xfc},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x1c, 0x30, 0x18, 0x7c, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x38, 0x60, 0xc0, 0xf8, 0xc0, 0x60, 0x38, 0x00},
+    {0x78, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00},
+    {0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00},
+    {0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0xfc, 0x00},
+    {0x60, 0x30, 0x18, 0x30, 0x60, 0x00, 0xfc, 0x00},
+    {0x18, 0x30, 0x60, 0x30, 0x18, 0x00, 0xfc, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x30, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x30, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x78, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00},
+    {0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP861[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0xf6, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x34, 0x18, 0x2c, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x42, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xce, 0xde, 0xd6, 0xf6, 0xe6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x60, 0xc0, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP861[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 862
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x00, 0xc6, 0x66, 0x76, 0xdc, 0xcc, 0xc6, 0x00},
+    {0x00, 0xf8, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x1c, 0x34, 0xe6, 0x00},
+    {0x00, 0xfe, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00},
+    {0x00, 0xfc, 0x06, 0x06, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0xfc, 0x36, 0x30, 0x30, 0x30, 0x30, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xcc, 0xd6, 0xd6, 0xc6, 0xcc, 0x78, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0xfc, 0x00},
+    {0xc0, 0xfc, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xfe, 0x00},
+    {0x00, 0xdc, 0x76, 0x66, 0xc6, 0xc6, 0xde, 0x00},
+    {0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c},
+    {0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x7c, 0x00},
+    {0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xcc, 0x78, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x66, 0x36, 0xfc, 0x00},
+    {0x00, 0xfc, 0x46, 0xc6, 0xe6, 0x06, 0x06, 0x06},
+    {0x00, 0xfc, 0x46, 0xc6, 0xe6, 0x06, 0xfe, 0x00},
+    {0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x70},
+    {0x00, 0x66, 0x36, 0x1c, 0x0c, 0x06, 0x7e, 0x00},
+    {0x00, 0xfc, 0x06, 0x66, 0x6c, 0x6e, 0x60, 0x60},
+    {0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00},
+    {0x00, 0xd6, 0xd6, 0xd6, 0xf6, 0xc6, 0x7c, 0x00},
+    {0x00, 0xfc, 0x66, 0x66, 0x66, 0xe6, 0xe6, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0x7e, 0x18, 0x18, 0x00},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x00},
+    {0xf8, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7, 0x00},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x30, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c},
+    {0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c},
+    {0x18, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0xc6},
+    {0x00, 0x3c, 0x6c, 0x6c, 0x36, 0x00, 0x7e, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00},
+    {0x00, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc6, 0x7c},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x00, 0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18},
+    {0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00},
+    {0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0xc0, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x3c, 0x18, 0x7e, 0x00},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP862[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x66, 0x76, 0xdc, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x1c, 0x36, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x36, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0x06, 0x06, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xde, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x66, 0x66, 0x36, 0x1c, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x46, 0xc6, 0xc6, 0xe6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x46, 0xc6, 0xc6, 0xe6, 0x06, 0x06, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x6c, 0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x66, 0x66, 0x3c, 0x18, 0x0c, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x66, 0x64, 0x6c, 0x6e, 0x60, 0x60, 0x60, 0x60},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x66, 0xe6, 0xe6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x1b, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x36, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP862[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 863
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff},
+    {0x18, 0x0c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x30, 0x18, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x38, 0x44, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0xfe, 0xc0, 0xfc, 0xc0, 0xfe, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x7c, 0x82, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x60, 0x30, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7c, 0x82, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78},
+    {0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x7e, 0x81, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0xe1, 0x32, 0x64, 0x3a, 0xf6, 0x2a, 0x5f, 0x82},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x7e},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP863[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00},
+    {0x18, 0x0c, 0x06, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x78, 0x00, 0x00},
+    {0x00, 0x7c, 0x06, 0x3c, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x3c, 0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0xe0, 0x30, 0xe2, 0x36, 0xec, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP863[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 864
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00},
+    {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x78, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xcc, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00},
+    {0x60, 0x80, 0x64, 0x8a, 0x08, 0x84, 0x82, 0x7c},
+    {0x60, 0x80, 0x60, 0x80, 0x06, 0x49, 0x84, 0x78},
+    {0x61, 0x89, 0x65, 0x82, 0x05, 0x0f, 0x00, 0x00},
+    {0x61, 0x89, 0x65, 0x85, 0x02, 0x1d, 0x00, 0x00},
+    {0x01, 0x09, 0x05, 0x02, 0x65, 0x8f, 0x60, 0x80},
+    {0x01, 0x09, 0x05, 0x05, 0x62, 0x8d, 0x60, 0x80},
+    {0x01, 0x09, 0x05, 0x02, 0x05, 0x0f, 0x00, 0x00},
+    {0x01, 0x09, 0x05, 0x05, 0x02, 0x1d, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x3f},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    {0x32, 0x4c, 0x00, 0x08, 0x08, 0x07, 0x00, 0x00},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6},
+    {0x00, 0x68, 0x88, 0x68, 0x88, 0x07, 0x00, 0x00},
+    {0x04, 0x06, 0x04, 0x04, 0x34, 0x44, 0x30, 0x40},
+    {0x00, 0x08, 0x08, 0x08, 0x68, 0x87, 0x60, 0x80},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x10},
+    {0x00, 0x00, 0x28, 0x81, 0x81, 0x7e, 0x00, 0x00},
+    {0x10, 0x00, 0x28, 0x81, 0x81, 0x7e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x44, 0x93, 0x80, 0x7c},
+    {0x00, 0x00, 0x00, 0xfe, 0x44, 0x83, 0x80, 0x7c},
+    {0x00, 0x10, 0x00, 0xfe, 0x44, 0x83, 0x80, 0x7c},
+    {0x00, 0x00, 0x18, 0x3c, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x10, 0x08, 0x08, 0x08, 0x00, 0x00},
+    {0x00, 0x3c, 0x42, 0x20, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x4a, 0x4a, 0x34, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x3c, 0x40, 0x38, 0x42, 0x3c, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x42, 0x3c, 0x00, 0x00},
+    {0x00, 0x42, 0x3e, 0x04, 0x04, 0x02, 0x00, 0x00},
+    {0x00, 0x42, 0x42, 0x24, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x24, 0x42, 0x42, 0x00, 0x00},
+    {0x00, 0x38, 0x44, 0x3c, 0x04, 0x02, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x89, 0x87, 0x7e, 0x00, 0x00},
+    {0x00, 0x08, 0x10, 0x18, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x49, 0x49, 0x76, 0x80, 0x00},
+    {0x08, 0x22, 0x00, 0x49, 0x49, 0x76, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x0e, 0x91, 0x7e, 0x80, 0x00},
+    {0x1c, 0x22, 0x10, 0x08, 0x00, 0x08, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0xc0, 0x7e, 0x18, 0x18, 0x00},
+    {0x00, 0x00, 0x1c, 0x20, 0x1c, 0x20, 0x00, 0x00},
+    {0x32, 0x4c, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00},
+    {0x00, 0x1a, 0x22, 0x1a, 0x22, 0x02, 0x00, 0x00},
+    {0x60, 0x80, 0x66, 0x89, 0x0f, 0x01, 0x11, 0x0e},
+    {0x00, 0x00, 0x0e, 0x11, 0x0e, 0x31, 0x40, 0x3e},
+    {0x0c, 0x10, 0x0c, 0x11, 0x01, 0xfe, 0x00, 0x00},
+    {0x10, 0x18, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x08},
+    {0x14, 0x00, 0x0c, 0x12, 0x11, 0x0e, 0x00, 0x00},
+    {0x00, 0x14, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x29, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x10},
+    {0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00},
+    {0x10, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00},
+    {0x00, 0x04, 0x02, 0x01, 0x21, 0x3f, 0x00, 0x00},
+    {0x10, 0x04, 0x02, 0x01, 0x21, 0x3f, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x22, 0x1c},
+    {0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x22, 0x1c},
+    {0x00, 0x00, 0x00, 0x29, 0x29, 0xd6, 0x00, 0x00},
+    {0x08, 0x22, 0x00, 0x29, 0x29, 0xd6, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x49, 0x51, 0xfe, 0x00, 0x00},
+    {0x00, 0x10, 0x06, 0x49, 0x51, 0xfe, 0x00, 0x00},
+    {0x20, 0x20, 0x20, 0x2e, 0x31, 0xfe, 0x00, 0x00},
+    {0x20, 0x24, 0x20, 0x2e, 0x31, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x0c, 0x12, 0x10, 0xfe, 0x00, 0x00},
+    {0x08, 0x00, 0x0c, 0x12, 0x10, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00},
+    {0x00, 0x00, 0x3c, 0x40, 0x38, 0x40, 0x42, 0x3c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00},
+    {0x0a, 0x00, 0x06, 0x09, 0x07, 0xfe, 0x00, 0x00},
+    {0x02, 0x04, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x06, 0x09, 0xf9, 0x06, 0x00},
+    {0x00, 0x08, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x00},
+    {0x00, 0x0c, 0x12, 0x0d, 0x11, 0xee, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x42, 0x3c},
+    {0x00, 0x00, 0x04, 0x0a, 0x08, 0x84, 0x82, 0x7c},
+    {0x00, 0x00, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x14},
+    {0x00, 0x08, 0x00, 0x0e, 0x91, 0x7e, 0x80, 0x00},
+    {0x00, 0x00, 0x1e, 0x22, 0x1c, 0xf7, 0x00, 0x00},
+    {0x04, 0x00, 0x0e, 0x11, 0x0e, 0x31, 0x40, 0x3e},
+    {0x10, 0x00, 0x3c, 0x40, 0x38, 0x40, 0x42, 0x3c},
+    {0x00, 0x00, 0x0c, 0x12, 0x01, 0x3e, 0x40, 0x40},
+    {0x00, 0x92, 0x6c, 0x00, 0x00, 0xfe, 0x00, 0x00},
+    {0x00, 0x92, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x42, 0x91, 0x81, 0x7e},
+    {0x00, 0x00, 0x0c, 0x12, 0x11, 0x0e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x24, 0xff, 0x24, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x81, 0x7e},
+    {0x00, 0x00, 0x4c, 0x92, 0x8a, 0x79, 0x00, 0x24},
+    {0x08, 0x00, 0x1e, 0x22, 0x1c, 0xf7, 0x00, 0x00},
+    {0x0a, 0x00, 0x06, 0x09, 0x0f, 0x81, 0x81, 0x7e},
+    {0x49, 0xb1, 0x05, 0x02, 0x05, 0x0f, 0x00, 0x00},
+    {0x49, 0xb1, 0x05, 0x05, 0x02, 0x1d, 0x00, 0x00},
+    {0x01, 0x01, 0x01, 0x01, 0x21, 0x41, 0x41, 0x3e},
+    {0x0d, 0x11, 0x0d, 0x91, 0x81, 0x7e, 0x00, 0x00},
+    {0x08, 0x14, 0x10, 0x8c, 0x82, 0x7c, 0x00, 0x28},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP864[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 32};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00},
+    {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xdc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x63, 0x66, 0x6c, 0x18, 0x30, 0x6e, 0x13, 0x06, 0x0c, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x63, 0x66, 0x6c, 0x18, 0x36, 0x6e, 0x1a, 0x3f, 0x06, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x80, 0x60, 0x80, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0x80, 0x60, 0x80, 0x00, 0x06, 0x49, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x12, 0x0a, 0x0a, 0x6a, 0x86, 0x6c, 0x8a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x61, 0x89, 0x69, 0x85, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x12, 0x12, 0x0a, 0x0a, 0x0c, 0x1a, 0x3e, 0x00, 0x0c, 0x10, 0x0c, 0x10, 0x00, 0x00},
+    {0x00, 0x01, 0x09, 0x09, 0x05, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x06, 0x08, 0x06, 0x08, 0x00, 0x00},
+    {0x00, 0x02, 0x12, 0x12, 0x0a, 0x0a, 0x0c, 0x1a, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x09, 0x09, 0x05, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x40, 0x40, 0x20, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x32, 0x4c, 0x00, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00},
+    {0x00, 0x68, 0x88, 0x68, 0x88, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x18, 0x20, 0x18, 0x20, 0x00, 0x00},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x0c, 0x10, 0x0c, 0x10, 0x00, 0x00},
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x28, 0x00, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x42, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x88, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xfc, 0x23, 0x40, 0x80, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x10, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x42, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x4a, 0x4a, 0x74, 0x40, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x20, 0x40, 0x38, 0x10, 0x20, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x24, 0x66, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x42, 0x3e, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x42, 0x42, 0x24, 0x24, 0x24, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x24, 0x24, 0x24, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x44, 0x44, 0x3c, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x00, 0x00, 0x4e, 0x89, 0x87, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x91, 0x49, 0x76, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x91, 0x49, 0x76, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x91, 0x61, 0x7e, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x30, 0x18, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x32, 0x4c, 0x00, 0x10, 0x18, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x34, 0x46, 0x36, 0x44, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x10, 0x0c, 0x10, 0x06, 0x09, 0x09, 0x07, 0x01, 0x01, 0x22, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x12, 0x0c, 0x13, 0x20, 0x40, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x0c, 0x10, 0x0c, 0x10, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x14, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x28, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x24, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x01, 0x21, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x04, 0x02, 0x01, 0x01, 0x21, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x44, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x44, 0x38, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x49, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x00, 0x28, 0x00, 0x02, 0x21, 0x49, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x51, 0x61, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x0e, 0x51, 0x61, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x31, 0x21, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x24, 0x20, 0x20, 0x2e, 0x31, 0x21, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x08, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x08, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x20, 0x10, 0x3c, 0x40, 0x80, 0x80, 0x80, 0x82, 0x7c, 0x00},
+    {0x00, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x09, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0xf9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x0d, 0x11, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x07, 0x01, 0x01, 0x22, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x00, 0x00, 0x0e, 0x91, 0x61, 0x7e, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x14, 0x08, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1e, 0x21, 0x12, 0x0c, 0x13, 0x20, 0x40, 0x80, 0x80, 0x41, 0x3e, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1c, 0x22, 0x20, 0x10, 0x3c, 0x40, 0x80, 0x80, 0x80, 0x82, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x01, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00},
+    {0x00, 0x22, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x22, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x81, 0x91, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x24, 0x18, 0xff, 0x18, 0x24, 0x14, 0x0c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x49, 0x84, 0x82, 0x82, 0x7c, 0x00, 0x28, 0x00},
+    {0x00, 0x08, 0x00, 0x00, 0x1c, 0x22, 0x14, 0x08, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x49, 0x87, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x65, 0x99, 0x01, 0x09, 0x05, 0x06, 0x0d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x65, 0x99, 0x01, 0x09, 0x05, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x81, 0x81, 0x82, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x0d, 0x11, 0x0d, 0x51, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x4c, 0x82, 0x82, 0x84, 0x78, 0x00, 0x50, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP864[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    5, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 32};
+
+#elif RP6502_CODE_PAGE == 865
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x0c, 0x78},
+    {0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x7c, 0x82, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x18, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7e, 0x0c, 0x38},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x7c, 0x82, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x38, 0x6c, 0x7c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x18, 0x30, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0x12, 0xfe, 0x90, 0xfe, 0x00},
+    {0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00},
+    {0x7c, 0x82, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x78, 0x84, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xfc},
+    {0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00},
+    {0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8, 0x00},
+    {0xf8, 0xcc, 0xcc, 0xfa, 0xc6, 0xcf, 0xc6, 0xc7},
+    {0x0e, 0x1b, 0x18, 0x3c, 0x18, 0xd8, 0x70, 0x00},
+    {0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00},
+    {0x0c, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00},
+    {0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00},
+    {0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00},
+    {0x18, 0x00, 0x18, 0x18, 0x30, 0x63, 0x3e, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x63, 0xe6, 0x6c, 0x7a, 0x36, 0x6a, 0xdf, 0x06},
+    {0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0xc8, 0xdc, 0x76, 0x00},
+    {0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00},
+    {0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x00},
+    {0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x00},
+    {0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0x70, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0xc0},
+    {0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x7e, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x7e},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00},
+    {0x0e, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0x7e, 0x00, 0x00},
+    {0x06, 0x0c, 0x7e, 0xdb, 0xdb, 0x7e, 0x60, 0xc0},
+    {0x1e, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1e, 0x00},
+    {0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00},
+    {0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00},
+    {0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0x70},
+    {0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00},
+    {0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c},
+    {0x6c, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP865[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00},
+    {0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x04, 0x7c, 0xce, 0xce, 0xd6, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0x7c, 0x40, 0x00, 0x00, 0x00},
+    {0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb, 0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP865[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 866
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x3e, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0xfe, 0x66, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0xfe, 0x66, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3},
+    {0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00},
+    {0xd6, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0xd6, 0x00},
+    {0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00},
+    {0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00},
+    {0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00},
+    {0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x00},
+    {0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00},
+    {0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x7c, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00},
+    {0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0xf0, 0xf0, 0xb0, 0x3c, 0x36, 0x36, 0x3c, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00},
+    {0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x00},
+    {0x78, 0x8c, 0x06, 0x3e, 0x06, 0x8c, 0x78, 0x00},
+    {0xdc, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xdc, 0x00},
+    {0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00},
+    {0x06, 0x7c, 0xc0, 0x7c, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6},
+    {0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x00, 0x00, 0xd6, 0x7c, 0x38, 0x7c, 0xd6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1c, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0x00, 0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00},
+    {0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0xe6, 0x00},
+    {0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0xe6, 0x00},
+    {0x00, 0x00, 0xc6, 0xfe, 0xfe, 0xd6, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0xf0},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x00, 0x00, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x38},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00},
+    {0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06},
+    {0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03},
+    {0x00, 0x00, 0xf0, 0xb0, 0x3c, 0x36, 0x3c, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xf6, 0xde, 0xf6, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66, 0xfc, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x1e, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xdc, 0xd6, 0xf6, 0xd6, 0xdc, 0x00},
+    {0x00, 0x00, 0x7e, 0xc6, 0x7e, 0x66, 0xc6, 0x00},
+    {0x6c, 0xfe, 0x62, 0x78, 0x60, 0x62, 0xfe, 0x00},
+    {0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00},
+    {0x3c, 0x66, 0xc0, 0xf8, 0xc0, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x3e, 0x63, 0x78, 0x63, 0x3e, 0x00},
+    {0x48, 0x78, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00},
+    {0x38, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x7c},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00},
+    {0x0e, 0x0c, 0x0c, 0x0c, 0x6c, 0x3c, 0x1c, 0x00},
+    {0x8f, 0xcd, 0xef, 0xfc, 0xdc, 0xcc, 0xcc, 0x00},
+    {0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP866[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x62, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0x81, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xdb, 0xdb, 0x5a, 0x5a, 0x7e, 0x7e, 0x5a, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1f, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xcf, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xdb, 0x99, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0xf8, 0xf0, 0xb0, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xf3, 0xdb, 0xdb, 0xdb, 0xdb, 0xf3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x26, 0x3e, 0x26, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xce, 0xdb, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x3e, 0x3e, 0x66, 0x66, 0x66, 0xe7, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x06, 0x7c, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x62, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3, 0xc3, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x54, 0x7c, 0x54, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+    {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x3c, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x18, 0x3c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xff, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x03, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb0, 0xb0, 0x3e, 0x33, 0x33, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xf6, 0xde, 0xde, 0xf6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x3e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc6, 0xc6, 0x7e, 0x36, 0x66, 0xe7, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc8, 0xf8, 0xc8, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xf8, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0xc6, 0x7c, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xcf, 0xcd, 0xef, 0xec, 0xff, 0xdc, 0xdc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP866[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127};
+
+#elif RP6502_CODE_PAGE == 869
+
+typedef uint8_t font_index_t;
+
+static const __in_flash("font") uint8_t FONT8_GLYPHS[][8] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x5c, 0xb6, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x06, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18},
+    {0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x5f, 0x90, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0xb3, 0xb3, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x00},
+    {0x5e, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00},
+    {0xc3, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00},
+    {0x5c, 0xb6, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00},
+    {0xb3, 0xb3, 0x33, 0x1e, 0x0c, 0x0c, 0x1e, 0x00},
+    {0x66, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x00},
+    {0x7e, 0x81, 0x9d, 0xa1, 0xa1, 0x9d, 0x81, 0x7e},
+    {0x5c, 0xb6, 0x63, 0x63, 0x36, 0x14, 0x77, 0x00},
+    {0x78, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00},
+    {0x78, 0x0c, 0x18, 0x0c, 0x78, 0x00, 0x00, 0x00},
+    {0x08, 0x10, 0x76, 0xcc, 0xcc, 0xcc, 0x76, 0x00},
+    {0x38, 0x6c, 0x64, 0xf0, 0x60, 0xe6, 0xfc, 0x00},
+    {0x08, 0x10, 0x7e, 0xc0, 0x7c, 0xc0, 0x7e, 0x00},
+    {0x08, 0x10, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x06},
+    {0x08, 0x10, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00},
+    {0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00},
+    {0x08, 0xd3, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x00},
+    {0x08, 0x10, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x08, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xfe, 0x00},
+    {0xfe, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xfe, 0x00},
+    {0xfe, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xfe, 0x00},
+    {0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00},
+    {0x63, 0xe6, 0x6c, 0x7e, 0x33, 0x66, 0xcc, 0x0f},
+    {0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00},
+    {0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00},
+    {0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00},
+    {0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18},
+    {0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00},
+    {0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00},
+    {0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00},
+    {0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00},
+    {0xfe, 0xc6, 0x00, 0x38, 0x00, 0xc6, 0xfe, 0x00},
+    {0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18},
+    {0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0xfc, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36},
+    {0xfe, 0xc0, 0x60, 0x30, 0x60, 0xc0, 0xfe, 0x00},
+    {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x00},
+    {0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00},
+    {0x10, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00},
+    {0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00},
+    {0x00, 0x00, 0x7a, 0xcc, 0xcc, 0xcc, 0x7a, 0x00},
+    {0x78, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xfc, 0x80},
+    {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x7c},
+    {0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0x7e, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0x7c, 0xc0, 0x7e, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x7e, 0x06, 0x1c, 0x30, 0x60, 0x3e, 0x02, 0x1c},
+    {0x00, 0x00, 0xbc, 0x66, 0x66, 0x66, 0x66, 0x06},
+    {0x7c, 0xc6, 0xe6, 0x3e, 0x86, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00},
+    {0x00, 0x00, 0xc6, 0xdc, 0xf0, 0xdc, 0xc6, 0x00},
+    {0x7c, 0xc6, 0x06, 0x1e, 0x36, 0x66, 0xc6, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xe6, 0xdd, 0xc0},
+    {0x00, 0x00, 0x82, 0xc6, 0xc6, 0x6c, 0x38, 0x00},
+    {0x7e, 0x18, 0x30, 0x3c, 0x60, 0x3e, 0x02, 0x1c},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0},
+    {0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0x78, 0x00},
+    {0x00, 0x00, 0x7e, 0xc0, 0xc0, 0x7c, 0x06, 0x1c},
+    {0x00, 0x00, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00},
+    {0x0c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00},
+    {0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x00, 0x00, 0x1c, 0x56, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x00, 0x00, 0xc2, 0x6c, 0x38, 0x6c, 0x86, 0x00},
+    {0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c},
+    {0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0x7c, 0x10},
+    {0x08, 0x10, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x44, 0xd6, 0xd6, 0xd6, 0x6c, 0x00},
+    {0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0xcb, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00},
+    {0x08, 0x10, 0x44, 0xd6, 0xd6, 0xd6, 0x6c, 0x00},
+    {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT8_CP869[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 0, 0, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 0};
+
+static const __in_flash("font") uint8_t FONT16_GLYPHS[][16] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x48, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xbf, 0x30, 0x30, 0x30, 0x3e, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb3, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x20, 0x5e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xbe, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb3, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0x42, 0x99, 0xa5, 0xa1, 0xa5, 0x99, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x40, 0xb8, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x0c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0x0c, 0x30, 0x0c, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x08, 0x10, 0x00, 0xcc, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x04, 0x08, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x06, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44},
+    {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa},
+    {0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8, 0xcc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc6, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0xfe, 0xc0, 0x60, 0x30, 0x18, 0x18, 0x30, 0x60, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x28, 0xee, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xfc, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0x80, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0x6c, 0x38, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x7e, 0x60, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0x78, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x60, 0x60, 0x60, 0x3e, 0x06, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x66, 0x36, 0x3e, 0x86, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3e, 0x66, 0x66, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xdd, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7e, 0x18, 0x30, 0x30, 0x1c, 0x30, 0x60, 0x60, 0x60, 0x3e, 0x06, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xdc, 0xc0, 0xc0, 0xc0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0x7c, 0x06, 0x06, 0x3c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x56, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x10, 0x00},
+    {0x04, 0x08, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x04, 0x08, 0x00, 0x66, 0x00, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+static const __in_flash("font") font_index_t FONT16_CP869[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 0, 0, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 8, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+    103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 0};
+
+#else
+
+typedef uint8_t font_index_t;
+static const __in_flash("font") uint8_t FONT8_GLYPHS[1][8];
+static const __in_flash("font") uint8_t FONT16_GLYPHS[1][16];
+
+#endif
+
+static uint16_t font_code_page;
+static bool font8_user;
+static bool font16_user;
+
+// Returns cp, or 0 if the code page isn't available.
+static uint16_t font_code_page_tables(uint16_t cp, const font_index_t **font8hi, const font_index_t **font16hi)
+{
+    (void)font8hi;
+    (void)font16hi;
     switch (cp)
     {
-        (void)FONT8_CP437;
-        (void)FONT16_CP437;
 #if RP6502_CODE_PAGE == 437 || RP6502_CODE_PAGE == 0
     case 437:
-        font8hi = FONT8_CP437;
-        font16hi = FONT16_CP437;
+        *font8hi = FONT8_CP437;
+        *font16hi = FONT16_CP437;
         break;
 #endif
-        (void)FONT8_CP737;
-        (void)FONT16_CP737;
 #if RP6502_CODE_PAGE == 737 || RP6502_CODE_PAGE == 0
     case 737:
-        font8hi = FONT8_CP737;
-        font16hi = FONT16_CP737;
+        *font8hi = FONT8_CP737;
+        *font16hi = FONT16_CP737;
         break;
 #endif
-        (void)FONT8_CP771;
-        (void)FONT16_CP771;
 #if RP6502_CODE_PAGE == 771 || RP6502_CODE_PAGE == 0
     case 771:
-        font8hi = FONT8_CP771;
-        font16hi = FONT16_CP771;
+        *font8hi = FONT8_CP771;
+        *font16hi = FONT16_CP771;
         break;
 #endif
-        (void)FONT8_CP775;
-        (void)FONT16_CP775;
 #if RP6502_CODE_PAGE == 775 || RP6502_CODE_PAGE == 0
     case 775:
-        font8hi = FONT8_CP775;
-        font16hi = FONT16_CP775;
+        *font8hi = FONT8_CP775;
+        *font16hi = FONT16_CP775;
         break;
 #endif
-        (void)FONT8_CP850;
-        (void)FONT16_CP850;
 #if RP6502_CODE_PAGE == 850 || RP6502_CODE_PAGE == 0
     case 850:
-        font8hi = FONT8_CP850;
-        font16hi = FONT16_CP850;
+        *font8hi = FONT8_CP850;
+        *font16hi = FONT16_CP850;
         break;
 #endif
-        (void)FONT8_CP852;
-        (void)FONT16_CP852;
 #if RP6502_CODE_PAGE == 852 || RP6502_CODE_PAGE == 0
     case 852:
-        font8hi = FONT8_CP852;
-        font16hi = FONT16_CP852;
+        *font8hi = FONT8_CP852;
+        *font16hi = FONT16_CP852;
         break;
 #endif
-        (void)FONT8_CP855;
-        (void)FONT16_CP855;
 #if RP6502_CODE_PAGE == 855 || RP6502_CODE_PAGE == 0
     case 855:
-        font8hi = FONT8_CP855;
-        font16hi = FONT16_CP855;
+        *font8hi = FONT8_CP855;
+        *font16hi = FONT16_CP855;
         break;
 #endif
-        (void)FONT8_CP857;
-        (void)FONT16_CP857;
 #if RP6502_CODE_PAGE == 857 || RP6502_CODE_PAGE == 0
     case 857:
-        font8hi = FONT8_CP857;
-        font16hi = FONT16_CP857;
+        *font8hi = FONT8_CP857;
+        *font16hi = FONT16_CP857;
         break;
 #endif
-        (void)FONT8_CP860;
-        (void)FONT16_CP860;
 #if RP6502_CODE_PAGE == 860 || RP6502_CODE_PAGE == 0
     case 860:
-        font8hi = FONT8_CP860;
-        font16hi = FONT16_CP860;
+        *font8hi = FONT8_CP860;
+        *font16hi = FONT16_CP860;
         break;
 #endif
-        (void)FONT8_CP861;
-        (void)FONT16_CP861;
 #if RP6502_CODE_PAGE == 861 || RP6502_CODE_PAGE == 0
     case 861:
-        font8hi = FONT8_CP861;
-        font16hi = FONT16_CP861;
+        *font8hi = FONT8_CP861;
+        *font16hi = FONT16_CP861;
         break;
 #endif
-        (void)FONT8_CP862;
-        (void)FONT16_CP862;
 #if RP6502_CODE_PAGE == 862 || RP6502_CODE_PAGE == 0
     case 862:
-        font8hi = FONT8_CP862;
-        font16hi = FONT16_CP862;
+        *font8hi = FONT8_CP862;
+        *font16hi = FONT16_CP862;
         break;
 #endif
-        (void)FONT8_CP863;
-        (void)FONT16_CP863;
 #if RP6502_CODE_PAGE == 863 || RP6502_CODE_PAGE == 0
     case 863:
-        font8hi = FONT8_CP863;
-        font16hi = FONT16_CP863;
+        *font8hi = FONT8_CP863;
+        *font16hi = FONT16_CP863;
         break;
 #endif
-        (void)FONT8_CP864;
-        (void)FONT16_CP864;
 #if RP6502_CODE_PAGE == 864 || RP6502_CODE_PAGE == 0
     case 864:
-        font8hi = FONT8_CP864;
-        font16hi = FONT16_CP864;
+        *font8hi = FONT8_CP864;
+        *font16hi = FONT16_CP864;
         break;
 #endif
-        (void)FONT8_CP865;
-        (void)FONT16_CP865;
 #if RP6502_CODE_PAGE == 865 || RP6502_CODE_PAGE == 0
     case 865:
-        font8hi = FONT8_CP865;
-        font16hi = FONT16_CP865;
+        *font8hi = FONT8_CP865;
+        *font16hi = FONT16_CP865;
         break;
 #endif
-        (void)FONT8_CP866;
-        (void)FONT16_CP866;
 #if RP6502_CODE_PAGE == 866 || RP6502_CODE_PAGE == 0
     case 866:
-        font8hi = FONT8_CP866;
-        font16hi = FONT16_CP866;
+        *font8hi = FONT8_CP866;
+        *font16hi = FONT16_CP866;
         break;
 #endif
-        (void)FONT8_CP869;
-        (void)FONT16_CP869;
 #if RP6502_CODE_PAGE == 869 || RP6502_CODE_PAGE == 0
     case 869:
-        font8hi = FONT8_CP869;
-        font16hi = FONT16_CP869;
+        *font8hi = FONT8_CP869;
+        *font16hi = FONT16_CP869;
         break;
 #endif
     default:
         cp = 0;
         break;
     }
+    return cp;
+}
+
+// Expand ASCII and the code page into the row-major RAM font
+// that the 1bpp renderers index directly.
+static void font_build(uint8_t *font, int height, const uint8_t *ascii,
+                       const uint8_t *glyphs, const font_index_t *hi)
+{
+    for (int row = 0; row < height; row++)
+    {
+        memcpy(&font[row * 256], &ascii[row * 128], 128);
+        if (!hi)
+            memset(&font[row * 256 + 128], 0, 128);
+        else
+            for (int glyph = 0; glyph < 128; glyph++)
+                font[row * 256 + 128 + glyph] = glyphs[hi[glyph] * height + row];
+    }
+}
+
+static void font_rebuild(void)
+{
+    const font_index_t *font8hi = NULL;
+    const font_index_t *font16hi = NULL;
+    font_code_page_tables(font_code_page, &font8hi, &font16hi);
+    if (!font8_user)
+        font_build(font8, 8, FONT8_ASCII, FONT8_GLYPHS[0], font8hi);
+    if (!font16_user)
+        font_build(font16, 16, FONT16_ASCII, FONT16_GLYPHS[0], font16hi);
+}
+
+// User fonts are 256 glyphs, glyph-major like a .fnt file.
+static bool font_load_xram(uint8_t *font, int height, bool *user, uint16_t xram_ptr)
+{
+    if (xram_ptr == 0xFFFF)
+    {
+        *user = false;
+        font_rebuild();
+        return true;
+    }
+    if (xram_ptr > 0x10000 - 256 * height)
+        return false;
+    for (int glyph = 0; glyph < 256; glyph++)
+        for (int row = 0; row < height; row++)
+            font[row * 256 + glyph] = xram[xram_ptr + glyph * height + row];
+    *user = true;
+    return true;
+}
+
+void font_init(void)
+{
+    font_rebuild();
+    if (RP6502_CODE_PAGE)
+        font_set_code_page(RP6502_CODE_PAGE);
+}
+
+void font_reset(void)
+{
+    if (font8_user || font16_user)
+    {
+        font8_user = font16_user = false;
+        font_rebuild();
+    }
+}
 
-    if (current_cp == cp)
+void font_set_code_page(uint16_t cp)
+{
+    const font_index_t *font8hi = NULL;
+    const font_index_t *font16hi = NULL;
+    cp = font_code_page_tables(cp, &font8hi, &font16hi);
+    if (font_code_page == cp)
         return;
-    current_cp = cp;
+    font_code_page = cp;
     printf("\30\33c");
+    font_rebuild();
+}
 
-    if (!cp)
-        for (int row = 0; row < 16; row++)
-        {
-            memset(&font16[row * 256 + 128], 0, 128);
-            if (row < 8)
-                memset(&font8[row * 256 + 128], 0, 128);
-        }
-    else
-        for (int row = 0; row < 16; row++)
-        {
-            memcpy(&font16[row * 256 + 128], &font16hi[row * 128], 128);
-            if (row < 8)
-                memcpy(&font8[row * 256 + 128], &font8hi[row * 128], 128);
-        }
+bool font_xreg(uint8_t addr, uint16_t word)
+{
+    switch (addr)
+    {
+    case 0x00: // FONT8
+        font_load_xram(font8, 8, &font8_user, word);
+        return true;
+    case 0x01: // FONT16
+        font_load_xram(font16, 16, &font16_user, word);
+        return true;
+    }
+    return false;
 }
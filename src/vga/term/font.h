@@ -18,7 +18,14 @@ extern uint8_t font16[4096];
  */
 
 void font_init(void);
+void font_reset(void);
 
 void font_set_code_page(uint16_t cp);
 
+/* Utility
+ */
+
+// PIX channel 2 registers, user fonts from XRAM.
+bool font_xreg(uint8_t addr, uint16_t word);
+
 #endif /* _VGA_TERM_FONT_H_ */
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+Test the modem telnet server on RP6502 RIA with local TCP clients.
+Demonstrates CIPSERVER, RING, ATA, S0 auto-answer and BUSY.
+
+The RIA queues up to 4 callers. Each rings in turn, oldest first,
+until answered. A 5th caller gets BUSY and is disconnected.
+
+Usage:
+    python3 test_at_server.py /dev/ttyACM0 192.168.1.50 [port]
+
+Requirements:
+    pip install pyserial
+"""
+
+import serial
+import socket
+import sys
+import time
+
+CALLERS_MAX = 4
+
+
+def send_at(ser, cmd, wait=0.5):
+    """Send AT command and read response."""
+    print(f">>> {cmd}")
+    ser.write(f"{cmd}\r".encode('ascii'))
+    return read_for(ser, wait)
+
+
+def read_for(ser, wait):
+    time.sleep(wait)
+    response = b""
+    while ser.in_waiting:
+        response += ser.read(ser.in_waiting)
+        time.sleep(0.05)
+    decoded = response.decode('ascii', errors='replace')
+    if decoded:
+        print(f"<<< {decoded}")
+    return decoded
+
+
+def call(host, port):
+    start = time.monotonic()
+    sock = socket.create_connection((host, port), timeout=5)
+    print(f"caller connected in {(time.monotonic() - start) * 1000:.1f} ms")
+    return sock
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+    host = sys.argv[2]
+    port = int(sys.argv[3]) if len(sys.argv) > 3 else 2323
+
+    ser = serial.Serial(sys.argv[1], 115200, timeout=1)
+    time.sleep(0.5)
+    ser.reset_input_buffer()
+    send_at(ser, "ATE0")
+    send_at(ser, "ATS0=0")
+    assert "OK" in send_at(ser, f"AT+CIPSERVER=1,{port}")
+    assert f"+CIPSERVER:1,{port}" in send_at(ser, "AT+CIPSERVER?")
+
+    # Fill the queue, the first caller talks before it is answered.
+    callers = [call(host, port) for _ in range(CALLERS_MAX)]
+    callers[0].sendall(b"hello from caller 0\r\n")
+    busy = call(host, port)
+    assert busy.recv(64).startswith(b"BUSY"), "5th caller not busy"
+    busy.close()
+
+    # Rings repeat every 2 seconds.
+    assert read_for(ser, 4.5).count("RING") >= 2, "no RING"
+    assert "1" in send_at(ser, "ATS1?")
+
+    # Answer the oldest, early data was kept.
+    reply = send_at(ser, "ATA", wait=1.0)
+    assert "CONNECT" in reply and "+RECV:" in reply
+    assert "hello from caller 0" in send_at(ser, "AT+CIPRECVDATA=64")
+    send_at(ser, 'AT+CIPSEND="hello from RP6502\\r\\n"')
+    assert b"hello from RP6502" in callers[0].recv(64)
+    send_at(ser, "AT+CIPCLOSE", wait=1.0)
+    assert callers[0].recv(64) == b"", "caller 0 not hung up"
+
+    # A caller that gives up leaves the queue.
+    callers[1].close()
+    time.sleep(0.5)
+
+    # Auto-answer on the second ring.
+    send_at(ser, "ATS0=2")
+    assert "CONNECT" in read_for(ser, 5.0), "no auto-answer"
+    callers[2].sendall(b"auto answered\r\n")
+    time.sleep(0.5)
+    assert "auto answered" in send_at(ser, "AT+CIPRECVDATA=64")
+    send_at(ser, "AT+CIPCLOSE", wait=1.0)
+
+    # Stopping the server drops whoever is still waiting.
+    send_at(ser, "ATS0=0")
+    assert "OK" in send_at(ser, "AT+CIPSERVER=0")
+    assert callers[3].recv(64) == b"", "waiting caller not dropped"
+    assert "+CIPSERVER:0,0" in send_at(ser, "AT+CIPSERVER?")
+
+    for sock in callers:
+        sock.close()
+    ser.close()
+    print("Test complete!")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Local HTTP/1.1 server stand-in for testing the RIA HTTP client.
+Serves predictable payloads so a 6502 test program can verify what
+arrived in its XRAM ring or file.
+
+Endpoints:
+    GET  /bytes/N     N bytes with Content-Length
+    GET  /chunked/N   N bytes with Transfer-Encoding: chunked
+    GET  /close/N     N bytes, no length, ends with Connection: close
+    GET  /status/N    empty response with status code N
+    POST /echo        echoes the request body
+
+Payload byte i is (i & 0xFF). Each request is logged with the
+connection number so keep-alive reuse is visible.
+
+Usage:
+    python3 test_http_server.py [port]
+    python3 test_http_server.py --self-test
+"""
+
+import http.client
+import http.server
+import itertools
+import random
+import sys
+import threading
+
+_conn_ids = itertools.count(1)
+
+
+def payload(n):
+    return bytes(i & 0xFF for i in range(n))
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def setup(self):
+        super().setup()
+        self.conn_id = next(_conn_ids)
+
+    def log_message(self, fmt, *args):
+        sys.stderr.write(f"[conn {self.conn_id}] {fmt % args}\n")
+
+    def _arg(self):
+        try:
+            return int(self.path.rsplit("/", 1)[1])
+        except (IndexError, ValueError):
+            return -1
+
+    def do_GET(self):
+        n = self._arg()
+        if n < 0:
+            self.send_error(404)
+        elif self.path.startswith("/bytes/"):
+            body = payload(n)
+            self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+        elif self.path.startswith("/chunked/"):
+            body = payload(n)
+            self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Transfer-Encoding", "chunked")
+            self.end_headers()
+            pos = 0
+            while pos < len(body):
+                size = random.randint(1, 700)
+                chunk = body[pos:pos + size]
+                self.wfile.write(b"%x;ext=1\r\n%s\r\n" % (len(chunk), chunk))
+                pos += size
+            self.wfile.write(b"0\r\nX-Trailer: done\r\n\r\n")
+        elif self.path.startswith("/close/"):
+            self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.wfile.write(payload(n))
+            self.close_connection = True
+        elif self.path.startswith("/status/"):
+            self.send_response(n)
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+        else:
+            self.send_error(404)
+
+    def do_POST(self):
+        if self.path != "/echo":
+            self.send_error(404)
+            return
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def self_test(port):
+    """Check the stand-in itself with a keep-alive client."""
+    conn = http.client.HTTPConnection("127.0.0.1", port)
+    for n in (0, 1, 1460, 5000):
+        conn.request("GET", f"/bytes/{n}")
+        assert conn.getresponse().read() == payload(n)
+        conn.request("GET", f"/chunked/{n}")
+        assert conn.getresponse().read() == payload(n)
+    sock = conn.sock
+    conn.request("POST", "/echo", body=payload(3000))
+    assert conn.getresponse().read() == payload(3000)
+    assert conn.sock is sock, "keep-alive connection was not reused"
+    conn.request("GET", "/status/204")
+    resp = conn.getresponse()
+    assert resp.status == 204 and resp.read() == b""
+    conn.request("GET", "/close/2000")
+    assert conn.getresponse().read() == payload(2000)
+    conn.close()
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    test = "--self-test" in args
+    args = [a for a in args if a != "--self-test"]
+    port = int(args[0]) if args else (0 if test else 8080)
+    server = http.server.ThreadingHTTPServer(("", port), Handler)
+    port = server.server_address[1]
+    if test:
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        self_test(port)
+        server.shutdown()
+        return
+    print(f"Serving on port {port}")
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""
+Report on a RIA bus trace saved with TRACE SAVE.
+
+The file is a 16 byte header, "RP6502T1", the record count and the
+number of older records overwritten, all little endian. Each 8 byte
+record follows, oldest first:
+
+    uint32  time in microseconds
+    uint8   bits 0-4 address - $FFE0, bit 5 set for writes
+    uint8   data
+    uint16  reads of $FFF0 only: us since the RIA raised IRQ, else $FFFF
+
+The report covers register use, OS calls, XRAM port traffic and IRQ
+latency. An OS call starts with a write to $FFEF and ends when the
+6502 reads $FFF4 on the way out of the $FFF1 spin.
+
+Usage:
+    python3 trace_report.py trace.bin
+    python3 trace_report.py --timeline trace.bin
+    python3 trace_report.py --self-test
+"""
+
+import struct
+import sys
+
+MAGIC = b"RP6502T1"
+HEADER = struct.Struct("<8sII")
+RECORD = struct.Struct("<IBBH")
+WRITE = 0x20
+
+REG_NAMES = {
+    0x00: "UART_STATUS", 0x01: "UART_TX", 0x02: "UART_RX", 0x03: "VSYNC",
+    0x04: "RW0", 0x05: "STEP0", 0x06: "ADDR0_L", 0x07: "ADDR0_H",
+    0x08: "RW1", 0x09: "STEP1", 0x0A: "ADDR1_L", 0x0B: "ADDR1_H",
+    0x0C: "XSTACK", 0x0D: "ERRNO_L", 0x0E: "ERRNO_H", 0x0F: "OP",
+    0x10: "IRQ", 0x14: "RETURN_A",
+}
+
+OP_NAMES = {
+    0x00: "zxstack", 0x01: "xreg", 0x02: "phi2", 0x03: "code_page",
+    0x04: "lrand", 0x05: "stdin_opt", 0x06: "errno_opt", 0x07: "profile",
+    0x0E: "get_time_us", 0x0F: "clock", 0x10: "clock_getres",
+    0x11: "clock_gettime", 0x12: "clock_settime", 0x13: "get_time_zone",
+    0x14: "open", 0x15: "close", 0x16: "read_xstack", 0x17: "read_xram",
+    0x18: "write_xstack", 0x19: "write_xram", 0x1A: "lseek", 0x1B: "unlink",
+    0x1C: "rename", 0x1D: "lseek", 0x1E: "syncfs", 0x1F: "stat",
+    0x20: "opendir", 0x21: "readdir", 0x22: "closedir", 0x23: "telldir",
+    0x24: "seekdir", 0x25: "rewinddir", 0x26: "chmod", 0x27: "utime",
+    0x28: "mkdir", 0x29: "chdir", 0x2A: "chdrive", 0x2B: "getcwd",
+    0x2C: "setlabel", 0x2D: "getlabel", 0x2E: "getfree",
+    0xFF: "exit",
+}
+
+
+def reg_name(reg):
+    addr = 0xFFE0 | (reg & 0x1F)
+    name = REG_NAMES.get(reg & 0x1F, "")
+    return f"${addr:04X} {name}".rstrip()
+
+
+def op_name(op):
+    return OP_NAMES.get(op, f"op ${op:02X}")
+
+
+def parse(data):
+    magic, count, overwritten = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("not a RIA trace")
+    records = [RECORD.unpack_from(data, HEADER.size + i * RECORD.size)
+               for i in range(count)]
+    return records, overwritten
+
+
+def os_calls(records):
+    """Return [(start_us, op, duration_us, xstack_bytes)]."""
+    calls, pending, pushed = [], None, 0
+    for time, reg, data, _ in records:
+        if reg == WRITE | 0x0C:
+            pushed += 1
+        elif reg == WRITE | 0x0F:
+            pending = (time, data, pushed)
+            pushed = 0
+        elif reg == 0x14 and pending:
+            start, op, nbytes = pending
+            calls.append((start, op, (time - start) & 0xFFFFFFFF, nbytes))
+            pending = None
+    return calls
+
+
+def xram_ports(records):
+    """Return {port: [reads, writes, address sets]}."""
+    ports = {0: [0, 0, 0], 1: [0, 0, 0]}
+    for _, reg, _, _ in records:
+        addr, write = reg & 0x1F, bool(reg & WRITE)
+        port = 0 if addr < 0x08 else 1
+        if addr in (0x04, 0x08):
+            ports[port][1 if write else 0] += 1
+        elif write and addr in (0x06, 0x07, 0x0A, 0x0B):
+            ports[port][2] += 1
+    return ports
+
+
+def irq_latency(records):
+    return [aux for _, reg, _, aux in records if reg & 0x1F == 0x10 and aux != 0xFFFF]
+
+
+def report(records, overwritten, timeline=False):
+    out = []
+    if not records:
+        return "empty trace"
+    span = (records[-1][0] - records[0][0]) & 0xFFFFFFFF
+    out.append(f"{len(records)} records over {span} us, {overwritten} overwritten")
+    counts = {}
+    for _, reg, _, _ in records:
+        counts[reg] = counts.get(reg, 0) + 1
+    out.append("\nRegisters:")
+    for reg, n in sorted(counts.items(), key=lambda t: -t[1]):
+        rw = "W" if reg & WRITE else "R"
+        out.append(f"  {rw} {reg_name(reg):20} {n:8}")
+    calls = os_calls(records)
+    if calls:
+        out.append("\nOS calls:")
+        by_op = {}
+        for _, op, dur, _ in calls:
+            by_op.setdefault(op, []).append(dur)
+        for op, durs in sorted(by_op.items(), key=lambda t: -sum(t[1])):
+            out.append(f"  {op_name(op):14} {len(durs):6} calls {sum(durs):9} us"
+                       f"  avg {sum(durs) // len(durs):6}  max {max(durs):6}")
+        if timeline:
+            out.append("\nTimeline:")
+            base = records[0][0]
+            for start, op, dur, nbytes in calls:
+                out.append(f"  {(start - base) & 0xFFFFFFFF:10} us  {op_name(op):14}"
+                           f" {dur:6} us  {nbytes} xstack bytes")
+    out.append("\nXRAM ports:")
+    for port, (reads, writes, sets) in xram_ports(records).items():
+        rate = (reads + writes) * 1000000 // span if span else 0
+        out.append(f"  RW{port} {reads:8} reads {writes:8} writes {sets:6} address sets"
+                   f"  {rate} bytes/s")
+    lat = irq_latency(records)
+    if lat:
+        out.append(f"\nIRQ latency: {len(lat)} acks, min {min(lat)} us,"
+                   f" avg {sum(lat) // len(lat)} us, max {max(lat)} us")
+    return "\n".join(out)
+
+
+def build(records, overwritten=0):
+    data = HEADER.pack(MAGIC, len(records), overwritten)
+    return data + b"".join(RECORD.pack(*r) for r in records)
+
+
+def self_test():
+    none = 0xFFFF
+    records = [
+        (100, WRITE | 0x06, 0x00, none),  # ADDR0 = $1000
+        (101, WRITE | 0x07, 0x10, none),
+        (102, WRITE | 0x04, 0xAA, none),  # XRAM writes
+        (103, WRITE | 0x04, 0xBB, none),
+        (104, 0x08, 0x00, none),          # XRAM read on port 1
+        (110, WRITE | 0x0C, 0x41, none),  # push 2 bytes, open()
+        (111, WRITE | 0x0C, 0x00, none),
+        (112, WRITE | 0x0F, 0x14, none),
+        (150, 0x14, 0x03, none),          # return
+        (200, 0x10, 0x00, 12),            # IRQ ack after 12 us
+        (300, 0x10, 0x00, 4),
+        (310, WRITE | 0x0F, 0x04, none),  # lrand()
+        (315, 0x14, 0x99, none),
+    ]
+    parsed, overwritten = parse(build(records, 7))
+    assert parsed == records and overwritten == 7
+    assert os_calls(records) == [(112, 0x14, 38, 2), (310, 0x04, 5, 0)]
+    assert xram_ports(records) == {0: [0, 2, 2], 1: [1, 0, 0]}
+    assert irq_latency(records) == [12, 4]
+    text = report(records, 7, timeline=True)
+    assert "open" in text and "IRQ latency: 2 acks, min 4 us, avg 8 us, max 12 us" in text
+    assert "13 records over 215 us, 7 overwritten" in text
+    try:
+        parse(b"NOTATRACE" + bytes(16))
+        assert False, "bad magic accepted"
+    except ValueError:
+        pass
+    print("self-test passed")
+
+
+def main():
+    args = sys.argv[1:]
+    if args == ["--self-test"]:
+        return self_test()
+    timeline = "--timeline" in args
+    args = [a for a in args if a != "--timeline"]
+    if len(args) != 1:
+        sys.exit(__doc__)
+    with open(args[0], "rb") as f:
+        records, overwritten = parse(f.read())
+    print(report(records, overwritten, timeline))
+
+
+if __name__ == "__main__":
+    main()